@@ -25,6 +25,7 @@
  * We use IR timer (timer 2 for AVR) for receive and send. Both functions can be used alternating but not at the same time.
  * For receive we initialize IR timer to generate interrupts at 10 to 20 kHz for calling irmp_ISR().
  * For send we have 76 kHz to toggle output pin. The irsnd_ISR() call rate is 1/4 of IR signal toggle rate.
+ * With IRSND_USE_HARDWARE_PWM timer 1 generates the carrier and we have only 19 kHz to call irsnd_ISR() at each interrupt.
  * For send, initIRTimer() is called at each irsnd_send_data().
  * The current state of IR timer is stored by initIRTimer() and restored after sending.
  * This enables us to set up IR timer for receiving and on calling irsnd_send_data() the IR timer is reconfigured for the duration of sending.
@@ -364,6 +365,12 @@ uint8_t sTimerOCR;
 #  endif
 uint8_t sTimerOCRB;
 uint8_t sTimerTIMSK;
+#  if defined(IRSND_USE_HARDWARE_PWM)
+uint8_t sPWMTimerTCCRA; // timer 1 generates the carrier while sending
+uint8_t sPWMTimerTCCRB;
+uint16_t sPWMTimerICR;
+uint16_t sPWMTimerOCR;
+#  endif
 
 #elif defined(ESP8266)
 uint32_t sTimerLoadValue;
@@ -473,6 +480,14 @@ void storeIRTimer(void) {
     sTimerLoadValue= T1L;
 #endif // defined(__AVR_ATmega16__)
 
+#if defined(IRSND_USE_HARDWARE_PWM)
+    // store timer 1, it is reprogrammed by irsnd_set_freq() at each frame
+    sPWMTimerTCCRA = TCCR1A;
+    sPWMTimerTCCRB = TCCR1B;
+    sPWMTimerICR = ICR1;
+    sPWMTimerOCR = OCR1A;
+#endif
+
 #if defined(USE_ONE_TIMER_FOR_IRMP_AND_IRSND)
     // If we do not use receive, we have no timer defined at the first call of this function
 #  if defined(ESP32)
@@ -589,6 +604,15 @@ void restoreIRTimer(void) {
     timer1_write(sTimerLoadValue);
 #endif // defined(__AVR_ATmega16__)
 
+#if defined(IRSND_USE_HARDWARE_PWM)
+    // give timer 1 back to other libraries like Servo, OC1A is already disconnected by irsnd_off()
+    TCCR1B = 0; // stop timer while changing TOP and compare value
+    ICR1 = sPWMTimerICR;
+    OCR1A = sPWMTimerOCR;
+    TCCR1A = sPWMTimerTCCRA;
+    TCCR1B = sPWMTimerTCCRB;
+#endif
+
 #if defined(USE_ONE_TIMER_FOR_IRMP_AND_IRSND)
 #  if defined(ESP32)
 #    if ESP_ARDUINO_VERSION >= ESP_ARDUINO_VERSION_VAL(3, 0, 0)
@@ -906,7 +930,7 @@ void irmp_timer_ISR(void)
 #  endif
 #endif
 
-#if (defined(_IRSND_H_) || defined(USE_ONE_TIMER_FOR_IRMP_AND_IRSND))
+#if (defined(_IRSND_H_) || defined(USE_ONE_TIMER_FOR_IRMP_AND_IRSND)) && !defined(IRSND_USE_HARDWARE_PWM)
     static uint8_t sDivider;        // IR signal toggle rate is 2 (4) times IRSND call rate
 #endif
 
@@ -919,6 +943,18 @@ void irmp_timer_ISR(void)
      * Send part of ISR
      */
     if(irsnd_busy) {
+#  if defined(IRSND_USE_HARDWARE_PWM)
+        // The carrier is switched by irsnd_on() and irsnd_off(), so just call irsnd_ISR() at each interrupt
+        if (!irsnd_ISR())
+        {
+            // End of frame
+            restoreIRTimer();
+#    if ! defined(USE_ONE_TIMER_FOR_IRMP_AND_IRSND)
+// only send mode required -> disable interrupt
+            disableIRTimerInterrupt();
+#    endif
+        }
+#  else
         if (irsnd_is_on)
         {
 #  if defined(IRSND_GENERATE_NO_SEND_RF)
@@ -958,6 +994,7 @@ void irmp_timer_ISR(void)
                 sDivider = 4;
             }
         }
+#  endif // defined(IRSND_USE_HARDWARE_PWM)
     } // if(irsnd_busy)
 #endif // defined(_IRSND_H_) || defined(USE_ONE_TIMER_FOR_IRMP_AND_IRSND)
 #if defined(USE_ONE_TIMER_FOR_IRMP_AND_IRSND)
@@ -970,6 +1007,9 @@ void irmp_timer_ISR(void)
      * Receive part of ISR
      */
     irmp_ISR();
+#  if defined(IRMP_ENABLE_HYBRID_TIMER_MODE)
+    irmp_stop_timer_if_idle();
+#  endif
 #endif
 
 #if defined(USE_ONE_TIMER_FOR_IRMP_AND_IRSND)
@@ -142,9 +142,46 @@ void irmp_register_complete_callback_function(void (*aCompleteCallbackFunction)(
 
 #if IRMP_32_BIT == 0 && IRMP_SUPPORT_MERLIN_PROTOCOL == 1
 #  undef IRMP_SUPPORT_MERLIN_PROTOCOL
+#  define IRMP_SUPPORT_MERLIN_PROTOCOL          0
 #  warning MERLIN protocol disabled, IRMP_32_BIT=1 needed
 #endif
 
+#if IRMP_ENABLE_CANDIDATES == 1 && IRMP_ENABLE_FEED_DURATION == 0
+#  warning IRMP_ENABLE_CANDIDATES needs IRMP_ENABLE_FEED_DURATION, IRMP_ENABLE_FEED_DURATION enabled
+#  undef IRMP_ENABLE_FEED_DURATION
+#  define IRMP_ENABLE_FEED_DURATION             1
+#endif
+
+#if IRMP_MULTI_RECEIVER_CHANNELS > 0 && IRMP_ENABLE_CONTEXT == 0
+#  warning IRMP_MULTI_RECEIVER_CHANNELS needs IRMP_ENABLE_CONTEXT, IRMP_ENABLE_CONTEXT enabled
+#  undef IRMP_ENABLE_CONTEXT
+#  define IRMP_ENABLE_CONTEXT                   1
+#endif
+
+#if IRMP_MULTI_RECEIVER_CHANNELS > 0 && IRMP_ENABLE_FEED_DURATION == 0
+#  warning IRMP_MULTI_RECEIVER_CHANNELS needs IRMP_ENABLE_FEED_DURATION, IRMP_ENABLE_FEED_DURATION enabled
+#  undef IRMP_ENABLE_FEED_DURATION
+#  define IRMP_ENABLE_FEED_DURATION             1
+#endif
+
+#if IRMP_MULTI_RECEIVER_CHANNELS > 8
+#  error IRMP_MULTI_RECEIVER_CHANNELS must be between 0 and 8
+#endif
+
+#if IRMP_ENABLE_CANDIDATES == 1 && (IRMP_CANDIDATE_BUFFER_LEN < 8 || IRMP_CANDIDATE_BUFFER_LEN > 255)
+#  error IRMP_CANDIDATE_BUFFER_LEN must be between 8 and 255
+#endif
+
+#if IRMP_ENABLE_CANDIDATES == 1 && IRMP_CANDIDATE_MAX_REPLAYS < 1
+#  error IRMP_CANDIDATE_MAX_REPLAYS must be at least 1
+#endif
+
+#if IRMP_ENABLE_CONSTEXPR_TABLES == 1 && (!defined(__cplusplus) || __cplusplus < 201103L)
+#  warning IRMP_ENABLE_CONSTEXPR_TABLES needs C++11, IRMP_ENABLE_CONSTEXPR_TABLES disabled
+#  undef IRMP_ENABLE_CONSTEXPR_TABLES
+#  define IRMP_ENABLE_CONSTEXPR_TABLES          0
+#endif
+
 #if IRMP_SUPPORT_DENON_PROTOCOL == 1 && IRMP_SUPPORT_RUWIDO_PROTOCOL == 1
 #  warning DENON protocol conflicts wih RUWIDO, please enable only one of both protocols
 #  warning RUWIDO protocol disabled
@@ -152,35 +189,36 @@ void irmp_register_complete_callback_function(void (*aCompleteCallbackFunction)(
 #  define IRMP_SUPPORT_RUWIDO_PROTOCOL          0
 #endif
 
-#if IRMP_SUPPORT_KASEIKYO_PROTOCOL == 1 && IRMP_SUPPORT_PANASONIC_PROTOCOL == 1
+// IRMP_ENABLE_CANDIDATES: protocols with the same start bit are tried one after another, so the following ones need not be disabled
+#if IRMP_SUPPORT_KASEIKYO_PROTOCOL == 1 && IRMP_SUPPORT_PANASONIC_PROTOCOL == 1 && IRMP_ENABLE_CANDIDATES == 0
 #  warning KASEIKYO protocol conflicts wih PANASONIC, please enable only one of both protocols
 #  warning PANASONIC protocol disabled
 #  undef IRMP_SUPPORT_PANASONIC_PROTOCOL
 #  define IRMP_SUPPORT_PANASONIC_PROTOCOL       0
 #endif
 
-#if IRMP_SUPPORT_DENON_PROTOCOL == 1 && IRMP_SUPPORT_ACP24_PROTOCOL == 1
+#if IRMP_SUPPORT_DENON_PROTOCOL == 1 && IRMP_SUPPORT_ACP24_PROTOCOL == 1 && IRMP_ENABLE_CANDIDATES == 0
 #  warning DENON protocol conflicts wih ACP24, please enable only one of both protocols
 #  warning ACP24 protocol disabled
 #  undef IRMP_SUPPORT_ACP24_PROTOCOL
 #  define IRMP_SUPPORT_ACP24_PROTOCOL           0
 #endif
 
-#if IRMP_SUPPORT_RC6_PROTOCOL == 1 && IRMP_SUPPORT_ROOMBA_PROTOCOL == 1
+#if IRMP_SUPPORT_RC6_PROTOCOL == 1 && IRMP_SUPPORT_ROOMBA_PROTOCOL == 1 && IRMP_ENABLE_CANDIDATES == 0
 #  warning RC6 protocol conflicts wih ROOMBA, please enable only one of both protocols
 #  warning ROOMBA protocol disabled
 #  undef IRMP_SUPPORT_ROOMBA_PROTOCOL
 #  define IRMP_SUPPORT_ROOMBA_PROTOCOL          0
 #endif
 
-#if IRMP_SUPPORT_PANASONIC_PROTOCOL == 1 && IRMP_SUPPORT_MITSU_HEAVY_PROTOCOL == 1
+#if IRMP_SUPPORT_PANASONIC_PROTOCOL == 1 && IRMP_SUPPORT_MITSU_HEAVY_PROTOCOL == 1 && IRMP_ENABLE_CANDIDATES == 0
 #  warning PANASONIC protocol conflicts wih MITSU_HEAVY, please enable only one of both protocols
 #  warning MITSU_HEAVY protocol disabled
 #  undef IRMP_SUPPORT_MITSU_HEAVY_PROTOCOL
 #  define IRMP_SUPPORT_MITSU_HEAVY_PROTOCOL      0
 #endif
 
-#if IRMP_SUPPORT_KASEIKYO_PROTOCOL == 1 && IRMP_SUPPORT_MITSU_HEAVY_PROTOCOL == 1
+#if IRMP_SUPPORT_KASEIKYO_PROTOCOL == 1 && IRMP_SUPPORT_MITSU_HEAVY_PROTOCOL == 1 && IRMP_ENABLE_CANDIDATES == 0
 #  warning KASEIKYO protocol conflicts wih MITSU_HEAVY, please enable only one of both protocols
 #  warning MITSU_HEAVY protocol disabled
 #  undef IRMP_SUPPORT_MITSU_HEAVY_PROTOCOL
@@ -324,12 +362,60 @@ void irmp_register_complete_callback_function(void (*aCompleteCallbackFunction)(
 # warning F_INTERRUPTS too high (should be not greater than 20000)
 #endif
 
+#if IRMP_FRAME_QUEUE_SIZE > 128 || (IRMP_FRAME_QUEUE_SIZE & (IRMP_FRAME_QUEUE_SIZE - 1)) != 0
+#  error IRMP_FRAME_QUEUE_SIZE must be 0 or a power of 2, max. 128
+#endif
+
+#if IRMP_RAW_CAPTURE_LEN > 65535
+#  error IRMP_RAW_CAPTURE_LEN must be 0 ... 65535
+#endif
+
+#if IRMP_SYMBOL_LUT_LEN > 256
+#  error IRMP_SYMBOL_LUT_LEN must be 0 ... 256
+#endif
+
+#if IRMP_FRAME_BITS != 0 && IRMP_FRAME_BITS != 64 && IRMP_FRAME_BITS != 128
+#  error IRMP_FRAME_BITS must be 0, 64 or 128
+#endif
+
 #include "irmpprotocols.h"
 
 #define IRMP_FLAG_NEW                   0x00
 #define IRMP_FLAG_REPETITION            0x01
 #define IRMP_FLAG_RELEASE               0x02                                    // see IRMP_ENABLE_RELEASE_DETECTION in irmpconfig.h
 
+#define IRMP_GAP_UNKNOWN                0xFFFFFFFF                              // IRMP_DATA_EX gap_ticks: no previous frame
+
+#if IRMP_ENABLE_PROTOCOL_MASK == 1
+typedef uint64_t                        IRMP_PROTOCOL_MASK;                     // bit n: protocol n enabled, see irmp_set_protocol_mask()
+#define IRMP_PROTOCOL_BIT(p)            ((IRMP_PROTOCOL_MASK) 1 << (p))
+#define IRMP_PROTOCOL_MASK_ALL          (~(IRMP_PROTOCOL_MASK) 0)
+#endif
+
+#if IRMP_RAW_CAPTURE_LEN > 0
+#if IRMP_RAW_CAPTURE_16_BIT == 1
+typedef uint16_t                        IRMP_RAW_TICKS;
+#else
+typedef uint8_t                         IRMP_RAW_TICKS;
+#endif
+
+typedef struct IRMP_RAW_FRAME
+{
+    uint16_t                            len;                                    // number of entries in ticks[], the pause after the last pulse is not stored
+    uint8_t                             overflow;                               // TRUE: frame was longer than IRMP_RAW_CAPTURE_LEN, the rest is missing
+    IRMP_RAW_TICKS                      ticks[IRMP_RAW_CAPTURE_LEN];            // pulse, pause, pulse, ... in ticks (1 / F_INTERRUPTS)
+} IRMP_RAW_FRAME;
+#endif // IRMP_RAW_CAPTURE_LEN > 0
+
+#if IRMP_FRAME_BITS > 0
+typedef struct IRMP_FRAME
+{
+    uint8_t                             protocol;                               // protocol, same as in IRMP_DATA
+    uint8_t                             len;                                    // number of data bits received, bits behind IRMP_FRAME_BITS are missing
+    uint8_t                             bits[IRMP_FRAME_BITS / 8];              // data bits in the order received, 1st bit is MSB of bits[0]
+} IRMP_FRAME;
+#endif // IRMP_FRAME_BITS > 0
+
 #ifdef __cplusplus
 extern "C"
 {
@@ -343,6 +429,111 @@ extern bool                             irmp_ISR (void);
 extern uint_fast8_t                     irmp_get_data (IRMP_DATA *);
 extern uint_fast8_t                     irmp_ISR (void);
 #endif
+#if IRMP_ENABLE_CONTEXT == 1
+/*
+ * The _ctx functions select the context by setting the global pointer irmp_ctx for the duration of the call and restoring it
+ * afterwards. So they are not reentrant: a context function must not be interrupted by another context function which is
+ * not nested completely within it, e.g. call irmp_ISR_ctx() of all contexts from the same ISR and irmp_get_data_ctx()
+ * from the same thread. irmp_ctx is thread local in the analyzer batch mode only.
+ */
+typedef struct irmp_context             IRMP_CONTEXT;                           // complete type is defined in irmp.hpp
+extern void                             irmp_init_ctx (IRMP_CONTEXT *);
+#ifdef __cplusplus
+extern bool                             irmp_get_data_ctx (IRMP_CONTEXT *, IRMP_DATA *);
+extern bool                             irmp_ISR_ctx (IRMP_CONTEXT *, uint_fast8_t);
+#else
+extern uint_fast8_t                     irmp_get_data_ctx (IRMP_CONTEXT *, IRMP_DATA *);
+extern uint_fast8_t                     irmp_ISR_ctx (IRMP_CONTEXT *, uint_fast8_t);
+#endif
+#endif // IRMP_ENABLE_CONTEXT == 1
+
+#if IRMP_ENABLE_FEED_DURATION == 1
+extern uint32_t                         irmp_micros_to_ticks (uint32_t);
+extern uint32_t                         irmp_feed_duration (uint_fast8_t, uint32_t);
+#if IRMP_ENABLE_CONTEXT == 1
+extern uint32_t                         irmp_feed_duration_ctx (IRMP_CONTEXT *, uint_fast8_t, uint32_t);
+#endif
+#endif // IRMP_ENABLE_FEED_DURATION == 1
+
+#if IRMP_MULTI_RECEIVER_CHANNELS > 0
+extern void                             irmp_init_multi (void);
+#ifdef __cplusplus
+extern bool                             irmp_ISR_multi (uint_fast8_t);
+#else
+extern uint_fast8_t                     irmp_ISR_multi (uint_fast8_t);
+#endif
+#if IRMP_MULTI_COMBINE_TIME > 0
+#ifdef __cplusplus
+extern bool                             irmp_get_data_combined (IRMP_DATA *, uint8_t *);
+#else
+extern uint_fast8_t                     irmp_get_data_combined (IRMP_DATA *, uint8_t *);
+#endif
+#else
+#ifdef __cplusplus
+extern bool                             irmp_get_data_multi (IRMP_DATA *, uint_fast8_t *);
+#else
+extern uint_fast8_t                     irmp_get_data_multi (IRMP_DATA *, uint_fast8_t *);
+#endif
+#endif // IRMP_MULTI_COMBINE_TIME > 0
+#endif // IRMP_MULTI_RECEIVER_CHANNELS > 0
+
+#if IRMP_FRAME_QUEUE_SIZE > 0
+#ifdef __cplusplus
+extern bool                             irmp_get_data_timestamp (IRMP_DATA *, uint32_t *);
+#else
+extern uint_fast8_t                     irmp_get_data_timestamp (IRMP_DATA *, uint32_t *);
+#endif
+extern uint16_t                         irmp_get_queue_overflows (void);
+#if IRMP_ENABLE_CONTEXT == 1
+#ifdef __cplusplus
+extern bool                             irmp_get_data_timestamp_ctx (IRMP_CONTEXT *, IRMP_DATA *, uint32_t *);
+#else
+extern uint_fast8_t                     irmp_get_data_timestamp_ctx (IRMP_CONTEXT *, IRMP_DATA *, uint32_t *);
+#endif
+extern uint16_t                         irmp_get_queue_overflows_ctx (IRMP_CONTEXT *);
+#endif
+#endif // IRMP_FRAME_QUEUE_SIZE > 0
+
+#if IRMP_ENABLE_DATA_EX == 1
+#ifdef __cplusplus
+extern bool                             irmp_get_data_ex (IRMP_DATA_EX *);
+#else
+extern uint_fast8_t                     irmp_get_data_ex (IRMP_DATA_EX *);
+#endif
+extern uint32_t                         irmp_get_ticks (void);
+#if IRMP_ENABLE_CONTEXT == 1
+#ifdef __cplusplus
+extern bool                             irmp_get_data_ex_ctx (IRMP_CONTEXT *, IRMP_DATA_EX *);
+#else
+extern uint_fast8_t                     irmp_get_data_ex_ctx (IRMP_CONTEXT *, IRMP_DATA_EX *);
+#endif
+extern uint32_t                         irmp_get_ticks_ctx (IRMP_CONTEXT *);
+#endif
+#endif // IRMP_ENABLE_DATA_EX == 1
+
+#if IRMP_RAW_CAPTURE_LEN > 0
+extern const IRMP_RAW_FRAME *           irmp_get_raw_frame (void);
+#if IRMP_ENABLE_CONTEXT == 1
+extern const IRMP_RAW_FRAME *           irmp_get_raw_frame_ctx (IRMP_CONTEXT *);
+#endif
+#endif // IRMP_RAW_CAPTURE_LEN > 0
+
+#if IRMP_FRAME_BITS > 0
+extern const IRMP_FRAME *               irmp_get_frame (void);
+#if IRMP_ENABLE_CONTEXT == 1
+extern const IRMP_FRAME *               irmp_get_frame_ctx (IRMP_CONTEXT *);
+#endif
+#endif // IRMP_FRAME_BITS > 0
+
+#if IRMP_LOGGING == 1 && IRMP_LOGGING_BUFFER_SIZE > 0
+extern void                             irmp_log_flush (void);
+#endif
+
+#if IRMP_ENABLE_PROTOCOL_MASK == 1
+extern void                             irmp_set_protocol_mask (IRMP_PROTOCOL_MASK);
+extern IRMP_PROTOCOL_MASK               irmp_get_protocol_mask (void);
+#endif
+
 #if IRMP_AUTODETECT_REPEATRATE
 extern volatile uint_fast8_t            delta, min_delta, keep_same_key, timeout, upper_border;
 extern volatile uint_fast16_t           tmp_delta;
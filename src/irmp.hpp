@@ -59,6 +59,7 @@
 #endif
 
 #define IRMP_KEY_REPETITION_LEN                 (uint_fast16_t)(F_INTERRUPTS * 150.0e-3 + 0.5)           // autodetect key repetition within 150 msec
+#define IRMP_MULTI_COMBINE_LEN                  (uint_fast16_t)(F_INTERRUPTS * IRMP_MULTI_COMBINE_TIME / 1000.0 + 0.5) // combine frames of channels
 
 #define MIN_TOLERANCE_00                        1.0                           // -0%
 #define MAX_TOLERANCE_00                        1.0                           // +0%
@@ -99,33 +100,46 @@
 #define MIN_TOLERANCE_70                        0.3                           // -70%
 #define MAX_TOLERANCE_70                        1.7                           // +70%
 
-#define SIRCS_START_BIT_PULSE_LEN_MIN           ((uint_fast8_t)(F_INTERRUPTS * SIRCS_START_BIT_PULSE_TIME * MIN_TOLERANCE_10 + 0.5) - 1)
-#define SIRCS_START_BIT_PULSE_LEN_MAX           ((uint_fast8_t)(F_INTERRUPTS * SIRCS_START_BIT_PULSE_TIME * MAX_TOLERANCE_10 + 0.5) + 1)
-#define SIRCS_START_BIT_PAUSE_LEN_MIN           ((uint_fast8_t)(F_INTERRUPTS * SIRCS_START_BIT_PAUSE_TIME * MIN_TOLERANCE_20 + 0.5) - 1)
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ * Type of the pulse and pause lengths below. With IRMP_ENABLE_CONSTEXPR_TABLES, lengths are not truncated to 8 bits, so that
+ * the constexpr tables and start bit checks below can reject lengths which do not fit at this F_INTERRUPTS at compile time.
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+#if IRMP_ENABLE_CONSTEXPR_TABLES == 1
+#  define IRMP_TICK8_T                          int
+#  define IRMP_CONSTEXPR                        constexpr                     // a length > 255 in a table is a narrowing error
+#else
+#  define IRMP_TICK8_T                          uint_fast8_t
+#  define IRMP_CONSTEXPR                        const
+#endif
+
+#define SIRCS_START_BIT_PULSE_LEN_MIN           ((IRMP_TICK8_T)(F_INTERRUPTS * SIRCS_START_BIT_PULSE_TIME * MIN_TOLERANCE_10 + 0.5) - 1)
+#define SIRCS_START_BIT_PULSE_LEN_MAX           ((IRMP_TICK8_T)(F_INTERRUPTS * SIRCS_START_BIT_PULSE_TIME * MAX_TOLERANCE_10 + 0.5) + 1)
+#define SIRCS_START_BIT_PAUSE_LEN_MIN           ((IRMP_TICK8_T)(F_INTERRUPTS * SIRCS_START_BIT_PAUSE_TIME * MIN_TOLERANCE_20 + 0.5) - 1)
 #if IRMP_SUPPORT_NETBOX_PROTOCOL                // only 5% to avoid conflict with NETBOX:
-#  define SIRCS_START_BIT_PAUSE_LEN_MAX         ((uint_fast8_t)(F_INTERRUPTS * SIRCS_START_BIT_PAUSE_TIME * MAX_TOLERANCE_05 + 0.5))
+#  define SIRCS_START_BIT_PAUSE_LEN_MAX         ((IRMP_TICK8_T)(F_INTERRUPTS * SIRCS_START_BIT_PAUSE_TIME * MAX_TOLERANCE_05 + 0.5))
 #else                                           // only 5% + 1 to avoid conflict with RC6:
-#  define SIRCS_START_BIT_PAUSE_LEN_MAX         ((uint_fast8_t)(F_INTERRUPTS * SIRCS_START_BIT_PAUSE_TIME * MAX_TOLERANCE_05 + 0.5) + 1)
-#endif
-#define SIRCS_1_PULSE_LEN_MIN                   ((uint_fast8_t)(F_INTERRUPTS * SIRCS_1_PULSE_TIME * MIN_TOLERANCE_10 + 0.5) - 1)
-#define SIRCS_1_PULSE_LEN_MAX                   ((uint_fast8_t)(F_INTERRUPTS * SIRCS_1_PULSE_TIME * MAX_TOLERANCE_10 + 0.5) + 1)
-#define SIRCS_0_PULSE_LEN_MIN                   ((uint_fast8_t)(F_INTERRUPTS * SIRCS_0_PULSE_TIME * MIN_TOLERANCE_10 + 0.5) - 1)
-#define SIRCS_0_PULSE_LEN_MAX                   ((uint_fast8_t)(F_INTERRUPTS * SIRCS_0_PULSE_TIME * MAX_TOLERANCE_10 + 0.5) + 1)
-#define SIRCS_PAUSE_LEN_MIN                     ((uint_fast8_t)(F_INTERRUPTS * SIRCS_PAUSE_TIME * MIN_TOLERANCE_10 + 0.5) - 1)
-#define SIRCS_PAUSE_LEN_MAX                     ((uint_fast8_t)(F_INTERRUPTS * SIRCS_PAUSE_TIME * MAX_TOLERANCE_10 + 0.5) + 1)
-
-#define NEC_START_BIT_PULSE_LEN_MIN             ((uint_fast8_t)(F_INTERRUPTS * NEC_START_BIT_PULSE_TIME * MIN_TOLERANCE_30 + 0.5) - 1)
-#define NEC_START_BIT_PULSE_LEN_MAX             ((uint_fast8_t)(F_INTERRUPTS * NEC_START_BIT_PULSE_TIME * MAX_TOLERANCE_30 + 0.5) + 1)
-#define NEC_START_BIT_PAUSE_LEN_MIN             ((uint_fast8_t)(F_INTERRUPTS * NEC_START_BIT_PAUSE_TIME * MIN_TOLERANCE_30 + 0.5) - 1)
-#define NEC_START_BIT_PAUSE_LEN_MAX             ((uint_fast8_t)(F_INTERRUPTS * NEC_START_BIT_PAUSE_TIME * MAX_TOLERANCE_30 + 0.5) + 1)
-#define NEC_REPEAT_START_BIT_PAUSE_LEN_MIN      ((uint_fast8_t)(F_INTERRUPTS * NEC_REPEAT_START_BIT_PAUSE_TIME * MIN_TOLERANCE_30 + 0.5) - 1)
-#define NEC_REPEAT_START_BIT_PAUSE_LEN_MAX      ((uint_fast8_t)(F_INTERRUPTS * NEC_REPEAT_START_BIT_PAUSE_TIME * MAX_TOLERANCE_30 + 0.5) + 1)
-#define NEC_PULSE_LEN_MIN                       ((uint_fast8_t)(F_INTERRUPTS * NEC_PULSE_TIME * MIN_TOLERANCE_30 + 0.5) - 1)
-#define NEC_PULSE_LEN_MAX                       ((uint_fast8_t)(F_INTERRUPTS * NEC_PULSE_TIME * MAX_TOLERANCE_30 + 0.5) + 1)
-#define NEC_1_PAUSE_LEN_MIN                     ((uint_fast8_t)(F_INTERRUPTS * NEC_1_PAUSE_TIME * MIN_TOLERANCE_30 + 0.5) - 1)
-#define NEC_1_PAUSE_LEN_MAX                     ((uint_fast8_t)(F_INTERRUPTS * NEC_1_PAUSE_TIME * MAX_TOLERANCE_30 + 0.5) + 1)
-#define NEC_0_PAUSE_LEN_MIN                     ((uint_fast8_t)(F_INTERRUPTS * NEC_0_PAUSE_TIME * MIN_TOLERANCE_30 + 0.5) - 1)
-#define NEC_0_PAUSE_LEN_MAX                     ((uint_fast8_t)(F_INTERRUPTS * NEC_0_PAUSE_TIME * MAX_TOLERANCE_30 + 0.5) + 1)
+#  define SIRCS_START_BIT_PAUSE_LEN_MAX         ((IRMP_TICK8_T)(F_INTERRUPTS * SIRCS_START_BIT_PAUSE_TIME * MAX_TOLERANCE_05 + 0.5) + 1)
+#endif
+#define SIRCS_1_PULSE_LEN_MIN                   ((IRMP_TICK8_T)(F_INTERRUPTS * SIRCS_1_PULSE_TIME * MIN_TOLERANCE_10 + 0.5) - 1)
+#define SIRCS_1_PULSE_LEN_MAX                   ((IRMP_TICK8_T)(F_INTERRUPTS * SIRCS_1_PULSE_TIME * MAX_TOLERANCE_10 + 0.5) + 1)
+#define SIRCS_0_PULSE_LEN_MIN                   ((IRMP_TICK8_T)(F_INTERRUPTS * SIRCS_0_PULSE_TIME * MIN_TOLERANCE_10 + 0.5) - 1)
+#define SIRCS_0_PULSE_LEN_MAX                   ((IRMP_TICK8_T)(F_INTERRUPTS * SIRCS_0_PULSE_TIME * MAX_TOLERANCE_10 + 0.5) + 1)
+#define SIRCS_PAUSE_LEN_MIN                     ((IRMP_TICK8_T)(F_INTERRUPTS * SIRCS_PAUSE_TIME * MIN_TOLERANCE_10 + 0.5) - 1)
+#define SIRCS_PAUSE_LEN_MAX                     ((IRMP_TICK8_T)(F_INTERRUPTS * SIRCS_PAUSE_TIME * MAX_TOLERANCE_10 + 0.5) + 1)
+
+#define NEC_START_BIT_PULSE_LEN_MIN             ((IRMP_TICK8_T)(F_INTERRUPTS * NEC_START_BIT_PULSE_TIME * MIN_TOLERANCE_30 + 0.5) - 1)
+#define NEC_START_BIT_PULSE_LEN_MAX             ((IRMP_TICK8_T)(F_INTERRUPTS * NEC_START_BIT_PULSE_TIME * MAX_TOLERANCE_30 + 0.5) + 1)
+#define NEC_START_BIT_PAUSE_LEN_MIN             ((IRMP_TICK8_T)(F_INTERRUPTS * NEC_START_BIT_PAUSE_TIME * MIN_TOLERANCE_30 + 0.5) - 1)
+#define NEC_START_BIT_PAUSE_LEN_MAX             ((IRMP_TICK8_T)(F_INTERRUPTS * NEC_START_BIT_PAUSE_TIME * MAX_TOLERANCE_30 + 0.5) + 1)
+#define NEC_REPEAT_START_BIT_PAUSE_LEN_MIN      ((IRMP_TICK8_T)(F_INTERRUPTS * NEC_REPEAT_START_BIT_PAUSE_TIME * MIN_TOLERANCE_30 + 0.5) - 1)
+#define NEC_REPEAT_START_BIT_PAUSE_LEN_MAX      ((IRMP_TICK8_T)(F_INTERRUPTS * NEC_REPEAT_START_BIT_PAUSE_TIME * MAX_TOLERANCE_30 + 0.5) + 1)
+#define NEC_PULSE_LEN_MIN                       ((IRMP_TICK8_T)(F_INTERRUPTS * NEC_PULSE_TIME * MIN_TOLERANCE_30 + 0.5) - 1)
+#define NEC_PULSE_LEN_MAX                       ((IRMP_TICK8_T)(F_INTERRUPTS * NEC_PULSE_TIME * MAX_TOLERANCE_30 + 0.5) + 1)
+#define NEC_1_PAUSE_LEN_MIN                     ((IRMP_TICK8_T)(F_INTERRUPTS * NEC_1_PAUSE_TIME * MIN_TOLERANCE_30 + 0.5) - 1)
+#define NEC_1_PAUSE_LEN_MAX                     ((IRMP_TICK8_T)(F_INTERRUPTS * NEC_1_PAUSE_TIME * MAX_TOLERANCE_30 + 0.5) + 1)
+#define NEC_0_PAUSE_LEN_MIN                     ((IRMP_TICK8_T)(F_INTERRUPTS * NEC_0_PAUSE_TIME * MIN_TOLERANCE_30 + 0.5) - 1)
+#define NEC_0_PAUSE_LEN_MAX                     ((IRMP_TICK8_T)(F_INTERRUPTS * NEC_0_PAUSE_TIME * MAX_TOLERANCE_30 + 0.5) + 1)
 // autodetect nec repetition frame within 50 msec:
 // NEC seems to send the first repetition frame after 40ms, further repetition frames after 100 ms
 #if 0
@@ -134,532 +148,532 @@
 #define NEC_FRAME_REPEAT_PAUSE_LEN_MAX          (uint_fast16_t)(F_INTERRUPTS * 100.0e-3 * MAX_TOLERANCE_20 + 0.5)
 #endif
 
-#define MELINERA_0_PULSE_LEN_MIN                ((uint_fast8_t)(F_INTERRUPTS * MELINERA_0_PULSE_TIME * MIN_TOLERANCE_30 + 0.5) - 1)
-#define MELINERA_0_PULSE_LEN_MAX                ((uint_fast8_t)(F_INTERRUPTS * MELINERA_0_PULSE_TIME * MAX_TOLERANCE_30 + 0.5) + 1)
-#define MELINERA_0_PAUSE_LEN_MIN                ((uint_fast8_t)(F_INTERRUPTS * MELINERA_0_PAUSE_TIME * MIN_TOLERANCE_30 + 0.5) - 1)
-#define MELINERA_0_PAUSE_LEN_MAX                ((uint_fast8_t)(F_INTERRUPTS * MELINERA_0_PAUSE_TIME * MAX_TOLERANCE_30 + 0.5) + 1)
-#define MELINERA_1_PULSE_LEN_MIN                ((uint_fast8_t)(F_INTERRUPTS * MELINERA_1_PULSE_TIME * MIN_TOLERANCE_30 + 0.5) - 1)
-#define MELINERA_1_PULSE_LEN_MAX                ((uint_fast8_t)(F_INTERRUPTS * MELINERA_1_PULSE_TIME * MAX_TOLERANCE_30 + 0.5) + 1)
-#define MELINERA_1_PAUSE_LEN_MIN                ((uint_fast8_t)(F_INTERRUPTS * MELINERA_1_PAUSE_TIME * MIN_TOLERANCE_30 + 0.5) - 1)
-#define MELINERA_1_PAUSE_LEN_MAX                ((uint_fast8_t)(F_INTERRUPTS * MELINERA_1_PAUSE_TIME * MAX_TOLERANCE_30 + 0.5) + 1)
-
-#define SAMSUNG_START_BIT_PULSE_LEN_MIN         ((uint_fast8_t)(F_INTERRUPTS * SAMSUNG_START_BIT_PULSE_TIME * MIN_TOLERANCE_10 + 0.5) - 1)
-#define SAMSUNG_START_BIT_PULSE_LEN_MAX         ((uint_fast8_t)(F_INTERRUPTS * SAMSUNG_START_BIT_PULSE_TIME * MAX_TOLERANCE_10 + 0.5) + 1)
-#define SAMSUNG_START_BIT_PAUSE_LEN_MIN         ((uint_fast8_t)(F_INTERRUPTS * SAMSUNG_START_BIT_PAUSE_TIME * MIN_TOLERANCE_10 + 0.5) - 1)
-#define SAMSUNG_START_BIT_PAUSE_LEN_MAX         ((uint_fast8_t)(F_INTERRUPTS * SAMSUNG_START_BIT_PAUSE_TIME * MAX_TOLERANCE_10 + 0.5) + 1)
-#define SAMSUNG_PULSE_LEN_MIN                   ((uint_fast8_t)(F_INTERRUPTS * SAMSUNG_PULSE_TIME * MIN_TOLERANCE_30 + 0.5) - 1)
-#define SAMSUNG_PULSE_LEN_MAX                   ((uint_fast8_t)(F_INTERRUPTS * SAMSUNG_PULSE_TIME * MAX_TOLERANCE_30 + 0.5) + 1)
-#define SAMSUNG_1_PAUSE_LEN_MIN                 ((uint_fast8_t)(F_INTERRUPTS * SAMSUNG_1_PAUSE_TIME * MIN_TOLERANCE_30 + 0.5) - 1)
-#define SAMSUNG_1_PAUSE_LEN_MAX                 ((uint_fast8_t)(F_INTERRUPTS * SAMSUNG_1_PAUSE_TIME * MAX_TOLERANCE_30 + 0.5) + 1)
-#define SAMSUNG_0_PAUSE_LEN_MIN                 ((uint_fast8_t)(F_INTERRUPTS * SAMSUNG_0_PAUSE_TIME * MIN_TOLERANCE_30 + 0.5) - 1)
-#define SAMSUNG_0_PAUSE_LEN_MAX                 ((uint_fast8_t)(F_INTERRUPTS * SAMSUNG_0_PAUSE_TIME * MAX_TOLERANCE_30 + 0.5) + 1)
-
-#define SAMSUNGAH_START_BIT_PULSE_LEN_MIN       ((uint_fast8_t)(F_INTERRUPTS * SAMSUNGAH_START_BIT_PULSE_TIME * MIN_TOLERANCE_10 + 0.5) - 1)
-#define SAMSUNGAH_START_BIT_PULSE_LEN_MAX       ((uint_fast8_t)(F_INTERRUPTS * SAMSUNGAH_START_BIT_PULSE_TIME * MAX_TOLERANCE_10 + 0.5) + 1)
-#define SAMSUNGAH_START_BIT_PAUSE_LEN_MIN       ((uint_fast8_t)(F_INTERRUPTS * SAMSUNGAH_START_BIT_PAUSE_TIME * MIN_TOLERANCE_10 + 0.5) - 1)
-#define SAMSUNGAH_START_BIT_PAUSE_LEN_MAX       ((uint_fast8_t)(F_INTERRUPTS * SAMSUNGAH_START_BIT_PAUSE_TIME * MAX_TOLERANCE_10 + 0.5) + 1)
-#define SAMSUNGAH_PULSE_LEN_MIN                 ((uint_fast8_t)(F_INTERRUPTS * SAMSUNGAH_PULSE_TIME * MIN_TOLERANCE_30 + 0.5) - 1)
-#define SAMSUNGAH_PULSE_LEN_MAX                 ((uint_fast8_t)(F_INTERRUPTS * SAMSUNGAH_PULSE_TIME * MAX_TOLERANCE_30 + 0.5) + 1)
-#define SAMSUNGAH_1_PAUSE_LEN_MIN               ((uint_fast8_t)(F_INTERRUPTS * SAMSUNGAH_1_PAUSE_TIME * MIN_TOLERANCE_30 + 0.5) - 1)
-#define SAMSUNGAH_1_PAUSE_LEN_MAX               ((uint_fast8_t)(F_INTERRUPTS * SAMSUNGAH_1_PAUSE_TIME * MAX_TOLERANCE_30 + 0.5) + 1)
-#define SAMSUNGAH_0_PAUSE_LEN_MIN               ((uint_fast8_t)(F_INTERRUPTS * SAMSUNGAH_0_PAUSE_TIME * MIN_TOLERANCE_30 + 0.5) - 1)
-#define SAMSUNGAH_0_PAUSE_LEN_MAX               ((uint_fast8_t)(F_INTERRUPTS * SAMSUNGAH_0_PAUSE_TIME * MAX_TOLERANCE_30 + 0.5) + 1)
-
-#define MATSUSHITA_START_BIT_PULSE_LEN_MIN      ((uint_fast8_t)(F_INTERRUPTS * MATSUSHITA_START_BIT_PULSE_TIME * MIN_TOLERANCE_20 + 0.5) - 1)
-#define MATSUSHITA_START_BIT_PULSE_LEN_MAX      ((uint_fast8_t)(F_INTERRUPTS * MATSUSHITA_START_BIT_PULSE_TIME * MAX_TOLERANCE_20 + 0.5) + 1)
-#define MATSUSHITA_START_BIT_PAUSE_LEN_MIN      ((uint_fast8_t)(F_INTERRUPTS * MATSUSHITA_START_BIT_PAUSE_TIME * MIN_TOLERANCE_20 + 0.5) - 1)
-#define MATSUSHITA_START_BIT_PAUSE_LEN_MAX      ((uint_fast8_t)(F_INTERRUPTS * MATSUSHITA_START_BIT_PAUSE_TIME * MAX_TOLERANCE_20 + 0.5) + 1)
-#define MATSUSHITA_PULSE_LEN_MIN                ((uint_fast8_t)(F_INTERRUPTS * MATSUSHITA_PULSE_TIME * MIN_TOLERANCE_40 + 0.5) - 1)
-#define MATSUSHITA_PULSE_LEN_MAX                ((uint_fast8_t)(F_INTERRUPTS * MATSUSHITA_PULSE_TIME * MAX_TOLERANCE_40 + 0.5) + 1)
-#define MATSUSHITA_1_PAUSE_LEN_MIN              ((uint_fast8_t)(F_INTERRUPTS * MATSUSHITA_1_PAUSE_TIME * MIN_TOLERANCE_40 + 0.5) - 1)
-#define MATSUSHITA_1_PAUSE_LEN_MAX              ((uint_fast8_t)(F_INTERRUPTS * MATSUSHITA_1_PAUSE_TIME * MAX_TOLERANCE_40 + 0.5) + 1)
-#define MATSUSHITA_0_PAUSE_LEN_MIN              ((uint_fast8_t)(F_INTERRUPTS * MATSUSHITA_0_PAUSE_TIME * MIN_TOLERANCE_40 + 0.5) - 1)
-#define MATSUSHITA_0_PAUSE_LEN_MAX              ((uint_fast8_t)(F_INTERRUPTS * MATSUSHITA_0_PAUSE_TIME * MAX_TOLERANCE_40 + 0.5) + 1)
-
-#define KASEIKYO_START_BIT_PULSE_LEN_MIN        ((uint_fast8_t)(F_INTERRUPTS * KASEIKYO_START_BIT_PULSE_TIME * MIN_TOLERANCE_20 + 0.5) - 1)
-#define KASEIKYO_START_BIT_PULSE_LEN_MAX        ((uint_fast8_t)(F_INTERRUPTS * KASEIKYO_START_BIT_PULSE_TIME * MAX_TOLERANCE_20 + 0.5) + 1)
-#define KASEIKYO_START_BIT_PAUSE_LEN_MIN        ((uint_fast8_t)(F_INTERRUPTS * KASEIKYO_START_BIT_PAUSE_TIME * MIN_TOLERANCE_20 + 0.5) - 1)
-#define KASEIKYO_START_BIT_PAUSE_LEN_MAX        ((uint_fast8_t)(F_INTERRUPTS * KASEIKYO_START_BIT_PAUSE_TIME * MAX_TOLERANCE_20 + 0.5) + 1)
-#define KASEIKYO_PULSE_LEN_MIN                  ((uint_fast8_t)(F_INTERRUPTS * KASEIKYO_PULSE_TIME * MIN_TOLERANCE_40 + 0.5) - 1)
-#define KASEIKYO_PULSE_LEN_MAX                  ((uint_fast8_t)(F_INTERRUPTS * KASEIKYO_PULSE_TIME * MAX_TOLERANCE_40 + 0.5) + 1)
-#define KASEIKYO_1_PAUSE_LEN_MIN                ((uint_fast8_t)(F_INTERRUPTS * KASEIKYO_1_PAUSE_TIME * MIN_TOLERANCE_20 + 0.5) - 1)
-#define KASEIKYO_1_PAUSE_LEN_MAX                ((uint_fast8_t)(F_INTERRUPTS * KASEIKYO_1_PAUSE_TIME * MAX_TOLERANCE_20 + 0.5) + 1)
-#define KASEIKYO_0_PAUSE_LEN_MIN                ((uint_fast8_t)(F_INTERRUPTS * KASEIKYO_0_PAUSE_TIME * MIN_TOLERANCE_20 + 0.5) - 1)
-#define KASEIKYO_0_PAUSE_LEN_MAX                ((uint_fast8_t)(F_INTERRUPTS * KASEIKYO_0_PAUSE_TIME * MAX_TOLERANCE_20 + 0.5) + 1)
-
-#define MITSU_HEAVY_START_BIT_PULSE_LEN_MIN     ((uint_fast8_t)(F_INTERRUPTS * MITSU_HEAVY_START_BIT_PULSE_TIME * MIN_TOLERANCE_10 + 0.5) - 1)
-#define MITSU_HEAVY_START_BIT_PULSE_LEN_MAX     ((uint_fast8_t)(F_INTERRUPTS * MITSU_HEAVY_START_BIT_PULSE_TIME * MAX_TOLERANCE_10 + 0.5) + 1)
-#define MITSU_HEAVY_START_BIT_PAUSE_LEN_MIN     ((uint_fast8_t)(F_INTERRUPTS * MITSU_HEAVY_START_BIT_PAUSE_TIME * MIN_TOLERANCE_10 + 0.5) - 1)
-#define MITSU_HEAVY_START_BIT_PAUSE_LEN_MAX     ((uint_fast8_t)(F_INTERRUPTS * MITSU_HEAVY_START_BIT_PAUSE_TIME * MAX_TOLERANCE_10 + 0.5) + 1)
-#define MITSU_HEAVY_PULSE_LEN_MIN               ((uint_fast8_t)(F_INTERRUPTS * MITSU_HEAVY_PULSE_TIME * MIN_TOLERANCE_40 + 0.5) - 1)
-#define MITSU_HEAVY_PULSE_LEN_MAX               ((uint_fast8_t)(F_INTERRUPTS * MITSU_HEAVY_PULSE_TIME * MAX_TOLERANCE_40 + 0.5) + 1)
-#define MITSU_HEAVY_1_PAUSE_LEN_MIN             ((uint_fast8_t)(F_INTERRUPTS * MITSU_HEAVY_1_PAUSE_TIME * MIN_TOLERANCE_20 + 0.5) - 1)
-#define MITSU_HEAVY_1_PAUSE_LEN_MAX             ((uint_fast8_t)(F_INTERRUPTS * MITSU_HEAVY_1_PAUSE_TIME * MAX_TOLERANCE_20 + 0.5) + 1)
-#define MITSU_HEAVY_0_PAUSE_LEN_MIN             ((uint_fast8_t)(F_INTERRUPTS * MITSU_HEAVY_0_PAUSE_TIME * MIN_TOLERANCE_20 + 0.5) - 1)
-#define MITSU_HEAVY_0_PAUSE_LEN_MAX             ((uint_fast8_t)(F_INTERRUPTS * MITSU_HEAVY_0_PAUSE_TIME * MAX_TOLERANCE_20 + 0.5) + 1)
-
-#define PANASONIC_START_BIT_PULSE_LEN_MIN       ((uint_fast8_t)(F_INTERRUPTS * PANASONIC_START_BIT_PULSE_TIME * MIN_TOLERANCE_10 + 0.5) - 1)
-#define PANASONIC_START_BIT_PULSE_LEN_MAX       ((uint_fast8_t)(F_INTERRUPTS * PANASONIC_START_BIT_PULSE_TIME * MAX_TOLERANCE_10 + 0.5) + 1)
-#define PANASONIC_START_BIT_PAUSE_LEN_MIN       ((uint_fast8_t)(F_INTERRUPTS * PANASONIC_START_BIT_PAUSE_TIME * MIN_TOLERANCE_10 + 0.5) - 1)
-#define PANASONIC_START_BIT_PAUSE_LEN_MAX       ((uint_fast8_t)(F_INTERRUPTS * PANASONIC_START_BIT_PAUSE_TIME * MAX_TOLERANCE_10 + 0.5) + 1)
-#define PANASONIC_PULSE_LEN_MIN                 ((uint_fast8_t)(F_INTERRUPTS * PANASONIC_PULSE_TIME * MIN_TOLERANCE_40 + 0.5) - 1)
-#define PANASONIC_PULSE_LEN_MAX                 ((uint_fast8_t)(F_INTERRUPTS * PANASONIC_PULSE_TIME * MAX_TOLERANCE_40 + 0.5) + 1)
-#define PANASONIC_1_PAUSE_LEN_MIN               ((uint_fast8_t)(F_INTERRUPTS * PANASONIC_1_PAUSE_TIME * MIN_TOLERANCE_20 + 0.5) - 1)
-#define PANASONIC_1_PAUSE_LEN_MAX               ((uint_fast8_t)(F_INTERRUPTS * PANASONIC_1_PAUSE_TIME * MAX_TOLERANCE_20 + 0.5) + 1)
-#define PANASONIC_0_PAUSE_LEN_MIN               ((uint_fast8_t)(F_INTERRUPTS * PANASONIC_0_PAUSE_TIME * MIN_TOLERANCE_20 + 0.5) - 1)
-#define PANASONIC_0_PAUSE_LEN_MAX               ((uint_fast8_t)(F_INTERRUPTS * PANASONIC_0_PAUSE_TIME * MAX_TOLERANCE_20 + 0.5) + 1)
-
-#define VINCENT_START_BIT_PULSE_LEN_MIN         ((uint_fast8_t)(F_INTERRUPTS * VINCENT_START_BIT_PULSE_TIME * MIN_TOLERANCE_10 + 0.5) - 1)
-#define VINCENT_START_BIT_PULSE_LEN_MAX         ((uint_fast8_t)(F_INTERRUPTS * VINCENT_START_BIT_PULSE_TIME * MAX_TOLERANCE_10 + 0.5) + 1)
-#define VINCENT_START_BIT_PAUSE_LEN_MIN         ((uint_fast8_t)(F_INTERRUPTS * VINCENT_START_BIT_PAUSE_TIME * MIN_TOLERANCE_10 + 0.5) - 1)
-#define VINCENT_START_BIT_PAUSE_LEN_MAX         ((uint_fast8_t)(F_INTERRUPTS * VINCENT_START_BIT_PAUSE_TIME * MAX_TOLERANCE_10 + 0.5) + 1)
-#define VINCENT_PULSE_LEN_MIN                   ((uint_fast8_t)(F_INTERRUPTS * VINCENT_PULSE_TIME * MIN_TOLERANCE_40 + 0.5) - 1)
-#define VINCENT_PULSE_LEN_MAX                   ((uint_fast8_t)(F_INTERRUPTS * VINCENT_PULSE_TIME * MAX_TOLERANCE_40 + 0.5) + 1)
-#define VINCENT_1_PAUSE_LEN_MIN                 ((uint_fast8_t)(F_INTERRUPTS * VINCENT_1_PAUSE_TIME * MIN_TOLERANCE_20 + 0.5) - 1)
-#define VINCENT_1_PAUSE_LEN_MAX                 ((uint_fast8_t)(F_INTERRUPTS * VINCENT_1_PAUSE_TIME * MAX_TOLERANCE_20 + 0.5) + 1)
-#define VINCENT_0_PAUSE_LEN_MIN                 ((uint_fast8_t)(F_INTERRUPTS * VINCENT_0_PAUSE_TIME * MIN_TOLERANCE_20 + 0.5) - 1)
-#define VINCENT_0_PAUSE_LEN_MAX                 ((uint_fast8_t)(F_INTERRUPTS * VINCENT_0_PAUSE_TIME * MAX_TOLERANCE_20 + 0.5) + 1)
-
-#define RECS80_START_BIT_PULSE_LEN_MIN          ((uint_fast8_t)(F_INTERRUPTS * RECS80_START_BIT_PULSE_TIME * MIN_TOLERANCE_20 + 0.5) - 1)
-#define RECS80_START_BIT_PULSE_LEN_MAX          ((uint_fast8_t)(F_INTERRUPTS * RECS80_START_BIT_PULSE_TIME * MAX_TOLERANCE_20 + 0.5) + 1)
-#define RECS80_START_BIT_PAUSE_LEN_MIN          ((uint_fast8_t)(F_INTERRUPTS * RECS80_START_BIT_PAUSE_TIME * MIN_TOLERANCE_10 + 0.5) - 1)
-#define RECS80_START_BIT_PAUSE_LEN_MAX          ((uint_fast8_t)(F_INTERRUPTS * RECS80_START_BIT_PAUSE_TIME * MAX_TOLERANCE_10 + 0.5) + 1)
-#define RECS80_PULSE_LEN_MIN                    ((uint_fast8_t)(F_INTERRUPTS * RECS80_PULSE_TIME * MIN_TOLERANCE_20 + 0.5) - 1)
-#define RECS80_PULSE_LEN_MAX                    ((uint_fast8_t)(F_INTERRUPTS * RECS80_PULSE_TIME * MAX_TOLERANCE_20 + 0.5) + 1)
-#define RECS80_1_PAUSE_LEN_MIN                  ((uint_fast8_t)(F_INTERRUPTS * RECS80_1_PAUSE_TIME * MIN_TOLERANCE_10 + 0.5) - 1)
-#define RECS80_1_PAUSE_LEN_MAX                  ((uint_fast8_t)(F_INTERRUPTS * RECS80_1_PAUSE_TIME * MAX_TOLERANCE_10 + 0.5) + 1)
-#define RECS80_0_PAUSE_LEN_MIN                  ((uint_fast8_t)(F_INTERRUPTS * RECS80_0_PAUSE_TIME * MIN_TOLERANCE_10 + 0.5) - 1)
-#define RECS80_0_PAUSE_LEN_MAX                  ((uint_fast8_t)(F_INTERRUPTS * RECS80_0_PAUSE_TIME * MAX_TOLERANCE_10 + 0.5) + 1)
+#define MELINERA_0_PULSE_LEN_MIN                ((IRMP_TICK8_T)(F_INTERRUPTS * MELINERA_0_PULSE_TIME * MIN_TOLERANCE_30 + 0.5) - 1)
+#define MELINERA_0_PULSE_LEN_MAX                ((IRMP_TICK8_T)(F_INTERRUPTS * MELINERA_0_PULSE_TIME * MAX_TOLERANCE_30 + 0.5) + 1)
+#define MELINERA_0_PAUSE_LEN_MIN                ((IRMP_TICK8_T)(F_INTERRUPTS * MELINERA_0_PAUSE_TIME * MIN_TOLERANCE_30 + 0.5) - 1)
+#define MELINERA_0_PAUSE_LEN_MAX                ((IRMP_TICK8_T)(F_INTERRUPTS * MELINERA_0_PAUSE_TIME * MAX_TOLERANCE_30 + 0.5) + 1)
+#define MELINERA_1_PULSE_LEN_MIN                ((IRMP_TICK8_T)(F_INTERRUPTS * MELINERA_1_PULSE_TIME * MIN_TOLERANCE_30 + 0.5) - 1)
+#define MELINERA_1_PULSE_LEN_MAX                ((IRMP_TICK8_T)(F_INTERRUPTS * MELINERA_1_PULSE_TIME * MAX_TOLERANCE_30 + 0.5) + 1)
+#define MELINERA_1_PAUSE_LEN_MIN                ((IRMP_TICK8_T)(F_INTERRUPTS * MELINERA_1_PAUSE_TIME * MIN_TOLERANCE_30 + 0.5) - 1)
+#define MELINERA_1_PAUSE_LEN_MAX                ((IRMP_TICK8_T)(F_INTERRUPTS * MELINERA_1_PAUSE_TIME * MAX_TOLERANCE_30 + 0.5) + 1)
+
+#define SAMSUNG_START_BIT_PULSE_LEN_MIN         ((IRMP_TICK8_T)(F_INTERRUPTS * SAMSUNG_START_BIT_PULSE_TIME * MIN_TOLERANCE_10 + 0.5) - 1)
+#define SAMSUNG_START_BIT_PULSE_LEN_MAX         ((IRMP_TICK8_T)(F_INTERRUPTS * SAMSUNG_START_BIT_PULSE_TIME * MAX_TOLERANCE_10 + 0.5) + 1)
+#define SAMSUNG_START_BIT_PAUSE_LEN_MIN         ((IRMP_TICK8_T)(F_INTERRUPTS * SAMSUNG_START_BIT_PAUSE_TIME * MIN_TOLERANCE_10 + 0.5) - 1)
+#define SAMSUNG_START_BIT_PAUSE_LEN_MAX         ((IRMP_TICK8_T)(F_INTERRUPTS * SAMSUNG_START_BIT_PAUSE_TIME * MAX_TOLERANCE_10 + 0.5) + 1)
+#define SAMSUNG_PULSE_LEN_MIN                   ((IRMP_TICK8_T)(F_INTERRUPTS * SAMSUNG_PULSE_TIME * MIN_TOLERANCE_30 + 0.5) - 1)
+#define SAMSUNG_PULSE_LEN_MAX                   ((IRMP_TICK8_T)(F_INTERRUPTS * SAMSUNG_PULSE_TIME * MAX_TOLERANCE_30 + 0.5) + 1)
+#define SAMSUNG_1_PAUSE_LEN_MIN                 ((IRMP_TICK8_T)(F_INTERRUPTS * SAMSUNG_1_PAUSE_TIME * MIN_TOLERANCE_30 + 0.5) - 1)
+#define SAMSUNG_1_PAUSE_LEN_MAX                 ((IRMP_TICK8_T)(F_INTERRUPTS * SAMSUNG_1_PAUSE_TIME * MAX_TOLERANCE_30 + 0.5) + 1)
+#define SAMSUNG_0_PAUSE_LEN_MIN                 ((IRMP_TICK8_T)(F_INTERRUPTS * SAMSUNG_0_PAUSE_TIME * MIN_TOLERANCE_30 + 0.5) - 1)
+#define SAMSUNG_0_PAUSE_LEN_MAX                 ((IRMP_TICK8_T)(F_INTERRUPTS * SAMSUNG_0_PAUSE_TIME * MAX_TOLERANCE_30 + 0.5) + 1)
+
+#define SAMSUNGAH_START_BIT_PULSE_LEN_MIN       ((IRMP_TICK8_T)(F_INTERRUPTS * SAMSUNGAH_START_BIT_PULSE_TIME * MIN_TOLERANCE_10 + 0.5) - 1)
+#define SAMSUNGAH_START_BIT_PULSE_LEN_MAX       ((IRMP_TICK8_T)(F_INTERRUPTS * SAMSUNGAH_START_BIT_PULSE_TIME * MAX_TOLERANCE_10 + 0.5) + 1)
+#define SAMSUNGAH_START_BIT_PAUSE_LEN_MIN       ((IRMP_TICK8_T)(F_INTERRUPTS * SAMSUNGAH_START_BIT_PAUSE_TIME * MIN_TOLERANCE_10 + 0.5) - 1)
+#define SAMSUNGAH_START_BIT_PAUSE_LEN_MAX       ((IRMP_TICK8_T)(F_INTERRUPTS * SAMSUNGAH_START_BIT_PAUSE_TIME * MAX_TOLERANCE_10 + 0.5) + 1)
+#define SAMSUNGAH_PULSE_LEN_MIN                 ((IRMP_TICK8_T)(F_INTERRUPTS * SAMSUNGAH_PULSE_TIME * MIN_TOLERANCE_30 + 0.5) - 1)
+#define SAMSUNGAH_PULSE_LEN_MAX                 ((IRMP_TICK8_T)(F_INTERRUPTS * SAMSUNGAH_PULSE_TIME * MAX_TOLERANCE_30 + 0.5) + 1)
+#define SAMSUNGAH_1_PAUSE_LEN_MIN               ((IRMP_TICK8_T)(F_INTERRUPTS * SAMSUNGAH_1_PAUSE_TIME * MIN_TOLERANCE_30 + 0.5) - 1)
+#define SAMSUNGAH_1_PAUSE_LEN_MAX               ((IRMP_TICK8_T)(F_INTERRUPTS * SAMSUNGAH_1_PAUSE_TIME * MAX_TOLERANCE_30 + 0.5) + 1)
+#define SAMSUNGAH_0_PAUSE_LEN_MIN               ((IRMP_TICK8_T)(F_INTERRUPTS * SAMSUNGAH_0_PAUSE_TIME * MIN_TOLERANCE_30 + 0.5) - 1)
+#define SAMSUNGAH_0_PAUSE_LEN_MAX               ((IRMP_TICK8_T)(F_INTERRUPTS * SAMSUNGAH_0_PAUSE_TIME * MAX_TOLERANCE_30 + 0.5) + 1)
+
+#define MATSUSHITA_START_BIT_PULSE_LEN_MIN      ((IRMP_TICK8_T)(F_INTERRUPTS * MATSUSHITA_START_BIT_PULSE_TIME * MIN_TOLERANCE_20 + 0.5) - 1)
+#define MATSUSHITA_START_BIT_PULSE_LEN_MAX      ((IRMP_TICK8_T)(F_INTERRUPTS * MATSUSHITA_START_BIT_PULSE_TIME * MAX_TOLERANCE_20 + 0.5) + 1)
+#define MATSUSHITA_START_BIT_PAUSE_LEN_MIN      ((IRMP_TICK8_T)(F_INTERRUPTS * MATSUSHITA_START_BIT_PAUSE_TIME * MIN_TOLERANCE_20 + 0.5) - 1)
+#define MATSUSHITA_START_BIT_PAUSE_LEN_MAX      ((IRMP_TICK8_T)(F_INTERRUPTS * MATSUSHITA_START_BIT_PAUSE_TIME * MAX_TOLERANCE_20 + 0.5) + 1)
+#define MATSUSHITA_PULSE_LEN_MIN                ((IRMP_TICK8_T)(F_INTERRUPTS * MATSUSHITA_PULSE_TIME * MIN_TOLERANCE_40 + 0.5) - 1)
+#define MATSUSHITA_PULSE_LEN_MAX                ((IRMP_TICK8_T)(F_INTERRUPTS * MATSUSHITA_PULSE_TIME * MAX_TOLERANCE_40 + 0.5) + 1)
+#define MATSUSHITA_1_PAUSE_LEN_MIN              ((IRMP_TICK8_T)(F_INTERRUPTS * MATSUSHITA_1_PAUSE_TIME * MIN_TOLERANCE_40 + 0.5) - 1)
+#define MATSUSHITA_1_PAUSE_LEN_MAX              ((IRMP_TICK8_T)(F_INTERRUPTS * MATSUSHITA_1_PAUSE_TIME * MAX_TOLERANCE_40 + 0.5) + 1)
+#define MATSUSHITA_0_PAUSE_LEN_MIN              ((IRMP_TICK8_T)(F_INTERRUPTS * MATSUSHITA_0_PAUSE_TIME * MIN_TOLERANCE_40 + 0.5) - 1)
+#define MATSUSHITA_0_PAUSE_LEN_MAX              ((IRMP_TICK8_T)(F_INTERRUPTS * MATSUSHITA_0_PAUSE_TIME * MAX_TOLERANCE_40 + 0.5) + 1)
+
+#define KASEIKYO_START_BIT_PULSE_LEN_MIN        ((IRMP_TICK8_T)(F_INTERRUPTS * KASEIKYO_START_BIT_PULSE_TIME * MIN_TOLERANCE_20 + 0.5) - 1)
+#define KASEIKYO_START_BIT_PULSE_LEN_MAX        ((IRMP_TICK8_T)(F_INTERRUPTS * KASEIKYO_START_BIT_PULSE_TIME * MAX_TOLERANCE_20 + 0.5) + 1)
+#define KASEIKYO_START_BIT_PAUSE_LEN_MIN        ((IRMP_TICK8_T)(F_INTERRUPTS * KASEIKYO_START_BIT_PAUSE_TIME * MIN_TOLERANCE_20 + 0.5) - 1)
+#define KASEIKYO_START_BIT_PAUSE_LEN_MAX        ((IRMP_TICK8_T)(F_INTERRUPTS * KASEIKYO_START_BIT_PAUSE_TIME * MAX_TOLERANCE_20 + 0.5) + 1)
+#define KASEIKYO_PULSE_LEN_MIN                  ((IRMP_TICK8_T)(F_INTERRUPTS * KASEIKYO_PULSE_TIME * MIN_TOLERANCE_40 + 0.5) - 1)
+#define KASEIKYO_PULSE_LEN_MAX                  ((IRMP_TICK8_T)(F_INTERRUPTS * KASEIKYO_PULSE_TIME * MAX_TOLERANCE_40 + 0.5) + 1)
+#define KASEIKYO_1_PAUSE_LEN_MIN                ((IRMP_TICK8_T)(F_INTERRUPTS * KASEIKYO_1_PAUSE_TIME * MIN_TOLERANCE_20 + 0.5) - 1)
+#define KASEIKYO_1_PAUSE_LEN_MAX                ((IRMP_TICK8_T)(F_INTERRUPTS * KASEIKYO_1_PAUSE_TIME * MAX_TOLERANCE_20 + 0.5) + 1)
+#define KASEIKYO_0_PAUSE_LEN_MIN                ((IRMP_TICK8_T)(F_INTERRUPTS * KASEIKYO_0_PAUSE_TIME * MIN_TOLERANCE_20 + 0.5) - 1)
+#define KASEIKYO_0_PAUSE_LEN_MAX                ((IRMP_TICK8_T)(F_INTERRUPTS * KASEIKYO_0_PAUSE_TIME * MAX_TOLERANCE_20 + 0.5) + 1)
+
+#define MITSU_HEAVY_START_BIT_PULSE_LEN_MIN     ((IRMP_TICK8_T)(F_INTERRUPTS * MITSU_HEAVY_START_BIT_PULSE_TIME * MIN_TOLERANCE_10 + 0.5) - 1)
+#define MITSU_HEAVY_START_BIT_PULSE_LEN_MAX     ((IRMP_TICK8_T)(F_INTERRUPTS * MITSU_HEAVY_START_BIT_PULSE_TIME * MAX_TOLERANCE_10 + 0.5) + 1)
+#define MITSU_HEAVY_START_BIT_PAUSE_LEN_MIN     ((IRMP_TICK8_T)(F_INTERRUPTS * MITSU_HEAVY_START_BIT_PAUSE_TIME * MIN_TOLERANCE_10 + 0.5) - 1)
+#define MITSU_HEAVY_START_BIT_PAUSE_LEN_MAX     ((IRMP_TICK8_T)(F_INTERRUPTS * MITSU_HEAVY_START_BIT_PAUSE_TIME * MAX_TOLERANCE_10 + 0.5) + 1)
+#define MITSU_HEAVY_PULSE_LEN_MIN               ((IRMP_TICK8_T)(F_INTERRUPTS * MITSU_HEAVY_PULSE_TIME * MIN_TOLERANCE_40 + 0.5) - 1)
+#define MITSU_HEAVY_PULSE_LEN_MAX               ((IRMP_TICK8_T)(F_INTERRUPTS * MITSU_HEAVY_PULSE_TIME * MAX_TOLERANCE_40 + 0.5) + 1)
+#define MITSU_HEAVY_1_PAUSE_LEN_MIN             ((IRMP_TICK8_T)(F_INTERRUPTS * MITSU_HEAVY_1_PAUSE_TIME * MIN_TOLERANCE_20 + 0.5) - 1)
+#define MITSU_HEAVY_1_PAUSE_LEN_MAX             ((IRMP_TICK8_T)(F_INTERRUPTS * MITSU_HEAVY_1_PAUSE_TIME * MAX_TOLERANCE_20 + 0.5) + 1)
+#define MITSU_HEAVY_0_PAUSE_LEN_MIN             ((IRMP_TICK8_T)(F_INTERRUPTS * MITSU_HEAVY_0_PAUSE_TIME * MIN_TOLERANCE_20 + 0.5) - 1)
+#define MITSU_HEAVY_0_PAUSE_LEN_MAX             ((IRMP_TICK8_T)(F_INTERRUPTS * MITSU_HEAVY_0_PAUSE_TIME * MAX_TOLERANCE_20 + 0.5) + 1)
+
+#define PANASONIC_START_BIT_PULSE_LEN_MIN       ((IRMP_TICK8_T)(F_INTERRUPTS * PANASONIC_START_BIT_PULSE_TIME * MIN_TOLERANCE_10 + 0.5) - 1)
+#define PANASONIC_START_BIT_PULSE_LEN_MAX       ((IRMP_TICK8_T)(F_INTERRUPTS * PANASONIC_START_BIT_PULSE_TIME * MAX_TOLERANCE_10 + 0.5) + 1)
+#define PANASONIC_START_BIT_PAUSE_LEN_MIN       ((IRMP_TICK8_T)(F_INTERRUPTS * PANASONIC_START_BIT_PAUSE_TIME * MIN_TOLERANCE_10 + 0.5) - 1)
+#define PANASONIC_START_BIT_PAUSE_LEN_MAX       ((IRMP_TICK8_T)(F_INTERRUPTS * PANASONIC_START_BIT_PAUSE_TIME * MAX_TOLERANCE_10 + 0.5) + 1)
+#define PANASONIC_PULSE_LEN_MIN                 ((IRMP_TICK8_T)(F_INTERRUPTS * PANASONIC_PULSE_TIME * MIN_TOLERANCE_40 + 0.5) - 1)
+#define PANASONIC_PULSE_LEN_MAX                 ((IRMP_TICK8_T)(F_INTERRUPTS * PANASONIC_PULSE_TIME * MAX_TOLERANCE_40 + 0.5) + 1)
+#define PANASONIC_1_PAUSE_LEN_MIN               ((IRMP_TICK8_T)(F_INTERRUPTS * PANASONIC_1_PAUSE_TIME * MIN_TOLERANCE_20 + 0.5) - 1)
+#define PANASONIC_1_PAUSE_LEN_MAX               ((IRMP_TICK8_T)(F_INTERRUPTS * PANASONIC_1_PAUSE_TIME * MAX_TOLERANCE_20 + 0.5) + 1)
+#define PANASONIC_0_PAUSE_LEN_MIN               ((IRMP_TICK8_T)(F_INTERRUPTS * PANASONIC_0_PAUSE_TIME * MIN_TOLERANCE_20 + 0.5) - 1)
+#define PANASONIC_0_PAUSE_LEN_MAX               ((IRMP_TICK8_T)(F_INTERRUPTS * PANASONIC_0_PAUSE_TIME * MAX_TOLERANCE_20 + 0.5) + 1)
+
+#define VINCENT_START_BIT_PULSE_LEN_MIN         ((IRMP_TICK8_T)(F_INTERRUPTS * VINCENT_START_BIT_PULSE_TIME * MIN_TOLERANCE_10 + 0.5) - 1)
+#define VINCENT_START_BIT_PULSE_LEN_MAX         ((IRMP_TICK8_T)(F_INTERRUPTS * VINCENT_START_BIT_PULSE_TIME * MAX_TOLERANCE_10 + 0.5) + 1)
+#define VINCENT_START_BIT_PAUSE_LEN_MIN         ((IRMP_TICK8_T)(F_INTERRUPTS * VINCENT_START_BIT_PAUSE_TIME * MIN_TOLERANCE_10 + 0.5) - 1)
+#define VINCENT_START_BIT_PAUSE_LEN_MAX         ((IRMP_TICK8_T)(F_INTERRUPTS * VINCENT_START_BIT_PAUSE_TIME * MAX_TOLERANCE_10 + 0.5) + 1)
+#define VINCENT_PULSE_LEN_MIN                   ((IRMP_TICK8_T)(F_INTERRUPTS * VINCENT_PULSE_TIME * MIN_TOLERANCE_40 + 0.5) - 1)
+#define VINCENT_PULSE_LEN_MAX                   ((IRMP_TICK8_T)(F_INTERRUPTS * VINCENT_PULSE_TIME * MAX_TOLERANCE_40 + 0.5) + 1)
+#define VINCENT_1_PAUSE_LEN_MIN                 ((IRMP_TICK8_T)(F_INTERRUPTS * VINCENT_1_PAUSE_TIME * MIN_TOLERANCE_20 + 0.5) - 1)
+#define VINCENT_1_PAUSE_LEN_MAX                 ((IRMP_TICK8_T)(F_INTERRUPTS * VINCENT_1_PAUSE_TIME * MAX_TOLERANCE_20 + 0.5) + 1)
+#define VINCENT_0_PAUSE_LEN_MIN                 ((IRMP_TICK8_T)(F_INTERRUPTS * VINCENT_0_PAUSE_TIME * MIN_TOLERANCE_20 + 0.5) - 1)
+#define VINCENT_0_PAUSE_LEN_MAX                 ((IRMP_TICK8_T)(F_INTERRUPTS * VINCENT_0_PAUSE_TIME * MAX_TOLERANCE_20 + 0.5) + 1)
+
+#define RECS80_START_BIT_PULSE_LEN_MIN          ((IRMP_TICK8_T)(F_INTERRUPTS * RECS80_START_BIT_PULSE_TIME * MIN_TOLERANCE_20 + 0.5) - 1)
+#define RECS80_START_BIT_PULSE_LEN_MAX          ((IRMP_TICK8_T)(F_INTERRUPTS * RECS80_START_BIT_PULSE_TIME * MAX_TOLERANCE_20 + 0.5) + 1)
+#define RECS80_START_BIT_PAUSE_LEN_MIN          ((IRMP_TICK8_T)(F_INTERRUPTS * RECS80_START_BIT_PAUSE_TIME * MIN_TOLERANCE_10 + 0.5) - 1)
+#define RECS80_START_BIT_PAUSE_LEN_MAX          ((IRMP_TICK8_T)(F_INTERRUPTS * RECS80_START_BIT_PAUSE_TIME * MAX_TOLERANCE_10 + 0.5) + 1)
+#define RECS80_PULSE_LEN_MIN                    ((IRMP_TICK8_T)(F_INTERRUPTS * RECS80_PULSE_TIME * MIN_TOLERANCE_20 + 0.5) - 1)
+#define RECS80_PULSE_LEN_MAX                    ((IRMP_TICK8_T)(F_INTERRUPTS * RECS80_PULSE_TIME * MAX_TOLERANCE_20 + 0.5) + 1)
+#define RECS80_1_PAUSE_LEN_MIN                  ((IRMP_TICK8_T)(F_INTERRUPTS * RECS80_1_PAUSE_TIME * MIN_TOLERANCE_10 + 0.5) - 1)
+#define RECS80_1_PAUSE_LEN_MAX                  ((IRMP_TICK8_T)(F_INTERRUPTS * RECS80_1_PAUSE_TIME * MAX_TOLERANCE_10 + 0.5) + 1)
+#define RECS80_0_PAUSE_LEN_MIN                  ((IRMP_TICK8_T)(F_INTERRUPTS * RECS80_0_PAUSE_TIME * MIN_TOLERANCE_10 + 0.5) - 1)
+#define RECS80_0_PAUSE_LEN_MAX                  ((IRMP_TICK8_T)(F_INTERRUPTS * RECS80_0_PAUSE_TIME * MAX_TOLERANCE_10 + 0.5) + 1)
 
 #if IRMP_SUPPORT_BOSE_PROTOCOL == 1 // BOSE conflicts with RC5, so keep tolerance for RC5 minimal here:
-#define RC5_START_BIT_LEN_MIN                   ((uint_fast8_t)(F_INTERRUPTS * RC5_BIT_TIME * MIN_TOLERANCE_05 + 0.5) - 1)
-#define RC5_START_BIT_LEN_MAX                   ((uint_fast8_t)(F_INTERRUPTS * RC5_BIT_TIME * MAX_TOLERANCE_05 + 0.5) + 1)
+#define RC5_START_BIT_LEN_MIN                   ((IRMP_TICK8_T)(F_INTERRUPTS * RC5_BIT_TIME * MIN_TOLERANCE_05 + 0.5) - 1)
+#define RC5_START_BIT_LEN_MAX                   ((IRMP_TICK8_T)(F_INTERRUPTS * RC5_BIT_TIME * MAX_TOLERANCE_05 + 0.5) + 1)
 #else
-#define RC5_START_BIT_LEN_MIN                   ((uint_fast8_t)(F_INTERRUPTS * RC5_BIT_TIME * MIN_TOLERANCE_10 + 0.5) - 1)
-#define RC5_START_BIT_LEN_MAX                   ((uint_fast8_t)(F_INTERRUPTS * RC5_BIT_TIME * MAX_TOLERANCE_10 + 0.5) + 1)
+#define RC5_START_BIT_LEN_MIN                   ((IRMP_TICK8_T)(F_INTERRUPTS * RC5_BIT_TIME * MIN_TOLERANCE_10 + 0.5) - 1)
+#define RC5_START_BIT_LEN_MAX                   ((IRMP_TICK8_T)(F_INTERRUPTS * RC5_BIT_TIME * MAX_TOLERANCE_10 + 0.5) + 1)
 #endif
 
-#define RC5_BIT_LEN_MIN                         ((uint_fast8_t)(F_INTERRUPTS * RC5_BIT_TIME * MIN_TOLERANCE_10 + 0.5) - 1)
-#define RC5_BIT_LEN_MAX                         ((uint_fast8_t)(F_INTERRUPTS * RC5_BIT_TIME * MAX_TOLERANCE_10 + 0.5) + 1)
+#define RC5_BIT_LEN_MIN                         ((IRMP_TICK8_T)(F_INTERRUPTS * RC5_BIT_TIME * MIN_TOLERANCE_10 + 0.5) - 1)
+#define RC5_BIT_LEN_MAX                         ((IRMP_TICK8_T)(F_INTERRUPTS * RC5_BIT_TIME * MAX_TOLERANCE_10 + 0.5) + 1)
 
-#define RCII_START_BIT_PULSE_LEN_MIN            ((uint_fast8_t)(F_INTERRUPTS * RCII_START_BIT_PULSE_TIME * MIN_TOLERANCE_05 + 0.5) - 1)
-#define RCII_START_BIT_PULSE_LEN_MAX            ((uint_fast8_t)(F_INTERRUPTS * RCII_START_BIT_PULSE_TIME * MAX_TOLERANCE_05 + 0.5) + 1)
-#define RCII_START_BIT_PAUSE_LEN_MIN            ((uint_fast8_t)(F_INTERRUPTS * RCII_START_BIT_PAUSE_TIME * MIN_TOLERANCE_05 + 0.5) - 1)
-#define RCII_START_BIT_PAUSE_LEN_MAX            ((uint_fast8_t)(F_INTERRUPTS * RCII_START_BIT_PAUSE_TIME * MAX_TOLERANCE_05 + 0.5) + 1)
-#define RCII_START_BIT2_PULSE_LEN_MIN           ((uint_fast8_t)(F_INTERRUPTS * RCII_START_BIT2_PULSE_TIME * MIN_TOLERANCE_05 + 0.5) - 1)
-#define RCII_START_BIT2_PULSE_LEN_MAX           ((uint_fast8_t)(F_INTERRUPTS * RCII_START_BIT2_PULSE_TIME * MAX_TOLERANCE_05 + 0.5) + 1)
+#define RCII_START_BIT_PULSE_LEN_MIN            ((IRMP_TICK8_T)(F_INTERRUPTS * RCII_START_BIT_PULSE_TIME * MIN_TOLERANCE_05 + 0.5) - 1)
+#define RCII_START_BIT_PULSE_LEN_MAX            ((IRMP_TICK8_T)(F_INTERRUPTS * RCII_START_BIT_PULSE_TIME * MAX_TOLERANCE_05 + 0.5) + 1)
+#define RCII_START_BIT_PAUSE_LEN_MIN            ((IRMP_TICK8_T)(F_INTERRUPTS * RCII_START_BIT_PAUSE_TIME * MIN_TOLERANCE_05 + 0.5) - 1)
+#define RCII_START_BIT_PAUSE_LEN_MAX            ((IRMP_TICK8_T)(F_INTERRUPTS * RCII_START_BIT_PAUSE_TIME * MAX_TOLERANCE_05 + 0.5) + 1)
+#define RCII_START_BIT2_PULSE_LEN_MIN           ((IRMP_TICK8_T)(F_INTERRUPTS * RCII_START_BIT2_PULSE_TIME * MIN_TOLERANCE_05 + 0.5) - 1)
+#define RCII_START_BIT2_PULSE_LEN_MAX           ((IRMP_TICK8_T)(F_INTERRUPTS * RCII_START_BIT2_PULSE_TIME * MAX_TOLERANCE_05 + 0.5) + 1)
 
-#define RCII_BIT_LEN_MIN                        ((uint_fast8_t)(F_INTERRUPTS * RCII_BIT_TIME * MIN_TOLERANCE_30 + 0.5) - 1)
-#define RCII_BIT_LEN                            ((uint_fast8_t)(F_INTERRUPTS * RCII_BIT_TIME))
-#define RCII_BIT_LEN_MAX                        ((uint_fast8_t)(F_INTERRUPTS * RCII_BIT_TIME * MAX_TOLERANCE_30 + 0.5) + 1)
+#define RCII_BIT_LEN_MIN                        ((IRMP_TICK8_T)(F_INTERRUPTS * RCII_BIT_TIME * MIN_TOLERANCE_30 + 0.5) - 1)
+#define RCII_BIT_LEN                            ((IRMP_TICK8_T)(F_INTERRUPTS * RCII_BIT_TIME))
+#define RCII_BIT_LEN_MAX                        ((IRMP_TICK8_T)(F_INTERRUPTS * RCII_BIT_TIME * MAX_TOLERANCE_30 + 0.5) + 1)
 
 #if IRMP_SUPPORT_BOSE_PROTOCOL == 1 // BOSE conflicts with S100, so keep tolerance for S100 minimal here:
-#define S100_START_BIT_LEN_MIN                   ((uint_fast8_t)(F_INTERRUPTS * S100_BIT_TIME * MIN_TOLERANCE_05 + 0.5) - 1)
-#define S100_START_BIT_LEN_MAX                   ((uint_fast8_t)(F_INTERRUPTS * S100_BIT_TIME * MAX_TOLERANCE_05 + 0.5) + 1)
+#define S100_START_BIT_LEN_MIN                   ((IRMP_TICK8_T)(F_INTERRUPTS * S100_BIT_TIME * MIN_TOLERANCE_05 + 0.5) - 1)
+#define S100_START_BIT_LEN_MAX                   ((IRMP_TICK8_T)(F_INTERRUPTS * S100_BIT_TIME * MAX_TOLERANCE_05 + 0.5) + 1)
 #else
-#define S100_START_BIT_LEN_MIN                   ((uint_fast8_t)(F_INTERRUPTS * S100_BIT_TIME * MIN_TOLERANCE_10 + 0.5) - 1)
-#define S100_START_BIT_LEN_MAX                   ((uint_fast8_t)(F_INTERRUPTS * S100_BIT_TIME * MAX_TOLERANCE_10 + 0.5) + 1)
+#define S100_START_BIT_LEN_MIN                   ((IRMP_TICK8_T)(F_INTERRUPTS * S100_BIT_TIME * MIN_TOLERANCE_10 + 0.5) - 1)
+#define S100_START_BIT_LEN_MAX                   ((IRMP_TICK8_T)(F_INTERRUPTS * S100_BIT_TIME * MAX_TOLERANCE_10 + 0.5) + 1)
 #endif
 
-#define S100_BIT_LEN_MIN                         ((uint_fast8_t)(F_INTERRUPTS * S100_BIT_TIME * MIN_TOLERANCE_10 + 0.5) - 1)
-#define S100_BIT_LEN_MAX                         ((uint_fast8_t)(F_INTERRUPTS * S100_BIT_TIME * MAX_TOLERANCE_10 + 0.5) + 1)
+#define S100_BIT_LEN_MIN                         ((IRMP_TICK8_T)(F_INTERRUPTS * S100_BIT_TIME * MIN_TOLERANCE_10 + 0.5) - 1)
+#define S100_BIT_LEN_MAX                         ((IRMP_TICK8_T)(F_INTERRUPTS * S100_BIT_TIME * MAX_TOLERANCE_10 + 0.5) + 1)
 
-#define DENON_PULSE_LEN_MIN                     ((uint_fast8_t)(F_INTERRUPTS * DENON_PULSE_TIME * MIN_TOLERANCE_10 + 0.5) - 1)
-#define DENON_PULSE_LEN_MAX                     ((uint_fast8_t)(F_INTERRUPTS * DENON_PULSE_TIME * MAX_TOLERANCE_20 + 0.5) + 1)
-#define DENON_1_PAUSE_LEN_MIN                   ((uint_fast8_t)(F_INTERRUPTS * DENON_1_PAUSE_TIME * MIN_TOLERANCE_10 + 0.5) - 1)
-#define DENON_1_PAUSE_LEN_MAX                   ((uint_fast8_t)(F_INTERRUPTS * DENON_1_PAUSE_TIME * MAX_TOLERANCE_10 + 0.5) + 1)
+#define DENON_PULSE_LEN_MIN                     ((IRMP_TICK8_T)(F_INTERRUPTS * DENON_PULSE_TIME * MIN_TOLERANCE_10 + 0.5) - 1)
+#define DENON_PULSE_LEN_MAX                     ((IRMP_TICK8_T)(F_INTERRUPTS * DENON_PULSE_TIME * MAX_TOLERANCE_20 + 0.5) + 1)
+#define DENON_1_PAUSE_LEN_MIN                   ((IRMP_TICK8_T)(F_INTERRUPTS * DENON_1_PAUSE_TIME * MIN_TOLERANCE_10 + 0.5) - 1)
+#define DENON_1_PAUSE_LEN_MAX                   ((IRMP_TICK8_T)(F_INTERRUPTS * DENON_1_PAUSE_TIME * MAX_TOLERANCE_10 + 0.5) + 1)
 // RUWIDO (see t-home-mediareceiver-15kHz.txt) conflicts here with DENON
-#define DENON_0_PAUSE_LEN_MIN                   ((uint_fast8_t)(F_INTERRUPTS * DENON_0_PAUSE_TIME * MIN_TOLERANCE_10 + 0.5) - 1)
-#define DENON_0_PAUSE_LEN_MAX                   ((uint_fast8_t)(F_INTERRUPTS * DENON_0_PAUSE_TIME * MAX_TOLERANCE_10 + 0.5) + 1)
+#define DENON_0_PAUSE_LEN_MIN                   ((IRMP_TICK8_T)(F_INTERRUPTS * DENON_0_PAUSE_TIME * MIN_TOLERANCE_10 + 0.5) - 1)
+#define DENON_0_PAUSE_LEN_MAX                   ((IRMP_TICK8_T)(F_INTERRUPTS * DENON_0_PAUSE_TIME * MAX_TOLERANCE_10 + 0.5) + 1)
 #define DENON_AUTO_REPETITION_PAUSE_LEN         ((uint_fast16_t)(F_INTERRUPTS * DENON_AUTO_REPETITION_PAUSE_TIME * MAX_TOLERANCE_10 + 0.5) + 1)
 
-#define THOMSON_PULSE_LEN_MIN                   ((uint_fast8_t)(F_INTERRUPTS * THOMSON_PULSE_TIME * MIN_TOLERANCE_10 + 0.5) - 1)
-#define THOMSON_PULSE_LEN_MAX                   ((uint_fast8_t)(F_INTERRUPTS * THOMSON_PULSE_TIME * MAX_TOLERANCE_20 + 0.5) + 1)
-#define THOMSON_1_PAUSE_LEN_MIN                 ((uint_fast8_t)(F_INTERRUPTS * THOMSON_1_PAUSE_TIME * MIN_TOLERANCE_10 + 0.5) - 1)
-#define THOMSON_1_PAUSE_LEN_MAX                 ((uint_fast8_t)(F_INTERRUPTS * THOMSON_1_PAUSE_TIME * MAX_TOLERANCE_10 + 0.5) + 1)
-#define THOMSON_0_PAUSE_LEN_MIN                 ((uint_fast8_t)(F_INTERRUPTS * THOMSON_0_PAUSE_TIME * MIN_TOLERANCE_30 + 0.5) - 1)
-#define THOMSON_0_PAUSE_LEN_MAX                 ((uint_fast8_t)(F_INTERRUPTS * THOMSON_0_PAUSE_TIME * MAX_TOLERANCE_10 + 0.5) + 1)
-
-#define RC6_START_BIT_PULSE_LEN_MIN             ((uint_fast8_t)(F_INTERRUPTS * RC6_START_BIT_PULSE_TIME * MIN_TOLERANCE_10 + 0.5) - 1)
-#define RC6_START_BIT_PULSE_LEN_MAX             ((uint_fast8_t)(F_INTERRUPTS * RC6_START_BIT_PULSE_TIME * MAX_TOLERANCE_10 + 0.5) + 1)
-#define RC6_START_BIT_PAUSE_LEN_MIN             ((uint_fast8_t)(F_INTERRUPTS * RC6_START_BIT_PAUSE_TIME * MIN_TOLERANCE_10 + 0.5) - 1)
-#define RC6_START_BIT_PAUSE_LEN_MAX             ((uint_fast8_t)(F_INTERRUPTS * RC6_START_BIT_PAUSE_TIME * MAX_TOLERANCE_10 + 0.5) + 1)
-#define RC6_TOGGLE_BIT_LEN_MIN                  ((uint_fast8_t)(F_INTERRUPTS * RC6_TOGGLE_BIT_TIME * MIN_TOLERANCE_10 + 0.5) - 1)
-#define RC6_TOGGLE_BIT_LEN_MAX                  ((uint_fast8_t)(F_INTERRUPTS * RC6_TOGGLE_BIT_TIME * MAX_TOLERANCE_10 + 0.5) + 1)
-#define RC6_BIT_PULSE_LEN_MIN                   ((uint_fast8_t)(F_INTERRUPTS * RC6_BIT_TIME * MIN_TOLERANCE_10 + 0.5) - 1)
-#define RC6_BIT_PULSE_LEN_MAX                   ((uint_fast8_t)(F_INTERRUPTS * RC6_BIT_TIME * MAX_TOLERANCE_60 + 0.5) + 1)       // pulses: 300 - 800
-#define RC6_BIT_PAUSE_LEN_MIN                   ((uint_fast8_t)(F_INTERRUPTS * RC6_BIT_TIME * MIN_TOLERANCE_10 + 0.5) - 1)
-#define RC6_BIT_PAUSE_LEN_MAX                   ((uint_fast8_t)(F_INTERRUPTS * RC6_BIT_TIME * MAX_TOLERANCE_20 + 0.5) + 1)       // pauses: 300 - 600
-
-#define RECS80EXT_START_BIT_PULSE_LEN_MIN       ((uint_fast8_t)(F_INTERRUPTS * RECS80EXT_START_BIT_PULSE_TIME * MIN_TOLERANCE_20 + 0.5) - 1)
-#define RECS80EXT_START_BIT_PULSE_LEN_MAX       ((uint_fast8_t)(F_INTERRUPTS * RECS80EXT_START_BIT_PULSE_TIME * MAX_TOLERANCE_20 + 0.5) + 1)
-#define RECS80EXT_START_BIT_PAUSE_LEN_MIN       ((uint_fast8_t)(F_INTERRUPTS * RECS80EXT_START_BIT_PAUSE_TIME * MIN_TOLERANCE_10 + 0.5) - 1)
-#define RECS80EXT_START_BIT_PAUSE_LEN_MAX       ((uint_fast8_t)(F_INTERRUPTS * RECS80EXT_START_BIT_PAUSE_TIME * MAX_TOLERANCE_10 + 0.5) + 1)
-#define RECS80EXT_PULSE_LEN_MIN                 ((uint_fast8_t)(F_INTERRUPTS * RECS80EXT_PULSE_TIME * MIN_TOLERANCE_20 + 0.5) - 1)
-#define RECS80EXT_PULSE_LEN_MAX                 ((uint_fast8_t)(F_INTERRUPTS * RECS80EXT_PULSE_TIME * MAX_TOLERANCE_20 + 0.5) + 1)
-#define RECS80EXT_1_PAUSE_LEN_MIN               ((uint_fast8_t)(F_INTERRUPTS * RECS80EXT_1_PAUSE_TIME * MIN_TOLERANCE_10 + 0.5) - 1)
-#define RECS80EXT_1_PAUSE_LEN_MAX               ((uint_fast8_t)(F_INTERRUPTS * RECS80EXT_1_PAUSE_TIME * MAX_TOLERANCE_10 + 0.5) + 1)
-#define RECS80EXT_0_PAUSE_LEN_MIN               ((uint_fast8_t)(F_INTERRUPTS * RECS80EXT_0_PAUSE_TIME * MIN_TOLERANCE_10 + 0.5) - 1)
-#define RECS80EXT_0_PAUSE_LEN_MAX               ((uint_fast8_t)(F_INTERRUPTS * RECS80EXT_0_PAUSE_TIME * MAX_TOLERANCE_10 + 0.5) + 1)
-
-#define NUBERT_START_BIT_PULSE_LEN_MIN          ((uint_fast8_t)(F_INTERRUPTS * NUBERT_START_BIT_PULSE_TIME * MIN_TOLERANCE_20 + 0.5) - 1)
-#define NUBERT_START_BIT_PULSE_LEN_MAX          ((uint_fast8_t)(F_INTERRUPTS * NUBERT_START_BIT_PULSE_TIME * MAX_TOLERANCE_20 + 0.5) + 1)
-#define NUBERT_START_BIT_PAUSE_LEN_MIN          ((uint_fast8_t)(F_INTERRUPTS * NUBERT_START_BIT_PAUSE_TIME * MIN_TOLERANCE_20 + 0.5) - 1)
-#define NUBERT_START_BIT_PAUSE_LEN_MAX          ((uint_fast8_t)(F_INTERRUPTS * NUBERT_START_BIT_PAUSE_TIME * MAX_TOLERANCE_20 + 0.5) + 1)
-#define NUBERT_1_PULSE_LEN_MIN                  ((uint_fast8_t)(F_INTERRUPTS * NUBERT_1_PULSE_TIME * MIN_TOLERANCE_20 + 0.5) - 1)
-#define NUBERT_1_PULSE_LEN_MAX                  ((uint_fast8_t)(F_INTERRUPTS * NUBERT_1_PULSE_TIME * MAX_TOLERANCE_20 + 0.5) + 1)
-#define NUBERT_1_PAUSE_LEN_MIN                  ((uint_fast8_t)(F_INTERRUPTS * NUBERT_1_PAUSE_TIME * MIN_TOLERANCE_20 + 0.5) - 1)
-#define NUBERT_1_PAUSE_LEN_MAX                  ((uint_fast8_t)(F_INTERRUPTS * NUBERT_1_PAUSE_TIME * MAX_TOLERANCE_20 + 0.5) + 1)
-#define NUBERT_0_PULSE_LEN_MIN                  ((uint_fast8_t)(F_INTERRUPTS * NUBERT_0_PULSE_TIME * MIN_TOLERANCE_20 + 0.5) - 1)
-#define NUBERT_0_PULSE_LEN_MAX                  ((uint_fast8_t)(F_INTERRUPTS * NUBERT_0_PULSE_TIME * MAX_TOLERANCE_20 + 0.5) + 1)
-#define NUBERT_0_PAUSE_LEN_MIN                  ((uint_fast8_t)(F_INTERRUPTS * NUBERT_0_PAUSE_TIME * MIN_TOLERANCE_20 + 0.5) - 1)
-#define NUBERT_0_PAUSE_LEN_MAX                  ((uint_fast8_t)(F_INTERRUPTS * NUBERT_0_PAUSE_TIME * MAX_TOLERANCE_20 + 0.5) + 1)
-
-#define FAN_START_BIT_PULSE_LEN_MIN             ((uint_fast8_t)(F_INTERRUPTS * FAN_START_BIT_PULSE_TIME * MIN_TOLERANCE_20 + 0.5) - 1)
-#define FAN_START_BIT_PULSE_LEN_MAX             ((uint_fast8_t)(F_INTERRUPTS * FAN_START_BIT_PULSE_TIME * MAX_TOLERANCE_20 + 0.5) + 1)
-#define FAN_START_BIT_PAUSE_LEN_MIN             ((uint_fast8_t)(F_INTERRUPTS * FAN_START_BIT_PAUSE_TIME * MIN_TOLERANCE_20 + 0.5) - 1)
-#define FAN_START_BIT_PAUSE_LEN_MAX             ((uint_fast8_t)(F_INTERRUPTS * FAN_START_BIT_PAUSE_TIME * MAX_TOLERANCE_20 + 0.5) + 1)
-#define FAN_1_PULSE_LEN_MIN                     ((uint_fast8_t)(F_INTERRUPTS * FAN_1_PULSE_TIME * MIN_TOLERANCE_20 + 0.5) - 1)
-#define FAN_1_PULSE_LEN_MAX                     ((uint_fast8_t)(F_INTERRUPTS * FAN_1_PULSE_TIME * MAX_TOLERANCE_20 + 0.5) + 1)
-#define FAN_1_PAUSE_LEN_MIN                     ((uint_fast8_t)(F_INTERRUPTS * FAN_1_PAUSE_TIME * MIN_TOLERANCE_20 + 0.5) - 1)
-#define FAN_1_PAUSE_LEN_MAX                     ((uint_fast8_t)(F_INTERRUPTS * FAN_1_PAUSE_TIME * MAX_TOLERANCE_20 + 0.5) + 1)
-#define FAN_0_PULSE_LEN_MIN                     ((uint_fast8_t)(F_INTERRUPTS * FAN_0_PULSE_TIME * MIN_TOLERANCE_20 + 0.5) - 1)
-#define FAN_0_PULSE_LEN_MAX                     ((uint_fast8_t)(F_INTERRUPTS * FAN_0_PULSE_TIME * MAX_TOLERANCE_20 + 0.5) + 1)
-#define FAN_0_PAUSE_LEN_MIN                     ((uint_fast8_t)(F_INTERRUPTS * FAN_0_PAUSE_TIME * MIN_TOLERANCE_20 + 0.5) - 1)
-#define FAN_0_PAUSE_LEN_MAX                     ((uint_fast8_t)(F_INTERRUPTS * FAN_0_PAUSE_TIME * MAX_TOLERANCE_20 + 0.5) + 1)
-
-#define SPEAKER_START_BIT_PULSE_LEN_MIN         ((uint_fast8_t)(F_INTERRUPTS * SPEAKER_START_BIT_PULSE_TIME * MIN_TOLERANCE_20 + 0.5) - 1)
-#define SPEAKER_START_BIT_PULSE_LEN_MAX         ((uint_fast8_t)(F_INTERRUPTS * SPEAKER_START_BIT_PULSE_TIME * MAX_TOLERANCE_20 + 0.5) + 1)
-#define SPEAKER_START_BIT_PAUSE_LEN_MIN         ((uint_fast8_t)(F_INTERRUPTS * SPEAKER_START_BIT_PAUSE_TIME * MIN_TOLERANCE_20 + 0.5) - 1)
-#define SPEAKER_START_BIT_PAUSE_LEN_MAX         ((uint_fast8_t)(F_INTERRUPTS * SPEAKER_START_BIT_PAUSE_TIME * MAX_TOLERANCE_20 + 0.5) + 1)
-#define SPEAKER_1_PULSE_LEN_MIN                 ((uint_fast8_t)(F_INTERRUPTS * SPEAKER_1_PULSE_TIME * MIN_TOLERANCE_20 + 0.5) - 1)
-#define SPEAKER_1_PULSE_LEN_MAX                 ((uint_fast8_t)(F_INTERRUPTS * SPEAKER_1_PULSE_TIME * MAX_TOLERANCE_20 + 0.5) + 1)
-#define SPEAKER_1_PAUSE_LEN_MIN                 ((uint_fast8_t)(F_INTERRUPTS * SPEAKER_1_PAUSE_TIME * MIN_TOLERANCE_20 + 0.5) - 1)
-#define SPEAKER_1_PAUSE_LEN_MAX                 ((uint_fast8_t)(F_INTERRUPTS * SPEAKER_1_PAUSE_TIME * MAX_TOLERANCE_20 + 0.5) + 1)
-#define SPEAKER_0_PULSE_LEN_MIN                 ((uint_fast8_t)(F_INTERRUPTS * SPEAKER_0_PULSE_TIME * MIN_TOLERANCE_20 + 0.5) - 1)
-#define SPEAKER_0_PULSE_LEN_MAX                 ((uint_fast8_t)(F_INTERRUPTS * SPEAKER_0_PULSE_TIME * MAX_TOLERANCE_20 + 0.5) + 1)
-#define SPEAKER_0_PAUSE_LEN_MIN                 ((uint_fast8_t)(F_INTERRUPTS * SPEAKER_0_PAUSE_TIME * MIN_TOLERANCE_20 + 0.5) - 1)
-#define SPEAKER_0_PAUSE_LEN_MAX                 ((uint_fast8_t)(F_INTERRUPTS * SPEAKER_0_PAUSE_TIME * MAX_TOLERANCE_20 + 0.5) + 1)
-
-#define BANG_OLUFSEN_START_BIT1_PULSE_LEN_MIN   ((uint_fast8_t)(F_INTERRUPTS * BANG_OLUFSEN_START_BIT1_PULSE_TIME * MIN_TOLERANCE_10 + 0.5) - 1)
-#define BANG_OLUFSEN_START_BIT1_PULSE_LEN_MAX   ((uint_fast8_t)(F_INTERRUPTS * BANG_OLUFSEN_START_BIT1_PULSE_TIME * MAX_TOLERANCE_10 + 0.5) + 1)
-#define BANG_OLUFSEN_START_BIT1_PAUSE_LEN_MIN   ((uint_fast8_t)(F_INTERRUPTS * BANG_OLUFSEN_START_BIT1_PAUSE_TIME * MIN_TOLERANCE_10 + 0.5) - 1)
-#define BANG_OLUFSEN_START_BIT1_PAUSE_LEN_MAX   ((uint_fast8_t)(F_INTERRUPTS * BANG_OLUFSEN_START_BIT1_PAUSE_TIME * MAX_TOLERANCE_10 + 0.5) + 1)
-#define BANG_OLUFSEN_START_BIT2_PULSE_LEN_MIN   ((uint_fast8_t)(F_INTERRUPTS * BANG_OLUFSEN_START_BIT2_PULSE_TIME * MIN_TOLERANCE_10 + 0.5) - 1)
-#define BANG_OLUFSEN_START_BIT2_PULSE_LEN_MAX   ((uint_fast8_t)(F_INTERRUPTS * BANG_OLUFSEN_START_BIT2_PULSE_TIME * MAX_TOLERANCE_10 + 0.5) + 1)
-#define BANG_OLUFSEN_START_BIT2_PAUSE_LEN_MIN   ((uint_fast8_t)(F_INTERRUPTS * BANG_OLUFSEN_START_BIT2_PAUSE_TIME * MIN_TOLERANCE_10 + 0.5) - 1)
-#define BANG_OLUFSEN_START_BIT2_PAUSE_LEN_MAX   ((uint_fast8_t)(F_INTERRUPTS * BANG_OLUFSEN_START_BIT2_PAUSE_TIME * MAX_TOLERANCE_10 + 0.5) + 1)
-#define BANG_OLUFSEN_START_BIT3_PULSE_LEN_MIN   ((uint_fast8_t)(F_INTERRUPTS * BANG_OLUFSEN_START_BIT3_PULSE_TIME * MIN_TOLERANCE_10 + 0.5) - 1)
-#define BANG_OLUFSEN_START_BIT3_PULSE_LEN_MAX   ((uint_fast8_t)(F_INTERRUPTS * BANG_OLUFSEN_START_BIT3_PULSE_TIME * MAX_TOLERANCE_10 + 0.5) + 1)
-#define BANG_OLUFSEN_START_BIT3_PAUSE_LEN_MIN   ((uint_fast8_t)(F_INTERRUPTS * BANG_OLUFSEN_START_BIT3_PAUSE_TIME * MIN_TOLERANCE_10 + 0.5) - 1)
+#define THOMSON_PULSE_LEN_MIN                   ((IRMP_TICK8_T)(F_INTERRUPTS * THOMSON_PULSE_TIME * MIN_TOLERANCE_10 + 0.5) - 1)
+#define THOMSON_PULSE_LEN_MAX                   ((IRMP_TICK8_T)(F_INTERRUPTS * THOMSON_PULSE_TIME * MAX_TOLERANCE_20 + 0.5) + 1)
+#define THOMSON_1_PAUSE_LEN_MIN                 ((IRMP_TICK8_T)(F_INTERRUPTS * THOMSON_1_PAUSE_TIME * MIN_TOLERANCE_10 + 0.5) - 1)
+#define THOMSON_1_PAUSE_LEN_MAX                 ((IRMP_TICK8_T)(F_INTERRUPTS * THOMSON_1_PAUSE_TIME * MAX_TOLERANCE_10 + 0.5) + 1)
+#define THOMSON_0_PAUSE_LEN_MIN                 ((IRMP_TICK8_T)(F_INTERRUPTS * THOMSON_0_PAUSE_TIME * MIN_TOLERANCE_30 + 0.5) - 1)
+#define THOMSON_0_PAUSE_LEN_MAX                 ((IRMP_TICK8_T)(F_INTERRUPTS * THOMSON_0_PAUSE_TIME * MAX_TOLERANCE_10 + 0.5) + 1)
+
+#define RC6_START_BIT_PULSE_LEN_MIN             ((IRMP_TICK8_T)(F_INTERRUPTS * RC6_START_BIT_PULSE_TIME * MIN_TOLERANCE_10 + 0.5) - 1)
+#define RC6_START_BIT_PULSE_LEN_MAX             ((IRMP_TICK8_T)(F_INTERRUPTS * RC6_START_BIT_PULSE_TIME * MAX_TOLERANCE_10 + 0.5) + 1)
+#define RC6_START_BIT_PAUSE_LEN_MIN             ((IRMP_TICK8_T)(F_INTERRUPTS * RC6_START_BIT_PAUSE_TIME * MIN_TOLERANCE_10 + 0.5) - 1)
+#define RC6_START_BIT_PAUSE_LEN_MAX             ((IRMP_TICK8_T)(F_INTERRUPTS * RC6_START_BIT_PAUSE_TIME * MAX_TOLERANCE_10 + 0.5) + 1)
+#define RC6_TOGGLE_BIT_LEN_MIN                  ((IRMP_TICK8_T)(F_INTERRUPTS * RC6_TOGGLE_BIT_TIME * MIN_TOLERANCE_10 + 0.5) - 1)
+#define RC6_TOGGLE_BIT_LEN_MAX                  ((IRMP_TICK8_T)(F_INTERRUPTS * RC6_TOGGLE_BIT_TIME * MAX_TOLERANCE_10 + 0.5) + 1)
+#define RC6_BIT_PULSE_LEN_MIN                   ((IRMP_TICK8_T)(F_INTERRUPTS * RC6_BIT_TIME * MIN_TOLERANCE_10 + 0.5) - 1)
+#define RC6_BIT_PULSE_LEN_MAX                   ((IRMP_TICK8_T)(F_INTERRUPTS * RC6_BIT_TIME * MAX_TOLERANCE_60 + 0.5) + 1)       // pulses: 300 - 800
+#define RC6_BIT_PAUSE_LEN_MIN                   ((IRMP_TICK8_T)(F_INTERRUPTS * RC6_BIT_TIME * MIN_TOLERANCE_10 + 0.5) - 1)
+#define RC6_BIT_PAUSE_LEN_MAX                   ((IRMP_TICK8_T)(F_INTERRUPTS * RC6_BIT_TIME * MAX_TOLERANCE_20 + 0.5) + 1)       // pauses: 300 - 600
+
+#define RECS80EXT_START_BIT_PULSE_LEN_MIN       ((IRMP_TICK8_T)(F_INTERRUPTS * RECS80EXT_START_BIT_PULSE_TIME * MIN_TOLERANCE_20 + 0.5) - 1)
+#define RECS80EXT_START_BIT_PULSE_LEN_MAX       ((IRMP_TICK8_T)(F_INTERRUPTS * RECS80EXT_START_BIT_PULSE_TIME * MAX_TOLERANCE_20 + 0.5) + 1)
+#define RECS80EXT_START_BIT_PAUSE_LEN_MIN       ((IRMP_TICK8_T)(F_INTERRUPTS * RECS80EXT_START_BIT_PAUSE_TIME * MIN_TOLERANCE_10 + 0.5) - 1)
+#define RECS80EXT_START_BIT_PAUSE_LEN_MAX       ((IRMP_TICK8_T)(F_INTERRUPTS * RECS80EXT_START_BIT_PAUSE_TIME * MAX_TOLERANCE_10 + 0.5) + 1)
+#define RECS80EXT_PULSE_LEN_MIN                 ((IRMP_TICK8_T)(F_INTERRUPTS * RECS80EXT_PULSE_TIME * MIN_TOLERANCE_20 + 0.5) - 1)
+#define RECS80EXT_PULSE_LEN_MAX                 ((IRMP_TICK8_T)(F_INTERRUPTS * RECS80EXT_PULSE_TIME * MAX_TOLERANCE_20 + 0.5) + 1)
+#define RECS80EXT_1_PAUSE_LEN_MIN               ((IRMP_TICK8_T)(F_INTERRUPTS * RECS80EXT_1_PAUSE_TIME * MIN_TOLERANCE_10 + 0.5) - 1)
+#define RECS80EXT_1_PAUSE_LEN_MAX               ((IRMP_TICK8_T)(F_INTERRUPTS * RECS80EXT_1_PAUSE_TIME * MAX_TOLERANCE_10 + 0.5) + 1)
+#define RECS80EXT_0_PAUSE_LEN_MIN               ((IRMP_TICK8_T)(F_INTERRUPTS * RECS80EXT_0_PAUSE_TIME * MIN_TOLERANCE_10 + 0.5) - 1)
+#define RECS80EXT_0_PAUSE_LEN_MAX               ((IRMP_TICK8_T)(F_INTERRUPTS * RECS80EXT_0_PAUSE_TIME * MAX_TOLERANCE_10 + 0.5) + 1)
+
+#define NUBERT_START_BIT_PULSE_LEN_MIN          ((IRMP_TICK8_T)(F_INTERRUPTS * NUBERT_START_BIT_PULSE_TIME * MIN_TOLERANCE_20 + 0.5) - 1)
+#define NUBERT_START_BIT_PULSE_LEN_MAX          ((IRMP_TICK8_T)(F_INTERRUPTS * NUBERT_START_BIT_PULSE_TIME * MAX_TOLERANCE_20 + 0.5) + 1)
+#define NUBERT_START_BIT_PAUSE_LEN_MIN          ((IRMP_TICK8_T)(F_INTERRUPTS * NUBERT_START_BIT_PAUSE_TIME * MIN_TOLERANCE_20 + 0.5) - 1)
+#define NUBERT_START_BIT_PAUSE_LEN_MAX          ((IRMP_TICK8_T)(F_INTERRUPTS * NUBERT_START_BIT_PAUSE_TIME * MAX_TOLERANCE_20 + 0.5) + 1)
+#define NUBERT_1_PULSE_LEN_MIN                  ((IRMP_TICK8_T)(F_INTERRUPTS * NUBERT_1_PULSE_TIME * MIN_TOLERANCE_20 + 0.5) - 1)
+#define NUBERT_1_PULSE_LEN_MAX                  ((IRMP_TICK8_T)(F_INTERRUPTS * NUBERT_1_PULSE_TIME * MAX_TOLERANCE_20 + 0.5) + 1)
+#define NUBERT_1_PAUSE_LEN_MIN                  ((IRMP_TICK8_T)(F_INTERRUPTS * NUBERT_1_PAUSE_TIME * MIN_TOLERANCE_20 + 0.5) - 1)
+#define NUBERT_1_PAUSE_LEN_MAX                  ((IRMP_TICK8_T)(F_INTERRUPTS * NUBERT_1_PAUSE_TIME * MAX_TOLERANCE_20 + 0.5) + 1)
+#define NUBERT_0_PULSE_LEN_MIN                  ((IRMP_TICK8_T)(F_INTERRUPTS * NUBERT_0_PULSE_TIME * MIN_TOLERANCE_20 + 0.5) - 1)
+#define NUBERT_0_PULSE_LEN_MAX                  ((IRMP_TICK8_T)(F_INTERRUPTS * NUBERT_0_PULSE_TIME * MAX_TOLERANCE_20 + 0.5) + 1)
+#define NUBERT_0_PAUSE_LEN_MIN                  ((IRMP_TICK8_T)(F_INTERRUPTS * NUBERT_0_PAUSE_TIME * MIN_TOLERANCE_20 + 0.5) - 1)
+#define NUBERT_0_PAUSE_LEN_MAX                  ((IRMP_TICK8_T)(F_INTERRUPTS * NUBERT_0_PAUSE_TIME * MAX_TOLERANCE_20 + 0.5) + 1)
+
+#define FAN_START_BIT_PULSE_LEN_MIN             ((IRMP_TICK8_T)(F_INTERRUPTS * FAN_START_BIT_PULSE_TIME * MIN_TOLERANCE_20 + 0.5) - 1)
+#define FAN_START_BIT_PULSE_LEN_MAX             ((IRMP_TICK8_T)(F_INTERRUPTS * FAN_START_BIT_PULSE_TIME * MAX_TOLERANCE_20 + 0.5) + 1)
+#define FAN_START_BIT_PAUSE_LEN_MIN             ((IRMP_TICK8_T)(F_INTERRUPTS * FAN_START_BIT_PAUSE_TIME * MIN_TOLERANCE_20 + 0.5) - 1)
+#define FAN_START_BIT_PAUSE_LEN_MAX             ((IRMP_TICK8_T)(F_INTERRUPTS * FAN_START_BIT_PAUSE_TIME * MAX_TOLERANCE_20 + 0.5) + 1)
+#define FAN_1_PULSE_LEN_MIN                     ((IRMP_TICK8_T)(F_INTERRUPTS * FAN_1_PULSE_TIME * MIN_TOLERANCE_20 + 0.5) - 1)
+#define FAN_1_PULSE_LEN_MAX                     ((IRMP_TICK8_T)(F_INTERRUPTS * FAN_1_PULSE_TIME * MAX_TOLERANCE_20 + 0.5) + 1)
+#define FAN_1_PAUSE_LEN_MIN                     ((IRMP_TICK8_T)(F_INTERRUPTS * FAN_1_PAUSE_TIME * MIN_TOLERANCE_20 + 0.5) - 1)
+#define FAN_1_PAUSE_LEN_MAX                     ((IRMP_TICK8_T)(F_INTERRUPTS * FAN_1_PAUSE_TIME * MAX_TOLERANCE_20 + 0.5) + 1)
+#define FAN_0_PULSE_LEN_MIN                     ((IRMP_TICK8_T)(F_INTERRUPTS * FAN_0_PULSE_TIME * MIN_TOLERANCE_20 + 0.5) - 1)
+#define FAN_0_PULSE_LEN_MAX                     ((IRMP_TICK8_T)(F_INTERRUPTS * FAN_0_PULSE_TIME * MAX_TOLERANCE_20 + 0.5) + 1)
+#define FAN_0_PAUSE_LEN_MIN                     ((IRMP_TICK8_T)(F_INTERRUPTS * FAN_0_PAUSE_TIME * MIN_TOLERANCE_20 + 0.5) - 1)
+#define FAN_0_PAUSE_LEN_MAX                     ((IRMP_TICK8_T)(F_INTERRUPTS * FAN_0_PAUSE_TIME * MAX_TOLERANCE_20 + 0.5) + 1)
+
+#define SPEAKER_START_BIT_PULSE_LEN_MIN         ((IRMP_TICK8_T)(F_INTERRUPTS * SPEAKER_START_BIT_PULSE_TIME * MIN_TOLERANCE_20 + 0.5) - 1)
+#define SPEAKER_START_BIT_PULSE_LEN_MAX         ((IRMP_TICK8_T)(F_INTERRUPTS * SPEAKER_START_BIT_PULSE_TIME * MAX_TOLERANCE_20 + 0.5) + 1)
+#define SPEAKER_START_BIT_PAUSE_LEN_MIN         ((IRMP_TICK8_T)(F_INTERRUPTS * SPEAKER_START_BIT_PAUSE_TIME * MIN_TOLERANCE_20 + 0.5) - 1)
+#define SPEAKER_START_BIT_PAUSE_LEN_MAX         ((IRMP_TICK8_T)(F_INTERRUPTS * SPEAKER_START_BIT_PAUSE_TIME * MAX_TOLERANCE_20 + 0.5) + 1)
+#define SPEAKER_1_PULSE_LEN_MIN                 ((IRMP_TICK8_T)(F_INTERRUPTS * SPEAKER_1_PULSE_TIME * MIN_TOLERANCE_20 + 0.5) - 1)
+#define SPEAKER_1_PULSE_LEN_MAX                 ((IRMP_TICK8_T)(F_INTERRUPTS * SPEAKER_1_PULSE_TIME * MAX_TOLERANCE_20 + 0.5) + 1)
+#define SPEAKER_1_PAUSE_LEN_MIN                 ((IRMP_TICK8_T)(F_INTERRUPTS * SPEAKER_1_PAUSE_TIME * MIN_TOLERANCE_20 + 0.5) - 1)
+#define SPEAKER_1_PAUSE_LEN_MAX                 ((IRMP_TICK8_T)(F_INTERRUPTS * SPEAKER_1_PAUSE_TIME * MAX_TOLERANCE_20 + 0.5) + 1)
+#define SPEAKER_0_PULSE_LEN_MIN                 ((IRMP_TICK8_T)(F_INTERRUPTS * SPEAKER_0_PULSE_TIME * MIN_TOLERANCE_20 + 0.5) - 1)
+#define SPEAKER_0_PULSE_LEN_MAX                 ((IRMP_TICK8_T)(F_INTERRUPTS * SPEAKER_0_PULSE_TIME * MAX_TOLERANCE_20 + 0.5) + 1)
+#define SPEAKER_0_PAUSE_LEN_MIN                 ((IRMP_TICK8_T)(F_INTERRUPTS * SPEAKER_0_PAUSE_TIME * MIN_TOLERANCE_20 + 0.5) - 1)
+#define SPEAKER_0_PAUSE_LEN_MAX                 ((IRMP_TICK8_T)(F_INTERRUPTS * SPEAKER_0_PAUSE_TIME * MAX_TOLERANCE_20 + 0.5) + 1)
+
+#define BANG_OLUFSEN_START_BIT1_PULSE_LEN_MIN   ((IRMP_TICK8_T)(F_INTERRUPTS * BANG_OLUFSEN_START_BIT1_PULSE_TIME * MIN_TOLERANCE_10 + 0.5) - 1)
+#define BANG_OLUFSEN_START_BIT1_PULSE_LEN_MAX   ((IRMP_TICK8_T)(F_INTERRUPTS * BANG_OLUFSEN_START_BIT1_PULSE_TIME * MAX_TOLERANCE_10 + 0.5) + 1)
+#define BANG_OLUFSEN_START_BIT1_PAUSE_LEN_MIN   ((IRMP_TICK8_T)(F_INTERRUPTS * BANG_OLUFSEN_START_BIT1_PAUSE_TIME * MIN_TOLERANCE_10 + 0.5) - 1)
+#define BANG_OLUFSEN_START_BIT1_PAUSE_LEN_MAX   ((IRMP_TICK8_T)(F_INTERRUPTS * BANG_OLUFSEN_START_BIT1_PAUSE_TIME * MAX_TOLERANCE_10 + 0.5) + 1)
+#define BANG_OLUFSEN_START_BIT2_PULSE_LEN_MIN   ((IRMP_TICK8_T)(F_INTERRUPTS * BANG_OLUFSEN_START_BIT2_PULSE_TIME * MIN_TOLERANCE_10 + 0.5) - 1)
+#define BANG_OLUFSEN_START_BIT2_PULSE_LEN_MAX   ((IRMP_TICK8_T)(F_INTERRUPTS * BANG_OLUFSEN_START_BIT2_PULSE_TIME * MAX_TOLERANCE_10 + 0.5) + 1)
+#define BANG_OLUFSEN_START_BIT2_PAUSE_LEN_MIN   ((IRMP_TICK8_T)(F_INTERRUPTS * BANG_OLUFSEN_START_BIT2_PAUSE_TIME * MIN_TOLERANCE_10 + 0.5) - 1)
+#define BANG_OLUFSEN_START_BIT2_PAUSE_LEN_MAX   ((IRMP_TICK8_T)(F_INTERRUPTS * BANG_OLUFSEN_START_BIT2_PAUSE_TIME * MAX_TOLERANCE_10 + 0.5) + 1)
+#define BANG_OLUFSEN_START_BIT3_PULSE_LEN_MIN   ((IRMP_TICK8_T)(F_INTERRUPTS * BANG_OLUFSEN_START_BIT3_PULSE_TIME * MIN_TOLERANCE_10 + 0.5) - 1)
+#define BANG_OLUFSEN_START_BIT3_PULSE_LEN_MAX   ((IRMP_TICK8_T)(F_INTERRUPTS * BANG_OLUFSEN_START_BIT3_PULSE_TIME * MAX_TOLERANCE_10 + 0.5) + 1)
+#define BANG_OLUFSEN_START_BIT3_PAUSE_LEN_MIN   ((IRMP_TICK8_T)(F_INTERRUPTS * BANG_OLUFSEN_START_BIT3_PAUSE_TIME * MIN_TOLERANCE_10 + 0.5) - 1)
 #define BANG_OLUFSEN_START_BIT3_PAUSE_LEN_MAX   ((PAUSE_LEN)(F_INTERRUPTS * BANG_OLUFSEN_START_BIT3_PAUSE_TIME * MAX_TOLERANCE_05 + 0.5) + 1) // value must be below IRMP_TIMEOUT
-#define BANG_OLUFSEN_START_BIT4_PULSE_LEN_MIN   ((uint_fast8_t)(F_INTERRUPTS * BANG_OLUFSEN_START_BIT4_PULSE_TIME * MIN_TOLERANCE_10 + 0.5) - 1)
-#define BANG_OLUFSEN_START_BIT4_PULSE_LEN_MAX   ((uint_fast8_t)(F_INTERRUPTS * BANG_OLUFSEN_START_BIT4_PULSE_TIME * MAX_TOLERANCE_10 + 0.5) + 1)
-#define BANG_OLUFSEN_START_BIT4_PAUSE_LEN_MIN   ((uint_fast8_t)(F_INTERRUPTS * BANG_OLUFSEN_START_BIT4_PAUSE_TIME * MIN_TOLERANCE_10 + 0.5) - 1)
-#define BANG_OLUFSEN_START_BIT4_PAUSE_LEN_MAX   ((uint_fast8_t)(F_INTERRUPTS * BANG_OLUFSEN_START_BIT4_PAUSE_TIME * MAX_TOLERANCE_10 + 0.5) + 1)
-#define BANG_OLUFSEN_PULSE_LEN_MIN              ((uint_fast8_t)(F_INTERRUPTS * BANG_OLUFSEN_PULSE_TIME * MIN_TOLERANCE_10 + 0.5) - 1)
-#define BANG_OLUFSEN_PULSE_LEN_MAX              ((uint_fast8_t)(F_INTERRUPTS * BANG_OLUFSEN_PULSE_TIME * MAX_TOLERANCE_10 + 0.5) + 1)
-#define BANG_OLUFSEN_1_PAUSE_LEN_MIN            ((uint_fast8_t)(F_INTERRUPTS * BANG_OLUFSEN_1_PAUSE_TIME * MIN_TOLERANCE_10 + 0.5) - 1)
-#define BANG_OLUFSEN_1_PAUSE_LEN_MAX            ((uint_fast8_t)(F_INTERRUPTS * BANG_OLUFSEN_1_PAUSE_TIME * MAX_TOLERANCE_10 + 0.5) + 1)
-#define BANG_OLUFSEN_0_PAUSE_LEN_MIN            ((uint_fast8_t)(F_INTERRUPTS * BANG_OLUFSEN_0_PAUSE_TIME * MIN_TOLERANCE_10 + 0.5) - 1)
-#define BANG_OLUFSEN_0_PAUSE_LEN_MAX            ((uint_fast8_t)(F_INTERRUPTS * BANG_OLUFSEN_0_PAUSE_TIME * MAX_TOLERANCE_10 + 0.5) + 1)
-#define BANG_OLUFSEN_R_PAUSE_LEN_MIN            ((uint_fast8_t)(F_INTERRUPTS * BANG_OLUFSEN_R_PAUSE_TIME * MIN_TOLERANCE_10 + 0.5) - 1)
-#define BANG_OLUFSEN_R_PAUSE_LEN_MAX            ((uint_fast8_t)(F_INTERRUPTS * BANG_OLUFSEN_R_PAUSE_TIME * MAX_TOLERANCE_10 + 0.5) + 1)
-#define BANG_OLUFSEN_TRAILER_BIT_PAUSE_LEN_MIN  ((uint_fast8_t)(F_INTERRUPTS * BANG_OLUFSEN_TRAILER_BIT_PAUSE_TIME * MIN_TOLERANCE_10 + 0.5) - 1)
-#define BANG_OLUFSEN_TRAILER_BIT_PAUSE_LEN_MAX  ((uint_fast8_t)(F_INTERRUPTS * BANG_OLUFSEN_TRAILER_BIT_PAUSE_TIME * MAX_TOLERANCE_10 + 0.5) + 1)
-
-#define IR60_TIMEOUT_LEN                        ((uint_fast8_t)(F_INTERRUPTS * IR60_TIMEOUT_TIME * 0.5))
-#define GRUNDIG_NOKIA_IR60_START_BIT_LEN_MIN    ((uint_fast8_t)(F_INTERRUPTS * GRUNDIG_NOKIA_IR60_BIT_TIME * MIN_TOLERANCE_10 + 0.5) - 1)
-#define GRUNDIG_NOKIA_IR60_START_BIT_LEN_MAX    ((uint_fast8_t)(F_INTERRUPTS * GRUNDIG_NOKIA_IR60_BIT_TIME * MAX_TOLERANCE_10 + 0.5) + 1)
-#define GRUNDIG_NOKIA_IR60_BIT_LEN_MIN          ((uint_fast8_t)(F_INTERRUPTS * GRUNDIG_NOKIA_IR60_BIT_TIME * MIN_TOLERANCE_10 + 0.5) - 1)
-#define GRUNDIG_NOKIA_IR60_BIT_LEN_MAX          ((uint_fast8_t)(F_INTERRUPTS * GRUNDIG_NOKIA_IR60_BIT_TIME * MAX_TOLERANCE_10 + 0.5) + 1)
-#define GRUNDIG_NOKIA_IR60_PRE_PAUSE_LEN_MIN    ((uint_fast8_t)(F_INTERRUPTS * GRUNDIG_NOKIA_IR60_PRE_PAUSE_TIME * MIN_TOLERANCE_20 + 0.5) + 1)
-#define GRUNDIG_NOKIA_IR60_PRE_PAUSE_LEN_MAX    ((uint_fast8_t)(F_INTERRUPTS * GRUNDIG_NOKIA_IR60_PRE_PAUSE_TIME * MAX_TOLERANCE_20 + 0.5) + 1)
-
-#define SIEMENS_OR_RUWIDO_START_BIT_PULSE_LEN_MIN       ((uint_fast8_t)(F_INTERRUPTS * SIEMENS_OR_RUWIDO_START_BIT_PULSE_TIME * MIN_TOLERANCE_00 + 0.5) - 0)
-#define SIEMENS_OR_RUWIDO_START_BIT_PULSE_LEN_MAX       ((uint_fast8_t)(F_INTERRUPTS * SIEMENS_OR_RUWIDO_START_BIT_PULSE_TIME * MAX_TOLERANCE_10 + 0.5) + 1)
-#define SIEMENS_OR_RUWIDO_START_BIT_PAUSE_LEN_MIN       ((uint_fast8_t)(F_INTERRUPTS * SIEMENS_OR_RUWIDO_START_BIT_PAUSE_TIME * MIN_TOLERANCE_00 + 0.5) - 1)
-#define SIEMENS_OR_RUWIDO_START_BIT_PAUSE_LEN_MAX       ((uint_fast8_t)(F_INTERRUPTS * SIEMENS_OR_RUWIDO_START_BIT_PAUSE_TIME * MAX_TOLERANCE_10 + 0.5) + 1)
-#define SIEMENS_OR_RUWIDO_BIT_PULSE_LEN_MIN             ((uint_fast8_t)(F_INTERRUPTS * SIEMENS_OR_RUWIDO_BIT_PULSE_TIME * MIN_TOLERANCE_00 + 0.5) - 1)
-#define SIEMENS_OR_RUWIDO_BIT_PULSE_LEN_MAX             ((uint_fast8_t)(F_INTERRUPTS * SIEMENS_OR_RUWIDO_BIT_PULSE_TIME * MAX_TOLERANCE_10 + 0.5) + 1)
-#define SIEMENS_OR_RUWIDO_BIT_PAUSE_LEN_MIN             ((uint_fast8_t)(F_INTERRUPTS * SIEMENS_OR_RUWIDO_BIT_PAUSE_TIME * MIN_TOLERANCE_00 + 0.5) - 1)
-#define SIEMENS_OR_RUWIDO_BIT_PAUSE_LEN_MAX             ((uint_fast8_t)(F_INTERRUPTS * SIEMENS_OR_RUWIDO_BIT_PAUSE_TIME * MAX_TOLERANCE_10 + 0.5) + 1)
-
-#define FDC_START_BIT_PULSE_LEN_MIN             ((uint_fast8_t)(F_INTERRUPTS * FDC_START_BIT_PULSE_TIME * MIN_TOLERANCE_05 + 0.5) - 1)   // 5%: avoid conflict with NETBOX
-#define FDC_START_BIT_PULSE_LEN_MAX             ((uint_fast8_t)(F_INTERRUPTS * FDC_START_BIT_PULSE_TIME * MAX_TOLERANCE_05 + 0.5))
-#define FDC_START_BIT_PAUSE_LEN_MIN             ((uint_fast8_t)(F_INTERRUPTS * FDC_START_BIT_PAUSE_TIME * MIN_TOLERANCE_05 + 0.5) - 1)
-#define FDC_START_BIT_PAUSE_LEN_MAX             ((uint_fast8_t)(F_INTERRUPTS * FDC_START_BIT_PAUSE_TIME * MAX_TOLERANCE_05 + 0.5))
-#define FDC_PULSE_LEN_MIN                       ((uint_fast8_t)(F_INTERRUPTS * FDC_PULSE_TIME * MIN_TOLERANCE_40 + 0.5) - 1)
-#define FDC_PULSE_LEN_MAX                       ((uint_fast8_t)(F_INTERRUPTS * FDC_PULSE_TIME * MAX_TOLERANCE_50 + 0.5) + 1)
-#define FDC_1_PAUSE_LEN_MIN                     ((uint_fast8_t)(F_INTERRUPTS * FDC_1_PAUSE_TIME * MIN_TOLERANCE_20 + 0.5) - 1)
-#define FDC_1_PAUSE_LEN_MAX                     ((uint_fast8_t)(F_INTERRUPTS * FDC_1_PAUSE_TIME * MAX_TOLERANCE_20 + 0.5) + 1)
+#define BANG_OLUFSEN_START_BIT4_PULSE_LEN_MIN   ((IRMP_TICK8_T)(F_INTERRUPTS * BANG_OLUFSEN_START_BIT4_PULSE_TIME * MIN_TOLERANCE_10 + 0.5) - 1)
+#define BANG_OLUFSEN_START_BIT4_PULSE_LEN_MAX   ((IRMP_TICK8_T)(F_INTERRUPTS * BANG_OLUFSEN_START_BIT4_PULSE_TIME * MAX_TOLERANCE_10 + 0.5) + 1)
+#define BANG_OLUFSEN_START_BIT4_PAUSE_LEN_MIN   ((IRMP_TICK8_T)(F_INTERRUPTS * BANG_OLUFSEN_START_BIT4_PAUSE_TIME * MIN_TOLERANCE_10 + 0.5) - 1)
+#define BANG_OLUFSEN_START_BIT4_PAUSE_LEN_MAX   ((IRMP_TICK8_T)(F_INTERRUPTS * BANG_OLUFSEN_START_BIT4_PAUSE_TIME * MAX_TOLERANCE_10 + 0.5) + 1)
+#define BANG_OLUFSEN_PULSE_LEN_MIN              ((IRMP_TICK8_T)(F_INTERRUPTS * BANG_OLUFSEN_PULSE_TIME * MIN_TOLERANCE_10 + 0.5) - 1)
+#define BANG_OLUFSEN_PULSE_LEN_MAX              ((IRMP_TICK8_T)(F_INTERRUPTS * BANG_OLUFSEN_PULSE_TIME * MAX_TOLERANCE_10 + 0.5) + 1)
+#define BANG_OLUFSEN_1_PAUSE_LEN_MIN            ((IRMP_TICK8_T)(F_INTERRUPTS * BANG_OLUFSEN_1_PAUSE_TIME * MIN_TOLERANCE_10 + 0.5) - 1)
+#define BANG_OLUFSEN_1_PAUSE_LEN_MAX            ((IRMP_TICK8_T)(F_INTERRUPTS * BANG_OLUFSEN_1_PAUSE_TIME * MAX_TOLERANCE_10 + 0.5) + 1)
+#define BANG_OLUFSEN_0_PAUSE_LEN_MIN            ((IRMP_TICK8_T)(F_INTERRUPTS * BANG_OLUFSEN_0_PAUSE_TIME * MIN_TOLERANCE_10 + 0.5) - 1)
+#define BANG_OLUFSEN_0_PAUSE_LEN_MAX            ((IRMP_TICK8_T)(F_INTERRUPTS * BANG_OLUFSEN_0_PAUSE_TIME * MAX_TOLERANCE_10 + 0.5) + 1)
+#define BANG_OLUFSEN_R_PAUSE_LEN_MIN            ((IRMP_TICK8_T)(F_INTERRUPTS * BANG_OLUFSEN_R_PAUSE_TIME * MIN_TOLERANCE_10 + 0.5) - 1)
+#define BANG_OLUFSEN_R_PAUSE_LEN_MAX            ((IRMP_TICK8_T)(F_INTERRUPTS * BANG_OLUFSEN_R_PAUSE_TIME * MAX_TOLERANCE_10 + 0.5) + 1)
+#define BANG_OLUFSEN_TRAILER_BIT_PAUSE_LEN_MIN  ((IRMP_TICK8_T)(F_INTERRUPTS * BANG_OLUFSEN_TRAILER_BIT_PAUSE_TIME * MIN_TOLERANCE_10 + 0.5) - 1)
+#define BANG_OLUFSEN_TRAILER_BIT_PAUSE_LEN_MAX  ((IRMP_TICK8_T)(F_INTERRUPTS * BANG_OLUFSEN_TRAILER_BIT_PAUSE_TIME * MAX_TOLERANCE_10 + 0.5) + 1)
+
+#define IR60_TIMEOUT_LEN                        ((IRMP_TICK8_T)(F_INTERRUPTS * IR60_TIMEOUT_TIME * 0.5))
+#define GRUNDIG_NOKIA_IR60_START_BIT_LEN_MIN    ((IRMP_TICK8_T)(F_INTERRUPTS * GRUNDIG_NOKIA_IR60_BIT_TIME * MIN_TOLERANCE_10 + 0.5) - 1)
+#define GRUNDIG_NOKIA_IR60_START_BIT_LEN_MAX    ((IRMP_TICK8_T)(F_INTERRUPTS * GRUNDIG_NOKIA_IR60_BIT_TIME * MAX_TOLERANCE_10 + 0.5) + 1)
+#define GRUNDIG_NOKIA_IR60_BIT_LEN_MIN          ((IRMP_TICK8_T)(F_INTERRUPTS * GRUNDIG_NOKIA_IR60_BIT_TIME * MIN_TOLERANCE_10 + 0.5) - 1)
+#define GRUNDIG_NOKIA_IR60_BIT_LEN_MAX          ((IRMP_TICK8_T)(F_INTERRUPTS * GRUNDIG_NOKIA_IR60_BIT_TIME * MAX_TOLERANCE_10 + 0.5) + 1)
+#define GRUNDIG_NOKIA_IR60_PRE_PAUSE_LEN_MIN    ((IRMP_TICK8_T)(F_INTERRUPTS * GRUNDIG_NOKIA_IR60_PRE_PAUSE_TIME * MIN_TOLERANCE_20 + 0.5) + 1)
+#define GRUNDIG_NOKIA_IR60_PRE_PAUSE_LEN_MAX    ((IRMP_TICK8_T)(F_INTERRUPTS * GRUNDIG_NOKIA_IR60_PRE_PAUSE_TIME * MAX_TOLERANCE_20 + 0.5) + 1)
+
+#define SIEMENS_OR_RUWIDO_START_BIT_PULSE_LEN_MIN       ((IRMP_TICK8_T)(F_INTERRUPTS * SIEMENS_OR_RUWIDO_START_BIT_PULSE_TIME * MIN_TOLERANCE_00 + 0.5) - 0)
+#define SIEMENS_OR_RUWIDO_START_BIT_PULSE_LEN_MAX       ((IRMP_TICK8_T)(F_INTERRUPTS * SIEMENS_OR_RUWIDO_START_BIT_PULSE_TIME * MAX_TOLERANCE_10 + 0.5) + 1)
+#define SIEMENS_OR_RUWIDO_START_BIT_PAUSE_LEN_MIN       ((IRMP_TICK8_T)(F_INTERRUPTS * SIEMENS_OR_RUWIDO_START_BIT_PAUSE_TIME * MIN_TOLERANCE_00 + 0.5) - 1)
+#define SIEMENS_OR_RUWIDO_START_BIT_PAUSE_LEN_MAX       ((IRMP_TICK8_T)(F_INTERRUPTS * SIEMENS_OR_RUWIDO_START_BIT_PAUSE_TIME * MAX_TOLERANCE_10 + 0.5) + 1)
+#define SIEMENS_OR_RUWIDO_BIT_PULSE_LEN_MIN             ((IRMP_TICK8_T)(F_INTERRUPTS * SIEMENS_OR_RUWIDO_BIT_PULSE_TIME * MIN_TOLERANCE_00 + 0.5) - 1)
+#define SIEMENS_OR_RUWIDO_BIT_PULSE_LEN_MAX             ((IRMP_TICK8_T)(F_INTERRUPTS * SIEMENS_OR_RUWIDO_BIT_PULSE_TIME * MAX_TOLERANCE_10 + 0.5) + 1)
+#define SIEMENS_OR_RUWIDO_BIT_PAUSE_LEN_MIN             ((IRMP_TICK8_T)(F_INTERRUPTS * SIEMENS_OR_RUWIDO_BIT_PAUSE_TIME * MIN_TOLERANCE_00 + 0.5) - 1)
+#define SIEMENS_OR_RUWIDO_BIT_PAUSE_LEN_MAX             ((IRMP_TICK8_T)(F_INTERRUPTS * SIEMENS_OR_RUWIDO_BIT_PAUSE_TIME * MAX_TOLERANCE_10 + 0.5) + 1)
+
+#define FDC_START_BIT_PULSE_LEN_MIN             ((IRMP_TICK8_T)(F_INTERRUPTS * FDC_START_BIT_PULSE_TIME * MIN_TOLERANCE_05 + 0.5) - 1)   // 5%: avoid conflict with NETBOX
+#define FDC_START_BIT_PULSE_LEN_MAX             ((IRMP_TICK8_T)(F_INTERRUPTS * FDC_START_BIT_PULSE_TIME * MAX_TOLERANCE_05 + 0.5))
+#define FDC_START_BIT_PAUSE_LEN_MIN             ((IRMP_TICK8_T)(F_INTERRUPTS * FDC_START_BIT_PAUSE_TIME * MIN_TOLERANCE_05 + 0.5) - 1)
+#define FDC_START_BIT_PAUSE_LEN_MAX             ((IRMP_TICK8_T)(F_INTERRUPTS * FDC_START_BIT_PAUSE_TIME * MAX_TOLERANCE_05 + 0.5))
+#define FDC_PULSE_LEN_MIN                       ((IRMP_TICK8_T)(F_INTERRUPTS * FDC_PULSE_TIME * MIN_TOLERANCE_40 + 0.5) - 1)
+#define FDC_PULSE_LEN_MAX                       ((IRMP_TICK8_T)(F_INTERRUPTS * FDC_PULSE_TIME * MAX_TOLERANCE_50 + 0.5) + 1)
+#define FDC_1_PAUSE_LEN_MIN                     ((IRMP_TICK8_T)(F_INTERRUPTS * FDC_1_PAUSE_TIME * MIN_TOLERANCE_20 + 0.5) - 1)
+#define FDC_1_PAUSE_LEN_MAX                     ((IRMP_TICK8_T)(F_INTERRUPTS * FDC_1_PAUSE_TIME * MAX_TOLERANCE_20 + 0.5) + 1)
 #if 0
-#define FDC_0_PAUSE_LEN_MIN                     ((uint_fast8_t)(F_INTERRUPTS * FDC_0_PAUSE_TIME * MIN_TOLERANCE_40 + 0.5) - 1)   // could be negative: 255
+#define FDC_0_PAUSE_LEN_MIN                     ((IRMP_TICK8_T)(F_INTERRUPTS * FDC_0_PAUSE_TIME * MIN_TOLERANCE_40 + 0.5) - 1)   // could be negative: 255
 #else
 #define FDC_0_PAUSE_LEN_MIN                     (1)                                                                         // simply use 1
 #endif
-#define FDC_0_PAUSE_LEN_MAX                     ((uint_fast8_t)(F_INTERRUPTS * FDC_0_PAUSE_TIME * MAX_TOLERANCE_10 + 0.5) + 1)
-
-#define RCCAR_START_BIT_PULSE_LEN_MIN           ((uint_fast8_t)(F_INTERRUPTS * RCCAR_START_BIT_PULSE_TIME * MIN_TOLERANCE_10 + 0.5) - 1)
-#define RCCAR_START_BIT_PULSE_LEN_MAX           ((uint_fast8_t)(F_INTERRUPTS * RCCAR_START_BIT_PULSE_TIME * MAX_TOLERANCE_10 + 0.5) + 1)
-#define RCCAR_START_BIT_PAUSE_LEN_MIN           ((uint_fast8_t)(F_INTERRUPTS * RCCAR_START_BIT_PAUSE_TIME * MIN_TOLERANCE_10 + 0.5) - 1)
-#define RCCAR_START_BIT_PAUSE_LEN_MAX           ((uint_fast8_t)(F_INTERRUPTS * RCCAR_START_BIT_PAUSE_TIME * MAX_TOLERANCE_10 + 0.5) + 1)
-#define RCCAR_PULSE_LEN_MIN                     ((uint_fast8_t)(F_INTERRUPTS * RCCAR_PULSE_TIME * MIN_TOLERANCE_20 + 0.5) - 1)
-#define RCCAR_PULSE_LEN_MAX                     ((uint_fast8_t)(F_INTERRUPTS * RCCAR_PULSE_TIME * MAX_TOLERANCE_20 + 0.5) + 1)
-#define RCCAR_1_PAUSE_LEN_MIN                   ((uint_fast8_t)(F_INTERRUPTS * RCCAR_1_PAUSE_TIME * MIN_TOLERANCE_30 + 0.5) - 1)
-#define RCCAR_1_PAUSE_LEN_MAX                   ((uint_fast8_t)(F_INTERRUPTS * RCCAR_1_PAUSE_TIME * MAX_TOLERANCE_25 + 0.5) + 1)
-#define RCCAR_0_PAUSE_LEN_MIN                   ((uint_fast8_t)(F_INTERRUPTS * RCCAR_0_PAUSE_TIME * MIN_TOLERANCE_25 + 0.5) - 1)
-#define RCCAR_0_PAUSE_LEN_MAX                   ((uint_fast8_t)(F_INTERRUPTS * RCCAR_0_PAUSE_TIME * MAX_TOLERANCE_30 + 0.5) + 1)
-
-#define JVC_START_BIT_PULSE_LEN_MIN             ((uint_fast8_t)(F_INTERRUPTS * JVC_START_BIT_PULSE_TIME * MIN_TOLERANCE_40 + 0.5) - 1)
-#define JVC_START_BIT_PULSE_LEN_MAX             ((uint_fast8_t)(F_INTERRUPTS * JVC_START_BIT_PULSE_TIME * MAX_TOLERANCE_40 + 0.5) + 1)
-#define JVC_REPEAT_START_BIT_PAUSE_LEN_MIN      ((uint_fast8_t)(F_INTERRUPTS * (JVC_FRAME_REPEAT_PAUSE_TIME - IRMP_TIMEOUT_TIME) * MIN_TOLERANCE_40 + 0.5) - 1)  // HACK!
-#define JVC_REPEAT_START_BIT_PAUSE_LEN_MAX      ((uint_fast8_t)(F_INTERRUPTS * (JVC_FRAME_REPEAT_PAUSE_TIME - IRMP_TIMEOUT_TIME) * MAX_TOLERANCE_70 + 0.5) - 1)  // HACK!
-#define JVC_PULSE_LEN_MIN                       ((uint_fast8_t)(F_INTERRUPTS * JVC_PULSE_TIME * MIN_TOLERANCE_40 + 0.5) - 1)
-#define JVC_PULSE_LEN_MAX                       ((uint_fast8_t)(F_INTERRUPTS * JVC_PULSE_TIME * MAX_TOLERANCE_40 + 0.5) + 1)
-#define JVC_1_PAUSE_LEN_MIN                     ((uint_fast8_t)(F_INTERRUPTS * JVC_1_PAUSE_TIME * MIN_TOLERANCE_40 + 0.5) - 1)
-#define JVC_1_PAUSE_LEN_MAX                     ((uint_fast8_t)(F_INTERRUPTS * JVC_1_PAUSE_TIME * MAX_TOLERANCE_40 + 0.5) + 1)
-#define JVC_0_PAUSE_LEN_MIN                     ((uint_fast8_t)(F_INTERRUPTS * JVC_0_PAUSE_TIME * MIN_TOLERANCE_40 + 0.5) - 1)
-#define JVC_0_PAUSE_LEN_MAX                     ((uint_fast8_t)(F_INTERRUPTS * JVC_0_PAUSE_TIME * MAX_TOLERANCE_40 + 0.5) + 1)
+#define FDC_0_PAUSE_LEN_MAX                     ((IRMP_TICK8_T)(F_INTERRUPTS * FDC_0_PAUSE_TIME * MAX_TOLERANCE_10 + 0.5) + 1)
+
+#define RCCAR_START_BIT_PULSE_LEN_MIN           ((IRMP_TICK8_T)(F_INTERRUPTS * RCCAR_START_BIT_PULSE_TIME * MIN_TOLERANCE_10 + 0.5) - 1)
+#define RCCAR_START_BIT_PULSE_LEN_MAX           ((IRMP_TICK8_T)(F_INTERRUPTS * RCCAR_START_BIT_PULSE_TIME * MAX_TOLERANCE_10 + 0.5) + 1)
+#define RCCAR_START_BIT_PAUSE_LEN_MIN           ((IRMP_TICK8_T)(F_INTERRUPTS * RCCAR_START_BIT_PAUSE_TIME * MIN_TOLERANCE_10 + 0.5) - 1)
+#define RCCAR_START_BIT_PAUSE_LEN_MAX           ((IRMP_TICK8_T)(F_INTERRUPTS * RCCAR_START_BIT_PAUSE_TIME * MAX_TOLERANCE_10 + 0.5) + 1)
+#define RCCAR_PULSE_LEN_MIN                     ((IRMP_TICK8_T)(F_INTERRUPTS * RCCAR_PULSE_TIME * MIN_TOLERANCE_20 + 0.5) - 1)
+#define RCCAR_PULSE_LEN_MAX                     ((IRMP_TICK8_T)(F_INTERRUPTS * RCCAR_PULSE_TIME * MAX_TOLERANCE_20 + 0.5) + 1)
+#define RCCAR_1_PAUSE_LEN_MIN                   ((IRMP_TICK8_T)(F_INTERRUPTS * RCCAR_1_PAUSE_TIME * MIN_TOLERANCE_30 + 0.5) - 1)
+#define RCCAR_1_PAUSE_LEN_MAX                   ((IRMP_TICK8_T)(F_INTERRUPTS * RCCAR_1_PAUSE_TIME * MAX_TOLERANCE_25 + 0.5) + 1)
+#define RCCAR_0_PAUSE_LEN_MIN                   ((IRMP_TICK8_T)(F_INTERRUPTS * RCCAR_0_PAUSE_TIME * MIN_TOLERANCE_25 + 0.5) - 1)
+#define RCCAR_0_PAUSE_LEN_MAX                   ((IRMP_TICK8_T)(F_INTERRUPTS * RCCAR_0_PAUSE_TIME * MAX_TOLERANCE_30 + 0.5) + 1)
+
+#define JVC_START_BIT_PULSE_LEN_MIN             ((IRMP_TICK8_T)(F_INTERRUPTS * JVC_START_BIT_PULSE_TIME * MIN_TOLERANCE_40 + 0.5) - 1)
+#define JVC_START_BIT_PULSE_LEN_MAX             ((IRMP_TICK8_T)(F_INTERRUPTS * JVC_START_BIT_PULSE_TIME * MAX_TOLERANCE_40 + 0.5) + 1)
+#define JVC_REPEAT_START_BIT_PAUSE_LEN_MIN      ((IRMP_TICK8_T)(F_INTERRUPTS * (JVC_FRAME_REPEAT_PAUSE_TIME - IRMP_TIMEOUT_TIME) * MIN_TOLERANCE_40 + 0.5) - 1)  // HACK!
+#define JVC_REPEAT_START_BIT_PAUSE_LEN_MAX      ((IRMP_TICK8_T)(F_INTERRUPTS * (JVC_FRAME_REPEAT_PAUSE_TIME - IRMP_TIMEOUT_TIME) * MAX_TOLERANCE_70 + 0.5) - 1)  // HACK!
+#define JVC_PULSE_LEN_MIN                       ((IRMP_TICK8_T)(F_INTERRUPTS * JVC_PULSE_TIME * MIN_TOLERANCE_40 + 0.5) - 1)
+#define JVC_PULSE_LEN_MAX                       ((IRMP_TICK8_T)(F_INTERRUPTS * JVC_PULSE_TIME * MAX_TOLERANCE_40 + 0.5) + 1)
+#define JVC_1_PAUSE_LEN_MIN                     ((IRMP_TICK8_T)(F_INTERRUPTS * JVC_1_PAUSE_TIME * MIN_TOLERANCE_40 + 0.5) - 1)
+#define JVC_1_PAUSE_LEN_MAX                     ((IRMP_TICK8_T)(F_INTERRUPTS * JVC_1_PAUSE_TIME * MAX_TOLERANCE_40 + 0.5) + 1)
+#define JVC_0_PAUSE_LEN_MIN                     ((IRMP_TICK8_T)(F_INTERRUPTS * JVC_0_PAUSE_TIME * MIN_TOLERANCE_40 + 0.5) - 1)
+#define JVC_0_PAUSE_LEN_MAX                     ((IRMP_TICK8_T)(F_INTERRUPTS * JVC_0_PAUSE_TIME * MAX_TOLERANCE_40 + 0.5) + 1)
 // autodetect JVC repetition frame within 50 msec:
 #define JVC_FRAME_REPEAT_PAUSE_LEN_MAX          (uint_fast16_t)(F_INTERRUPTS * JVC_FRAME_REPEAT_PAUSE_TIME * MAX_TOLERANCE_20 + 0.5)
 
-#define NIKON_START_BIT_PULSE_LEN_MIN           ((uint_fast8_t)(F_INTERRUPTS * NIKON_START_BIT_PULSE_TIME * MIN_TOLERANCE_20 + 0.5) - 1)
-#define NIKON_START_BIT_PULSE_LEN_MAX           ((uint_fast8_t)(F_INTERRUPTS * NIKON_START_BIT_PULSE_TIME * MAX_TOLERANCE_20 + 0.5) + 1)
+#define NIKON_START_BIT_PULSE_LEN_MIN           ((IRMP_TICK8_T)(F_INTERRUPTS * NIKON_START_BIT_PULSE_TIME * MIN_TOLERANCE_20 + 0.5) - 1)
+#define NIKON_START_BIT_PULSE_LEN_MAX           ((IRMP_TICK8_T)(F_INTERRUPTS * NIKON_START_BIT_PULSE_TIME * MAX_TOLERANCE_20 + 0.5) + 1)
 #define NIKON_START_BIT_PAUSE_LEN_MIN           ((uint_fast16_t)(F_INTERRUPTS * NIKON_START_BIT_PAUSE_TIME * MIN_TOLERANCE_20 + 0.5) - 1)
 #define NIKON_START_BIT_PAUSE_LEN_MAX           ((uint_fast16_t)(F_INTERRUPTS * NIKON_START_BIT_PAUSE_TIME * MAX_TOLERANCE_20 + 0.5) + 1)
-#define NIKON_REPEAT_START_BIT_PAUSE_LEN_MIN    ((uint_fast8_t)(F_INTERRUPTS * NIKON_REPEAT_START_BIT_PAUSE_TIME * MIN_TOLERANCE_20 + 0.5) - 1)
-#define NIKON_REPEAT_START_BIT_PAUSE_LEN_MAX    ((uint_fast8_t)(F_INTERRUPTS * NIKON_REPEAT_START_BIT_PAUSE_TIME * MAX_TOLERANCE_20 + 0.5) + 1)
-#define NIKON_PULSE_LEN_MIN                     ((uint_fast8_t)(F_INTERRUPTS * NIKON_PULSE_TIME * MIN_TOLERANCE_20 + 0.5) - 1)
-#define NIKON_PULSE_LEN_MAX                     ((uint_fast8_t)(F_INTERRUPTS * NIKON_PULSE_TIME * MAX_TOLERANCE_20 + 0.5) + 1)
-#define NIKON_1_PAUSE_LEN_MIN                   ((uint_fast8_t)(F_INTERRUPTS * NIKON_1_PAUSE_TIME * MIN_TOLERANCE_20 + 0.5) - 1)
-#define NIKON_1_PAUSE_LEN_MAX                   ((uint_fast8_t)(F_INTERRUPTS * NIKON_1_PAUSE_TIME * MAX_TOLERANCE_20 + 0.5) + 1)
-#define NIKON_0_PAUSE_LEN_MIN                   ((uint_fast8_t)(F_INTERRUPTS * NIKON_0_PAUSE_TIME * MIN_TOLERANCE_20 + 0.5) - 1)
-#define NIKON_0_PAUSE_LEN_MAX                   ((uint_fast8_t)(F_INTERRUPTS * NIKON_0_PAUSE_TIME * MAX_TOLERANCE_20 + 0.5) + 1)
+#define NIKON_REPEAT_START_BIT_PAUSE_LEN_MIN    ((IRMP_TICK8_T)(F_INTERRUPTS * NIKON_REPEAT_START_BIT_PAUSE_TIME * MIN_TOLERANCE_20 + 0.5) - 1)
+#define NIKON_REPEAT_START_BIT_PAUSE_LEN_MAX    ((IRMP_TICK8_T)(F_INTERRUPTS * NIKON_REPEAT_START_BIT_PAUSE_TIME * MAX_TOLERANCE_20 + 0.5) + 1)
+#define NIKON_PULSE_LEN_MIN                     ((IRMP_TICK8_T)(F_INTERRUPTS * NIKON_PULSE_TIME * MIN_TOLERANCE_20 + 0.5) - 1)
+#define NIKON_PULSE_LEN_MAX                     ((IRMP_TICK8_T)(F_INTERRUPTS * NIKON_PULSE_TIME * MAX_TOLERANCE_20 + 0.5) + 1)
+#define NIKON_1_PAUSE_LEN_MIN                   ((IRMP_TICK8_T)(F_INTERRUPTS * NIKON_1_PAUSE_TIME * MIN_TOLERANCE_20 + 0.5) - 1)
+#define NIKON_1_PAUSE_LEN_MAX                   ((IRMP_TICK8_T)(F_INTERRUPTS * NIKON_1_PAUSE_TIME * MAX_TOLERANCE_20 + 0.5) + 1)
+#define NIKON_0_PAUSE_LEN_MIN                   ((IRMP_TICK8_T)(F_INTERRUPTS * NIKON_0_PAUSE_TIME * MIN_TOLERANCE_20 + 0.5) - 1)
+#define NIKON_0_PAUSE_LEN_MAX                   ((IRMP_TICK8_T)(F_INTERRUPTS * NIKON_0_PAUSE_TIME * MAX_TOLERANCE_20 + 0.5) + 1)
 #define NIKON_FRAME_REPEAT_PAUSE_LEN_MAX        (uint_fast16_t)(F_INTERRUPTS * NIKON_FRAME_REPEAT_PAUSE_TIME * MAX_TOLERANCE_20 + 0.5)
 
-#define KATHREIN_START_BIT_PULSE_LEN_MIN        ((uint_fast8_t)(F_INTERRUPTS * KATHREIN_START_BIT_PULSE_TIME * MIN_TOLERANCE_10 + 0.5) - 1)
-#define KATHREIN_START_BIT_PULSE_LEN_MAX        ((uint_fast8_t)(F_INTERRUPTS * KATHREIN_START_BIT_PULSE_TIME * MAX_TOLERANCE_10 + 0.5) + 1)
-#define KATHREIN_START_BIT_PAUSE_LEN_MIN        ((uint_fast8_t)(F_INTERRUPTS * KATHREIN_START_BIT_PAUSE_TIME * MIN_TOLERANCE_10 + 0.5) - 1)
-#define KATHREIN_START_BIT_PAUSE_LEN_MAX        ((uint_fast8_t)(F_INTERRUPTS * KATHREIN_START_BIT_PAUSE_TIME * MAX_TOLERANCE_10 + 0.5) + 1)
-#define KATHREIN_1_PULSE_LEN_MIN                ((uint_fast8_t)(F_INTERRUPTS * KATHREIN_1_PULSE_TIME * MIN_TOLERANCE_10 + 0.5) - 1)
-#define KATHREIN_1_PULSE_LEN_MAX                ((uint_fast8_t)(F_INTERRUPTS * KATHREIN_1_PULSE_TIME * MAX_TOLERANCE_10 + 0.5) + 1)
-#define KATHREIN_1_PAUSE_LEN_MIN                ((uint_fast8_t)(F_INTERRUPTS * KATHREIN_1_PAUSE_TIME * MIN_TOLERANCE_10 + 0.5) - 1)
-#define KATHREIN_1_PAUSE_LEN_MAX                ((uint_fast8_t)(F_INTERRUPTS * KATHREIN_1_PAUSE_TIME * MAX_TOLERANCE_10 + 0.5) + 1)
-#define KATHREIN_0_PULSE_LEN_MIN                ((uint_fast8_t)(F_INTERRUPTS * KATHREIN_0_PULSE_TIME * MIN_TOLERANCE_10 + 0.5) - 1)
-#define KATHREIN_0_PULSE_LEN_MAX                ((uint_fast8_t)(F_INTERRUPTS * KATHREIN_0_PULSE_TIME * MAX_TOLERANCE_10 + 0.5) + 1)
-#define KATHREIN_0_PAUSE_LEN_MIN                ((uint_fast8_t)(F_INTERRUPTS * KATHREIN_0_PAUSE_TIME * MIN_TOLERANCE_10 + 0.5) - 1)
-#define KATHREIN_0_PAUSE_LEN_MAX                ((uint_fast8_t)(F_INTERRUPTS * KATHREIN_0_PAUSE_TIME * MAX_TOLERANCE_10 + 0.5) + 1)
-#define KATHREIN_SYNC_BIT_PAUSE_LEN_MIN         ((uint_fast8_t)(F_INTERRUPTS * KATHREIN_SYNC_BIT_PAUSE_LEN_TIME * MIN_TOLERANCE_10 + 0.5) - 1)
-#define KATHREIN_SYNC_BIT_PAUSE_LEN_MAX         ((uint_fast8_t)(F_INTERRUPTS * KATHREIN_SYNC_BIT_PAUSE_LEN_TIME * MAX_TOLERANCE_10 + 0.5) + 1)
-
-#define NETBOX_START_BIT_PULSE_LEN_MIN          ((uint_fast8_t)(F_INTERRUPTS * NETBOX_START_BIT_PULSE_TIME * MIN_TOLERANCE_10 + 0.5) - 1)
-#define NETBOX_START_BIT_PULSE_LEN_MAX          ((uint_fast8_t)(F_INTERRUPTS * NETBOX_START_BIT_PULSE_TIME * MAX_TOLERANCE_10 + 0.5) + 1)
-#define NETBOX_START_BIT_PAUSE_LEN_MIN          ((uint_fast8_t)(F_INTERRUPTS * NETBOX_START_BIT_PAUSE_TIME * MIN_TOLERANCE_10 + 0.5) - 1)
-#define NETBOX_START_BIT_PAUSE_LEN_MAX          ((uint_fast8_t)(F_INTERRUPTS * NETBOX_START_BIT_PAUSE_TIME * MAX_TOLERANCE_10 + 0.5) + 1)
-#define NETBOX_PULSE_LEN                        ((uint_fast8_t)(F_INTERRUPTS * NETBOX_PULSE_TIME))
-#define NETBOX_PAUSE_LEN                        ((uint_fast8_t)(F_INTERRUPTS * NETBOX_PAUSE_TIME))
-#define NETBOX_PULSE_REST_LEN                   ((uint_fast8_t)(F_INTERRUPTS * NETBOX_PULSE_TIME / 4))
-#define NETBOX_PAUSE_REST_LEN                   ((uint_fast8_t)(F_INTERRUPTS * NETBOX_PAUSE_TIME / 4))
-
-#define LEGO_START_BIT_PULSE_LEN_MIN            ((uint_fast8_t)(F_INTERRUPTS * LEGO_START_BIT_PULSE_TIME * MIN_TOLERANCE_40 + 0.5) - 1)
-#define LEGO_START_BIT_PULSE_LEN_MAX            ((uint_fast8_t)(F_INTERRUPTS * LEGO_START_BIT_PULSE_TIME * MAX_TOLERANCE_40 + 0.5) + 1)
-#define LEGO_START_BIT_PAUSE_LEN_MIN            ((uint_fast8_t)(F_INTERRUPTS * LEGO_START_BIT_PAUSE_TIME * MIN_TOLERANCE_40 + 0.5) - 1)
-#define LEGO_START_BIT_PAUSE_LEN_MAX            ((uint_fast8_t)(F_INTERRUPTS * LEGO_START_BIT_PAUSE_TIME * MAX_TOLERANCE_40 + 0.5) + 1)
-#define LEGO_PULSE_LEN_MIN                      ((uint_fast8_t)(F_INTERRUPTS * LEGO_PULSE_TIME * MIN_TOLERANCE_40 + 0.5) - 1)
-#define LEGO_PULSE_LEN_MAX                      ((uint_fast8_t)(F_INTERRUPTS * LEGO_PULSE_TIME * MAX_TOLERANCE_40 + 0.5) + 1)
-#define LEGO_1_PAUSE_LEN_MIN                    ((uint_fast8_t)(F_INTERRUPTS * LEGO_1_PAUSE_TIME * MIN_TOLERANCE_25 + 0.5) - 1)
-#define LEGO_1_PAUSE_LEN_MAX                    ((uint_fast8_t)(F_INTERRUPTS * LEGO_1_PAUSE_TIME * MAX_TOLERANCE_40 + 0.5) + 1)
-#define LEGO_0_PAUSE_LEN_MIN                    ((uint_fast8_t)(F_INTERRUPTS * LEGO_0_PAUSE_TIME * MIN_TOLERANCE_40 + 0.5) - 1)
-#define LEGO_0_PAUSE_LEN_MAX                    ((uint_fast8_t)(F_INTERRUPTS * LEGO_0_PAUSE_TIME * MAX_TOLERANCE_10 + 0.5) + 1)
-
-#define IRMP16_START_BIT_PULSE_LEN_MIN          ((uint_fast8_t)(F_INTERRUPTS * IRMP16_START_BIT_PULSE_TIME * MIN_TOLERANCE_20 + 0.5) - 1)
-#define IRMP16_START_BIT_PULSE_LEN_MAX          ((uint_fast8_t)(F_INTERRUPTS * IRMP16_START_BIT_PULSE_TIME * MAX_TOLERANCE_20 + 0.5) + 1)
-#define IRMP16_START_BIT_PAUSE_LEN_MIN          ((uint_fast8_t)(F_INTERRUPTS * IRMP16_START_BIT_PAUSE_TIME * MIN_TOLERANCE_20 + 0.5) - 1)
-#define IRMP16_START_BIT_PAUSE_LEN_MAX          ((uint_fast8_t)(F_INTERRUPTS * IRMP16_START_BIT_PAUSE_TIME * MAX_TOLERANCE_20 + 0.5) + 1)
-#define IRMP16_PULSE_LEN_MIN                    ((uint_fast8_t)(F_INTERRUPTS * IRMP16_PULSE_TIME * MIN_TOLERANCE_20 + 0.5) - 1)
-#define IRMP16_PULSE_LEN_MAX                    ((uint_fast8_t)(F_INTERRUPTS * IRMP16_PULSE_TIME * MAX_TOLERANCE_20 + 0.5) + 1)
-#define IRMP16_1_PAUSE_LEN_MIN                  ((uint_fast8_t)(F_INTERRUPTS * IRMP16_1_PAUSE_TIME * MIN_TOLERANCE_20 + 0.5) - 1)
-#define IRMP16_1_PAUSE_LEN_MAX                  ((uint_fast8_t)(F_INTERRUPTS * IRMP16_1_PAUSE_TIME * MAX_TOLERANCE_20 + 0.5) + 1)
-#define IRMP16_0_PAUSE_LEN_MIN                  ((uint_fast8_t)(F_INTERRUPTS * IRMP16_0_PAUSE_TIME * MIN_TOLERANCE_20 + 0.5) - 1)
-#define IRMP16_0_PAUSE_LEN_MAX                  ((uint_fast8_t)(F_INTERRUPTS * IRMP16_0_PAUSE_TIME * MAX_TOLERANCE_20 + 0.5) + 1)
-
-#define GREE_START_BIT_PULSE_LEN_MIN            ((uint_fast8_t)(F_INTERRUPTS * GREE_START_BIT_PULSE_TIME * MIN_TOLERANCE_20 + 0.5) - 1)
-#define GREE_START_BIT_PULSE_LEN_MAX            ((uint_fast8_t)(F_INTERRUPTS * GREE_START_BIT_PULSE_TIME * MAX_TOLERANCE_20 + 0.5) + 1)
-#define GREE_START_BIT_PAUSE_LEN_MIN            ((uint_fast8_t)(F_INTERRUPTS * GREE_START_BIT_PAUSE_TIME * MIN_TOLERANCE_20 + 0.5) - 1)
-#define GREE_START_BIT_PAUSE_LEN_MAX            ((uint_fast8_t)(F_INTERRUPTS * GREE_START_BIT_PAUSE_TIME * MAX_TOLERANCE_20 + 0.5) + 1)
-#define GREE_PULSE_LEN_MIN                      ((uint_fast8_t)(F_INTERRUPTS * GREE_PULSE_TIME * MIN_TOLERANCE_20 + 0.5) - 1)
-#define GREE_PULSE_LEN_MAX                      ((uint_fast8_t)(F_INTERRUPTS * GREE_PULSE_TIME * MAX_TOLERANCE_20 + 0.5) + 1)
-#define GREE_1_PAUSE_LEN_MIN                    ((uint_fast8_t)(F_INTERRUPTS * GREE_1_PAUSE_TIME * MIN_TOLERANCE_20 + 0.5) - 1)
-#define GREE_1_PAUSE_LEN_MAX                    ((uint_fast8_t)(F_INTERRUPTS * GREE_1_PAUSE_TIME * MAX_TOLERANCE_20 + 0.5) + 1)
-#define GREE_0_PAUSE_LEN_MIN                    ((uint_fast8_t)(F_INTERRUPTS * GREE_0_PAUSE_TIME * MIN_TOLERANCE_20 + 0.5) - 1)
-#define GREE_0_PAUSE_LEN_MAX                    ((uint_fast8_t)(F_INTERRUPTS * GREE_0_PAUSE_TIME * MAX_TOLERANCE_20 + 0.5) + 1)
-
-#define BOSE_START_BIT_PULSE_LEN_MIN             ((uint_fast8_t)(F_INTERRUPTS * BOSE_START_BIT_PULSE_TIME * MIN_TOLERANCE_30 + 0.5) - 1)
-#define BOSE_START_BIT_PULSE_LEN_MAX             ((uint_fast8_t)(F_INTERRUPTS * BOSE_START_BIT_PULSE_TIME * MAX_TOLERANCE_30 + 0.5) + 1)
-#define BOSE_START_BIT_PAUSE_LEN_MIN             ((uint_fast8_t)(F_INTERRUPTS * BOSE_START_BIT_PAUSE_TIME * MIN_TOLERANCE_30 + 0.5) - 1)
-#define BOSE_START_BIT_PAUSE_LEN_MAX             ((uint_fast8_t)(F_INTERRUPTS * BOSE_START_BIT_PAUSE_TIME * MAX_TOLERANCE_30 + 0.5) + 1)
-#define BOSE_PULSE_LEN_MIN                       ((uint_fast8_t)(F_INTERRUPTS * BOSE_PULSE_TIME * MIN_TOLERANCE_30 + 0.5) - 1)
-#define BOSE_PULSE_LEN_MAX                       ((uint_fast8_t)(F_INTERRUPTS * BOSE_PULSE_TIME * MAX_TOLERANCE_30 + 0.5) + 1)
-#define BOSE_1_PAUSE_LEN_MIN                     ((uint_fast8_t)(F_INTERRUPTS * BOSE_1_PAUSE_TIME * MIN_TOLERANCE_30 + 0.5) - 1)
-#define BOSE_1_PAUSE_LEN_MAX                     ((uint_fast8_t)(F_INTERRUPTS * BOSE_1_PAUSE_TIME * MAX_TOLERANCE_30 + 0.5) + 1)
-#define BOSE_0_PAUSE_LEN_MIN                     ((uint_fast8_t)(F_INTERRUPTS * BOSE_0_PAUSE_TIME * MIN_TOLERANCE_30 + 0.5) - 1)
-#define BOSE_0_PAUSE_LEN_MAX                     ((uint_fast8_t)(F_INTERRUPTS * BOSE_0_PAUSE_TIME * MAX_TOLERANCE_30 + 0.5) + 1)
+#define KATHREIN_START_BIT_PULSE_LEN_MIN        ((IRMP_TICK8_T)(F_INTERRUPTS * KATHREIN_START_BIT_PULSE_TIME * MIN_TOLERANCE_10 + 0.5) - 1)
+#define KATHREIN_START_BIT_PULSE_LEN_MAX        ((IRMP_TICK8_T)(F_INTERRUPTS * KATHREIN_START_BIT_PULSE_TIME * MAX_TOLERANCE_10 + 0.5) + 1)
+#define KATHREIN_START_BIT_PAUSE_LEN_MIN        ((IRMP_TICK8_T)(F_INTERRUPTS * KATHREIN_START_BIT_PAUSE_TIME * MIN_TOLERANCE_10 + 0.5) - 1)
+#define KATHREIN_START_BIT_PAUSE_LEN_MAX        ((IRMP_TICK8_T)(F_INTERRUPTS * KATHREIN_START_BIT_PAUSE_TIME * MAX_TOLERANCE_10 + 0.5) + 1)
+#define KATHREIN_1_PULSE_LEN_MIN                ((IRMP_TICK8_T)(F_INTERRUPTS * KATHREIN_1_PULSE_TIME * MIN_TOLERANCE_10 + 0.5) - 1)
+#define KATHREIN_1_PULSE_LEN_MAX                ((IRMP_TICK8_T)(F_INTERRUPTS * KATHREIN_1_PULSE_TIME * MAX_TOLERANCE_10 + 0.5) + 1)
+#define KATHREIN_1_PAUSE_LEN_MIN                ((IRMP_TICK8_T)(F_INTERRUPTS * KATHREIN_1_PAUSE_TIME * MIN_TOLERANCE_10 + 0.5) - 1)
+#define KATHREIN_1_PAUSE_LEN_MAX                ((IRMP_TICK8_T)(F_INTERRUPTS * KATHREIN_1_PAUSE_TIME * MAX_TOLERANCE_10 + 0.5) + 1)
+#define KATHREIN_0_PULSE_LEN_MIN                ((IRMP_TICK8_T)(F_INTERRUPTS * KATHREIN_0_PULSE_TIME * MIN_TOLERANCE_10 + 0.5) - 1)
+#define KATHREIN_0_PULSE_LEN_MAX                ((IRMP_TICK8_T)(F_INTERRUPTS * KATHREIN_0_PULSE_TIME * MAX_TOLERANCE_10 + 0.5) + 1)
+#define KATHREIN_0_PAUSE_LEN_MIN                ((IRMP_TICK8_T)(F_INTERRUPTS * KATHREIN_0_PAUSE_TIME * MIN_TOLERANCE_10 + 0.5) - 1)
+#define KATHREIN_0_PAUSE_LEN_MAX                ((IRMP_TICK8_T)(F_INTERRUPTS * KATHREIN_0_PAUSE_TIME * MAX_TOLERANCE_10 + 0.5) + 1)
+#define KATHREIN_SYNC_BIT_PAUSE_LEN_MIN         ((IRMP_TICK8_T)(F_INTERRUPTS * KATHREIN_SYNC_BIT_PAUSE_LEN_TIME * MIN_TOLERANCE_10 + 0.5) - 1)
+#define KATHREIN_SYNC_BIT_PAUSE_LEN_MAX         ((IRMP_TICK8_T)(F_INTERRUPTS * KATHREIN_SYNC_BIT_PAUSE_LEN_TIME * MAX_TOLERANCE_10 + 0.5) + 1)
+
+#define NETBOX_START_BIT_PULSE_LEN_MIN          ((IRMP_TICK8_T)(F_INTERRUPTS * NETBOX_START_BIT_PULSE_TIME * MIN_TOLERANCE_10 + 0.5) - 1)
+#define NETBOX_START_BIT_PULSE_LEN_MAX          ((IRMP_TICK8_T)(F_INTERRUPTS * NETBOX_START_BIT_PULSE_TIME * MAX_TOLERANCE_10 + 0.5) + 1)
+#define NETBOX_START_BIT_PAUSE_LEN_MIN          ((IRMP_TICK8_T)(F_INTERRUPTS * NETBOX_START_BIT_PAUSE_TIME * MIN_TOLERANCE_10 + 0.5) - 1)
+#define NETBOX_START_BIT_PAUSE_LEN_MAX          ((IRMP_TICK8_T)(F_INTERRUPTS * NETBOX_START_BIT_PAUSE_TIME * MAX_TOLERANCE_10 + 0.5) + 1)
+#define NETBOX_PULSE_LEN                        ((IRMP_TICK8_T)(F_INTERRUPTS * NETBOX_PULSE_TIME))
+#define NETBOX_PAUSE_LEN                        ((IRMP_TICK8_T)(F_INTERRUPTS * NETBOX_PAUSE_TIME))
+#define NETBOX_PULSE_REST_LEN                   ((IRMP_TICK8_T)(F_INTERRUPTS * NETBOX_PULSE_TIME / 4))
+#define NETBOX_PAUSE_REST_LEN                   ((IRMP_TICK8_T)(F_INTERRUPTS * NETBOX_PAUSE_TIME / 4))
+
+#define LEGO_START_BIT_PULSE_LEN_MIN            ((IRMP_TICK8_T)(F_INTERRUPTS * LEGO_START_BIT_PULSE_TIME * MIN_TOLERANCE_40 + 0.5) - 1)
+#define LEGO_START_BIT_PULSE_LEN_MAX            ((IRMP_TICK8_T)(F_INTERRUPTS * LEGO_START_BIT_PULSE_TIME * MAX_TOLERANCE_40 + 0.5) + 1)
+#define LEGO_START_BIT_PAUSE_LEN_MIN            ((IRMP_TICK8_T)(F_INTERRUPTS * LEGO_START_BIT_PAUSE_TIME * MIN_TOLERANCE_40 + 0.5) - 1)
+#define LEGO_START_BIT_PAUSE_LEN_MAX            ((IRMP_TICK8_T)(F_INTERRUPTS * LEGO_START_BIT_PAUSE_TIME * MAX_TOLERANCE_40 + 0.5) + 1)
+#define LEGO_PULSE_LEN_MIN                      ((IRMP_TICK8_T)(F_INTERRUPTS * LEGO_PULSE_TIME * MIN_TOLERANCE_40 + 0.5) - 1)
+#define LEGO_PULSE_LEN_MAX                      ((IRMP_TICK8_T)(F_INTERRUPTS * LEGO_PULSE_TIME * MAX_TOLERANCE_40 + 0.5) + 1)
+#define LEGO_1_PAUSE_LEN_MIN                    ((IRMP_TICK8_T)(F_INTERRUPTS * LEGO_1_PAUSE_TIME * MIN_TOLERANCE_25 + 0.5) - 1)
+#define LEGO_1_PAUSE_LEN_MAX                    ((IRMP_TICK8_T)(F_INTERRUPTS * LEGO_1_PAUSE_TIME * MAX_TOLERANCE_40 + 0.5) + 1)
+#define LEGO_0_PAUSE_LEN_MIN                    ((IRMP_TICK8_T)(F_INTERRUPTS * LEGO_0_PAUSE_TIME * MIN_TOLERANCE_40 + 0.5) - 1)
+#define LEGO_0_PAUSE_LEN_MAX                    ((IRMP_TICK8_T)(F_INTERRUPTS * LEGO_0_PAUSE_TIME * MAX_TOLERANCE_10 + 0.5) + 1)
+
+#define IRMP16_START_BIT_PULSE_LEN_MIN          ((IRMP_TICK8_T)(F_INTERRUPTS * IRMP16_START_BIT_PULSE_TIME * MIN_TOLERANCE_20 + 0.5) - 1)
+#define IRMP16_START_BIT_PULSE_LEN_MAX          ((IRMP_TICK8_T)(F_INTERRUPTS * IRMP16_START_BIT_PULSE_TIME * MAX_TOLERANCE_20 + 0.5) + 1)
+#define IRMP16_START_BIT_PAUSE_LEN_MIN          ((IRMP_TICK8_T)(F_INTERRUPTS * IRMP16_START_BIT_PAUSE_TIME * MIN_TOLERANCE_20 + 0.5) - 1)
+#define IRMP16_START_BIT_PAUSE_LEN_MAX          ((IRMP_TICK8_T)(F_INTERRUPTS * IRMP16_START_BIT_PAUSE_TIME * MAX_TOLERANCE_20 + 0.5) + 1)
+#define IRMP16_PULSE_LEN_MIN                    ((IRMP_TICK8_T)(F_INTERRUPTS * IRMP16_PULSE_TIME * MIN_TOLERANCE_20 + 0.5) - 1)
+#define IRMP16_PULSE_LEN_MAX                    ((IRMP_TICK8_T)(F_INTERRUPTS * IRMP16_PULSE_TIME * MAX_TOLERANCE_20 + 0.5) + 1)
+#define IRMP16_1_PAUSE_LEN_MIN                  ((IRMP_TICK8_T)(F_INTERRUPTS * IRMP16_1_PAUSE_TIME * MIN_TOLERANCE_20 + 0.5) - 1)
+#define IRMP16_1_PAUSE_LEN_MAX                  ((IRMP_TICK8_T)(F_INTERRUPTS * IRMP16_1_PAUSE_TIME * MAX_TOLERANCE_20 + 0.5) + 1)
+#define IRMP16_0_PAUSE_LEN_MIN                  ((IRMP_TICK8_T)(F_INTERRUPTS * IRMP16_0_PAUSE_TIME * MIN_TOLERANCE_20 + 0.5) - 1)
+#define IRMP16_0_PAUSE_LEN_MAX                  ((IRMP_TICK8_T)(F_INTERRUPTS * IRMP16_0_PAUSE_TIME * MAX_TOLERANCE_20 + 0.5) + 1)
+
+#define GREE_START_BIT_PULSE_LEN_MIN            ((IRMP_TICK8_T)(F_INTERRUPTS * GREE_START_BIT_PULSE_TIME * MIN_TOLERANCE_20 + 0.5) - 1)
+#define GREE_START_BIT_PULSE_LEN_MAX            ((IRMP_TICK8_T)(F_INTERRUPTS * GREE_START_BIT_PULSE_TIME * MAX_TOLERANCE_20 + 0.5) + 1)
+#define GREE_START_BIT_PAUSE_LEN_MIN            ((IRMP_TICK8_T)(F_INTERRUPTS * GREE_START_BIT_PAUSE_TIME * MIN_TOLERANCE_20 + 0.5) - 1)
+#define GREE_START_BIT_PAUSE_LEN_MAX            ((IRMP_TICK8_T)(F_INTERRUPTS * GREE_START_BIT_PAUSE_TIME * MAX_TOLERANCE_20 + 0.5) + 1)
+#define GREE_PULSE_LEN_MIN                      ((IRMP_TICK8_T)(F_INTERRUPTS * GREE_PULSE_TIME * MIN_TOLERANCE_20 + 0.5) - 1)
+#define GREE_PULSE_LEN_MAX                      ((IRMP_TICK8_T)(F_INTERRUPTS * GREE_PULSE_TIME * MAX_TOLERANCE_20 + 0.5) + 1)
+#define GREE_1_PAUSE_LEN_MIN                    ((IRMP_TICK8_T)(F_INTERRUPTS * GREE_1_PAUSE_TIME * MIN_TOLERANCE_20 + 0.5) - 1)
+#define GREE_1_PAUSE_LEN_MAX                    ((IRMP_TICK8_T)(F_INTERRUPTS * GREE_1_PAUSE_TIME * MAX_TOLERANCE_20 + 0.5) + 1)
+#define GREE_0_PAUSE_LEN_MIN                    ((IRMP_TICK8_T)(F_INTERRUPTS * GREE_0_PAUSE_TIME * MIN_TOLERANCE_20 + 0.5) - 1)
+#define GREE_0_PAUSE_LEN_MAX                    ((IRMP_TICK8_T)(F_INTERRUPTS * GREE_0_PAUSE_TIME * MAX_TOLERANCE_20 + 0.5) + 1)
+
+#define BOSE_START_BIT_PULSE_LEN_MIN             ((IRMP_TICK8_T)(F_INTERRUPTS * BOSE_START_BIT_PULSE_TIME * MIN_TOLERANCE_30 + 0.5) - 1)
+#define BOSE_START_BIT_PULSE_LEN_MAX             ((IRMP_TICK8_T)(F_INTERRUPTS * BOSE_START_BIT_PULSE_TIME * MAX_TOLERANCE_30 + 0.5) + 1)
+#define BOSE_START_BIT_PAUSE_LEN_MIN             ((IRMP_TICK8_T)(F_INTERRUPTS * BOSE_START_BIT_PAUSE_TIME * MIN_TOLERANCE_30 + 0.5) - 1)
+#define BOSE_START_BIT_PAUSE_LEN_MAX             ((IRMP_TICK8_T)(F_INTERRUPTS * BOSE_START_BIT_PAUSE_TIME * MAX_TOLERANCE_30 + 0.5) + 1)
+#define BOSE_PULSE_LEN_MIN                       ((IRMP_TICK8_T)(F_INTERRUPTS * BOSE_PULSE_TIME * MIN_TOLERANCE_30 + 0.5) - 1)
+#define BOSE_PULSE_LEN_MAX                       ((IRMP_TICK8_T)(F_INTERRUPTS * BOSE_PULSE_TIME * MAX_TOLERANCE_30 + 0.5) + 1)
+#define BOSE_1_PAUSE_LEN_MIN                     ((IRMP_TICK8_T)(F_INTERRUPTS * BOSE_1_PAUSE_TIME * MIN_TOLERANCE_30 + 0.5) - 1)
+#define BOSE_1_PAUSE_LEN_MAX                     ((IRMP_TICK8_T)(F_INTERRUPTS * BOSE_1_PAUSE_TIME * MAX_TOLERANCE_30 + 0.5) + 1)
+#define BOSE_0_PAUSE_LEN_MIN                     ((IRMP_TICK8_T)(F_INTERRUPTS * BOSE_0_PAUSE_TIME * MIN_TOLERANCE_30 + 0.5) - 1)
+#define BOSE_0_PAUSE_LEN_MAX                     ((IRMP_TICK8_T)(F_INTERRUPTS * BOSE_0_PAUSE_TIME * MAX_TOLERANCE_30 + 0.5) + 1)
 #define BOSE_FRAME_REPEAT_PAUSE_LEN_MAX          (uint_fast16_t)(F_INTERRUPTS * 100.0e-3 * MAX_TOLERANCE_20 + 0.5)
 
-#define A1TVBOX_START_BIT_PULSE_LEN_MIN         ((uint_fast8_t)(F_INTERRUPTS * A1TVBOX_START_BIT_PULSE_TIME * MIN_TOLERANCE_10 + 0.5) - 1)
-#define A1TVBOX_START_BIT_PULSE_LEN_MAX         ((uint_fast8_t)(F_INTERRUPTS * A1TVBOX_START_BIT_PULSE_TIME * MAX_TOLERANCE_20 + 0.5) + 1)
-#define A1TVBOX_START_BIT_PAUSE_LEN_MIN         ((uint_fast8_t)(F_INTERRUPTS * A1TVBOX_START_BIT_PAUSE_TIME * MIN_TOLERANCE_20 + 0.5) - 1)
-#define A1TVBOX_START_BIT_PAUSE_LEN_MAX         ((uint_fast8_t)(F_INTERRUPTS * A1TVBOX_START_BIT_PAUSE_TIME * MAX_TOLERANCE_00 + 0.5) + 1)
-#define A1TVBOX_BIT_PULSE_LEN_MIN               ((uint_fast8_t)(F_INTERRUPTS * A1TVBOX_BIT_PULSE_TIME * MIN_TOLERANCE_05 + 0.5) - 1)
-#define A1TVBOX_BIT_PULSE_LEN_MAX               ((uint_fast8_t)(F_INTERRUPTS * A1TVBOX_BIT_PULSE_TIME * MAX_TOLERANCE_30 + 0.5) + 1)
-#define A1TVBOX_BIT_PAUSE_LEN_MIN               ((uint_fast8_t)(F_INTERRUPTS * A1TVBOX_BIT_PAUSE_TIME * MIN_TOLERANCE_00 + 0.5) - 0)
-#define A1TVBOX_BIT_PAUSE_LEN_MAX               ((uint_fast8_t)(F_INTERRUPTS * A1TVBOX_BIT_PAUSE_TIME * MAX_TOLERANCE_20 + 0.5) + 1)
-
-#define MERLIN_START_BIT_PULSE_LEN_MIN          ((uint_fast8_t)(F_INTERRUPTS * MERLIN_START_BIT_PULSE_TIME * MIN_TOLERANCE_10 + 0.5) - 1)
-#define MERLIN_START_BIT_PULSE_LEN_MAX          ((uint_fast8_t)(F_INTERRUPTS * MERLIN_START_BIT_PULSE_TIME * MAX_TOLERANCE_10 + 0.5) + 1)
-#define MERLIN_START_BIT_PAUSE_LEN_MIN          ((uint_fast8_t)(F_INTERRUPTS * MERLIN_START_BIT_PAUSE_TIME * MIN_TOLERANCE_10 + 0.5) - 1)
-#define MERLIN_START_BIT_PAUSE_LEN_MAX          ((uint_fast8_t)(F_INTERRUPTS * MERLIN_START_BIT_PAUSE_TIME * MAX_TOLERANCE_10 + 0.5) + 1)
-#define MERLIN_BIT_PULSE_LEN_MIN                ((uint_fast8_t)(F_INTERRUPTS * MERLIN_BIT_PULSE_TIME * MIN_TOLERANCE_30 + 0.5) - 1)
-#define MERLIN_BIT_PULSE_LEN_MAX                ((uint_fast8_t)(F_INTERRUPTS * MERLIN_BIT_PULSE_TIME * MAX_TOLERANCE_30 + 0.5) + 1)
-#define MERLIN_BIT_PAUSE_LEN_MIN                ((uint_fast8_t)(F_INTERRUPTS * MERLIN_BIT_PAUSE_TIME * MIN_TOLERANCE_30 + 0.5) - 1)
-#define MERLIN_BIT_PAUSE_LEN_MAX                ((uint_fast8_t)(F_INTERRUPTS * MERLIN_BIT_PAUSE_TIME * MAX_TOLERANCE_30 + 0.5) + 1)
-
-#define ORTEK_START_BIT_PULSE_LEN_MIN           ((uint_fast8_t)(F_INTERRUPTS * ORTEK_START_BIT_PULSE_TIME * MIN_TOLERANCE_10 + 0.5) - 1)
-#define ORTEK_START_BIT_PULSE_LEN_MAX           ((uint_fast8_t)(F_INTERRUPTS * ORTEK_START_BIT_PULSE_TIME * MAX_TOLERANCE_10 + 0.5) + 1)
-#define ORTEK_START_BIT_PAUSE_LEN_MIN           ((uint_fast8_t)(F_INTERRUPTS * ORTEK_START_BIT_PAUSE_TIME * MIN_TOLERANCE_10 + 0.5) - 1)
-#define ORTEK_START_BIT_PAUSE_LEN_MAX           ((uint_fast8_t)(F_INTERRUPTS * ORTEK_START_BIT_PAUSE_TIME * MAX_TOLERANCE_10 + 0.5) + 1)
-#define ORTEK_BIT_PULSE_LEN_MIN                 ((uint_fast8_t)(F_INTERRUPTS * ORTEK_BIT_TIME * MIN_TOLERANCE_10 + 0.5) - 1)
-#define ORTEK_BIT_PULSE_LEN_MAX                 ((uint_fast8_t)(F_INTERRUPTS * ORTEK_BIT_TIME * MAX_TOLERANCE_10 + 0.5) + 1)
-#define ORTEK_BIT_PAUSE_LEN_MIN                 ((uint_fast8_t)(F_INTERRUPTS * ORTEK_BIT_TIME * MIN_TOLERANCE_10 + 0.5) - 1)
-#define ORTEK_BIT_PAUSE_LEN_MAX                 ((uint_fast8_t)(F_INTERRUPTS * ORTEK_BIT_TIME * MAX_TOLERANCE_10 + 0.5) + 1)
-
-#define TELEFUNKEN_START_BIT_PULSE_LEN_MIN      ((uint_fast8_t)(F_INTERRUPTS * TELEFUNKEN_START_BIT_PULSE_TIME * MIN_TOLERANCE_10 + 0.5) - 1)
-#define TELEFUNKEN_START_BIT_PULSE_LEN_MAX      ((uint_fast8_t)(F_INTERRUPTS * TELEFUNKEN_START_BIT_PULSE_TIME * MAX_TOLERANCE_10 + 0.5) + 1)
-#define TELEFUNKEN_START_BIT_PAUSE_LEN_MIN      ((uint_fast8_t)(F_INTERRUPTS * (TELEFUNKEN_START_BIT_PAUSE_TIME) * MIN_TOLERANCE_10 + 0.5) - 1)
-#define TELEFUNKEN_START_BIT_PAUSE_LEN_MAX      ((uint_fast8_t)(F_INTERRUPTS * (TELEFUNKEN_START_BIT_PAUSE_TIME) * MAX_TOLERANCE_10 + 0.5) - 1)
-#define TELEFUNKEN_PULSE_LEN_MIN                ((uint_fast8_t)(F_INTERRUPTS * TELEFUNKEN_PULSE_TIME * MIN_TOLERANCE_30 + 0.5) - 1)
-#define TELEFUNKEN_PULSE_LEN_MAX                ((uint_fast8_t)(F_INTERRUPTS * TELEFUNKEN_PULSE_TIME * MAX_TOLERANCE_30 + 0.5) + 1)
-#define TELEFUNKEN_1_PAUSE_LEN_MIN              ((uint_fast8_t)(F_INTERRUPTS * TELEFUNKEN_1_PAUSE_TIME * MIN_TOLERANCE_30 + 0.5) - 1)
-#define TELEFUNKEN_1_PAUSE_LEN_MAX              ((uint_fast8_t)(F_INTERRUPTS * TELEFUNKEN_1_PAUSE_TIME * MAX_TOLERANCE_30 + 0.5) + 1)
-#define TELEFUNKEN_0_PAUSE_LEN_MIN              ((uint_fast8_t)(F_INTERRUPTS * TELEFUNKEN_0_PAUSE_TIME * MIN_TOLERANCE_30 + 0.5) - 1)
-#define TELEFUNKEN_0_PAUSE_LEN_MAX              ((uint_fast8_t)(F_INTERRUPTS * TELEFUNKEN_0_PAUSE_TIME * MAX_TOLERANCE_30 + 0.5) + 1)
+#define A1TVBOX_START_BIT_PULSE_LEN_MIN         ((IRMP_TICK8_T)(F_INTERRUPTS * A1TVBOX_START_BIT_PULSE_TIME * MIN_TOLERANCE_10 + 0.5) - 1)
+#define A1TVBOX_START_BIT_PULSE_LEN_MAX         ((IRMP_TICK8_T)(F_INTERRUPTS * A1TVBOX_START_BIT_PULSE_TIME * MAX_TOLERANCE_20 + 0.5) + 1)
+#define A1TVBOX_START_BIT_PAUSE_LEN_MIN         ((IRMP_TICK8_T)(F_INTERRUPTS * A1TVBOX_START_BIT_PAUSE_TIME * MIN_TOLERANCE_20 + 0.5) - 1)
+#define A1TVBOX_START_BIT_PAUSE_LEN_MAX         ((IRMP_TICK8_T)(F_INTERRUPTS * A1TVBOX_START_BIT_PAUSE_TIME * MAX_TOLERANCE_00 + 0.5) + 1)
+#define A1TVBOX_BIT_PULSE_LEN_MIN               ((IRMP_TICK8_T)(F_INTERRUPTS * A1TVBOX_BIT_PULSE_TIME * MIN_TOLERANCE_05 + 0.5) - 1)
+#define A1TVBOX_BIT_PULSE_LEN_MAX               ((IRMP_TICK8_T)(F_INTERRUPTS * A1TVBOX_BIT_PULSE_TIME * MAX_TOLERANCE_30 + 0.5) + 1)
+#define A1TVBOX_BIT_PAUSE_LEN_MIN               ((IRMP_TICK8_T)(F_INTERRUPTS * A1TVBOX_BIT_PAUSE_TIME * MIN_TOLERANCE_00 + 0.5) - 0)
+#define A1TVBOX_BIT_PAUSE_LEN_MAX               ((IRMP_TICK8_T)(F_INTERRUPTS * A1TVBOX_BIT_PAUSE_TIME * MAX_TOLERANCE_20 + 0.5) + 1)
+
+#define MERLIN_START_BIT_PULSE_LEN_MIN          ((IRMP_TICK8_T)(F_INTERRUPTS * MERLIN_START_BIT_PULSE_TIME * MIN_TOLERANCE_10 + 0.5) - 1)
+#define MERLIN_START_BIT_PULSE_LEN_MAX          ((IRMP_TICK8_T)(F_INTERRUPTS * MERLIN_START_BIT_PULSE_TIME * MAX_TOLERANCE_10 + 0.5) + 1)
+#define MERLIN_START_BIT_PAUSE_LEN_MIN          ((IRMP_TICK8_T)(F_INTERRUPTS * MERLIN_START_BIT_PAUSE_TIME * MIN_TOLERANCE_10 + 0.5) - 1)
+#define MERLIN_START_BIT_PAUSE_LEN_MAX          ((IRMP_TICK8_T)(F_INTERRUPTS * MERLIN_START_BIT_PAUSE_TIME * MAX_TOLERANCE_10 + 0.5) + 1)
+#define MERLIN_BIT_PULSE_LEN_MIN                ((IRMP_TICK8_T)(F_INTERRUPTS * MERLIN_BIT_PULSE_TIME * MIN_TOLERANCE_30 + 0.5) - 1)
+#define MERLIN_BIT_PULSE_LEN_MAX                ((IRMP_TICK8_T)(F_INTERRUPTS * MERLIN_BIT_PULSE_TIME * MAX_TOLERANCE_30 + 0.5) + 1)
+#define MERLIN_BIT_PAUSE_LEN_MIN                ((IRMP_TICK8_T)(F_INTERRUPTS * MERLIN_BIT_PAUSE_TIME * MIN_TOLERANCE_30 + 0.5) - 1)
+#define MERLIN_BIT_PAUSE_LEN_MAX                ((IRMP_TICK8_T)(F_INTERRUPTS * MERLIN_BIT_PAUSE_TIME * MAX_TOLERANCE_30 + 0.5) + 1)
+
+#define ORTEK_START_BIT_PULSE_LEN_MIN           ((IRMP_TICK8_T)(F_INTERRUPTS * ORTEK_START_BIT_PULSE_TIME * MIN_TOLERANCE_10 + 0.5) - 1)
+#define ORTEK_START_BIT_PULSE_LEN_MAX           ((IRMP_TICK8_T)(F_INTERRUPTS * ORTEK_START_BIT_PULSE_TIME * MAX_TOLERANCE_10 + 0.5) + 1)
+#define ORTEK_START_BIT_PAUSE_LEN_MIN           ((IRMP_TICK8_T)(F_INTERRUPTS * ORTEK_START_BIT_PAUSE_TIME * MIN_TOLERANCE_10 + 0.5) - 1)
+#define ORTEK_START_BIT_PAUSE_LEN_MAX           ((IRMP_TICK8_T)(F_INTERRUPTS * ORTEK_START_BIT_PAUSE_TIME * MAX_TOLERANCE_10 + 0.5) + 1)
+#define ORTEK_BIT_PULSE_LEN_MIN                 ((IRMP_TICK8_T)(F_INTERRUPTS * ORTEK_BIT_TIME * MIN_TOLERANCE_10 + 0.5) - 1)
+#define ORTEK_BIT_PULSE_LEN_MAX                 ((IRMP_TICK8_T)(F_INTERRUPTS * ORTEK_BIT_TIME * MAX_TOLERANCE_10 + 0.5) + 1)
+#define ORTEK_BIT_PAUSE_LEN_MIN                 ((IRMP_TICK8_T)(F_INTERRUPTS * ORTEK_BIT_TIME * MIN_TOLERANCE_10 + 0.5) - 1)
+#define ORTEK_BIT_PAUSE_LEN_MAX                 ((IRMP_TICK8_T)(F_INTERRUPTS * ORTEK_BIT_TIME * MAX_TOLERANCE_10 + 0.5) + 1)
+
+#define TELEFUNKEN_START_BIT_PULSE_LEN_MIN      ((IRMP_TICK8_T)(F_INTERRUPTS * TELEFUNKEN_START_BIT_PULSE_TIME * MIN_TOLERANCE_10 + 0.5) - 1)
+#define TELEFUNKEN_START_BIT_PULSE_LEN_MAX      ((IRMP_TICK8_T)(F_INTERRUPTS * TELEFUNKEN_START_BIT_PULSE_TIME * MAX_TOLERANCE_10 + 0.5) + 1)
+#define TELEFUNKEN_START_BIT_PAUSE_LEN_MIN      ((IRMP_TICK8_T)(F_INTERRUPTS * (TELEFUNKEN_START_BIT_PAUSE_TIME) * MIN_TOLERANCE_10 + 0.5) - 1)
+#define TELEFUNKEN_START_BIT_PAUSE_LEN_MAX      ((IRMP_TICK8_T)(F_INTERRUPTS * (TELEFUNKEN_START_BIT_PAUSE_TIME) * MAX_TOLERANCE_10 + 0.5) - 1)
+#define TELEFUNKEN_PULSE_LEN_MIN                ((IRMP_TICK8_T)(F_INTERRUPTS * TELEFUNKEN_PULSE_TIME * MIN_TOLERANCE_30 + 0.5) - 1)
+#define TELEFUNKEN_PULSE_LEN_MAX                ((IRMP_TICK8_T)(F_INTERRUPTS * TELEFUNKEN_PULSE_TIME * MAX_TOLERANCE_30 + 0.5) + 1)
+#define TELEFUNKEN_1_PAUSE_LEN_MIN              ((IRMP_TICK8_T)(F_INTERRUPTS * TELEFUNKEN_1_PAUSE_TIME * MIN_TOLERANCE_30 + 0.5) - 1)
+#define TELEFUNKEN_1_PAUSE_LEN_MAX              ((IRMP_TICK8_T)(F_INTERRUPTS * TELEFUNKEN_1_PAUSE_TIME * MAX_TOLERANCE_30 + 0.5) + 1)
+#define TELEFUNKEN_0_PAUSE_LEN_MIN              ((IRMP_TICK8_T)(F_INTERRUPTS * TELEFUNKEN_0_PAUSE_TIME * MIN_TOLERANCE_30 + 0.5) - 1)
+#define TELEFUNKEN_0_PAUSE_LEN_MAX              ((IRMP_TICK8_T)(F_INTERRUPTS * TELEFUNKEN_0_PAUSE_TIME * MAX_TOLERANCE_30 + 0.5) + 1)
 // autodetect TELEFUNKEN repetition frame within 50 msec:
 // #define TELEFUNKEN_FRAME_REPEAT_PAUSE_LEN_MAX   (uint_fast16_t)(F_INTERRUPTS * TELEFUNKEN_FRAME_REPEAT_PAUSE_TIME * MAX_TOLERANCE_20 + 0.5)
 
-#define ROOMBA_START_BIT_PULSE_LEN_MIN          ((uint_fast8_t)(F_INTERRUPTS * ROOMBA_START_BIT_PULSE_TIME * MIN_TOLERANCE_10 + 0.5) - 1)
-#define ROOMBA_START_BIT_PULSE_LEN_MAX          ((uint_fast8_t)(F_INTERRUPTS * ROOMBA_START_BIT_PULSE_TIME * MAX_TOLERANCE_10 + 0.5) + 1)
-#define ROOMBA_START_BIT_PAUSE_LEN_MIN          ((uint_fast8_t)(F_INTERRUPTS * ROOMBA_START_BIT_PAUSE_TIME * MIN_TOLERANCE_10 + 0.5) - 1)
-#define ROOMBA_START_BIT_PAUSE_LEN_MAX          ((uint_fast8_t)(F_INTERRUPTS * ROOMBA_START_BIT_PAUSE_TIME * MAX_TOLERANCE_10 + 0.5) + 1)
-#define ROOMBA_1_PAUSE_LEN_EXACT                ((uint_fast8_t)(F_INTERRUPTS * ROOMBA_1_PAUSE_TIME + 0.5))
-#define ROOMBA_1_PULSE_LEN_MIN                  ((uint_fast8_t)(F_INTERRUPTS * ROOMBA_1_PULSE_TIME * MIN_TOLERANCE_20 + 0.5) - 1)
-#define ROOMBA_1_PULSE_LEN_MAX                  ((uint_fast8_t)(F_INTERRUPTS * ROOMBA_1_PULSE_TIME * MAX_TOLERANCE_20 + 0.5) + 1)
-#define ROOMBA_1_PAUSE_LEN_MIN                  ((uint_fast8_t)(F_INTERRUPTS * ROOMBA_1_PAUSE_TIME * MIN_TOLERANCE_20 + 0.5) - 1)
-#define ROOMBA_1_PAUSE_LEN_MAX                  ((uint_fast8_t)(F_INTERRUPTS * ROOMBA_1_PAUSE_TIME * MAX_TOLERANCE_20 + 0.5) + 1)
-#define ROOMBA_0_PAUSE_LEN                      ((uint_fast8_t)(F_INTERRUPTS * ROOMBA_0_PAUSE_TIME))
-#define ROOMBA_0_PULSE_LEN_MIN                  ((uint_fast8_t)(F_INTERRUPTS * ROOMBA_0_PULSE_TIME * MIN_TOLERANCE_20 + 0.5) - 1)
-#define ROOMBA_0_PULSE_LEN_MAX                  ((uint_fast8_t)(F_INTERRUPTS * ROOMBA_0_PULSE_TIME * MAX_TOLERANCE_20 + 0.5) + 1)
-#define ROOMBA_0_PAUSE_LEN_MIN                  ((uint_fast8_t)(F_INTERRUPTS * ROOMBA_0_PAUSE_TIME * MIN_TOLERANCE_20 + 0.5) - 1)
-#define ROOMBA_0_PAUSE_LEN_MAX                  ((uint_fast8_t)(F_INTERRUPTS * ROOMBA_0_PAUSE_TIME * MAX_TOLERANCE_20 + 0.5) + 1)
-
-#define RCMM32_START_BIT_PULSE_LEN_MIN          ((uint_fast8_t)(F_INTERRUPTS * RCMM32_START_BIT_PULSE_TIME * MIN_TOLERANCE_05 + 0.5) - 1)
-#define RCMM32_START_BIT_PULSE_LEN_MAX          ((uint_fast8_t)(F_INTERRUPTS * RCMM32_START_BIT_PULSE_TIME * MAX_TOLERANCE_05 + 0.5) + 1)
-#define RCMM32_START_BIT_PAUSE_LEN_MIN          ((uint_fast8_t)(F_INTERRUPTS * RCMM32_START_BIT_PAUSE_TIME * MIN_TOLERANCE_05 + 0.5) - 1)
-#define RCMM32_START_BIT_PAUSE_LEN_MAX          ((uint_fast8_t)(F_INTERRUPTS * RCMM32_START_BIT_PAUSE_TIME * MAX_TOLERANCE_05 + 0.5) + 1)
-#define RCMM32_BIT_PULSE_LEN_MIN                ((uint_fast8_t)(F_INTERRUPTS * RCMM32_PULSE_TIME * MIN_TOLERANCE_05 + 0.5) - 1)
-#define RCMM32_BIT_PULSE_LEN_MAX                ((uint_fast8_t)(F_INTERRUPTS * RCMM32_PULSE_TIME * MAX_TOLERANCE_05 + 0.5) + 1)
-#define RCMM32_BIT_00_PAUSE_LEN_MIN             ((uint_fast8_t)(F_INTERRUPTS * RCMM32_00_PAUSE_TIME * MIN_TOLERANCE_05 + 0.5) - 1)
-#define RCMM32_BIT_00_PAUSE_LEN_MAX             ((uint_fast8_t)(F_INTERRUPTS * RCMM32_00_PAUSE_TIME * MAX_TOLERANCE_05 + 0.5) + 1)
-#define RCMM32_BIT_01_PAUSE_LEN_MIN             ((uint_fast8_t)(F_INTERRUPTS * RCMM32_01_PAUSE_TIME * MIN_TOLERANCE_05 + 0.5) - 1)
-#define RCMM32_BIT_01_PAUSE_LEN_MAX             ((uint_fast8_t)(F_INTERRUPTS * RCMM32_01_PAUSE_TIME * MAX_TOLERANCE_05 + 0.5) + 1)
-#define RCMM32_BIT_10_PAUSE_LEN_MIN             ((uint_fast8_t)(F_INTERRUPTS * RCMM32_10_PAUSE_TIME * MIN_TOLERANCE_05 + 0.5) - 1)
-#define RCMM32_BIT_10_PAUSE_LEN_MAX             ((uint_fast8_t)(F_INTERRUPTS * RCMM32_10_PAUSE_TIME * MAX_TOLERANCE_05 + 0.5) + 1)
-#define RCMM32_BIT_11_PAUSE_LEN_MIN             ((uint_fast8_t)(F_INTERRUPTS * RCMM32_11_PAUSE_TIME * MIN_TOLERANCE_05 + 0.5) - 1)
-#define RCMM32_BIT_11_PAUSE_LEN_MAX             ((uint_fast8_t)(F_INTERRUPTS * RCMM32_11_PAUSE_TIME * MAX_TOLERANCE_05 + 0.5) + 1)
-
-#define PENTAX_START_BIT_PULSE_LEN_MIN          ((uint_fast8_t)(F_INTERRUPTS * PENTAX_START_BIT_PULSE_TIME * MIN_TOLERANCE_10 + 0.5) - 1)
-#define PENTAX_START_BIT_PULSE_LEN_MAX          ((uint_fast8_t)(F_INTERRUPTS * PENTAX_START_BIT_PULSE_TIME * MAX_TOLERANCE_10 + 0.5) + 1)
-#define PENTAX_START_BIT_PAUSE_LEN_MIN          ((uint_fast8_t)(F_INTERRUPTS * PENTAX_START_BIT_PAUSE_TIME * MIN_TOLERANCE_10 + 0.5) - 1)
-#define PENTAX_START_BIT_PAUSE_LEN_MAX          ((uint_fast8_t)(F_INTERRUPTS * PENTAX_START_BIT_PAUSE_TIME * MAX_TOLERANCE_10 + 0.5) + 1)
-#define PENTAX_1_PAUSE_LEN_EXACT                ((uint_fast8_t)(F_INTERRUPTS * PENTAX_1_PAUSE_TIME + 0.5))
-#define PENTAX_PULSE_LEN_MIN                    ((uint_fast8_t)(F_INTERRUPTS * PENTAX_PULSE_TIME * MIN_TOLERANCE_20 + 0.5) - 1)
-#define PENTAX_PULSE_LEN_MAX                    ((uint_fast8_t)(F_INTERRUPTS * PENTAX_PULSE_TIME * MAX_TOLERANCE_20 + 0.5) + 1)
-#define PENTAX_1_PAUSE_LEN_MIN                  ((uint_fast8_t)(F_INTERRUPTS * PENTAX_1_PAUSE_TIME * MIN_TOLERANCE_20 + 0.5) - 1)
-#define PENTAX_1_PAUSE_LEN_MAX                  ((uint_fast8_t)(F_INTERRUPTS * PENTAX_1_PAUSE_TIME * MAX_TOLERANCE_20 + 0.5) + 1)
-#define PENTAX_0_PAUSE_LEN                      ((uint_fast8_t)(F_INTERRUPTS * PENTAX_0_PAUSE_TIME))
-#define PENTAX_PULSE_LEN_MIN                    ((uint_fast8_t)(F_INTERRUPTS * PENTAX_PULSE_TIME * MIN_TOLERANCE_20 + 0.5) - 1)
-#define PENTAX_PULSE_LEN_MAX                    ((uint_fast8_t)(F_INTERRUPTS * PENTAX_PULSE_TIME * MAX_TOLERANCE_20 + 0.5) + 1)
-#define PENTAX_0_PAUSE_LEN_MIN                  ((uint_fast8_t)(F_INTERRUPTS * PENTAX_0_PAUSE_TIME * MIN_TOLERANCE_20 + 0.5) - 1)
-#define PENTAX_0_PAUSE_LEN_MAX                  ((uint_fast8_t)(F_INTERRUPTS * PENTAX_0_PAUSE_TIME * MAX_TOLERANCE_20 + 0.5) + 1)
-
-#define ACP24_START_BIT_PULSE_LEN_MIN           ((uint_fast8_t)(F_INTERRUPTS * ACP24_START_BIT_PULSE_TIME * MIN_TOLERANCE_15 + 0.5) - 1)
-#define ACP24_START_BIT_PULSE_LEN_MAX           ((uint_fast8_t)(F_INTERRUPTS * ACP24_START_BIT_PULSE_TIME * MAX_TOLERANCE_15 + 0.5) + 1)
-#define ACP24_START_BIT_PAUSE_LEN_MIN           ((uint_fast8_t)(F_INTERRUPTS * ACP24_START_BIT_PAUSE_TIME * MIN_TOLERANCE_15 + 0.5) - 1)
-#define ACP24_START_BIT_PAUSE_LEN_MAX           ((uint_fast8_t)(F_INTERRUPTS * ACP24_START_BIT_PAUSE_TIME * MAX_TOLERANCE_15 + 0.5) + 1)
-#define ACP24_PULSE_LEN_MIN                     ((uint_fast8_t)(F_INTERRUPTS * ACP24_PULSE_TIME * MIN_TOLERANCE_15 + 0.5) - 1)
-#define ACP24_PULSE_LEN_MAX                     ((uint_fast8_t)(F_INTERRUPTS * ACP24_PULSE_TIME * MAX_TOLERANCE_15 + 0.5) + 1)
-#define ACP24_1_PAUSE_LEN_MIN                   ((uint_fast8_t)(F_INTERRUPTS * ACP24_1_PAUSE_TIME * MIN_TOLERANCE_15 + 0.5) - 1)
-#define ACP24_1_PAUSE_LEN_MAX                   ((uint_fast8_t)(F_INTERRUPTS * ACP24_1_PAUSE_TIME * MAX_TOLERANCE_15 + 0.5) + 1)
-#define ACP24_0_PAUSE_LEN_MIN                   ((uint_fast8_t)(F_INTERRUPTS * ACP24_0_PAUSE_TIME * MIN_TOLERANCE_15 + 0.5) - 1)
-#define ACP24_0_PAUSE_LEN_MAX                   ((uint_fast8_t)(F_INTERRUPTS * ACP24_0_PAUSE_TIME * MAX_TOLERANCE_15 + 0.5) + 1)
-
-#define METZ_START_BIT_PULSE_LEN_MIN            ((uint_fast8_t)(F_INTERRUPTS * METZ_START_BIT_PULSE_TIME * MIN_TOLERANCE_05 + 0.5) - 1)
-#define METZ_START_BIT_PULSE_LEN_MAX            ((uint_fast8_t)(F_INTERRUPTS * METZ_START_BIT_PULSE_TIME * MAX_TOLERANCE_05 + 0.5) + 1)
-#define METZ_START_BIT_PAUSE_LEN_MIN            ((uint_fast8_t)(F_INTERRUPTS * METZ_START_BIT_PAUSE_TIME * MIN_TOLERANCE_05 + 0.5) - 1)
-#define METZ_START_BIT_PAUSE_LEN_MAX            ((uint_fast8_t)(F_INTERRUPTS * METZ_START_BIT_PAUSE_TIME * MAX_TOLERANCE_05 + 0.5) + 1)
-#define METZ_PULSE_LEN_MIN                      ((uint_fast8_t)(F_INTERRUPTS * METZ_PULSE_TIME * MIN_TOLERANCE_20 + 0.5) - 1)
-#define METZ_PULSE_LEN_MAX                      ((uint_fast8_t)(F_INTERRUPTS * METZ_PULSE_TIME * MAX_TOLERANCE_20 + 0.5) + 1)
-#define METZ_1_PAUSE_LEN_MIN                    ((uint_fast8_t)(F_INTERRUPTS * METZ_1_PAUSE_TIME * MIN_TOLERANCE_20 + 0.5) - 1)
-#define METZ_1_PAUSE_LEN_MAX                    ((uint_fast8_t)(F_INTERRUPTS * METZ_1_PAUSE_TIME * MAX_TOLERANCE_20 + 0.5) + 1)
-#define METZ_0_PAUSE_LEN_MIN                    ((uint_fast8_t)(F_INTERRUPTS * METZ_0_PAUSE_TIME * MIN_TOLERANCE_20 + 0.5) - 1)
-#define METZ_0_PAUSE_LEN_MAX                    ((uint_fast8_t)(F_INTERRUPTS * METZ_0_PAUSE_TIME * MAX_TOLERANCE_20 + 0.5) + 1)
+#define ROOMBA_START_BIT_PULSE_LEN_MIN          ((IRMP_TICK8_T)(F_INTERRUPTS * ROOMBA_START_BIT_PULSE_TIME * MIN_TOLERANCE_10 + 0.5) - 1)
+#define ROOMBA_START_BIT_PULSE_LEN_MAX          ((IRMP_TICK8_T)(F_INTERRUPTS * ROOMBA_START_BIT_PULSE_TIME * MAX_TOLERANCE_10 + 0.5) + 1)
+#define ROOMBA_START_BIT_PAUSE_LEN_MIN          ((IRMP_TICK8_T)(F_INTERRUPTS * ROOMBA_START_BIT_PAUSE_TIME * MIN_TOLERANCE_10 + 0.5) - 1)
+#define ROOMBA_START_BIT_PAUSE_LEN_MAX          ((IRMP_TICK8_T)(F_INTERRUPTS * ROOMBA_START_BIT_PAUSE_TIME * MAX_TOLERANCE_10 + 0.5) + 1)
+#define ROOMBA_1_PAUSE_LEN_EXACT                ((IRMP_TICK8_T)(F_INTERRUPTS * ROOMBA_1_PAUSE_TIME + 0.5))
+#define ROOMBA_1_PULSE_LEN_MIN                  ((IRMP_TICK8_T)(F_INTERRUPTS * ROOMBA_1_PULSE_TIME * MIN_TOLERANCE_20 + 0.5) - 1)
+#define ROOMBA_1_PULSE_LEN_MAX                  ((IRMP_TICK8_T)(F_INTERRUPTS * ROOMBA_1_PULSE_TIME * MAX_TOLERANCE_20 + 0.5) + 1)
+#define ROOMBA_1_PAUSE_LEN_MIN                  ((IRMP_TICK8_T)(F_INTERRUPTS * ROOMBA_1_PAUSE_TIME * MIN_TOLERANCE_20 + 0.5) - 1)
+#define ROOMBA_1_PAUSE_LEN_MAX                  ((IRMP_TICK8_T)(F_INTERRUPTS * ROOMBA_1_PAUSE_TIME * MAX_TOLERANCE_20 + 0.5) + 1)
+#define ROOMBA_0_PAUSE_LEN                      ((IRMP_TICK8_T)(F_INTERRUPTS * ROOMBA_0_PAUSE_TIME))
+#define ROOMBA_0_PULSE_LEN_MIN                  ((IRMP_TICK8_T)(F_INTERRUPTS * ROOMBA_0_PULSE_TIME * MIN_TOLERANCE_20 + 0.5) - 1)
+#define ROOMBA_0_PULSE_LEN_MAX                  ((IRMP_TICK8_T)(F_INTERRUPTS * ROOMBA_0_PULSE_TIME * MAX_TOLERANCE_20 + 0.5) + 1)
+#define ROOMBA_0_PAUSE_LEN_MIN                  ((IRMP_TICK8_T)(F_INTERRUPTS * ROOMBA_0_PAUSE_TIME * MIN_TOLERANCE_20 + 0.5) - 1)
+#define ROOMBA_0_PAUSE_LEN_MAX                  ((IRMP_TICK8_T)(F_INTERRUPTS * ROOMBA_0_PAUSE_TIME * MAX_TOLERANCE_20 + 0.5) + 1)
+
+#define RCMM32_START_BIT_PULSE_LEN_MIN          ((IRMP_TICK8_T)(F_INTERRUPTS * RCMM32_START_BIT_PULSE_TIME * MIN_TOLERANCE_05 + 0.5) - 1)
+#define RCMM32_START_BIT_PULSE_LEN_MAX          ((IRMP_TICK8_T)(F_INTERRUPTS * RCMM32_START_BIT_PULSE_TIME * MAX_TOLERANCE_05 + 0.5) + 1)
+#define RCMM32_START_BIT_PAUSE_LEN_MIN          ((IRMP_TICK8_T)(F_INTERRUPTS * RCMM32_START_BIT_PAUSE_TIME * MIN_TOLERANCE_05 + 0.5) - 1)
+#define RCMM32_START_BIT_PAUSE_LEN_MAX          ((IRMP_TICK8_T)(F_INTERRUPTS * RCMM32_START_BIT_PAUSE_TIME * MAX_TOLERANCE_05 + 0.5) + 1)
+#define RCMM32_BIT_PULSE_LEN_MIN                ((IRMP_TICK8_T)(F_INTERRUPTS * RCMM32_PULSE_TIME * MIN_TOLERANCE_05 + 0.5) - 1)
+#define RCMM32_BIT_PULSE_LEN_MAX                ((IRMP_TICK8_T)(F_INTERRUPTS * RCMM32_PULSE_TIME * MAX_TOLERANCE_05 + 0.5) + 1)
+#define RCMM32_BIT_00_PAUSE_LEN_MIN             ((IRMP_TICK8_T)(F_INTERRUPTS * RCMM32_00_PAUSE_TIME * MIN_TOLERANCE_05 + 0.5) - 1)
+#define RCMM32_BIT_00_PAUSE_LEN_MAX             ((IRMP_TICK8_T)(F_INTERRUPTS * RCMM32_00_PAUSE_TIME * MAX_TOLERANCE_05 + 0.5) + 1)
+#define RCMM32_BIT_01_PAUSE_LEN_MIN             ((IRMP_TICK8_T)(F_INTERRUPTS * RCMM32_01_PAUSE_TIME * MIN_TOLERANCE_05 + 0.5) - 1)
+#define RCMM32_BIT_01_PAUSE_LEN_MAX             ((IRMP_TICK8_T)(F_INTERRUPTS * RCMM32_01_PAUSE_TIME * MAX_TOLERANCE_05 + 0.5) + 1)
+#define RCMM32_BIT_10_PAUSE_LEN_MIN             ((IRMP_TICK8_T)(F_INTERRUPTS * RCMM32_10_PAUSE_TIME * MIN_TOLERANCE_05 + 0.5) - 1)
+#define RCMM32_BIT_10_PAUSE_LEN_MAX             ((IRMP_TICK8_T)(F_INTERRUPTS * RCMM32_10_PAUSE_TIME * MAX_TOLERANCE_05 + 0.5) + 1)
+#define RCMM32_BIT_11_PAUSE_LEN_MIN             ((IRMP_TICK8_T)(F_INTERRUPTS * RCMM32_11_PAUSE_TIME * MIN_TOLERANCE_05 + 0.5) - 1)
+#define RCMM32_BIT_11_PAUSE_LEN_MAX             ((IRMP_TICK8_T)(F_INTERRUPTS * RCMM32_11_PAUSE_TIME * MAX_TOLERANCE_05 + 0.5) + 1)
+
+#define PENTAX_START_BIT_PULSE_LEN_MIN          ((IRMP_TICK8_T)(F_INTERRUPTS * PENTAX_START_BIT_PULSE_TIME * MIN_TOLERANCE_10 + 0.5) - 1)
+#define PENTAX_START_BIT_PULSE_LEN_MAX          ((IRMP_TICK8_T)(F_INTERRUPTS * PENTAX_START_BIT_PULSE_TIME * MAX_TOLERANCE_10 + 0.5) + 1)
+#define PENTAX_START_BIT_PAUSE_LEN_MIN          ((IRMP_TICK8_T)(F_INTERRUPTS * PENTAX_START_BIT_PAUSE_TIME * MIN_TOLERANCE_10 + 0.5) - 1)
+#define PENTAX_START_BIT_PAUSE_LEN_MAX          ((IRMP_TICK8_T)(F_INTERRUPTS * PENTAX_START_BIT_PAUSE_TIME * MAX_TOLERANCE_10 + 0.5) + 1)
+#define PENTAX_1_PAUSE_LEN_EXACT                ((IRMP_TICK8_T)(F_INTERRUPTS * PENTAX_1_PAUSE_TIME + 0.5))
+#define PENTAX_PULSE_LEN_MIN                    ((IRMP_TICK8_T)(F_INTERRUPTS * PENTAX_PULSE_TIME * MIN_TOLERANCE_20 + 0.5) - 1)
+#define PENTAX_PULSE_LEN_MAX                    ((IRMP_TICK8_T)(F_INTERRUPTS * PENTAX_PULSE_TIME * MAX_TOLERANCE_20 + 0.5) + 1)
+#define PENTAX_1_PAUSE_LEN_MIN                  ((IRMP_TICK8_T)(F_INTERRUPTS * PENTAX_1_PAUSE_TIME * MIN_TOLERANCE_20 + 0.5) - 1)
+#define PENTAX_1_PAUSE_LEN_MAX                  ((IRMP_TICK8_T)(F_INTERRUPTS * PENTAX_1_PAUSE_TIME * MAX_TOLERANCE_20 + 0.5) + 1)
+#define PENTAX_0_PAUSE_LEN                      ((IRMP_TICK8_T)(F_INTERRUPTS * PENTAX_0_PAUSE_TIME))
+#define PENTAX_PULSE_LEN_MIN                    ((IRMP_TICK8_T)(F_INTERRUPTS * PENTAX_PULSE_TIME * MIN_TOLERANCE_20 + 0.5) - 1)
+#define PENTAX_PULSE_LEN_MAX                    ((IRMP_TICK8_T)(F_INTERRUPTS * PENTAX_PULSE_TIME * MAX_TOLERANCE_20 + 0.5) + 1)
+#define PENTAX_0_PAUSE_LEN_MIN                  ((IRMP_TICK8_T)(F_INTERRUPTS * PENTAX_0_PAUSE_TIME * MIN_TOLERANCE_20 + 0.5) - 1)
+#define PENTAX_0_PAUSE_LEN_MAX                  ((IRMP_TICK8_T)(F_INTERRUPTS * PENTAX_0_PAUSE_TIME * MAX_TOLERANCE_20 + 0.5) + 1)
+
+#define ACP24_START_BIT_PULSE_LEN_MIN           ((IRMP_TICK8_T)(F_INTERRUPTS * ACP24_START_BIT_PULSE_TIME * MIN_TOLERANCE_15 + 0.5) - 1)
+#define ACP24_START_BIT_PULSE_LEN_MAX           ((IRMP_TICK8_T)(F_INTERRUPTS * ACP24_START_BIT_PULSE_TIME * MAX_TOLERANCE_15 + 0.5) + 1)
+#define ACP24_START_BIT_PAUSE_LEN_MIN           ((IRMP_TICK8_T)(F_INTERRUPTS * ACP24_START_BIT_PAUSE_TIME * MIN_TOLERANCE_15 + 0.5) - 1)
+#define ACP24_START_BIT_PAUSE_LEN_MAX           ((IRMP_TICK8_T)(F_INTERRUPTS * ACP24_START_BIT_PAUSE_TIME * MAX_TOLERANCE_15 + 0.5) + 1)
+#define ACP24_PULSE_LEN_MIN                     ((IRMP_TICK8_T)(F_INTERRUPTS * ACP24_PULSE_TIME * MIN_TOLERANCE_15 + 0.5) - 1)
+#define ACP24_PULSE_LEN_MAX                     ((IRMP_TICK8_T)(F_INTERRUPTS * ACP24_PULSE_TIME * MAX_TOLERANCE_15 + 0.5) + 1)
+#define ACP24_1_PAUSE_LEN_MIN                   ((IRMP_TICK8_T)(F_INTERRUPTS * ACP24_1_PAUSE_TIME * MIN_TOLERANCE_15 + 0.5) - 1)
+#define ACP24_1_PAUSE_LEN_MAX                   ((IRMP_TICK8_T)(F_INTERRUPTS * ACP24_1_PAUSE_TIME * MAX_TOLERANCE_15 + 0.5) + 1)
+#define ACP24_0_PAUSE_LEN_MIN                   ((IRMP_TICK8_T)(F_INTERRUPTS * ACP24_0_PAUSE_TIME * MIN_TOLERANCE_15 + 0.5) - 1)
+#define ACP24_0_PAUSE_LEN_MAX                   ((IRMP_TICK8_T)(F_INTERRUPTS * ACP24_0_PAUSE_TIME * MAX_TOLERANCE_15 + 0.5) + 1)
+
+#define METZ_START_BIT_PULSE_LEN_MIN            ((IRMP_TICK8_T)(F_INTERRUPTS * METZ_START_BIT_PULSE_TIME * MIN_TOLERANCE_05 + 0.5) - 1)
+#define METZ_START_BIT_PULSE_LEN_MAX            ((IRMP_TICK8_T)(F_INTERRUPTS * METZ_START_BIT_PULSE_TIME * MAX_TOLERANCE_05 + 0.5) + 1)
+#define METZ_START_BIT_PAUSE_LEN_MIN            ((IRMP_TICK8_T)(F_INTERRUPTS * METZ_START_BIT_PAUSE_TIME * MIN_TOLERANCE_05 + 0.5) - 1)
+#define METZ_START_BIT_PAUSE_LEN_MAX            ((IRMP_TICK8_T)(F_INTERRUPTS * METZ_START_BIT_PAUSE_TIME * MAX_TOLERANCE_05 + 0.5) + 1)
+#define METZ_PULSE_LEN_MIN                      ((IRMP_TICK8_T)(F_INTERRUPTS * METZ_PULSE_TIME * MIN_TOLERANCE_20 + 0.5) - 1)
+#define METZ_PULSE_LEN_MAX                      ((IRMP_TICK8_T)(F_INTERRUPTS * METZ_PULSE_TIME * MAX_TOLERANCE_20 + 0.5) + 1)
+#define METZ_1_PAUSE_LEN_MIN                    ((IRMP_TICK8_T)(F_INTERRUPTS * METZ_1_PAUSE_TIME * MIN_TOLERANCE_20 + 0.5) - 1)
+#define METZ_1_PAUSE_LEN_MAX                    ((IRMP_TICK8_T)(F_INTERRUPTS * METZ_1_PAUSE_TIME * MAX_TOLERANCE_20 + 0.5) + 1)
+#define METZ_0_PAUSE_LEN_MIN                    ((IRMP_TICK8_T)(F_INTERRUPTS * METZ_0_PAUSE_TIME * MIN_TOLERANCE_20 + 0.5) - 1)
+#define METZ_0_PAUSE_LEN_MAX                    ((IRMP_TICK8_T)(F_INTERRUPTS * METZ_0_PAUSE_TIME * MAX_TOLERANCE_20 + 0.5) + 1)
 #define METZ_FRAME_REPEAT_PAUSE_LEN_MAX         (uint_fast16_t)(F_INTERRUPTS * METZ_FRAME_REPEAT_PAUSE_TIME * MAX_TOLERANCE_20 + 0.5)
 
-#define RF_GEN24_1_PAUSE_LEN_EXACT              ((uint_fast8_t)(F_INTERRUPTS * RF_GEN24_1_PAUSE_TIME + 0.5))
-#define RF_GEN24_1_PULSE_LEN_MIN                ((uint_fast8_t)(F_INTERRUPTS * RF_GEN24_1_PULSE_TIME * MIN_TOLERANCE_30 + 0.5) - 1)
-#define RF_GEN24_1_PULSE_LEN_MAX                ((uint_fast8_t)(F_INTERRUPTS * RF_GEN24_1_PULSE_TIME * MAX_TOLERANCE_30 + 0.5) + 1)
-#define RF_GEN24_1_PAUSE_LEN_MIN                ((uint_fast8_t)(F_INTERRUPTS * RF_GEN24_1_PAUSE_TIME * MIN_TOLERANCE_30 + 0.5) - 1)
-#define RF_GEN24_1_PAUSE_LEN_MAX                ((uint_fast8_t)(F_INTERRUPTS * RF_GEN24_1_PAUSE_TIME * MAX_TOLERANCE_30 + 0.5) + 1)
-#define RF_GEN24_0_PAUSE_LEN                    ((uint_fast8_t)(F_INTERRUPTS * RF_GEN24_0_PAUSE_TIME))
-#define RF_GEN24_0_PULSE_LEN_MIN                ((uint_fast8_t)(F_INTERRUPTS * RF_GEN24_0_PULSE_TIME * MIN_TOLERANCE_30 + 0.5) - 1)
-#define RF_GEN24_0_PULSE_LEN_MAX                ((uint_fast8_t)(F_INTERRUPTS * RF_GEN24_0_PULSE_TIME * MAX_TOLERANCE_30 + 0.5) + 1)
-#define RF_GEN24_0_PAUSE_LEN_MIN                ((uint_fast8_t)(F_INTERRUPTS * RF_GEN24_0_PAUSE_TIME * MIN_TOLERANCE_30 + 0.5) - 1)
-#define RF_GEN24_0_PAUSE_LEN_MAX                ((uint_fast8_t)(F_INTERRUPTS * RF_GEN24_0_PAUSE_TIME * MAX_TOLERANCE_30 + 0.5) + 1)
-
-#define RF_X10_START_BIT_PULSE_LEN_MIN          ((uint_fast8_t)(F_INTERRUPTS * RF_X10_START_BIT_PULSE_TIME * MIN_TOLERANCE_05 + 0.5) - 1)
-#define RF_X10_START_BIT_PULSE_LEN_MAX          ((uint_fast8_t)(F_INTERRUPTS * RF_X10_START_BIT_PULSE_TIME * MAX_TOLERANCE_05 + 0.5) + 1)
-#define RF_X10_START_BIT_PAUSE_LEN_MIN          ((uint_fast8_t)(F_INTERRUPTS * RF_X10_START_BIT_PAUSE_TIME * MIN_TOLERANCE_05 + 0.5) - 1)
-#define RF_X10_START_BIT_PAUSE_LEN_MAX          ((uint_fast8_t)(F_INTERRUPTS * RF_X10_START_BIT_PAUSE_TIME * MAX_TOLERANCE_05 + 0.5) + 1)
-#define RF_X10_1_PAUSE_LEN_EXACT                ((uint_fast8_t)(F_INTERRUPTS * RF_X10_1_PAUSE_TIME + 0.5))
-#define RF_X10_1_PULSE_LEN_MIN                  ((uint_fast8_t)(F_INTERRUPTS * RF_X10_1_PULSE_TIME * MIN_TOLERANCE_10 + 0.5) - 1)
-#define RF_X10_1_PULSE_LEN_MAX                  ((uint_fast8_t)(F_INTERRUPTS * RF_X10_1_PULSE_TIME * MAX_TOLERANCE_10 + 0.5) + 1)
-#define RF_X10_1_PAUSE_LEN_MIN                  ((uint_fast8_t)(F_INTERRUPTS * RF_X10_1_PAUSE_TIME * MIN_TOLERANCE_10 + 0.5) - 1)
-#define RF_X10_1_PAUSE_LEN_MAX                  ((uint_fast8_t)(F_INTERRUPTS * RF_X10_1_PAUSE_TIME * MAX_TOLERANCE_10 + 0.5) + 1)
-#define RF_X10_0_PAUSE_LEN                      ((uint_fast8_t)(F_INTERRUPTS * RF_X10_0_PAUSE_TIME))
-#define RF_X10_0_PULSE_LEN_MIN                  ((uint_fast8_t)(F_INTERRUPTS * RF_X10_0_PULSE_TIME * MIN_TOLERANCE_10 + 0.5) - 1)
-#define RF_X10_0_PULSE_LEN_MAX                  ((uint_fast8_t)(F_INTERRUPTS * RF_X10_0_PULSE_TIME * MAX_TOLERANCE_10 + 0.5) + 1)
-#define RF_X10_0_PAUSE_LEN_MIN                  ((uint_fast8_t)(F_INTERRUPTS * RF_X10_0_PAUSE_TIME * MIN_TOLERANCE_10 + 0.5) - 1)
-#define RF_X10_0_PAUSE_LEN_MAX                  ((uint_fast8_t)(F_INTERRUPTS * RF_X10_0_PAUSE_TIME * MAX_TOLERANCE_10 + 0.5) + 1)
-
-#define RF_MEDION_START_BIT_PULSE_LEN_MIN       ((uint_fast8_t)(F_INTERRUPTS * RF_MEDION_START_BIT_PULSE_TIME * MIN_TOLERANCE_05 + 0.5) - 1)
-#define RF_MEDION_START_BIT_PULSE_LEN_MAX       ((uint_fast8_t)(F_INTERRUPTS * RF_MEDION_START_BIT_PULSE_TIME * MAX_TOLERANCE_05 + 0.5) + 1)
-#define RF_MEDION_START_BIT_PAUSE_LEN_MIN       ((uint_fast8_t)(F_INTERRUPTS * RF_MEDION_START_BIT_PAUSE_TIME * MIN_TOLERANCE_05 + 0.5) - 1)
-#define RF_MEDION_START_BIT_PAUSE_LEN_MAX       ((uint_fast8_t)(F_INTERRUPTS * RF_MEDION_START_BIT_PAUSE_TIME * MAX_TOLERANCE_05 + 0.5) + 1)
-#define RF_MEDION_1_PAUSE_LEN_EXACT             ((uint_fast8_t)(F_INTERRUPTS * RF_MEDION_1_PAUSE_TIME + 0.5))
-#define RF_MEDION_1_PULSE_LEN_MIN               ((uint_fast8_t)(F_INTERRUPTS * RF_MEDION_1_PULSE_TIME * MIN_TOLERANCE_10 + 0.5) - 1)
-#define RF_MEDION_1_PULSE_LEN_MAX               ((uint_fast8_t)(F_INTERRUPTS * RF_MEDION_1_PULSE_TIME * MAX_TOLERANCE_10 + 0.5) + 1)
-#define RF_MEDION_1_PAUSE_LEN_MIN               ((uint_fast8_t)(F_INTERRUPTS * RF_MEDION_1_PAUSE_TIME * MIN_TOLERANCE_10 + 0.5) - 1)
-#define RF_MEDION_1_PAUSE_LEN_MAX               ((uint_fast8_t)(F_INTERRUPTS * RF_MEDION_1_PAUSE_TIME * MAX_TOLERANCE_10 + 0.5) + 1)
-#define RF_MEDION_0_PAUSE_LEN                   ((uint_fast8_t)(F_INTERRUPTS * RF_MEDION_0_PAUSE_TIME))
-#define RF_MEDION_0_PULSE_LEN_MIN               ((uint_fast8_t)(F_INTERRUPTS * RF_MEDION_0_PULSE_TIME * MIN_TOLERANCE_10 + 0.5) - 1)
-#define RF_MEDION_0_PULSE_LEN_MAX               ((uint_fast8_t)(F_INTERRUPTS * RF_MEDION_0_PULSE_TIME * MAX_TOLERANCE_10 + 0.5) + 1)
-#define RF_MEDION_0_PAUSE_LEN_MIN               ((uint_fast8_t)(F_INTERRUPTS * RF_MEDION_0_PAUSE_TIME * MIN_TOLERANCE_10 + 0.5) - 1)
-#define RF_MEDION_0_PAUSE_LEN_MAX               ((uint_fast8_t)(F_INTERRUPTS * RF_MEDION_0_PAUSE_TIME * MAX_TOLERANCE_10 + 0.5) + 1)
+#define RF_GEN24_1_PAUSE_LEN_EXACT              ((IRMP_TICK8_T)(F_INTERRUPTS * RF_GEN24_1_PAUSE_TIME + 0.5))
+#define RF_GEN24_1_PULSE_LEN_MIN                ((IRMP_TICK8_T)(F_INTERRUPTS * RF_GEN24_1_PULSE_TIME * MIN_TOLERANCE_30 + 0.5) - 1)
+#define RF_GEN24_1_PULSE_LEN_MAX                ((IRMP_TICK8_T)(F_INTERRUPTS * RF_GEN24_1_PULSE_TIME * MAX_TOLERANCE_30 + 0.5) + 1)
+#define RF_GEN24_1_PAUSE_LEN_MIN                ((IRMP_TICK8_T)(F_INTERRUPTS * RF_GEN24_1_PAUSE_TIME * MIN_TOLERANCE_30 + 0.5) - 1)
+#define RF_GEN24_1_PAUSE_LEN_MAX                ((IRMP_TICK8_T)(F_INTERRUPTS * RF_GEN24_1_PAUSE_TIME * MAX_TOLERANCE_30 + 0.5) + 1)
+#define RF_GEN24_0_PAUSE_LEN                    ((IRMP_TICK8_T)(F_INTERRUPTS * RF_GEN24_0_PAUSE_TIME))
+#define RF_GEN24_0_PULSE_LEN_MIN                ((IRMP_TICK8_T)(F_INTERRUPTS * RF_GEN24_0_PULSE_TIME * MIN_TOLERANCE_30 + 0.5) - 1)
+#define RF_GEN24_0_PULSE_LEN_MAX                ((IRMP_TICK8_T)(F_INTERRUPTS * RF_GEN24_0_PULSE_TIME * MAX_TOLERANCE_30 + 0.5) + 1)
+#define RF_GEN24_0_PAUSE_LEN_MIN                ((IRMP_TICK8_T)(F_INTERRUPTS * RF_GEN24_0_PAUSE_TIME * MIN_TOLERANCE_30 + 0.5) - 1)
+#define RF_GEN24_0_PAUSE_LEN_MAX                ((IRMP_TICK8_T)(F_INTERRUPTS * RF_GEN24_0_PAUSE_TIME * MAX_TOLERANCE_30 + 0.5) + 1)
+
+#define RF_X10_START_BIT_PULSE_LEN_MIN          ((IRMP_TICK8_T)(F_INTERRUPTS * RF_X10_START_BIT_PULSE_TIME * MIN_TOLERANCE_05 + 0.5) - 1)
+#define RF_X10_START_BIT_PULSE_LEN_MAX          ((IRMP_TICK8_T)(F_INTERRUPTS * RF_X10_START_BIT_PULSE_TIME * MAX_TOLERANCE_05 + 0.5) + 1)
+#define RF_X10_START_BIT_PAUSE_LEN_MIN          ((IRMP_TICK8_T)(F_INTERRUPTS * RF_X10_START_BIT_PAUSE_TIME * MIN_TOLERANCE_05 + 0.5) - 1)
+#define RF_X10_START_BIT_PAUSE_LEN_MAX          ((IRMP_TICK8_T)(F_INTERRUPTS * RF_X10_START_BIT_PAUSE_TIME * MAX_TOLERANCE_05 + 0.5) + 1)
+#define RF_X10_1_PAUSE_LEN_EXACT                ((IRMP_TICK8_T)(F_INTERRUPTS * RF_X10_1_PAUSE_TIME + 0.5))
+#define RF_X10_1_PULSE_LEN_MIN                  ((IRMP_TICK8_T)(F_INTERRUPTS * RF_X10_1_PULSE_TIME * MIN_TOLERANCE_10 + 0.5) - 1)
+#define RF_X10_1_PULSE_LEN_MAX                  ((IRMP_TICK8_T)(F_INTERRUPTS * RF_X10_1_PULSE_TIME * MAX_TOLERANCE_10 + 0.5) + 1)
+#define RF_X10_1_PAUSE_LEN_MIN                  ((IRMP_TICK8_T)(F_INTERRUPTS * RF_X10_1_PAUSE_TIME * MIN_TOLERANCE_10 + 0.5) - 1)
+#define RF_X10_1_PAUSE_LEN_MAX                  ((IRMP_TICK8_T)(F_INTERRUPTS * RF_X10_1_PAUSE_TIME * MAX_TOLERANCE_10 + 0.5) + 1)
+#define RF_X10_0_PAUSE_LEN                      ((IRMP_TICK8_T)(F_INTERRUPTS * RF_X10_0_PAUSE_TIME))
+#define RF_X10_0_PULSE_LEN_MIN                  ((IRMP_TICK8_T)(F_INTERRUPTS * RF_X10_0_PULSE_TIME * MIN_TOLERANCE_10 + 0.5) - 1)
+#define RF_X10_0_PULSE_LEN_MAX                  ((IRMP_TICK8_T)(F_INTERRUPTS * RF_X10_0_PULSE_TIME * MAX_TOLERANCE_10 + 0.5) + 1)
+#define RF_X10_0_PAUSE_LEN_MIN                  ((IRMP_TICK8_T)(F_INTERRUPTS * RF_X10_0_PAUSE_TIME * MIN_TOLERANCE_10 + 0.5) - 1)
+#define RF_X10_0_PAUSE_LEN_MAX                  ((IRMP_TICK8_T)(F_INTERRUPTS * RF_X10_0_PAUSE_TIME * MAX_TOLERANCE_10 + 0.5) + 1)
+
+#define RF_MEDION_START_BIT_PULSE_LEN_MIN       ((IRMP_TICK8_T)(F_INTERRUPTS * RF_MEDION_START_BIT_PULSE_TIME * MIN_TOLERANCE_05 + 0.5) - 1)
+#define RF_MEDION_START_BIT_PULSE_LEN_MAX       ((IRMP_TICK8_T)(F_INTERRUPTS * RF_MEDION_START_BIT_PULSE_TIME * MAX_TOLERANCE_05 + 0.5) + 1)
+#define RF_MEDION_START_BIT_PAUSE_LEN_MIN       ((IRMP_TICK8_T)(F_INTERRUPTS * RF_MEDION_START_BIT_PAUSE_TIME * MIN_TOLERANCE_05 + 0.5) - 1)
+#define RF_MEDION_START_BIT_PAUSE_LEN_MAX       ((IRMP_TICK8_T)(F_INTERRUPTS * RF_MEDION_START_BIT_PAUSE_TIME * MAX_TOLERANCE_05 + 0.5) + 1)
+#define RF_MEDION_1_PAUSE_LEN_EXACT             ((IRMP_TICK8_T)(F_INTERRUPTS * RF_MEDION_1_PAUSE_TIME + 0.5))
+#define RF_MEDION_1_PULSE_LEN_MIN               ((IRMP_TICK8_T)(F_INTERRUPTS * RF_MEDION_1_PULSE_TIME * MIN_TOLERANCE_10 + 0.5) - 1)
+#define RF_MEDION_1_PULSE_LEN_MAX               ((IRMP_TICK8_T)(F_INTERRUPTS * RF_MEDION_1_PULSE_TIME * MAX_TOLERANCE_10 + 0.5) + 1)
+#define RF_MEDION_1_PAUSE_LEN_MIN               ((IRMP_TICK8_T)(F_INTERRUPTS * RF_MEDION_1_PAUSE_TIME * MIN_TOLERANCE_10 + 0.5) - 1)
+#define RF_MEDION_1_PAUSE_LEN_MAX               ((IRMP_TICK8_T)(F_INTERRUPTS * RF_MEDION_1_PAUSE_TIME * MAX_TOLERANCE_10 + 0.5) + 1)
+#define RF_MEDION_0_PAUSE_LEN                   ((IRMP_TICK8_T)(F_INTERRUPTS * RF_MEDION_0_PAUSE_TIME))
+#define RF_MEDION_0_PULSE_LEN_MIN               ((IRMP_TICK8_T)(F_INTERRUPTS * RF_MEDION_0_PULSE_TIME * MIN_TOLERANCE_10 + 0.5) - 1)
+#define RF_MEDION_0_PULSE_LEN_MAX               ((IRMP_TICK8_T)(F_INTERRUPTS * RF_MEDION_0_PULSE_TIME * MAX_TOLERANCE_10 + 0.5) + 1)
+#define RF_MEDION_0_PAUSE_LEN_MIN               ((IRMP_TICK8_T)(F_INTERRUPTS * RF_MEDION_0_PAUSE_TIME * MIN_TOLERANCE_10 + 0.5) - 1)
+#define RF_MEDION_0_PAUSE_LEN_MAX               ((IRMP_TICK8_T)(F_INTERRUPTS * RF_MEDION_0_PAUSE_TIME * MAX_TOLERANCE_10 + 0.5) + 1)
 
 #define AUTO_FRAME_REPETITION_LEN               (uint_fast16_t)(F_INTERRUPTS * AUTO_FRAME_REPETITION_TIME + 0.5)        // use uint_fast16_t!
 
 #define STOP_BIT_PAUSE_TIME_MIN                 3000.0e-6                                                               // minimum stop bit pause time: 3.0 msec
-#define STOP_BIT_PAUSE_LEN_MIN                  ((uint_fast8_t)(F_INTERRUPTS * STOP_BIT_PAUSE_TIME_MIN + 0.5) + 1)      // minimum stop bit pause len
+#define STOP_BIT_PAUSE_LEN_MIN                  ((IRMP_TICK8_T)(F_INTERRUPTS * STOP_BIT_PAUSE_TIME_MIN + 0.5) + 1)      // minimum stop bit pause len
 
 // XC8 Compiler does not support variadic macros
 #if defined(ANALYZE)
@@ -678,8 +692,13 @@
 //#  define ANALYZE_ONLY_NORMAL_PRINTF(...)     { if (! silent && !verbose) { printf (__VA_ARGS__); } }
 #  define ANALYZE_ONLY_NORMAL_PRINTF1(a)        { if (! silent && !verbose) { printf (a); } }
 #  define ANALYZE_NEWLINE()                     { if (verbose)              { putchar ('\n');       } }
+#  if defined(__cplusplus)
+#    define IRMP_THREAD_LOCAL                   thread_local                // analyzer batch mode runs decoders in several threads
+#  else
+#    define IRMP_THREAD_LOCAL
+#  endif
 static int                                      silent;
-static int                                      time_counter;
+static IRMP_THREAD_LOCAL int                    time_counter;
 static int                                      verbose;
 
 #else
@@ -698,6 +717,7 @@ static int                                      verbose;
 //#  define ANALYZE_ONLY_NORMAL_PRINTF(...)
 #  define ANALYZE_ONLY_NORMAL_PRINTF1(a)
 #  define ANALYZE_NEWLINE()
+#  define IRMP_THREAD_LOCAL
 #endif
 
 #if IRMP_USE_CALLBACK == 1
@@ -722,6 +742,22 @@ void irmp_register_complete_callback_function(void (*aCompleteCallbackFunction)(
 #include "irmpprotocols.hpp"  // include protocol strings and array of strings
 #endif
 
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ *  Binary RLE scan format, written by irmp_log() if IRMP_LOGGING_RLE == 1, read by the analyzer
+ *
+ *  A scan is a sequence of records, one per frame, so scans can be concatenated:
+ *    header:       'I' 'R' 'L' 'E', version, flags, F_INTERRUPTS of the logging device (4 bytes, little endian)
+ *    durations:    ticks of pulse, pause, pulse, ... pulse, followed by 0 (end of frame)
+ *  A duration is 1 byte if less than 0xFF, else 0xFF and 2 bytes little endian.
+ *  Durations are pulse/pause, not pin levels: flag IRMP_RLE_FLAG_HIGH_ACTIVE only tells the polarity of the logging device.
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+#define IRMP_RLE_MAGIC                          "IRLE"
+#define IRMP_RLE_VERSION                        1
+#define IRMP_RLE_HEADER_LEN                     10
+#define IRMP_RLE_FLAG_HIGH_ACTIVE               0x01
+#define IRMP_RLE_ESCAPE                         0xFF
+
 /*---------------------------------------------------------------------------------------------------------------------------------------------------
  *  Logging
  *---------------------------------------------------------------------------------------------------------------------------------------------------
@@ -755,7 +791,7 @@ void irmp_register_complete_callback_function(void (*aCompleteCallbackFunction)(
 #    include <util/setbaud.h>
 #  endif
 
-#if defined(UBRR)0H
+#if defined(UBRR0H)
 
 #define UART0_UBRRH                             UBRR0H
 #define UART0_UBRRL                             UBRR0L
@@ -984,7 +1020,11 @@ irmp_uart_putc (unsigned char ch)
 
 #elif defined(_CHIBIOS_HAL_)
     // use the SD interface from HAL, log to IRMP_LOGGING_SD which is defined in irmpconfig.h
+#  if IRMP_LOGGING_BUFFER_SIZE > 0
+    sdWrite(&IRMP_LOGGING_SD,&ch,1);       // we are called by irmp_log_flush() from thread context
+#  else
     sdWriteI(&IRMP_LOGGING_SD,&ch,1);      // we are called from interrupt context, so use the ...I version of the function
+#  endif
 
 #else
 #if (IRMP_EXT_LOGGING == 0)
@@ -1027,94 +1067,343 @@ irmp_uart_putc (unsigned char ch)
 #define ENDBITS                        1000                                 // number of sequenced highbits to detect end
 #define DATALEN                         700                                 // log buffer size
 
-static void
-irmp_log (uint_fast8_t val)
+#if IRMP_LOGGING_BUFFER_SIZE > 0
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ *  Log buffer
+ *  @details  irmp_log() stores the durations of a frame into the ring buffer irmp_log_buf, irmp_log_flush() writes them to the UART.
+ *            irmp_ISR() only writes irmp_log_frames_written, irmp_log_flush() only writes irmp_log_frames_read, so no locking is
+ *            needed. Both counters run freely, the number of buffered frames is (uint8_t) (written - read).
+ *            If the buffer or irmp_log_frame_start[] is full, the frame is dropped up to its end, free space is only checked again
+ *            at the start of the next frame.
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+#define IRMP_LOG_BUF_LEN                IRMP_LOGGING_BUFFER_SIZE            // log buffer size
+#define IRMP_LOG_FRAMES                 4                                   // max. number of buffered frames
+
+#if defined(__GNUC__)
+#  define IRMP_LOG_BARRIER()            __asm__ __volatile__ ("" ::: "memory")  // keep buffer accesses on their side of the counter update
+#else
+#  define IRMP_LOG_BARRIER()
+#endif
+
+static uint_fast16_t                    irmp_log_frame_start[IRMP_LOG_FRAMES];  // start of frame in irmp_log_buf, written by irmp_ISR() only
+static uint_fast16_t                    irmp_log_frame_len[IRMP_LOG_FRAMES];    // length of frame, written by irmp_ISR() only
+static volatile uint8_t                 irmp_log_frames_written;            // number of stored frames, changed by irmp_ISR() only
+static volatile uint8_t                 irmp_log_frames_read;               // number of written frames, changed by irmp_log_flush() only
+#else
+#define IRMP_LOG_BUF_LEN                DATALEN                             // log buffer size
+#endif
+
+static uint8_t                          irmp_log_buf[IRMP_LOG_BUF_LEN];     // logging buffer
+static uint_fast16_t                    irmp_log_start;                     // start of current frame in irmp_log_buf
+static uint_fast16_t                    irmp_log_idx;                       // index in current frame, 0: no frame
+static uint_fast8_t                     irmp_log_dropping;                  // current frame does not fit, drop it up to its end
+static uint_fast16_t                    irmp_log_len;                       // free space for current frame
+static uint_fast8_t                     irmp_log_startcycles;               // current number of start-zeros
+static uint_fast16_t                    irmp_log_cnt;                       // counts sequenced highbits - to detect end
+static uint_fast8_t                     irmp_log_last_val = 1;              // last logged value
+
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ *  Get position in log buffer
+ *  @param    start of frame, less than IRMP_LOG_BUF_LEN
+ *  @param    index in frame, less than IRMP_LOG_BUF_LEN
+ *  @return   position in irmp_log_buf
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+static uint_fast16_t
+irmp_log_pos (uint_fast16_t start, uint_fast16_t idx)
 {
-    static uint8_t          buf[DATALEN];                                   // logging buffer
-    static uint_fast16_t    buf_idx;                                        // index
-    static uint_fast8_t     startcycles;                                    // current number of start-zeros
-    static uint_fast16_t    cnt;                                            // counts sequenced highbits - to detect end
-    static uint_fast8_t     last_val = 1;
+    uint_fast16_t   pos = start + idx;
+
+    if (pos >= IRMP_LOG_BUF_LEN)
+    {
+        pos -= IRMP_LOG_BUF_LEN;                                            // wrap around, ring buffer
+    }
+    return pos;
+}
 
-    if (! val && (startcycles < STARTCYCLES) && !buf_idx)                   // prevent that single random zeros init logging
+#if IRMP_LOGGING_RLE == 1
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ *  Log a duration in binary RLE scan format, see IRMP_RLE_MAGIC
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+static void
+irmp_log_rle_duration (uint_fast16_t d)
+{
+    if (d >= IRMP_RLE_ESCAPE)
     {
-        startcycles++;
+        irmp_uart_putc (IRMP_RLE_ESCAPE);
+        irmp_uart_putc (d & 0xff);
+        irmp_uart_putc (d >> 8);
     }
     else
     {
-        startcycles = 0;
+        irmp_uart_putc (d);
+    }
+}
+
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ *  Log the header of a binary RLE scan record, see IRMP_RLE_MAGIC
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+static void
+irmp_log_rle_header (void)
+{
+    uint32_t        f = F_INTERRUPTS;
+    uint_fast8_t    i;
+
+    for (i = 0; i < 4; i++)
+    {
+        irmp_uart_putc (IRMP_RLE_MAGIC[i]);
+    }
+
+    irmp_uart_putc (IRMP_RLE_VERSION);
+    irmp_uart_putc (IRMP_HIGH_ACTIVE ? IRMP_RLE_FLAG_HIGH_ACTIVE : 0);
+
+    for (i = 0; i < 4; i++)
+    {
+        irmp_uart_putc (f & 0xff);
+        f >>= 8;
+    }
+}
+#endif // IRMP_LOGGING_RLE == 1
+
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ *  Write logged frame to UART
+ *  @param    start of frame in irmp_log_buf
+ *  @param    length of frame
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+static void
+irmp_log_write_frame (uint_fast16_t start, uint_fast16_t len)
+{
+#if IRMP_LOGGING_RLE == 1
+    uint_fast16_t    i;
+    uint_fast16_t    d;
+    uint_fast16_t    startcycles_len = STARTCYCLES;
+
+    irmp_log_rle_header ();
+
+    for (i = 1; i < len; i++)                                   // 1st byte holds the number of leading highbits, always 0
+    {
+        d = irmp_log_buf[irmp_log_pos (start, i)];
 
-        if (! val || buf_idx != 0)                                          // start or continue logging on "0", "1" cannot init logging
+        if (d == 0xff)
         {
-            if (last_val == val)
-            {
-                cnt++;
+            i++;
+            d = irmp_log_buf[irmp_log_pos (start, i)];
+            i++;
+            d |= ((uint_fast16_t) irmp_log_buf[irmp_log_pos (start, i)] << 8);
+        }
 
-                if (val && cnt > ENDBITS)                                   // if high received then look at log-stop condition
-                {                                                           // if stop condition is true, output on uart
-                    uint_fast8_t     i8;
-                    uint_fast16_t    i;
-                    uint_fast16_t    j;
-                    uint_fast8_t     v = '1';
-                    uint_fast16_t    d;
+        irmp_log_rle_duration (d + startcycles_len);                // add the ignored starting zeros to the 1st pulse
+        startcycles_len = 0;
+    }
 
-                    for (i8 = 0; i8 < STARTCYCLES; i8++)
-                    {
-                        irmp_uart_putc ('0');                               // the ignored starting zeros
-                    }
+    irmp_log_rle_duration (0);                                      // end of frame
+#else
+    uint_fast8_t     i8;
+    uint_fast16_t    i;
+    uint_fast16_t    j;
+    uint_fast8_t     v = '1';
+    uint_fast16_t    d;
 
-                    for (i = 0; i < buf_idx; i++)
-                    {
-                        d = buf[i];
+    for (i8 = 0; i8 < STARTCYCLES; i8++)
+    {
+        irmp_uart_putc ('0');                                       // the ignored starting zeros
+    }
 
-                        if (d == 0xff)
-                        {
-                            i++;
-                            d = buf[i];
-                            i++;
-                            d |= ((uint_fast16_t) buf[i] << 8);
-                        }
+    for (i = 0; i < len; i++)
+    {
+        d = irmp_log_buf[irmp_log_pos (start, i)];
 
-                        for (j = 0; j < d; j++)
-                        {
-                            irmp_uart_putc (v);
-                        }
+        if (d == 0xff)
+        {
+            i++;
+            d = irmp_log_buf[irmp_log_pos (start, i)];
+            i++;
+            d |= ((uint_fast16_t) irmp_log_buf[irmp_log_pos (start, i)] << 8);
+        }
 
-                        v = (v == '1') ? '0' : '1';
-                    }
+        for (j = 0; j < d; j++)
+        {
+            irmp_uart_putc (v);
+        }
+
+        v = (v == '1') ? '0' : '1';
+    }
+
+    for (i8 = 0; i8 < 20; i8++)
+    {
+        irmp_uart_putc ('1');
+    }
+
+    irmp_uart_putc ('\n');
+#endif // IRMP_LOGGING_RLE == 1
+}
+
+#if IRMP_LOGGING_BUFFER_SIZE > 0
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ *  Get free space for the current frame in log buffer
+ *  @return   number of bytes
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+static uint_fast16_t
+irmp_log_get_free_len (void)
+{
+    uint8_t         n_frames = irmp_log_frames_written - irmp_log_frames_read;
+
+    if (n_frames == 0)
+    {
+        return IRMP_LOG_BUF_LEN - 1;                                        // buffer is empty
+    }
+
+    if (n_frames >= IRMP_LOG_FRAMES)
+    {
+        return 0;                                                           // no free entry in irmp_log_frame_start[]
+    }
+                                                                            // distance to oldest unread frame
+    return irmp_log_pos (irmp_log_frame_start[irmp_log_frames_read % IRMP_LOG_FRAMES], IRMP_LOG_BUF_LEN - 1 - irmp_log_start);
+}
+
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ *  Write buffered log to UART
+ *  @details  call it in the main loop. The ISR only stores the durations of a frame, this function writes them to the UART.
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+void
+irmp_log_flush (void)
+{
+    uint_fast8_t    idx;
+
+    while (irmp_log_frames_read != irmp_log_frames_written)
+    {
+        IRMP_LOG_BARRIER ();
+        idx = irmp_log_frames_read % IRMP_LOG_FRAMES;
+        irmp_log_write_frame (irmp_log_frame_start[idx], irmp_log_frame_len[idx]);
+        IRMP_LOG_BARRIER ();
+        irmp_log_frames_read++;                                             // free frame for irmp_log()
+    }
+}
+#endif // IRMP_LOGGING_BUFFER_SIZE > 0
+
+static void
+irmp_log (uint_fast8_t val)
+{
+    if (! val && (irmp_log_startcycles < STARTCYCLES) && !irmp_log_idx && !irmp_log_dropping) // prevent that single random zeros init logging
+    {
+        irmp_log_startcycles++;
+    }
+    else
+    {
+        irmp_log_startcycles = 0;
+
+        if (! val || irmp_log_idx != 0 || irmp_log_dropping)                // start or continue logging on "0", "1" cannot init logging
+        {
+            if (irmp_log_last_val == val)
+            {
+                irmp_log_cnt++;
 
-                    for (i8 = 0; i8 < 20; i8++)
+                if (val && irmp_log_cnt > ENDBITS)                          // if high received then look at log-stop condition
+                {                                                           // if stop condition is true, output on uart
+#if IRMP_LOGGING_BUFFER_SIZE > 0
+                    if (! irmp_log_dropping)
                     {
-                        irmp_uart_putc ('1');
-                    }
+                        uint_fast8_t    idx = irmp_log_frames_written % IRMP_LOG_FRAMES;
 
-                    irmp_uart_putc ('\n');
-                    buf_idx = 0;
-                    last_val = 1;
-                    cnt = 0;
+                        irmp_log_frame_start[idx]   = irmp_log_start;       // store frame, irmp_log_flush() writes it to the UART
+                        irmp_log_frame_len[idx]     = irmp_log_idx;
+                        irmp_log_start              = irmp_log_pos (irmp_log_start, irmp_log_idx);
+                        IRMP_LOG_BARRIER ();
+                        irmp_log_frames_written++;
+                    }
+#else
+                    irmp_log_write_frame (irmp_log_start, irmp_log_idx);
+#endif
+                    irmp_log_idx = 0;
+                    irmp_log_dropping = 0;
+                    irmp_log_last_val = 1;
+                    irmp_log_cnt = 0;
                 }
             }
-            else if (buf_idx < DATALEN - 3)
+            else
             {
-                if (cnt >= 0xff)
+                if (irmp_log_idx == 0 && ! irmp_log_dropping)
+                {                                                           // start of frame
+#if IRMP_LOGGING_BUFFER_SIZE > 0
+                    irmp_log_len = irmp_log_get_free_len ();
+#else
+                    irmp_log_len = IRMP_LOG_BUF_LEN;
+#endif
+                }
+
+                if (! irmp_log_dropping && irmp_log_idx + 3 < irmp_log_len)
                 {
-                    buf[buf_idx++]  = 0xff;
-                    buf[buf_idx++]  = (cnt & 0xff);
-                    buf[buf_idx]    = (cnt >> 8);
+                    if (irmp_log_cnt >= 0xff)
+                    {
+                        irmp_log_buf[irmp_log_pos (irmp_log_start, irmp_log_idx++)]  = 0xff;
+                        irmp_log_buf[irmp_log_pos (irmp_log_start, irmp_log_idx++)]  = (irmp_log_cnt & 0xff);
+                        irmp_log_buf[irmp_log_pos (irmp_log_start, irmp_log_idx)]    = (irmp_log_cnt >> 8);
+                    }
+                    else
+                    {
+                        irmp_log_buf[irmp_log_pos (irmp_log_start, irmp_log_idx)] = irmp_log_cnt;
+                    }
+
+                    irmp_log_idx++;
                 }
+#if IRMP_LOGGING_BUFFER_SIZE > 0
                 else
                 {
-                    buf[buf_idx] = cnt;
+                    irmp_log_dropping = 1;                                  // frame does not fit, drop it up to its end
                 }
+#endif
 
-                buf_idx++;
-                cnt = 1;
-                last_val = val;
+                irmp_log_cnt = 1;                                           // count on, else the end of a truncated frame is not detected
+                irmp_log_last_val = val;
             }
         }
     }
 }
 
+#if IRMP_ENABLE_FEED_DURATION == 1
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ *  Get number of following ticks which irmp_log() only counts, see irmp_get_skip_len()
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+static uint_fast16_t
+irmp_log_get_skip_len (uint_fast8_t val)
+{
+    if (! irmp_log_idx && ! irmp_log_dropping)
+    {
+        return (val && ! irmp_log_startcycles) ? 0xFFFF : 0;                // idle, only a zero starts logging
+    }
+
+    if (val != irmp_log_last_val || irmp_log_cnt >= (val ? ENDBITS : 0xFFFF))
+    {
+        return 0;                                                           // new duration or end of frame
+    }
+
+    return (val ? ENDBITS : 0xFFFF) - irmp_log_cnt;
+}
+
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ *  Skip ticks of irmp_log()
+ *  @details  does the same as len calls of irmp_log(), len must not be greater than irmp_log_get_skip_len()
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+static void
+irmp_log_skip (uint_fast16_t len)
+{
+    irmp_log_startcycles = 0;
+
+    if (irmp_log_idx || irmp_log_dropping)
+    {
+        irmp_log_cnt += len;
+    }
+}
+#endif // IRMP_ENABLE_FEED_DURATION == 1
+
 #else
 #define irmp_log(val)
 #endif //IRMP_LOGGING
@@ -1142,7 +1431,7 @@ typedef struct
 
 #if IRMP_SUPPORT_SIRCS_PROTOCOL == 1
 
-static const PROGMEM IRMP_PARAMETER sircs_param =
+static IRMP_CONSTEXPR PROGMEM IRMP_PARAMETER sircs_param =
 {
     IRMP_SIRCS_PROTOCOL,                                                // protocol:        ir protocol
     SIRCS_1_PULSE_LEN_MIN,                                              // pulse_1_len_min: minimum length of pulse with bit value 1
@@ -1167,7 +1456,7 @@ static const PROGMEM IRMP_PARAMETER sircs_param =
 
 #if IRMP_SUPPORT_NEC_PROTOCOL == 1
 
-static const PROGMEM IRMP_PARAMETER nec_param =
+static IRMP_CONSTEXPR PROGMEM IRMP_PARAMETER nec_param =
 {
     IRMP_NEC_PROTOCOL,                                                  // protocol:        ir protocol
     NEC_PULSE_LEN_MIN,                                                  // pulse_1_len_min: minimum length of pulse with bit value 1
@@ -1188,7 +1477,7 @@ static const PROGMEM IRMP_PARAMETER nec_param =
     NEC_FLAGS                                                           // flags:           some flags
 };
 
-static const PROGMEM IRMP_PARAMETER nec_rep_param =
+static IRMP_CONSTEXPR PROGMEM IRMP_PARAMETER nec_rep_param =
 {
     IRMP_NEC_PROTOCOL,                                                  // protocol:        ir protocol
     NEC_PULSE_LEN_MIN,                                                  // pulse_1_len_min: minimum length of pulse with bit value 1
@@ -1213,7 +1502,7 @@ static const PROGMEM IRMP_PARAMETER nec_rep_param =
 
 #if IRMP_SUPPORT_NEC42_PROTOCOL == 1
 
-static const PROGMEM IRMP_PARAMETER nec42_param =
+static IRMP_CONSTEXPR PROGMEM IRMP_PARAMETER nec42_param =
 {
     IRMP_NEC42_PROTOCOL,                                                // protocol:        ir protocol
     NEC_PULSE_LEN_MIN,                                                  // pulse_1_len_min: minimum length of pulse with bit value 1
@@ -1239,7 +1528,7 @@ static const PROGMEM IRMP_PARAMETER nec42_param =
 #if IRMP_SUPPORT_LGAIR_PROTOCOL == 1
 #if 0 // not needed, switching from NEC
 
-static const PROGMEM IRMP_PARAMETER lgair_param =
+static IRMP_CONSTEXPR PROGMEM IRMP_PARAMETER lgair_param =
 {
     IRMP_LGAIR_PROTOCOL,                                                // protocol:        ir protocol
     NEC_PULSE_LEN_MIN,                                                  // pulse_1_len_min: minimum length of pulse with bit value 1
@@ -1265,7 +1554,7 @@ static const PROGMEM IRMP_PARAMETER lgair_param =
 
 #if IRMP_SUPPORT_SAMSUNG_PROTOCOL == 1
 
-static const PROGMEM IRMP_PARAMETER samsung_param =
+static IRMP_CONSTEXPR PROGMEM IRMP_PARAMETER samsung_param =
 {
     IRMP_SAMSUNG_PROTOCOL,                                              // protocol:        ir protocol
     SAMSUNG_PULSE_LEN_MIN,                                              // pulse_1_len_min: minimum length of pulse with bit value 1
@@ -1290,7 +1579,7 @@ static const PROGMEM IRMP_PARAMETER samsung_param =
 
 #if IRMP_SUPPORT_SAMSUNGAH_PROTOCOL == 1
 
-static const PROGMEM IRMP_PARAMETER samsungah_param =
+static IRMP_CONSTEXPR PROGMEM IRMP_PARAMETER samsungah_param =
 {
     IRMP_SAMSUNGAH_PROTOCOL,                                            // protocol:        ir protocol
     SAMSUNGAH_PULSE_LEN_MIN,                                            // pulse_1_len_min: minimum length of pulse with bit value 1
@@ -1315,7 +1604,7 @@ static const PROGMEM IRMP_PARAMETER samsungah_param =
 
 #if IRMP_SUPPORT_TELEFUNKEN_PROTOCOL == 1
 
-static const PROGMEM IRMP_PARAMETER telefunken_param =
+static IRMP_CONSTEXPR PROGMEM IRMP_PARAMETER telefunken_param =
 {
     IRMP_TELEFUNKEN_PROTOCOL,                                           // protocol:        ir protocol
     TELEFUNKEN_PULSE_LEN_MIN,                                           // pulse_1_len_min: minimum length of pulse with bit value 1
@@ -1340,7 +1629,7 @@ static const PROGMEM IRMP_PARAMETER telefunken_param =
 
 #if IRMP_SUPPORT_MATSUSHITA_PROTOCOL == 1
 
-static const PROGMEM IRMP_PARAMETER matsushita_param =
+static IRMP_CONSTEXPR PROGMEM IRMP_PARAMETER matsushita_param =
 {
     IRMP_MATSUSHITA_PROTOCOL,                                           // protocol:        ir protocol
     MATSUSHITA_PULSE_LEN_MIN,                                           // pulse_1_len_min: minimum length of pulse with bit value 1
@@ -1365,7 +1654,7 @@ static const PROGMEM IRMP_PARAMETER matsushita_param =
 
 #if IRMP_SUPPORT_KASEIKYO_PROTOCOL == 1
 
-static const PROGMEM IRMP_PARAMETER kaseikyo_param =
+static IRMP_CONSTEXPR PROGMEM IRMP_PARAMETER kaseikyo_param =
 {
     IRMP_KASEIKYO_PROTOCOL,                                             // protocol:        ir protocol
     KASEIKYO_PULSE_LEN_MIN,                                             // pulse_1_len_min: minimum length of pulse with bit value 1
@@ -1390,7 +1679,7 @@ static const PROGMEM IRMP_PARAMETER kaseikyo_param =
 
 #if IRMP_SUPPORT_PANASONIC_PROTOCOL == 1
 
-static const PROGMEM IRMP_PARAMETER panasonic_param =
+static IRMP_CONSTEXPR PROGMEM IRMP_PARAMETER panasonic_param =
 {
     IRMP_PANASONIC_PROTOCOL,                                            // protocol:        ir protocol
     PANASONIC_PULSE_LEN_MIN,                                            // pulse_1_len_min: minimum length of pulse with bit value 1
@@ -1415,7 +1704,7 @@ static const PROGMEM IRMP_PARAMETER panasonic_param =
 
 #if IRMP_SUPPORT_MITSU_HEAVY_PROTOCOL == 1
 
-static const PROGMEM IRMP_PARAMETER mitsu_heavy_param =
+static IRMP_CONSTEXPR PROGMEM IRMP_PARAMETER mitsu_heavy_param =
 {
     IRMP_MITSU_HEAVY_PROTOCOL,                                          // protocol:        ir protocol
     MITSU_HEAVY_PULSE_LEN_MIN,                                          // pulse_1_len_min: minimum length of pulse with bit value 1
@@ -1440,7 +1729,7 @@ static const PROGMEM IRMP_PARAMETER mitsu_heavy_param =
 
 #if IRMP_SUPPORT_VINCENT_PROTOCOL == 1
 
-static const PROGMEM IRMP_PARAMETER vincent_param =
+static IRMP_CONSTEXPR PROGMEM IRMP_PARAMETER vincent_param =
 {
     IRMP_VINCENT_PROTOCOL,                                              // protocol:        ir protocol
     VINCENT_PULSE_LEN_MIN,                                              // pulse_1_len_min: minimum length of pulse with bit value 1
@@ -1465,7 +1754,7 @@ static const PROGMEM IRMP_PARAMETER vincent_param =
 
 #if IRMP_SUPPORT_RECS80_PROTOCOL == 1
 
-static const PROGMEM IRMP_PARAMETER recs80_param =
+static IRMP_CONSTEXPR PROGMEM IRMP_PARAMETER recs80_param =
 {
     IRMP_RECS80_PROTOCOL,                                               // protocol:        ir protocol
     RECS80_PULSE_LEN_MIN,                                               // pulse_1_len_min: minimum length of pulse with bit value 1
@@ -1490,7 +1779,7 @@ static const PROGMEM IRMP_PARAMETER recs80_param =
 
 #if IRMP_SUPPORT_RC5_PROTOCOL == 1
 
-static const PROGMEM IRMP_PARAMETER rc5_param =
+static IRMP_CONSTEXPR PROGMEM IRMP_PARAMETER rc5_param =
 {
     IRMP_RC5_PROTOCOL,                                                  // protocol:        ir protocol
     RC5_BIT_LEN_MIN,                                                    // pulse_1_len_min: here: minimum length of short pulse
@@ -1515,7 +1804,7 @@ static const PROGMEM IRMP_PARAMETER rc5_param =
 
 #if IRMP_SUPPORT_RCII_PROTOCOL == 1
 
-static const PROGMEM IRMP_PARAMETER rcii_param =
+static IRMP_CONSTEXPR PROGMEM IRMP_PARAMETER rcii_param =
 {
     IRMP_RCII_PROTOCOL,                                                 // protocol:        ir protocol
     RCII_BIT_LEN_MIN,                                                   // pulse_1_len_min: here: minimum length of short pulse
@@ -1540,7 +1829,7 @@ static const PROGMEM IRMP_PARAMETER rcii_param =
 
 #if IRMP_SUPPORT_S100_PROTOCOL == 1
 
-static const PROGMEM IRMP_PARAMETER s100_param =
+static IRMP_CONSTEXPR PROGMEM IRMP_PARAMETER s100_param =
 {
     IRMP_S100_PROTOCOL,                                                 // protocol:        ir protocol
     S100_BIT_LEN_MIN,                                                   // pulse_1_len_min: here: minimum length of short pulse
@@ -1565,7 +1854,7 @@ static const PROGMEM IRMP_PARAMETER s100_param =
 
 #if IRMP_SUPPORT_DENON_PROTOCOL == 1
 
-static const PROGMEM IRMP_PARAMETER denon_param =
+static IRMP_CONSTEXPR PROGMEM IRMP_PARAMETER denon_param =
 {
     IRMP_DENON_PROTOCOL,                                                // protocol:        ir protocol
     DENON_PULSE_LEN_MIN,                                                // pulse_1_len_min: minimum length of pulse with bit value 1
@@ -1590,7 +1879,7 @@ static const PROGMEM IRMP_PARAMETER denon_param =
 
 #if IRMP_SUPPORT_RC6_PROTOCOL == 1
 
-static const PROGMEM IRMP_PARAMETER rc6_param =
+static IRMP_CONSTEXPR PROGMEM IRMP_PARAMETER rc6_param =
 {
     IRMP_RC6_PROTOCOL,                                                  // protocol:        ir protocol
 
@@ -1616,7 +1905,7 @@ static const PROGMEM IRMP_PARAMETER rc6_param =
 
 #if IRMP_SUPPORT_RECS80EXT_PROTOCOL == 1
 
-static const PROGMEM IRMP_PARAMETER recs80ext_param =
+static IRMP_CONSTEXPR PROGMEM IRMP_PARAMETER recs80ext_param =
 {
     IRMP_RECS80EXT_PROTOCOL,                                            // protocol:        ir protocol
     RECS80EXT_PULSE_LEN_MIN,                                            // pulse_1_len_min: minimum length of pulse with bit value 1
@@ -1641,7 +1930,7 @@ static const PROGMEM IRMP_PARAMETER recs80ext_param =
 
 #if IRMP_SUPPORT_NUBERT_PROTOCOL == 1
 
-static const PROGMEM IRMP_PARAMETER nubert_param =
+static IRMP_CONSTEXPR PROGMEM IRMP_PARAMETER nubert_param =
 {
     IRMP_NUBERT_PROTOCOL,                                               // protocol:        ir protocol
     NUBERT_1_PULSE_LEN_MIN,                                             // pulse_1_len_min: minimum length of pulse with bit value 1
@@ -1666,7 +1955,7 @@ static const PROGMEM IRMP_PARAMETER nubert_param =
 
 #if IRMP_SUPPORT_FAN_PROTOCOL == 1
 
-static const PROGMEM IRMP_PARAMETER fan_param =
+static IRMP_CONSTEXPR PROGMEM IRMP_PARAMETER fan_param =
 {
     IRMP_FAN_PROTOCOL,                                                  // protocol:        ir protocol
     FAN_1_PULSE_LEN_MIN,                                                // pulse_1_len_min: minimum length of pulse with bit value 1
@@ -1691,7 +1980,7 @@ static const PROGMEM IRMP_PARAMETER fan_param =
 
 #if IRMP_SUPPORT_SPEAKER_PROTOCOL == 1
 
-static const PROGMEM IRMP_PARAMETER speaker_param =
+static IRMP_CONSTEXPR PROGMEM IRMP_PARAMETER speaker_param =
 {
     IRMP_SPEAKER_PROTOCOL,                                              // protocol:        ir protocol
     SPEAKER_1_PULSE_LEN_MIN,                                            // pulse_1_len_min: minimum length of pulse with bit value 1
@@ -1716,7 +2005,7 @@ static const PROGMEM IRMP_PARAMETER speaker_param =
 
 #if IRMP_SUPPORT_BANG_OLUFSEN_PROTOCOL == 1
 
-static const PROGMEM IRMP_PARAMETER bang_olufsen_param =
+static IRMP_CONSTEXPR PROGMEM IRMP_PARAMETER bang_olufsen_param =
 {
     IRMP_BANG_OLUFSEN_PROTOCOL,                                         // protocol:        ir protocol
     BANG_OLUFSEN_PULSE_LEN_MIN,                                         // pulse_1_len_min: minimum length of pulse with bit value 1
@@ -1741,9 +2030,11 @@ static const PROGMEM IRMP_PARAMETER bang_olufsen_param =
 
 #if IRMP_SUPPORT_GRUNDIG_NOKIA_IR60_PROTOCOL == 1
 
+#if IRMP_ENABLE_CONTEXT == 0
 static uint_fast8_t first_bit;
+#endif
 
-static const PROGMEM IRMP_PARAMETER grundig_param =
+static IRMP_CONSTEXPR PROGMEM IRMP_PARAMETER grundig_param =
 {
     IRMP_GRUNDIG_PROTOCOL,                                              // protocol:        ir protocol
 
@@ -1769,7 +2060,7 @@ static const PROGMEM IRMP_PARAMETER grundig_param =
 
 #if IRMP_SUPPORT_SIEMENS_OR_RUWIDO_PROTOCOL == 1
 
-static const PROGMEM IRMP_PARAMETER ruwido_param =
+static IRMP_CONSTEXPR PROGMEM IRMP_PARAMETER ruwido_param =
 {
     IRMP_RUWIDO_PROTOCOL,                                               // protocol:        ir protocol
     SIEMENS_OR_RUWIDO_BIT_PULSE_LEN_MIN,                                // pulse_1_len_min: here: minimum length of short pulse
@@ -1794,7 +2085,7 @@ static const PROGMEM IRMP_PARAMETER ruwido_param =
 
 #if IRMP_SUPPORT_FDC_PROTOCOL == 1
 
-static const PROGMEM IRMP_PARAMETER fdc_param =
+static IRMP_CONSTEXPR PROGMEM IRMP_PARAMETER fdc_param =
 {
     IRMP_FDC_PROTOCOL,                                                  // protocol:        ir protocol
     FDC_PULSE_LEN_MIN,                                                  // pulse_1_len_min: minimum length of pulse with bit value 1
@@ -1819,7 +2110,7 @@ static const PROGMEM IRMP_PARAMETER fdc_param =
 
 #if IRMP_SUPPORT_RCCAR_PROTOCOL == 1
 
-static const PROGMEM IRMP_PARAMETER rccar_param =
+static IRMP_CONSTEXPR PROGMEM IRMP_PARAMETER rccar_param =
 {
     IRMP_RCCAR_PROTOCOL,                                                // protocol:        ir protocol
     RCCAR_PULSE_LEN_MIN,                                                // pulse_1_len_min: minimum length of pulse with bit value 1
@@ -1844,7 +2135,7 @@ static const PROGMEM IRMP_PARAMETER rccar_param =
 
 #if IRMP_SUPPORT_NIKON_PROTOCOL == 1
 
-static const PROGMEM IRMP_PARAMETER nikon_param =
+static IRMP_CONSTEXPR PROGMEM IRMP_PARAMETER nikon_param =
 {
     IRMP_NIKON_PROTOCOL,                                                // protocol:        ir protocol
     NIKON_PULSE_LEN_MIN,                                                // pulse_1_len_min: minimum length of pulse with bit value 1
@@ -1869,7 +2160,7 @@ static const PROGMEM IRMP_PARAMETER nikon_param =
 
 #if IRMP_SUPPORT_KATHREIN_PROTOCOL == 1
 
-static const PROGMEM IRMP_PARAMETER kathrein_param =
+static IRMP_CONSTEXPR PROGMEM IRMP_PARAMETER kathrein_param =
 {
     IRMP_KATHREIN_PROTOCOL,                                             // protocol:        ir protocol
     KATHREIN_1_PULSE_LEN_MIN,                                           // pulse_1_len_min: minimum length of pulse with bit value 1
@@ -1894,7 +2185,7 @@ static const PROGMEM IRMP_PARAMETER kathrein_param =
 
 #if IRMP_SUPPORT_NETBOX_PROTOCOL == 1
 
-static const PROGMEM IRMP_PARAMETER netbox_param =
+static IRMP_CONSTEXPR PROGMEM IRMP_PARAMETER netbox_param =
 {
     IRMP_NETBOX_PROTOCOL,                                               // protocol:        ir protocol
     NETBOX_PULSE_LEN,                                                   // pulse_1_len_min: minimum length of pulse with bit value 1, here: exact value
@@ -1919,7 +2210,7 @@ static const PROGMEM IRMP_PARAMETER netbox_param =
 
 #if IRMP_SUPPORT_LEGO_PROTOCOL == 1
 
-static const PROGMEM IRMP_PARAMETER lego_param =
+static IRMP_CONSTEXPR PROGMEM IRMP_PARAMETER lego_param =
 {
     IRMP_LEGO_PROTOCOL,                                                 // protocol:        ir protocol
     LEGO_PULSE_LEN_MIN,                                                 // pulse_1_len_min: minimum length of pulse with bit value 1
@@ -1944,7 +2235,7 @@ static const PROGMEM IRMP_PARAMETER lego_param =
 
 #if IRMP_SUPPORT_IRMP16_PROTOCOL == 1
 
-static const PROGMEM IRMP_PARAMETER irmp16_param =
+static IRMP_CONSTEXPR PROGMEM IRMP_PARAMETER irmp16_param =
 {
     IRMP_IRMP16_PROTOCOL,                                               // protocol:        ir protocol
     IRMP16_PULSE_LEN_MIN,                                               // pulse_1_len_min: minimum length of pulse with bit value 1
@@ -1969,7 +2260,7 @@ static const PROGMEM IRMP_PARAMETER irmp16_param =
 
 #if IRMP_SUPPORT_GREE_PROTOCOL == 1
 
-static const PROGMEM IRMP_PARAMETER gree_param =
+static IRMP_CONSTEXPR PROGMEM IRMP_PARAMETER gree_param =
 {
     IRMP_GREE_PROTOCOL,                                               // protocol:        ir protocol
     GREE_PULSE_LEN_MIN,                                               // pulse_1_len_min: minimum length of pulse with bit value 1
@@ -1994,7 +2285,7 @@ static const PROGMEM IRMP_PARAMETER gree_param =
 
 #if IRMP_SUPPORT_THOMSON_PROTOCOL == 1
 
-static const PROGMEM IRMP_PARAMETER thomson_param =
+static IRMP_CONSTEXPR PROGMEM IRMP_PARAMETER thomson_param =
 {
     IRMP_THOMSON_PROTOCOL,                                              // protocol:        ir protocol
     THOMSON_PULSE_LEN_MIN,                                              // pulse_1_len_min: minimum length of pulse with bit value 1
@@ -2019,7 +2310,7 @@ static const PROGMEM IRMP_PARAMETER thomson_param =
 
 #if IRMP_SUPPORT_BOSE_PROTOCOL == 1
 
-static const PROGMEM IRMP_PARAMETER bose_param =
+static IRMP_CONSTEXPR PROGMEM IRMP_PARAMETER bose_param =
 {
     IRMP_BOSE_PROTOCOL,                                                 // protocol:        ir protocol
     BOSE_PULSE_LEN_MIN,                                                 // pulse_1_len_min: minimum length of pulse with bit value 1
@@ -2044,7 +2335,7 @@ static const PROGMEM IRMP_PARAMETER bose_param =
 
 #if IRMP_SUPPORT_A1TVBOX_PROTOCOL == 1
 
-static const PROGMEM IRMP_PARAMETER a1tvbox_param =
+static IRMP_CONSTEXPR PROGMEM IRMP_PARAMETER a1tvbox_param =
 {
     IRMP_A1TVBOX_PROTOCOL,                                              // protocol:        ir protocol
 
@@ -2070,7 +2361,7 @@ static const PROGMEM IRMP_PARAMETER a1tvbox_param =
 
 #if IRMP_SUPPORT_MERLIN_PROTOCOL == 1
 
-static const PROGMEM IRMP_PARAMETER merlin_param =
+static IRMP_CONSTEXPR PROGMEM IRMP_PARAMETER merlin_param =
 {
     IRMP_MERLIN_PROTOCOL,                                               // protocol:        ir protocol
 
@@ -2096,7 +2387,7 @@ static const PROGMEM IRMP_PARAMETER merlin_param =
 
 #if IRMP_SUPPORT_ORTEK_PROTOCOL == 1
 
-static const PROGMEM IRMP_PARAMETER ortek_param =
+static IRMP_CONSTEXPR PROGMEM IRMP_PARAMETER ortek_param =
 {
     IRMP_ORTEK_PROTOCOL,                                                // protocol:        ir protocol
 
@@ -2122,7 +2413,7 @@ static const PROGMEM IRMP_PARAMETER ortek_param =
 
 #if IRMP_SUPPORT_ROOMBA_PROTOCOL == 1
 
-static const PROGMEM IRMP_PARAMETER roomba_param =
+static IRMP_CONSTEXPR PROGMEM IRMP_PARAMETER roomba_param =
 {
     IRMP_ROOMBA_PROTOCOL,                                               // protocol:        ir protocol
     ROOMBA_1_PULSE_LEN_MIN,                                             // pulse_1_len_min: minimum length of pulse with bit value 1
@@ -2147,7 +2438,7 @@ static const PROGMEM IRMP_PARAMETER roomba_param =
 
 #if IRMP_SUPPORT_RCMM_PROTOCOL == 1
 
-static const PROGMEM IRMP_PARAMETER rcmm_param =
+static IRMP_CONSTEXPR PROGMEM IRMP_PARAMETER rcmm_param =
 {
     IRMP_RCMM32_PROTOCOL,                                               // protocol:        ir protocol
 
@@ -2173,7 +2464,7 @@ static const PROGMEM IRMP_PARAMETER rcmm_param =
 
 #if IRMP_SUPPORT_PENTAX_PROTOCOL == 1
 
-static const PROGMEM IRMP_PARAMETER pentax_param =
+static IRMP_CONSTEXPR PROGMEM IRMP_PARAMETER pentax_param =
 {
     IRMP_PENTAX_PROTOCOL,                                               // protocol:        ir protocol
     PENTAX_PULSE_LEN_MIN,                                               // pulse_1_len_min: minimum length of pulse with bit value 1
@@ -2198,7 +2489,7 @@ static const PROGMEM IRMP_PARAMETER pentax_param =
 
 #if IRMP_SUPPORT_ACP24_PROTOCOL == 1
 
-static const PROGMEM IRMP_PARAMETER acp24_param =
+static IRMP_CONSTEXPR PROGMEM IRMP_PARAMETER acp24_param =
 {
     IRMP_ACP24_PROTOCOL,                                                // protocol:        ir protocol
     ACP24_PULSE_LEN_MIN,                                                // pulse_1_len_min: minimum length of pulse with bit value 1
@@ -2223,7 +2514,7 @@ static const PROGMEM IRMP_PARAMETER acp24_param =
 
 #if IRMP_SUPPORT_METZ_PROTOCOL == 1
 
-static const PROGMEM IRMP_PARAMETER metz_param =
+static IRMP_CONSTEXPR PROGMEM IRMP_PARAMETER metz_param =
 {
     IRMP_METZ_PROTOCOL,                                                 // protocol:        ir protocol
     METZ_PULSE_LEN_MIN,                                                 // pulse_1_len_min: minimum length of pulse with bit value 1
@@ -2248,7 +2539,7 @@ static const PROGMEM IRMP_PARAMETER metz_param =
 
 #if IRMP_SUPPORT_RF_GEN24_PROTOCOL == 1
 
-static const PROGMEM IRMP_PARAMETER rf_gen24_param =
+static IRMP_CONSTEXPR PROGMEM IRMP_PARAMETER rf_gen24_param =
 {
     RF_GEN24_PROTOCOL,                                                  // protocol:        ir protocol
 
@@ -2274,7 +2565,7 @@ static const PROGMEM IRMP_PARAMETER rf_gen24_param =
 
 #if IRMP_SUPPORT_RF_X10_PROTOCOL == 1
 
-static const PROGMEM IRMP_PARAMETER rf_x10_param =
+static IRMP_CONSTEXPR PROGMEM IRMP_PARAMETER rf_x10_param =
 {
     RF_X10_PROTOCOL,                                                    // protocol:        ir protocol
 
@@ -2300,7 +2591,7 @@ static const PROGMEM IRMP_PARAMETER rf_x10_param =
 
 #if IRMP_SUPPORT_RF_MEDION_PROTOCOL == 1
 
-static const PROGMEM IRMP_PARAMETER rf_medion_param =
+static IRMP_CONSTEXPR PROGMEM IRMP_PARAMETER rf_medion_param =
 {
     RF_MEDION_PROTOCOL,                                                 // protocol:        ir protocol
 
@@ -2324,3615 +2615,8114 @@ static const PROGMEM IRMP_PARAMETER rf_medion_param =
 
 #endif
 
-static uint_fast8_t                             irmp_bit;               // current bit position
-static IRMP_PARAMETER                           irmp_param;
-
-#if IRMP_SUPPORT_RC5_PROTOCOL == 1 && (IRMP_SUPPORT_FDC_PROTOCOL == 1 || IRMP_SUPPORT_RCCAR_PROTOCOL == 1)
-static IRMP_PARAMETER                           irmp_param2;
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ *  Start bit table
+ *  @details  One entry for each start bit check in irmp_ISR(), in the order of these checks, which is the priority of the protocols.
+ *            irmp_start_bit_candidates[] holds a bitmask of the entries whose start bit pulse range overlaps a bucket of pulse lengths,
+ *            so irmp_ISR() only checks the few entries which can match the received start bit pulse. The compiler calculates the
+ *            table from the enabled protocols and their timings. If you add a start bit check, add an entry here too!
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+enum
+{
+#if IRMP_SUPPORT_SIRCS_PROTOCOL == 1
+    IRMP_START_BIT_SIRCS,
 #endif
-
-static volatile uint_fast8_t                    irmp_ir_detected = FALSE;
-static volatile uint_fast8_t                    irmp_protocol;
-static volatile uint_fast16_t                   irmp_address;
-#if IRMP_32_BIT == 1
-static uint_fast32_t                            irmp_command;
-#else
-static uint_fast16_t                            irmp_command; // removed volatile, because it is only used in irmp_get_data and therefore volatile makes no sense
+#if IRMP_SUPPORT_JVC_PROTOCOL == 1
+    IRMP_START_BIT_JVC,
 #endif
-static volatile uint_fast16_t                   irmp_id;                // only used for SAMSUNG protocol
-static uint_fast8_t                             irmp_flags; // removed volatile, because it is only used in irmp_get_data and therefore volatile makes no sense
-// static volatile uint_fast8_t                 irmp_busy_flag;
-#if IRMP_AUTODETECT_REPEATRATE
-volatile uint_fast16_t                          delta_detection = 0;    // interval between two detections in ticks
-volatile uint32_t                               pass_on_delta_detection = 0xFFFF;    // interval between two detections in ticks
-volatile uint_fast16_t                          tmp_delta = 0xFFFF;
-volatile uint_fast8_t                           delta = 0;              // interval between two detections in ms
-volatile uint_fast8_t                           min_delta = 170;  // detected repeat rate, preset to greatest known repeat rate
-static volatile uint_fast8_t                    previous_irmp_protocol = 0;
-volatile uint_fast8_t                           same_key = 0;
-volatile uint_fast8_t                           keep_same_key = 0;
-volatile uint_fast8_t                           timeout = 1;
-volatile uint_fast8_t                           upper_border = 176;     // repeatrate plus jitter (threshold for timeout)
+#if IRMP_SUPPORT_NEC_PROTOCOL == 1
+    IRMP_START_BIT_NEC,
 #endif
-
-#if defined(__MBED__)
-// DigitalIn inputPin(IRMP_PIN, PullUp);                                // this requires mbed.h and source to be compiled as cpp
-gpio_t                                          gpioIRin;               // use low level c function instead
+#if IRMP_SUPPORT_TELEFUNKEN_PROTOCOL == 1
+    IRMP_START_BIT_TELEFUNKEN,
 #endif
-
-
-#if defined(ANALYZE)
-#define input(x)                                (x)
-static uint_fast8_t                             IRMP_PIN;
+#if IRMP_SUPPORT_ROOMBA_PROTOCOL == 1
+    IRMP_START_BIT_ROOMBA,
 #endif
+#if IRMP_SUPPORT_ACP24_PROTOCOL == 1
+    IRMP_START_BIT_ACP24,
+#endif
+#if IRMP_SUPPORT_PENTAX_PROTOCOL == 1
+    IRMP_START_BIT_PENTAX,
+#endif
+#if IRMP_SUPPORT_NIKON_PROTOCOL == 1
+    IRMP_START_BIT_NIKON,
+#endif
+#if IRMP_SUPPORT_SAMSUNG_PROTOCOL == 1
+    IRMP_START_BIT_SAMSUNG,
+#endif
+#if IRMP_SUPPORT_SAMSUNGAH_PROTOCOL == 1
+    IRMP_START_BIT_SAMSUNGAH,
+#endif
+#if IRMP_SUPPORT_MATSUSHITA_PROTOCOL == 1
+    IRMP_START_BIT_MATSUSHITA,
+#endif
+#if IRMP_SUPPORT_KASEIKYO_PROTOCOL == 1
+    IRMP_START_BIT_KASEIKYO,
+#endif
+#if IRMP_SUPPORT_PANASONIC_PROTOCOL == 1
+    IRMP_START_BIT_PANASONIC,
+#endif
+#if IRMP_SUPPORT_MITSU_HEAVY_PROTOCOL == 1
+    IRMP_START_BIT_MITSU_HEAVY,
+#endif
+#if IRMP_SUPPORT_VINCENT_PROTOCOL == 1
+    IRMP_START_BIT_VINCENT,
+#endif
+#if IRMP_SUPPORT_METZ_PROTOCOL == 1
+    IRMP_START_BIT_METZ,
+#endif
+#if IRMP_SUPPORT_RF_GEN24_PROTOCOL == 1
+    IRMP_START_BIT_RF_GEN24_0,
+    IRMP_START_BIT_RF_GEN24_1,
+#endif
+#if IRMP_SUPPORT_RF_X10_PROTOCOL == 1
+    IRMP_START_BIT_RF_X10,
+#endif
+#if IRMP_SUPPORT_RF_MEDION_PROTOCOL == 1
+    IRMP_START_BIT_RF_MEDION,
+#endif
+#if IRMP_SUPPORT_RECS80_PROTOCOL == 1
+    IRMP_START_BIT_RECS80,
+#endif
+#if IRMP_SUPPORT_S100_PROTOCOL == 1
+    IRMP_START_BIT_S100,
+#endif
+#if IRMP_SUPPORT_RC5_PROTOCOL == 1
+    IRMP_START_BIT_RC5,
+#endif
+#if IRMP_SUPPORT_RCII_PROTOCOL == 1
+    IRMP_START_BIT_RCII,
+#endif
+#if IRMP_SUPPORT_DENON_PROTOCOL == 1
+    IRMP_START_BIT_DENON,
+#endif
+#if IRMP_SUPPORT_THOMSON_PROTOCOL == 1
+    IRMP_START_BIT_THOMSON,
+#endif
+#if IRMP_SUPPORT_BOSE_PROTOCOL == 1
+    IRMP_START_BIT_BOSE,
+#endif
+#if IRMP_SUPPORT_RC6_PROTOCOL == 1
+    IRMP_START_BIT_RC6,
+#endif
+#if IRMP_SUPPORT_RECS80EXT_PROTOCOL == 1
+    IRMP_START_BIT_RECS80EXT,
+#endif
+#if IRMP_SUPPORT_NUBERT_PROTOCOL == 1
+    IRMP_START_BIT_NUBERT,
+#endif
+#if IRMP_SUPPORT_FAN_PROTOCOL == 1
+    IRMP_START_BIT_FAN,
+#endif
+#if IRMP_SUPPORT_SPEAKER_PROTOCOL == 1
+    IRMP_START_BIT_SPEAKER,
+#endif
+#if IRMP_SUPPORT_BANG_OLUFSEN_PROTOCOL == 1
+    IRMP_START_BIT_BANG_OLUFSEN,
+#endif
+#if IRMP_SUPPORT_GRUNDIG_NOKIA_IR60_PROTOCOL == 1
+    IRMP_START_BIT_GRUNDIG_NOKIA_IR60,
+#endif
+#if IRMP_SUPPORT_MERLIN_PROTOCOL == 1
+    IRMP_START_BIT_MERLIN,
+#endif
+#if IRMP_SUPPORT_SIEMENS_OR_RUWIDO_PROTOCOL == 1
+    IRMP_START_BIT_SIEMENS_OR_RUWIDO,
+#endif
+#if IRMP_SUPPORT_FDC_PROTOCOL == 1
+    IRMP_START_BIT_FDC,
+#endif
+#if IRMP_SUPPORT_RCCAR_PROTOCOL == 1
+    IRMP_START_BIT_RCCAR,
+#endif
+#if IRMP_SUPPORT_KATHREIN_PROTOCOL == 1
+    IRMP_START_BIT_KATHREIN,
+#endif
+#if IRMP_SUPPORT_NETBOX_PROTOCOL == 1
+    IRMP_START_BIT_NETBOX,
+#endif
+#if IRMP_SUPPORT_LEGO_PROTOCOL == 1
+    IRMP_START_BIT_LEGO,
+#endif
+#if IRMP_SUPPORT_IRMP16_PROTOCOL == 1
+    IRMP_START_BIT_IRMP16,
+#endif
+#if IRMP_SUPPORT_GREE_PROTOCOL == 1
+    IRMP_START_BIT_GREE,
+#endif
+#if IRMP_SUPPORT_A1TVBOX_PROTOCOL == 1
+    IRMP_START_BIT_A1TVBOX,
+#endif
+#if IRMP_SUPPORT_ORTEK_PROTOCOL == 1
+    IRMP_START_BIT_ORTEK,
+#endif
+#if IRMP_SUPPORT_RCMM_PROTOCOL == 1
+    IRMP_START_BIT_RCMM,
+#endif
+    IRMP_START_BIT_ENTRIES                                                      // number of entries
+};
 
-/*---------------------------------------------------------------------------------------------------------------------------------------------------
- *  Initialize IRMP decoder
- *  @details  Configures IRMP input pin
- *---------------------------------------------------------------------------------------------------------------------------------------------------
- */
-#if !defined(ANALYZE)
-#if ! defined(ARDUINO)
-void
-irmp_init (void)
-{
-#if defined(PIC_CCS) || defined(PIC_C18)                                // PIC: do nothing
-#elif defined(PIC_XC32)
-#  if defined(IRMP_ANSELBIT)
-    IRMP_ANSELBIT = 0;
-#  endif
-#elif defined (ARM_STM32_HAL)                                           // STM32 with Hal Library: do nothing
-#elif defined (ARM_STM32)                                               // STM32
-    GPIO_InitTypeDef     GPIO_InitStructure;
-
-    /* GPIOx clock enable */
-#  if defined (ARM_STM32L1XX)
-    RCC_AHBPeriphClockCmd(IRMP_PORT_RCC, ENABLE);
-#  elif defined (ARM_STM32F10X)
-    RCC_APB2PeriphClockCmd(IRMP_PORT_RCC, ENABLE);
-#  elif defined (ARM_STM32F30X)
-    RCC_AHBPeriphClockCmd(IRMP_PORT_RCC, ENABLE);
-#  elif defined (ARM_STM32F4XX)
-    RCC_AHB1PeriphClockCmd(IRMP_PORT_RCC, ENABLE);
-#  endif
-
-    /* GPIO Configuration */
-    GPIO_InitStructure.GPIO_Pin = IRMP_BIT;
-#  if defined (ARM_STM32L1XX) || defined (ARM_STM32F4XX)
-    GPIO_InitStructure.GPIO_Mode = GPIO_Mode_IN;
-    GPIO_InitStructure.GPIO_Speed = GPIO_Speed_2MHz;
-    GPIO_InitStructure.GPIO_OType = GPIO_OType_PP;
-    GPIO_InitStructure.GPIO_PuPd = GPIO_PuPd_NOPULL;
-#  elif defined (ARM_STM32F10X)
-    GPIO_InitStructure.GPIO_Speed = GPIO_Speed_2MHz;
-    GPIO_InitStructure.GPIO_Mode = GPIO_Mode_IN_FLOATING;
-#  elif defined (ARM_STM32F30X)
-    GPIO_InitStructure.GPIO_Mode = GPIO_Mode_IN;
-    GPIO_InitStructure.GPIO_Speed = GPIO_Speed_2MHz;
-    GPIO_InitStructure.GPIO_PuPd = GPIO_PuPd_NOPULL;
-#  endif
-    GPIO_Init(IRMP_PORT, &GPIO_InitStructure);
-
-#elif defined (ARM_STM32_OPENCM3)                                       // ARM_STM32_OPENCM3
-
-    /* GPIOx clock enable */
-#  if defined (STM32L1) || defined (STM32F1) || defined (STM32F3) || defined (STM32F4)
-    rcc_periph_clock_enable(IRMP_PORT_RCC);
-#  endif
+#define IRMP_START_BIT_ENTRY_COUNT          (IRMP_SUPPORT_SIRCS_PROTOCOL + IRMP_SUPPORT_JVC_PROTOCOL + IRMP_SUPPORT_NEC_PROTOCOL + \
+                                             IRMP_SUPPORT_TELEFUNKEN_PROTOCOL + IRMP_SUPPORT_ROOMBA_PROTOCOL + IRMP_SUPPORT_ACP24_PROTOCOL + \
+                                             IRMP_SUPPORT_PENTAX_PROTOCOL + IRMP_SUPPORT_NIKON_PROTOCOL + IRMP_SUPPORT_SAMSUNG_PROTOCOL + \
+                                             IRMP_SUPPORT_SAMSUNGAH_PROTOCOL + IRMP_SUPPORT_MATSUSHITA_PROTOCOL + IRMP_SUPPORT_KASEIKYO_PROTOCOL + \
+                                             IRMP_SUPPORT_PANASONIC_PROTOCOL + IRMP_SUPPORT_MITSU_HEAVY_PROTOCOL + IRMP_SUPPORT_VINCENT_PROTOCOL + \
+                                             IRMP_SUPPORT_METZ_PROTOCOL + 2 * IRMP_SUPPORT_RF_GEN24_PROTOCOL + IRMP_SUPPORT_RF_X10_PROTOCOL + \
+                                             IRMP_SUPPORT_RF_MEDION_PROTOCOL + IRMP_SUPPORT_RECS80_PROTOCOL + IRMP_SUPPORT_S100_PROTOCOL + \
+                                             IRMP_SUPPORT_RC5_PROTOCOL + IRMP_SUPPORT_RCII_PROTOCOL + IRMP_SUPPORT_DENON_PROTOCOL + \
+                                             IRMP_SUPPORT_THOMSON_PROTOCOL + IRMP_SUPPORT_BOSE_PROTOCOL + IRMP_SUPPORT_RC6_PROTOCOL + \
+                                             IRMP_SUPPORT_RECS80EXT_PROTOCOL + IRMP_SUPPORT_NUBERT_PROTOCOL + IRMP_SUPPORT_FAN_PROTOCOL + \
+                                             IRMP_SUPPORT_SPEAKER_PROTOCOL + IRMP_SUPPORT_BANG_OLUFSEN_PROTOCOL + IRMP_SUPPORT_GRUNDIG_NOKIA_IR60_PROTOCOL + \
+                                             IRMP_SUPPORT_MERLIN_PROTOCOL + IRMP_SUPPORT_SIEMENS_OR_RUWIDO_PROTOCOL + IRMP_SUPPORT_FDC_PROTOCOL + \
+                                             IRMP_SUPPORT_RCCAR_PROTOCOL + IRMP_SUPPORT_KATHREIN_PROTOCOL + IRMP_SUPPORT_NETBOX_PROTOCOL + \
+                                             IRMP_SUPPORT_LEGO_PROTOCOL + IRMP_SUPPORT_IRMP16_PROTOCOL + IRMP_SUPPORT_GREE_PROTOCOL + \
+                                             IRMP_SUPPORT_A1TVBOX_PROTOCOL + IRMP_SUPPORT_ORTEK_PROTOCOL + IRMP_SUPPORT_RCMM_PROTOCOL)
+
+#if IRMP_START_BIT_ENTRY_COUNT <= 8
+typedef uint8_t                                 IRMP_START_BIT_MASK;
+#elif IRMP_START_BIT_ENTRY_COUNT <= 16
+typedef uint16_t                                IRMP_START_BIT_MASK;
+#elif IRMP_START_BIT_ENTRY_COUNT <= 32
+typedef uint32_t                                IRMP_START_BIT_MASK;
+#else
+typedef uint64_t                                IRMP_START_BIT_MASK;
+#endif
 
-    /* GPIO Configuration */
-#  if defined (STM32L1) || defined (STM32F4) || defined (STM32F3)
-    gpio_mode_setup(IRMP_PORT, GPIO_MODE_INPUT, GPIO_PUPD_NONE, IRMP_BIT);
-    gpio_set_output_options(IRMP_PORT, GPIO_OTYPE_PP, GPIO_OSPEED_2MHZ, IRMP_BIT);
-#  elif defined (STM32F1)
-    gpio_set_mode(IRMP_PORT, GPIO_MODE_INPUT, GPIO_CNF_INPUT_FLOAT, IRMP_BIT);
-#  endif
+typedef char irmp_start_bit_entry_count_check[(IRMP_START_BIT_ENTRIES == IRMP_START_BIT_ENTRY_COUNT) ? 1 : -1];  // enum and count must match
 
-#elif defined(STELLARIS_ARM_CORTEX_M4)
-    // Enable the GPIO port
-    ROM_SysCtlPeripheralEnable(IRMP_PORT_PERIPH);
+#define IRMP_START_BIT_BUCKETS                  32                                                              // number of pulse length buckets
+#if F_INTERRUPTS <= 20000
+#  define IRMP_START_BIT_BUCKET_SHIFT           3                                                               // 8 ticks per bucket
+#elif F_INTERRUPTS <= 40000
+#  define IRMP_START_BIT_BUCKET_SHIFT           4                                                               // 16 ticks per bucket
+#else
+#  define IRMP_START_BIT_BUCKET_SHIFT           5                                                               // 32 ticks per bucket
+#endif
+#define IRMP_START_BIT_BUCKET_MIN(b)            ((b) << IRMP_START_BIT_BUCKET_SHIFT)
+#define IRMP_START_BIT_BUCKET_MAX(b)            (((b) == IRMP_START_BIT_BUCKETS - 1) ? 0xFFFF : (((b) + 1) << IRMP_START_BIT_BUCKET_SHIFT) - 1)   // last bucket takes all longer pulses
+#define IRMP_START_BIT_IN_BUCKET(b, min, max)   ((max) >= IRMP_START_BIT_BUCKET_MIN(b) && (min) <= IRMP_START_BIT_BUCKET_MAX(b))
+#if __SIZEOF_INT__ == 4
+#  define IRMP_PULSE_TIME_MAX                   0xFFFF                                                          // irmp_pulse_time is uint_fast16_t
+#else
+#  define IRMP_PULSE_TIME_MAX                   0xFF                                                            // irmp_pulse_time is uint_fast8_t
+#endif
+#define IRMP_START_BIT_TOO_LONG                 0xFF                                                            // pseudo bucket: start bits irmp_pulse_time cannot count
+#define IRMP_START_BIT_IS_TOO_LONG(max)         ((max) > IRMP_PULSE_TIME_MAX)
+#define IRMP_START_BIT_ENTRY(b, e, min, max)    (((b) == IRMP_START_BIT_TOO_LONG ? IRMP_START_BIT_IS_TOO_LONG(max) : IRMP_START_BIT_IN_BUCKET(b, min, max)) ? \
+                                                 ((IRMP_START_BIT_MASK) 1 << (e)) : 0)
 
-    // Set as an input
-    ROM_GPIODirModeSet(IRMP_PORT_BASE, IRMP_PORT_PIN, GPIO_DIR_MODE_IN);
-    ROM_GPIOPadConfigSet(IRMP_PORT_BASE, IRMP_PORT_PIN, GPIO_STRENGTH_2MA, GPIO_PIN_TYPE_STD_WPU);
+#if IRMP_SUPPORT_SIRCS_PROTOCOL == 1
+#  define IRMP_START_BIT_SIRCS_MASK(b)              IRMP_START_BIT_ENTRY (b, IRMP_START_BIT_SIRCS, SIRCS_START_BIT_PULSE_LEN_MIN, SIRCS_START_BIT_PULSE_LEN_MAX)
+#else
+#  define IRMP_START_BIT_SIRCS_MASK(b)              0
+#endif
 
-#elif defined(__SDCC_stm8)                                              // STM8
-    IRMP_GPIO_STRUCT->DDR &= ~(1<<IRMP_BIT);                            // pin is input
-    IRMP_GPIO_STRUCT->CR1 |= (1<<IRMP_BIT);                             // activate pullup
+#if IRMP_SUPPORT_JVC_PROTOCOL == 1
+#  define IRMP_START_BIT_JVC_MASK(b)                IRMP_START_BIT_ENTRY (b, IRMP_START_BIT_JVC, JVC_START_BIT_PULSE_LEN_MIN, JVC_START_BIT_PULSE_LEN_MAX)
+#else
+#  define IRMP_START_BIT_JVC_MASK(b)                0
+#endif
 
-#elif defined (TEENSY_ARM_CORTEX_M4)                                    // TEENSY
-    pinMode(IRMP_PIN, INPUT);
+#if IRMP_SUPPORT_NEC_PROTOCOL == 1
+#  define IRMP_START_BIT_NEC_MASK(b)                IRMP_START_BIT_ENTRY (b, IRMP_START_BIT_NEC, NEC_START_BIT_PULSE_LEN_MIN, NEC_START_BIT_PULSE_LEN_MAX)
+#else
+#  define IRMP_START_BIT_NEC_MASK(b)                0
+#endif
 
-#elif defined(__xtensa__)                                               // ESP8266
-    pinMode(IRMP_BIT_NUMBER, INPUT);
-                                                                        // select pin function
-#  if (IRMP_BIT_NUMBER == 12)
-    PIN_FUNC_SELECT(PERIPHS_IO_MUX_MTDI_U, FUNC_GPIO12);
-//  doesn't work for me:
-//  # elif (IRMP_BIT_NUMBER == 13)
-//  PIN_FUNC_SELECT(PERIPHS_IO_MUX_MTCK_U , FUNC_GPIO13);
-#  else
-#   warning Please add PIN_FUNC_SELECT when necessary.
-#  endif
-    GPIO_DIS_OUTPUT(IRMP_BIT_NUMBER);
+#if IRMP_SUPPORT_TELEFUNKEN_PROTOCOL == 1
+#  define IRMP_START_BIT_TELEFUNKEN_MASK(b)         IRMP_START_BIT_ENTRY (b, IRMP_START_BIT_TELEFUNKEN, TELEFUNKEN_START_BIT_PULSE_LEN_MIN, TELEFUNKEN_START_BIT_PULSE_LEN_MAX)
+#else
+#  define IRMP_START_BIT_TELEFUNKEN_MASK(b)         0
+#endif
 
-#elif defined(__MBED__)
-    gpio_init_in_ex(&gpioIRin, IRMP_PIN, IRMP_PINMODE);                 // initialize input for IR diode
+#if IRMP_SUPPORT_ROOMBA_PROTOCOL == 1
+#  define IRMP_START_BIT_ROOMBA_MASK(b)             IRMP_START_BIT_ENTRY (b, IRMP_START_BIT_ROOMBA, ROOMBA_START_BIT_PULSE_LEN_MIN, ROOMBA_START_BIT_PULSE_LEN_MAX)
+#else
+#  define IRMP_START_BIT_ROOMBA_MASK(b)             0
+#endif
 
-#elif defined(_CHIBIOS_HAL_)
-    // ChibiOS HAL automatically initializes all pins according to the board config file, no need to repeat here
+#if IRMP_SUPPORT_ACP24_PROTOCOL == 1
+#  define IRMP_START_BIT_ACP24_MASK(b)              IRMP_START_BIT_ENTRY (b, IRMP_START_BIT_ACP24, ACP24_START_BIT_PULSE_LEN_MIN, ACP24_START_BIT_PULSE_LEN_MAX)
+#else
+#  define IRMP_START_BIT_ACP24_MASK(b)              0
+#endif
 
-#elif defined(PICO_RP2040)
-    /* GPIO Configuration */
-    gpio_init(IRMP_BIT);
-    gpio_pull_up(IRMP_BIT);
+#if IRMP_SUPPORT_PENTAX_PROTOCOL == 1
+#  define IRMP_START_BIT_PENTAX_MASK(b)             IRMP_START_BIT_ENTRY (b, IRMP_START_BIT_PENTAX, PENTAX_START_BIT_PULSE_LEN_MIN, PENTAX_START_BIT_PULSE_LEN_MAX)
+#else
+#  define IRMP_START_BIT_PENTAX_MASK(b)             0
+#endif
 
-#else                                                                   // AVR
-    IRMP_PORT &= ~(1<<IRMP_BIT);                                        // deactivate pullup
-    IRMP_DDR &= ~(1<<IRMP_BIT);                                         // set pin to input
+#if IRMP_SUPPORT_NIKON_PROTOCOL == 1
+#  define IRMP_START_BIT_NIKON_MASK(b)              IRMP_START_BIT_ENTRY (b, IRMP_START_BIT_NIKON, NIKON_START_BIT_PULSE_LEN_MIN, NIKON_START_BIT_PULSE_LEN_MAX)
+#else
+#  define IRMP_START_BIT_NIKON_MASK(b)              0
 #endif
 
-#if IRMP_LOGGING == 1
-    irmp_uart_init ();
+#if IRMP_SUPPORT_SAMSUNG_PROTOCOL == 1
+#  define IRMP_START_BIT_SAMSUNG_MASK(b)            IRMP_START_BIT_ENTRY (b, IRMP_START_BIT_SAMSUNG, SAMSUNG_START_BIT_PULSE_LEN_MIN, SAMSUNG_START_BIT_PULSE_LEN_MAX)
+#else
+#  define IRMP_START_BIT_SAMSUNG_MASK(b)            0
 #endif
-}
-#endif // ! defined(ARDUINO)
-#endif // if !defined(ANALYZE)
-/*---------------------------------------------------------------------------------------------------------------------------------------------------
- *  Get IRMP data
- *  @details  gets decoded IRMP data
- *  @param    pointer in order to store IRMP data
- *  @return    TRUE: successful, FALSE: failed
- *---------------------------------------------------------------------------------------------------------------------------------------------------
- */
-#  ifdef __cplusplus
-bool
+
+#if IRMP_SUPPORT_SAMSUNGAH_PROTOCOL == 1
+#  define IRMP_START_BIT_SAMSUNGAH_MASK(b)          IRMP_START_BIT_ENTRY (b, IRMP_START_BIT_SAMSUNGAH, SAMSUNGAH_START_BIT_PULSE_LEN_MIN, SAMSUNGAH_START_BIT_PULSE_LEN_MAX)
 #else
-uint_fast8_t
+#  define IRMP_START_BIT_SAMSUNGAH_MASK(b)          0
 #endif
-irmp_get_data (IRMP_DATA * irmp_data_p)
-{
-    uint_fast8_t   tReturnCode = FALSE;
 
-    if (irmp_ir_detected)
-    {
-        switch (irmp_protocol)
-        {
-#if IRMP_SUPPORT_SAMSUNG_PROTOCOL == 1
-            case IRMP_SAMSUNG_PROTOCOL:
-                if ((irmp_command >> 8) == (~irmp_command & 0x00FF))
-                {
-                    irmp_command &= 0xff;
-//                    irmp_command |= irmp_id << 8; // for samsung32 irmp_id looks to be the same as irmp_command
-                    tReturnCode = TRUE;
-                }
-                break;
+#if IRMP_SUPPORT_MATSUSHITA_PROTOCOL == 1
+#  define IRMP_START_BIT_MATSUSHITA_MASK(b)         IRMP_START_BIT_ENTRY (b, IRMP_START_BIT_MATSUSHITA, MATSUSHITA_START_BIT_PULSE_LEN_MIN, MATSUSHITA_START_BIT_PULSE_LEN_MAX)
+#else
+#  define IRMP_START_BIT_MATSUSHITA_MASK(b)         0
+#endif
 
-#  if IRMP_SUPPORT_SAMSUNG48_PROTOCOL == 1
-            case IRMP_SAMSUNG48_PROTOCOL:
-                irmp_command = (irmp_command & 0x00FF) | ((irmp_id & 0x00FF) << 8);
-                tReturnCode = TRUE;
-                break;
-#  endif
+#if IRMP_SUPPORT_KASEIKYO_PROTOCOL == 1
+#  define IRMP_START_BIT_KASEIKYO_MASK(b)           IRMP_START_BIT_ENTRY (b, IRMP_START_BIT_KASEIKYO, KASEIKYO_START_BIT_PULSE_LEN_MIN, KASEIKYO_START_BIT_PULSE_LEN_MAX)
+#else
+#  define IRMP_START_BIT_KASEIKYO_MASK(b)           0
 #endif
 
-#if IRMP_SUPPORT_SIRCS_PROTOCOL == 1
-            case IRMP_SIRCS_PROTOCOL:
-                // Concatenate high byte of command and low byte of address
-                irmp_address <<= 7;
-                irmp_address = irmp_address | irmp_command >> 8;
-                // Command is 7 bytes, so add the 8.th bit of command to address
-                irmp_address <<= 1;
-                if ((irmp_command & 0x80))
-                {
-                    irmp_address++;
-                }
-                irmp_command &= 0x7F;
-                tReturnCode = TRUE;
-                break;
+#if IRMP_SUPPORT_PANASONIC_PROTOCOL == 1
+#  define IRMP_START_BIT_PANASONIC_MASK(b)          IRMP_START_BIT_ENTRY (b, IRMP_START_BIT_PANASONIC, PANASONIC_START_BIT_PULSE_LEN_MIN, PANASONIC_START_BIT_PULSE_LEN_MAX)
+#else
+#  define IRMP_START_BIT_PANASONIC_MASK(b)          0
 #endif
 
-#if IRMP_SUPPORT_NEC_PROTOCOL == 1
-            case IRMP_NEC_PROTOCOL:
-                if ((irmp_command >> 8) == (~irmp_command & 0x00FF))
-                {
-                    if ((irmp_address >> 8) == (~irmp_address & 0x00FF))
-                    {
-                        irmp_address &= 0xff;
-                    }
-                    irmp_command &= 0xff;
-                }
-                else if (irmp_address == 0x87EE)
-                {
-                    ANALYZE_PRINTF1 ("APPLE protocol detected\n");
-                    irmp_protocol = IRMP_APPLE_PROTOCOL;
-                    irmp_address = (irmp_command & 0xFF00) >> 8; // address was received in command!
-                    irmp_command &= 0x00FF;
-                }
-                else
-                {
-                    ANALYZE_PRINTF1 ("ONKYO protocol detected\n");
-                    irmp_protocol = IRMP_ONKYO_PROTOCOL;
-                }
-                tReturnCode = TRUE;
-                break;
+#if IRMP_SUPPORT_MITSU_HEAVY_PROTOCOL == 1
+#  define IRMP_START_BIT_MITSU_HEAVY_MASK(b)        IRMP_START_BIT_ENTRY (b, IRMP_START_BIT_MITSU_HEAVY, MITSU_HEAVY_START_BIT_PULSE_LEN_MIN, MITSU_HEAVY_START_BIT_PULSE_LEN_MAX)
+#else
+#  define IRMP_START_BIT_MITSU_HEAVY_MASK(b)        0
 #endif
 
 #if IRMP_SUPPORT_VINCENT_PROTOCOL == 1
-            case IRMP_VINCENT_PROTOCOL:
-                if ((irmp_command >> 8) == (irmp_command & 0x00FF))
-                {
-                    irmp_command &= 0xff;
-                    tReturnCode = TRUE;
-                }
-                break;
+#  define IRMP_START_BIT_VINCENT_MASK(b)            IRMP_START_BIT_ENTRY (b, IRMP_START_BIT_VINCENT, VINCENT_START_BIT_PULSE_LEN_MIN, VINCENT_START_BIT_PULSE_LEN_MAX)
+#else
+#  define IRMP_START_BIT_VINCENT_MASK(b)            0
 #endif
 
-#if IRMP_SUPPORT_KASEIKYO_PROTOCOL == 1
-            case IRMP_KASEIKYO_PROTOCOL:
-                /*
-                 * Todo AJ 14.7.22 The bit before the command (not existent bit 16 of command) is skipped and I have a Panasonic remote where it is 1 for 2 buttons
-                 * and the 4 LSB command bits are always zero for this remote
-                 */
-                if( irmp_address == 0x2002) // PANASONIC_VENDOR_ID_CODE
-                {
-                    ANALYZE_PRINTF1 ("Kaseikyo_Panasonic protocol detected\n");
-                    irmp_protocol = IRMP_PANASONIC_PROTOCOL;
-                    irmp_command = irmp_command >> 4; // remove the 4 zero bits
-                    irmp_address = (irmp_command & 0xF00) >> 8; // LSB address (genre1) was received in command!
-                    irmp_address |= irmp_flags & 0xF0; // MSB of address(genre2 bits) are located in MSB of the flag byte
-                    irmp_command &= 0x00FF;
-                }
-                tReturnCode = TRUE;
-                break;
+#if IRMP_SUPPORT_METZ_PROTOCOL == 1
+#  define IRMP_START_BIT_METZ_MASK(b)               IRMP_START_BIT_ENTRY (b, IRMP_START_BIT_METZ, METZ_START_BIT_PULSE_LEN_MIN, METZ_START_BIT_PULSE_LEN_MAX)
+#else
+#  define IRMP_START_BIT_METZ_MASK(b)               0
 #endif
 
-#if IRMP_SUPPORT_BOSE_PROTOCOL == 1
-            case IRMP_BOSE_PROTOCOL:
-                if ((irmp_command >> 8) == (~irmp_command & 0x00FF))
-                {
-                    irmp_command &= 0xff;
-                    tReturnCode = TRUE;
-                }
-                break;
+#if IRMP_SUPPORT_RF_GEN24_PROTOCOL == 1
+#  define IRMP_START_BIT_RF_GEN24_0_MASK(b)         IRMP_START_BIT_ENTRY (b, IRMP_START_BIT_RF_GEN24_0, RF_GEN24_0_PULSE_LEN_MIN, RF_GEN24_0_PULSE_LEN_MAX)
+#else
+#  define IRMP_START_BIT_RF_GEN24_0_MASK(b)         0
 #endif
 
-#if IRMP_SUPPORT_MERLIN_PROTOCOL == 1
-            case IRMP_MERLIN_PROTOCOL:
-                if (irmp_bit == 10)
-                {
-                    tReturnCode = TRUE;
-                }
-                else if (irmp_bit >= 19 && ((irmp_bit - 3) % 8 == 0))
-                {
-                    if (((irmp_command >> 1) & 1) != (irmp_command & 1))
-                    {
-                        irmp_command >>= 1;
-                        irmp_command |= ((irmp_address & 1) << (irmp_bit - 12));
-                        irmp_address >>= 1;
-                        tReturnCode = TRUE;
-                    }
-                }
-                break;
+#if IRMP_SUPPORT_RF_GEN24_PROTOCOL == 1
+#  define IRMP_START_BIT_RF_GEN24_1_MASK(b)         IRMP_START_BIT_ENTRY (b, IRMP_START_BIT_RF_GEN24_1, RF_GEN24_1_PULSE_LEN_MIN, RF_GEN24_1_PULSE_LEN_MAX)
+#else
+#  define IRMP_START_BIT_RF_GEN24_1_MASK(b)         0
 #endif
 
-#if IRMP_SUPPORT_SIEMENS_OR_RUWIDO_PROTOCOL == 1
-            case IRMP_SIEMENS_PROTOCOL:
-            case IRMP_RUWIDO_PROTOCOL:
-                if (((irmp_command >> 1) & 0x0001) == (~irmp_command & 0x0001))
-                {
-                    irmp_command >>= 1;
-                    tReturnCode = TRUE;
-                }
-                break;
+#if IRMP_SUPPORT_RF_X10_PROTOCOL == 1
+#  define IRMP_START_BIT_RF_X10_MASK(b)             IRMP_START_BIT_ENTRY (b, IRMP_START_BIT_RF_X10, RF_X10_START_BIT_PULSE_LEN_MIN, RF_X10_START_BIT_PULSE_LEN_MAX)
+#else
+#  define IRMP_START_BIT_RF_X10_MASK(b)             0
 #endif
-#if IRMP_SUPPORT_KATHREIN_PROTOCOL == 1
-            case IRMP_KATHREIN_PROTOCOL:
-                if (irmp_command != 0x0000)
-                {
-                    tReturnCode = TRUE;
-                }
-                break;
+
+#if IRMP_SUPPORT_RF_MEDION_PROTOCOL == 1
+#  define IRMP_START_BIT_RF_MEDION_MASK(b)          IRMP_START_BIT_ENTRY (b, IRMP_START_BIT_RF_MEDION, RF_MEDION_START_BIT_PULSE_LEN_MIN, RF_MEDION_START_BIT_PULSE_LEN_MAX)
+#else
+#  define IRMP_START_BIT_RF_MEDION_MASK(b)          0
 #endif
-#if IRMP_SUPPORT_RC5_PROTOCOL == 1
-            case IRMP_RC5_PROTOCOL:
-                irmp_address &= ~0x20;                              // clear toggle bit
-                tReturnCode = TRUE;
-                break;
+
+#if IRMP_SUPPORT_RECS80_PROTOCOL == 1
+#  define IRMP_START_BIT_RECS80_MASK(b)             IRMP_START_BIT_ENTRY (b, IRMP_START_BIT_RECS80, RECS80_START_BIT_PULSE_LEN_MIN, RECS80_START_BIT_PULSE_LEN_MAX)
+#else
+#  define IRMP_START_BIT_RECS80_MASK(b)             0
 #endif
+
 #if IRMP_SUPPORT_S100_PROTOCOL == 1
-            case IRMP_S100_PROTOCOL:
-                irmp_address &= ~0x20;                              // clear toggle bit
-                tReturnCode = TRUE;
-                break;
-#endif
-#if IRMP_SUPPORT_IR60_PROTOCOL == 1
-            case IRMP_IR60_PROTOCOL:
-                if (irmp_command != 0x007d)                         // 0x007d (== 62<<1 + 1) is start instruction frame
-                {
-                    tReturnCode = TRUE;
-                }
-                else
-                {
-                    ANALYZE_PRINTF1("Info IR60: got start instruction frame\n");
-                }
-                break;
+#  define IRMP_START_BIT_S100_MASK(b)               (IRMP_START_BIT_ENTRY (b, IRMP_START_BIT_S100, S100_START_BIT_LEN_MIN, S100_START_BIT_LEN_MAX) | \
+                                                     IRMP_START_BIT_ENTRY (b, IRMP_START_BIT_S100, 2 * S100_START_BIT_LEN_MIN, 2 * S100_START_BIT_LEN_MAX))
+#else
+#  define IRMP_START_BIT_S100_MASK(b)               0
 #endif
-#if IRMP_SUPPORT_RCCAR_PROTOCOL == 1
-            case IRMP_RCCAR_PROTOCOL:
-                // frame in irmp_data:
-                // Bit 12 11 10 9  8  7  6  5  4  3  2  1  0
-                //     V  D7 D6 D5 D4 D3 D2 D1 D0 A1 A0 C1 C0   //         10 9  8  7  6  5  4  3  2  1  0
-                irmp_address = (irmp_command & 0x000C) >> 2;    // addr:   0  0  0  0  0  0  0  0  0  A1 A0
-                irmp_command = ((irmp_command & 0x1000) >> 2) | // V-Bit:  V  0  0  0  0  0  0  0  0  0  0
-                               ((irmp_command & 0x0003) << 8) | // C-Bits: 0  C1 C0 0  0  0  0  0  0  0  0
-                               ((irmp_command & 0x0FF0) >> 4);  // D-Bits:          D7 D6 D5 D4 D3 D2 D1 D0
-                tReturnCode = TRUE;                                     // Summe:  V  C1 C0 D7 D6 D5 D4 D3 D2 D1 D0
-                break;
+
+#if IRMP_SUPPORT_RC5_PROTOCOL == 1
+#  define IRMP_START_BIT_RC5_MASK(b)                (IRMP_START_BIT_ENTRY (b, IRMP_START_BIT_RC5, RC5_START_BIT_LEN_MIN, RC5_START_BIT_LEN_MAX) | \
+                                                     IRMP_START_BIT_ENTRY (b, IRMP_START_BIT_RC5, 2 * RC5_START_BIT_LEN_MIN, 2 * RC5_START_BIT_LEN_MAX))
+#else
+#  define IRMP_START_BIT_RC5_MASK(b)                0
 #endif
 
-#if IRMP_SUPPORT_NETBOX_PROTOCOL == 1                           // squeeze code to 8 bit, upper bit indicates release-key
-            case IRMP_NETBOX_PROTOCOL:
-                if (irmp_command & 0x1000)                      // last bit set?
-                {
-                    if ((irmp_command & 0x1f) == 0x15)          // key pressed: 101 01 (LSB)
-                    {
-                        irmp_command >>= 5;
-                        irmp_command &= 0x7F;
-                        tReturnCode = TRUE;
-                    }
-                    else if ((irmp_command & 0x1f) == 0x10)     // key released: 000 01 (LSB)
-                    {
-                        irmp_command >>= 5;
-                        irmp_command |= 0x80;
-                        tReturnCode = TRUE;
-                    }
-                    else
-                    {
-                        ANALYZE_PRINTF1("error NETBOX: bit6/7 must be 0/1\n");
-                    }
-                }
-                else
-                {
-                    ANALYZE_PRINTF1("error NETBOX: last bit not set\n");
-                }
-                break;
+#if IRMP_SUPPORT_RCII_PROTOCOL == 1
+#  define IRMP_START_BIT_RCII_MASK(b)               IRMP_START_BIT_ENTRY (b, IRMP_START_BIT_RCII, RCII_START_BIT_PULSE_LEN_MIN, RCII_START_BIT_PULSE_LEN_MAX)
+#else
+#  define IRMP_START_BIT_RCII_MASK(b)               0
 #endif
-#if IRMP_SUPPORT_LEGO_PROTOCOL == 1
-            case IRMP_LEGO_PROTOCOL:
-            {
-                uint_fast8_t crc = 0x0F ^ ((irmp_command & 0xF000) >> 12) ^ ((irmp_command & 0x0F00) >> 8) ^ ((irmp_command & 0x00F0) >> 4);
 
-                if ((irmp_command & 0x000F) == crc)
-                {
-                    irmp_command >>= 4;
-                    tReturnCode = TRUE;
-                }
-                else
-                {
-                    ANALYZE_PRINTF1 ("CRC error in LEGO protocol\n");
-                    // rtc = TRUE;                              // don't accept codes with CRC errors
-                }
-                break;
-            }
+#if IRMP_SUPPORT_DENON_PROTOCOL == 1
+#  define IRMP_START_BIT_DENON_MASK(b)              IRMP_START_BIT_ENTRY (b, IRMP_START_BIT_DENON, DENON_PULSE_LEN_MIN, DENON_PULSE_LEN_MAX)
+#else
+#  define IRMP_START_BIT_DENON_MASK(b)              0
 #endif
 
-#if IRMP_SUPPORT_METZ_PROTOCOL == 1
-            case IRMP_METZ_PROTOCOL:
-                irmp_address &= ~0x40;                              // clear toggle bit
-                if (((~irmp_address) & 0x07) == (irmp_address >> 3) && ((~irmp_command) & 0x3f) == (irmp_command >> 6))
-                {
-                    irmp_address >>= 3;
-                    irmp_command >>= 6;
-                    tReturnCode = TRUE;
-                }
-                break;
+#if IRMP_SUPPORT_THOMSON_PROTOCOL == 1
+#  define IRMP_START_BIT_THOMSON_MASK(b)            IRMP_START_BIT_ENTRY (b, IRMP_START_BIT_THOMSON, THOMSON_PULSE_LEN_MIN, THOMSON_PULSE_LEN_MAX)
+#else
+#  define IRMP_START_BIT_THOMSON_MASK(b)            0
 #endif
 
+#if IRMP_SUPPORT_BOSE_PROTOCOL == 1
+#  define IRMP_START_BIT_BOSE_MASK(b)               IRMP_START_BIT_ENTRY (b, IRMP_START_BIT_BOSE, BOSE_START_BIT_PULSE_LEN_MIN, BOSE_START_BIT_PULSE_LEN_MAX)
+#else
+#  define IRMP_START_BIT_BOSE_MASK(b)               0
+#endif
 
-#if IRMP_SUPPORT_RF_X10_PROTOCOL == 1 || IRMP_SUPPORT_RF_MEDION_PROTOCOL == 1
-            case RF_X10_PROTOCOL:
-            case RF_MEDION_PROTOCOL:
-            {
-                uint8_t channel;
-                uint8_t checksum;
+#if IRMP_SUPPORT_RC6_PROTOCOL == 1
+#  define IRMP_START_BIT_RC6_MASK(b)                IRMP_START_BIT_ENTRY (b, IRMP_START_BIT_RC6, RC6_START_BIT_PULSE_LEN_MIN, RC6_START_BIT_PULSE_LEN_MAX)
+#else
+#  define IRMP_START_BIT_RC6_MASK(b)                0
+#endif
 
-                channel = irmp_command & 0x0F;                      // lower nibble: RF channel 0-15
-                irmp_command >>= 4;                                 // shift out channel
+#if IRMP_SUPPORT_RECS80EXT_PROTOCOL == 1
+#  define IRMP_START_BIT_RECS80EXT_MASK(b)          IRMP_START_BIT_ENTRY (b, IRMP_START_BIT_RECS80EXT, RECS80EXT_START_BIT_PULSE_LEN_MIN, RECS80EXT_START_BIT_PULSE_LEN_MAX)
+#else
+#  define IRMP_START_BIT_RECS80EXT_MASK(b)          0
+#endif
 
-                checksum = irmp_address;                            // get checksum
+#if IRMP_SUPPORT_NUBERT_PROTOCOL == 1
+#  define IRMP_START_BIT_NUBERT_MASK(b)             IRMP_START_BIT_ENTRY (b, IRMP_START_BIT_NUBERT, NUBERT_START_BIT_PULSE_LEN_MIN, NUBERT_START_BIT_PULSE_LEN_MAX)
+#else
+#  define IRMP_START_BIT_NUBERT_MASK(b)             0
+#endif
 
-                if (((irmp_command + (0x0055 + (channel << 4))) & 0x7F) == checksum)
-                {                                                   // checksum correct?
-                    irmp_address = channel + 1;                     // set address to channel + 1
-                    tReturnCode = TRUE;
-                }
-                break;
-            }
+#if IRMP_SUPPORT_FAN_PROTOCOL == 1
+#  define IRMP_START_BIT_FAN_MASK(b)                IRMP_START_BIT_ENTRY (b, IRMP_START_BIT_FAN, FAN_START_BIT_PULSE_LEN_MIN, FAN_START_BIT_PULSE_LEN_MAX)
+#else
+#  define IRMP_START_BIT_FAN_MASK(b)                0
 #endif
 
-            default:
-            {
-                tReturnCode = TRUE;
-                break;
-            }
-        }
+#if IRMP_SUPPORT_SPEAKER_PROTOCOL == 1
+#  define IRMP_START_BIT_SPEAKER_MASK(b)            IRMP_START_BIT_ENTRY (b, IRMP_START_BIT_SPEAKER, SPEAKER_START_BIT_PULSE_LEN_MIN, SPEAKER_START_BIT_PULSE_LEN_MAX)
+#else
+#  define IRMP_START_BIT_SPEAKER_MASK(b)            0
+#endif
 
-        if (tReturnCode)
-        {
-            irmp_data_p->protocol = irmp_protocol;
-            irmp_data_p->address  = irmp_address;
-            irmp_data_p->command  = irmp_command;
+#if IRMP_SUPPORT_BANG_OLUFSEN_PROTOCOL == 1
+#  define IRMP_START_BIT_BANG_OLUFSEN_MASK(b)       IRMP_START_BIT_ENTRY (b, IRMP_START_BIT_BANG_OLUFSEN, BANG_OLUFSEN_START_BIT1_PULSE_LEN_MIN, BANG_OLUFSEN_START_BIT1_PULSE_LEN_MAX)
+#else
+#  define IRMP_START_BIT_BANG_OLUFSEN_MASK(b)       0
+#endif
 
-#if IRMP_AUTODETECT_REPEATRATE
-            tmp_delta = (pass_on_delta_detection * (1000000 / F_INTERRUPTS)) / 1000; // ms, this division is not precise
-            if (tmp_delta > 0xFF ) // reduce to uint8_t
-                delta = 0xFF;
-            else
-                delta = tmp_delta;
-            if (irmp_protocol != previous_irmp_protocol) { // reset
-                min_delta = 170;
-                upper_border = min_delta * (100 + JITTER_COMPENSATION) / 100 + 1;
-                timeout = 1;
-                keep_same_key = 0;
-                previous_irmp_protocol = irmp_protocol;
-            } else {
-                if (!(irmp_protocol == IRMP_NEC_PROTOCOL && delta < 75)) { // if NEC, ignore first short interval
-                    if (delta < min_delta && same_key)
-                        min_delta = delta;
-                }
-                upper_border = min_delta * (100 + JITTER_COMPENSATION) / 100 + 1;
-                timeout = (delta >= upper_border);
-                if (irmp_protocol == IRMP_RC5_PROTOCOL || irmp_protocol == IRMP_RC6_PROTOCOL || irmp_protocol == IRMP_RC6A_PROTOCOL || irmp_protocol == IRMP_RECS80_PROTOCOL \
-                    || irmp_protocol == IRMP_RECS80EXT_PROTOCOL || irmp_protocol == IRMP_RCMM24_PROTOCOL || irmp_protocol == IRMP_RCMM32_PROTOCOL \
-                    || irmp_protocol == IRMP_THOMSON_PROTOCOL || irmp_protocol == IRMP_S100_PROTOCOL || irmp_protocol == IRMP_METZ_PROTOCOL) {
-                    if (same_key) // same_key is false, if toggle; not using timeout helps detecting repeats after misdetection and timeout isn't needed for discerning repetition
-                        irmp_flags |= IRMP_FLAG_REPETITION;
-                } else {
-                    if (same_key && !timeout)
-                        irmp_flags |= IRMP_FLAG_REPETITION;
-                }
-                keep_same_key = same_key;
-                same_key = 0;
-            }
+#if IRMP_SUPPORT_GRUNDIG_NOKIA_IR60_PROTOCOL == 1
+#  define IRMP_START_BIT_GRUNDIG_NOKIA_IR60_MASK(b) IRMP_START_BIT_ENTRY (b, IRMP_START_BIT_GRUNDIG_NOKIA_IR60, GRUNDIG_NOKIA_IR60_START_BIT_LEN_MIN, GRUNDIG_NOKIA_IR60_START_BIT_LEN_MAX)
+#else
+#  define IRMP_START_BIT_GRUNDIG_NOKIA_IR60_MASK(b) 0
 #endif
 
-            irmp_data_p->flags    = irmp_flags;
-        }
-        else
-        {
-            irmp_protocol = IRMP_UNKNOWN_PROTOCOL;
-        }
+#if IRMP_SUPPORT_MERLIN_PROTOCOL == 1
+#  define IRMP_START_BIT_MERLIN_MASK(b)             IRMP_START_BIT_ENTRY (b, IRMP_START_BIT_MERLIN, MERLIN_START_BIT_PULSE_LEN_MIN, MERLIN_START_BIT_PULSE_LEN_MAX)
+#else
+#  define IRMP_START_BIT_MERLIN_MASK(b)             0
+#endif
 
-        irmp_command  = 0;                                      // don't reset irmp_protocol here, needed for detection of NEC & JVC repetition frames!
-        irmp_address  = 0;
-        irmp_flags    = 0;
-
-        irmp_ir_detected = FALSE;
-    }
+#if IRMP_SUPPORT_SIEMENS_OR_RUWIDO_PROTOCOL == 1
+#  define IRMP_START_BIT_SIEMENS_OR_RUWIDO_MASK(b)  (IRMP_START_BIT_ENTRY (b, IRMP_START_BIT_SIEMENS_OR_RUWIDO, SIEMENS_OR_RUWIDO_START_BIT_PULSE_LEN_MIN, SIEMENS_OR_RUWIDO_START_BIT_PULSE_LEN_MAX) | \
+                                                     IRMP_START_BIT_ENTRY (b, IRMP_START_BIT_SIEMENS_OR_RUWIDO, 2 * SIEMENS_OR_RUWIDO_START_BIT_PULSE_LEN_MIN, 2 * SIEMENS_OR_RUWIDO_START_BIT_PULSE_LEN_MAX))
+#else
+#  define IRMP_START_BIT_SIEMENS_OR_RUWIDO_MASK(b)  0
+#endif
 
-    return tReturnCode;
-}
+#if IRMP_SUPPORT_FDC_PROTOCOL == 1
+#  define IRMP_START_BIT_FDC_MASK(b)                IRMP_START_BIT_ENTRY (b, IRMP_START_BIT_FDC, FDC_START_BIT_PULSE_LEN_MIN, FDC_START_BIT_PULSE_LEN_MAX)
+#else
+#  define IRMP_START_BIT_FDC_MASK(b)                0
+#endif
 
-#if IRMP_USE_CALLBACK == 1
-void
-irmp_set_callback_ptr (void (*cb)(uint_fast8_t))
-{
-    irmp_callback_ptr = cb;
-}
-#endif // IRMP_USE_CALLBACK == 1
+#if IRMP_SUPPORT_RCCAR_PROTOCOL == 1
+#  define IRMP_START_BIT_RCCAR_MASK(b)              IRMP_START_BIT_ENTRY (b, IRMP_START_BIT_RCCAR, RCCAR_START_BIT_PULSE_LEN_MIN, RCCAR_START_BIT_PULSE_LEN_MAX)
+#else
+#  define IRMP_START_BIT_RCCAR_MASK(b)              0
+#endif
 
-// these statics must not be volatile, because they are only used by irmp_store_bit(), which is called by irmp_ISR()
-static uint_fast16_t irmp_tmp_address;                                      // ir address
-#if IRMP_32_BIT == 1
-static uint_fast32_t irmp_tmp_command;                                      // ir command
+#if IRMP_SUPPORT_KATHREIN_PROTOCOL == 1
+#  define IRMP_START_BIT_KATHREIN_MASK(b)           IRMP_START_BIT_ENTRY (b, IRMP_START_BIT_KATHREIN, KATHREIN_START_BIT_PULSE_LEN_MIN, KATHREIN_START_BIT_PULSE_LEN_MAX)
 #else
-static uint_fast16_t irmp_tmp_command;                                      // ir command
+#  define IRMP_START_BIT_KATHREIN_MASK(b)           0
 #endif
 
-#if (IRMP_SUPPORT_RC5_PROTOCOL == 1 && (IRMP_SUPPORT_FDC_PROTOCOL == 1 || IRMP_SUPPORT_RCCAR_PROTOCOL == 1)) || IRMP_SUPPORT_NEC42_PROTOCOL == 1
-static uint_fast16_t irmp_tmp_address2;                                     // ir address
-static uint_fast16_t irmp_tmp_command2;                                     // ir command
+#if IRMP_SUPPORT_NETBOX_PROTOCOL == 1
+#  define IRMP_START_BIT_NETBOX_MASK(b)             IRMP_START_BIT_ENTRY (b, IRMP_START_BIT_NETBOX, NETBOX_START_BIT_PULSE_LEN_MIN, NETBOX_START_BIT_PULSE_LEN_MAX)
+#else
+#  define IRMP_START_BIT_NETBOX_MASK(b)             0
 #endif
 
-#if IRMP_SUPPORT_LGAIR_PROTOCOL == 1
-static uint_fast16_t irmp_lgair_address;                                    // ir address
-static uint_fast16_t irmp_lgair_command;                                    // ir command
+#if IRMP_SUPPORT_LEGO_PROTOCOL == 1
+#  define IRMP_START_BIT_LEGO_MASK(b)               IRMP_START_BIT_ENTRY (b, IRMP_START_BIT_LEGO, LEGO_START_BIT_PULSE_LEN_MIN, LEGO_START_BIT_PULSE_LEN_MAX)
+#else
+#  define IRMP_START_BIT_LEGO_MASK(b)               0
 #endif
 
-#if IRMP_SUPPORT_MELINERA_PROTOCOL == 1
-static uint_fast16_t irmp_melinera_command;                                 // ir command
+#if IRMP_SUPPORT_IRMP16_PROTOCOL == 1
+#  define IRMP_START_BIT_IRMP16_MASK(b)             IRMP_START_BIT_ENTRY (b, IRMP_START_BIT_IRMP16, IRMP16_START_BIT_PULSE_LEN_MIN, IRMP16_START_BIT_PULSE_LEN_MAX)
+#else
+#  define IRMP_START_BIT_IRMP16_MASK(b)             0
 #endif
 
-#if IRMP_SUPPORT_SAMSUNG_PROTOCOL == 1
-static uint_fast16_t irmp_tmp_id;                                           // ir id (only SAMSUNG)
+#if IRMP_SUPPORT_GREE_PROTOCOL == 1
+#  define IRMP_START_BIT_GREE_MASK(b)               IRMP_START_BIT_ENTRY (b, IRMP_START_BIT_GREE, GREE_START_BIT_PULSE_LEN_MIN, GREE_START_BIT_PULSE_LEN_MAX)
+#else
+#  define IRMP_START_BIT_GREE_MASK(b)               0
 #endif
-#if IRMP_SUPPORT_KASEIKYO_PROTOCOL == 1
-static uint8_t      xor_check[6];                                           // check kaseikyo "parity" bits
-static uint_fast8_t genre2;                                                 // save genre2 bits here, later copied to MSB in flags
+
+#if IRMP_SUPPORT_A1TVBOX_PROTOCOL == 1
+#  define IRMP_START_BIT_A1TVBOX_MASK(b)            IRMP_START_BIT_ENTRY (b, IRMP_START_BIT_A1TVBOX, A1TVBOX_START_BIT_PULSE_LEN_MIN, A1TVBOX_START_BIT_PULSE_LEN_MAX)
+#else
+#  define IRMP_START_BIT_A1TVBOX_MASK(b)            0
 #endif
 
 #if IRMP_SUPPORT_ORTEK_PROTOCOL == 1
-static uint_fast8_t  parity;                                                // number of '1' of the first 14 bits, check if even.
+#  define IRMP_START_BIT_ORTEK_MASK(b)              IRMP_START_BIT_ENTRY (b, IRMP_START_BIT_ORTEK, ORTEK_START_BIT_PULSE_LEN_MIN, ORTEK_START_BIT_PULSE_LEN_MAX)
+#else
+#  define IRMP_START_BIT_ORTEK_MASK(b)              0
 #endif
 
-#if IRMP_SUPPORT_MITSU_HEAVY_PROTOCOL == 1
-static uint_fast8_t  check;                                                 // number of '1' of the first 14 bits, check if even.
-static uint_fast8_t  mitsu_parity;                                          // number of '1' of the first 14 bits, check if even.
+#if IRMP_SUPPORT_RCMM_PROTOCOL == 1
+#  define IRMP_START_BIT_RCMM_MASK(b)               IRMP_START_BIT_ENTRY (b, IRMP_START_BIT_RCMM, RCMM32_START_BIT_PULSE_LEN_MIN, RCMM32_START_BIT_PULSE_LEN_MAX)
+#else
+#  define IRMP_START_BIT_RCMM_MASK(b)               0
+#endif
+
+#define IRMP_START_BIT_BUCKET_MASK(b)       (IRMP_START_BIT_SIRCS_MASK(b) | IRMP_START_BIT_JVC_MASK(b) | IRMP_START_BIT_NEC_MASK(b) | \
+                                             IRMP_START_BIT_TELEFUNKEN_MASK(b) | IRMP_START_BIT_ROOMBA_MASK(b) | IRMP_START_BIT_ACP24_MASK(b) | \
+                                             IRMP_START_BIT_PENTAX_MASK(b) | IRMP_START_BIT_NIKON_MASK(b) | IRMP_START_BIT_SAMSUNG_MASK(b) | \
+                                             IRMP_START_BIT_SAMSUNGAH_MASK(b) | IRMP_START_BIT_MATSUSHITA_MASK(b) | IRMP_START_BIT_KASEIKYO_MASK(b) | \
+                                             IRMP_START_BIT_PANASONIC_MASK(b) | IRMP_START_BIT_MITSU_HEAVY_MASK(b) | IRMP_START_BIT_VINCENT_MASK(b) | \
+                                             IRMP_START_BIT_METZ_MASK(b) | IRMP_START_BIT_RF_GEN24_0_MASK(b) | IRMP_START_BIT_RF_GEN24_1_MASK(b) | \
+                                             IRMP_START_BIT_RF_X10_MASK(b) | IRMP_START_BIT_RF_MEDION_MASK(b) | IRMP_START_BIT_RECS80_MASK(b) | \
+                                             IRMP_START_BIT_S100_MASK(b) | IRMP_START_BIT_RC5_MASK(b) | IRMP_START_BIT_RCII_MASK(b) | \
+                                             IRMP_START_BIT_DENON_MASK(b) | IRMP_START_BIT_THOMSON_MASK(b) | IRMP_START_BIT_BOSE_MASK(b) | \
+                                             IRMP_START_BIT_RC6_MASK(b) | IRMP_START_BIT_RECS80EXT_MASK(b) | IRMP_START_BIT_NUBERT_MASK(b) | \
+                                             IRMP_START_BIT_FAN_MASK(b) | IRMP_START_BIT_SPEAKER_MASK(b) | IRMP_START_BIT_BANG_OLUFSEN_MASK(b) | \
+                                             IRMP_START_BIT_GRUNDIG_NOKIA_IR60_MASK(b) | IRMP_START_BIT_MERLIN_MASK(b) | \
+                                             IRMP_START_BIT_SIEMENS_OR_RUWIDO_MASK(b) | IRMP_START_BIT_FDC_MASK(b) | IRMP_START_BIT_RCCAR_MASK(b) | \
+                                             IRMP_START_BIT_KATHREIN_MASK(b) | IRMP_START_BIT_NETBOX_MASK(b) | IRMP_START_BIT_LEGO_MASK(b) | \
+                                             IRMP_START_BIT_IRMP16_MASK(b) | IRMP_START_BIT_GREE_MASK(b) | IRMP_START_BIT_A1TVBOX_MASK(b) | \
+                                             IRMP_START_BIT_ORTEK_MASK(b) | IRMP_START_BIT_RCMM_MASK(b))
+
+static IRMP_CONSTEXPR PROGMEM IRMP_START_BIT_MASK irmp_start_bit_candidates[IRMP_START_BIT_BUCKETS] =
+{
+    IRMP_START_BIT_BUCKET_MASK (0), IRMP_START_BIT_BUCKET_MASK (1), IRMP_START_BIT_BUCKET_MASK (2), IRMP_START_BIT_BUCKET_MASK (3),
+    IRMP_START_BIT_BUCKET_MASK (4), IRMP_START_BIT_BUCKET_MASK (5), IRMP_START_BIT_BUCKET_MASK (6), IRMP_START_BIT_BUCKET_MASK (7),
+    IRMP_START_BIT_BUCKET_MASK (8), IRMP_START_BIT_BUCKET_MASK (9), IRMP_START_BIT_BUCKET_MASK (10), IRMP_START_BIT_BUCKET_MASK (11),
+    IRMP_START_BIT_BUCKET_MASK (12), IRMP_START_BIT_BUCKET_MASK (13), IRMP_START_BIT_BUCKET_MASK (14), IRMP_START_BIT_BUCKET_MASK (15),
+    IRMP_START_BIT_BUCKET_MASK (16), IRMP_START_BIT_BUCKET_MASK (17), IRMP_START_BIT_BUCKET_MASK (18), IRMP_START_BIT_BUCKET_MASK (19),
+    IRMP_START_BIT_BUCKET_MASK (20), IRMP_START_BIT_BUCKET_MASK (21), IRMP_START_BIT_BUCKET_MASK (22), IRMP_START_BIT_BUCKET_MASK (23),
+    IRMP_START_BIT_BUCKET_MASK (24), IRMP_START_BIT_BUCKET_MASK (25), IRMP_START_BIT_BUCKET_MASK (26), IRMP_START_BIT_BUCKET_MASK (27),
+    IRMP_START_BIT_BUCKET_MASK (28), IRMP_START_BIT_BUCKET_MASK (29), IRMP_START_BIT_BUCKET_MASK (30), IRMP_START_BIT_BUCKET_MASK (31)
+};
+
+#if IRMP_ENABLE_CONSTEXPR_TABLES == 1
+static_assert (IRMP_START_BIT_BUCKET_MASK (IRMP_START_BIT_TOO_LONG) == 0,
+               "start bit pulse of an enabled protocol does not fit into irmp_pulse_time, reduce F_INTERRUPTS or disable the protocol");
 #endif
 
 /*---------------------------------------------------------------------------------------------------------------------------------------------------
- *  store bit
- *  @details  store bit in temp address or temp command
- *  @param    value to store: 0 or 1
+ *  Get start bit candidates
+ *  @details  returns the entries of the start bit table which may match the pulse length
+ *  @param    length of start bit pulse
+ *  @return   bitmask of entries, bit n = 1 << IRMP_START_BIT_xxx
  *---------------------------------------------------------------------------------------------------------------------------------------------------
  */
-// verhindert, dass irmp_store_bit() inline compiliert wird:
-// static void irmp_store_bit (uint_fast8_t) __attribute__ ((noinline));
-
-static void
-irmp_store_bit (uint_fast8_t value)
+static IRMP_START_BIT_MASK
+irmp_start_bit_candidates_get (uint_fast16_t pulse_time)
 {
-#if IRMP_SUPPORT_ACP24_PROTOCOL == 1
-    if (irmp_param.protocol == IRMP_ACP24_PROTOCOL)                                                 // squeeze 64 bits into 16 bits:
-    {
-        if (value)
-        {
-            // ACP24-Frame:
-            //           1         2         3         4         5         6
-            // 0123456789012345678901234567890123456789012345678901234567890123456789
-            // N VVMMM    ? ???    t vmA x                 y                     TTTT
-            //
-            // irmp_data_p->command:
-            //
-            //         5432109876543210
-            //         NAVVvMMMmtxyTTTT
-
-            switch (irmp_bit)
-            {
-                case  0: irmp_tmp_command |= (1<<15); break;                                        // N
-                case  2: irmp_tmp_command |= (1<<13); break;                                        // V
-                case  3: irmp_tmp_command |= (1<<12); break;                                        // V
-                case  4: irmp_tmp_command |= (1<<10); break;                                        // M
-                case  5: irmp_tmp_command |= (1<< 9); break;                                        // M
-                case  6: irmp_tmp_command |= (1<< 8); break;                                        // M
-                case 20: irmp_tmp_command |= (1<< 6); break;                                        // t
-                case 22: irmp_tmp_command |= (1<<11); break;                                        // v
-                case 23: irmp_tmp_command |= (1<< 7); break;                                        // m
-                case 24: irmp_tmp_command |= (1<<14); break;                                        // A
-                case 26: irmp_tmp_command |= (1<< 5); break;                                        // x
-                case 44: irmp_tmp_command |= (1<< 4); break;                                        // y
-                case 66: irmp_tmp_command |= (1<< 3); break;                                        // T
-                case 67: irmp_tmp_command |= (1<< 2); break;                                        // T
-                case 68: irmp_tmp_command |= (1<< 1); break;                                        // T
-                case 69: irmp_tmp_command |= (1<< 0); break;                                        // T
-            }
-        }
-    }
-    else
-#endif // IRMP_SUPPORT_ACP24_PROTOCOL
+    IRMP_START_BIT_MASK candidates;
+    uint_fast16_t       bucket = pulse_time >> IRMP_START_BIT_BUCKET_SHIFT;
 
-#if IRMP_SUPPORT_ORTEK_PROTOCOL == 1
-    if (irmp_param.protocol == IRMP_ORTEK_PROTOCOL)
-    {
-        if (irmp_bit < 14)
-        {
-            if (value)
-            {
-                parity++;
-            }
-        }
-        else if (irmp_bit == 14)
-        {
-            if (value)                                                                                      // value == 1: even parity
-            {
-                if (parity & 0x01)
-                {
-                    parity = PARITY_CHECK_FAILED;
-                }
-                else
-                {
-                    parity = PARITY_CHECK_OK;
-                }
-            }
-            else
-            {
-                if (parity & 0x01)                                                                          // value == 0: odd parity
-                {
-                    parity = PARITY_CHECK_OK;
-                }
-                else
-                {
-                    parity = PARITY_CHECK_FAILED;
-                }
-            }
-        }
-    }
-    else
-#endif
+    if (bucket > IRMP_START_BIT_BUCKETS - 1)
     {
-        ;
+        bucket = IRMP_START_BIT_BUCKETS - 1;
     }
 
-#if IRMP_SUPPORT_GRUNDIG_NOKIA_IR60_PROTOCOL == 1
-    if (irmp_bit == 0 && irmp_param.protocol == IRMP_GRUNDIG_PROTOCOL)
-    {
-        first_bit = value;
-    }
-    else
-#endif
+    memcpy_P (&candidates, &irmp_start_bit_candidates[bucket], sizeof (IRMP_START_BIT_MASK));
+    return candidates;
+}
 
-    if (irmp_bit >= irmp_param.address_offset && irmp_bit < irmp_param.address_end)
-    {
-        if (irmp_param.lsb_first)
-        {
-            irmp_tmp_address |= (((uint_fast16_t) (value)) << (irmp_bit - irmp_param.address_offset));      // CV wants cast
-        }
-        else
-        {
-            irmp_tmp_address <<= 1;
-            irmp_tmp_address |= value;
-        }
-    }
-    else if (irmp_bit >= irmp_param.command_offset && irmp_bit < irmp_param.command_end)
-    {
-        if (irmp_param.lsb_first)
-        {
-#if IRMP_SUPPORT_SAMSUNG48_PROTOCOL == 1
-            if (irmp_param.protocol == IRMP_SAMSUNG48_PROTOCOL && irmp_bit >= 32)
-            {
-                irmp_tmp_id |= (((uint_fast16_t) (value)) << (irmp_bit - 32));                              // CV wants cast
-            }
-            else
-#endif
-            {
-                irmp_tmp_command |= (((uint_fast16_t) (value)) << (irmp_bit - irmp_param.command_offset));  // CV wants cast
-            }
-        }
-        else
-        {
-            irmp_tmp_command <<= 1;
-            irmp_tmp_command |= value;
-        }
-    }
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ *  Get first start bit candidate
+ *  @details  index of the lowest set bit, so only candidates are visited, not every entry of the table
+ *  @param    bitmask of entries, must not be 0
+ *  @return   IRMP_START_BIT_xxx
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+static uint_fast8_t
+irmp_start_bit_first (IRMP_START_BIT_MASK candidates)
+{
+#if defined(__GNUC__)
+#  if IRMP_START_BIT_ENTRY_COUNT <= 16
+    return __builtin_ctz (candidates);                                          // count trailing zeros, unsigned int has >= 16 bits
+#  elif IRMP_START_BIT_ENTRY_COUNT <= 32
+    return __builtin_ctzl (candidates);
+#  else
+    return __builtin_ctzll (candidates);
+#  endif
+#else
+    uint_fast8_t        idx = 0;
 
-#if IRMP_SUPPORT_LGAIR_PROTOCOL == 1
-    if (irmp_param.protocol == IRMP_NEC_PROTOCOL || irmp_param.protocol == IRMP_NEC42_PROTOCOL)
+    while (! (candidates & 0xFF))                                               // skip zero bytes at once
     {
-        if (irmp_bit < 8)
-        {
-            irmp_lgair_address <<= 1;                                                                       // LGAIR uses MSB
-            irmp_lgair_address |= value;
-        }
-        else if (irmp_bit < 24)
-        {
-            irmp_lgair_command <<= 1;                                                                       // LGAIR uses MSB
-            irmp_lgair_command |= value;
-        }
+        candidates >>= 8;
+        idx += 8;
     }
-    // NO else!
-#endif
 
-#if IRMP_SUPPORT_MELINERA_PROTOCOL == 1
-    if (irmp_param.protocol == IRMP_NEC_PROTOCOL || irmp_param.protocol == IRMP_NEC42_PROTOCOL || irmp_param.protocol == IRMP_MELINERA_PROTOCOL)
+    while (! (candidates & 1))
     {
-        irmp_melinera_command <<= 1;                                                                        // MELINERA uses MSB
-        irmp_melinera_command |= value;
+        candidates >>= 1;
+        idx++;
     }
-#endif
 
-#if IRMP_SUPPORT_NEC42_PROTOCOL == 1
-    if (irmp_param.protocol == IRMP_NEC42_PROTOCOL && irmp_bit >= 13 && irmp_bit < 26)
-    {
-        irmp_tmp_address2 |= (((uint_fast16_t) (value)) << (irmp_bit - 13));                                // CV wants cast
-    }
-    else
+    return idx;
 #endif
+}
 
+#if IRMP_ENABLE_PROTOCOL_MASK == 1
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ *  Protocols of the start bit table
+ *  @details  one entry for each entry of the start bit table: the protocols which a frame with this start bit may turn out to be.
+ *            If you add a start bit check, add an entry here too!
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+static IRMP_CONSTEXPR PROGMEM IRMP_PROTOCOL_MASK irmp_start_bit_protocols[IRMP_START_BIT_ENTRIES] =
+{
+#if IRMP_SUPPORT_SIRCS_PROTOCOL == 1
+    IRMP_PROTOCOL_BIT (IRMP_SIRCS_PROTOCOL),                                    // IRMP_START_BIT_SIRCS
+#endif
+#if IRMP_SUPPORT_JVC_PROTOCOL == 1
+    IRMP_PROTOCOL_BIT (IRMP_JVC_PROTOCOL),                                      // IRMP_START_BIT_JVC
+#endif
+#if IRMP_SUPPORT_NEC_PROTOCOL == 1
+    IRMP_PROTOCOL_BIT (IRMP_NEC_PROTOCOL) | IRMP_PROTOCOL_BIT (IRMP_NEC16_PROTOCOL) |
+    IRMP_PROTOCOL_BIT (IRMP_NEC42_PROTOCOL) | IRMP_PROTOCOL_BIT (IRMP_APPLE_PROTOCOL) |
+    IRMP_PROTOCOL_BIT (IRMP_ONKYO_PROTOCOL) | IRMP_PROTOCOL_BIT (IRMP_JVC_PROTOCOL) |
+    IRMP_PROTOCOL_BIT (IRMP_LGAIR_PROTOCOL) | IRMP_PROTOCOL_BIT (IRMP_MELINERA_PROTOCOL), // IRMP_START_BIT_NEC
+#endif
+#if IRMP_SUPPORT_TELEFUNKEN_PROTOCOL == 1
+    IRMP_PROTOCOL_BIT (IRMP_TELEFUNKEN_PROTOCOL),                               // IRMP_START_BIT_TELEFUNKEN
+#endif
+#if IRMP_SUPPORT_ROOMBA_PROTOCOL == 1
+    IRMP_PROTOCOL_BIT (IRMP_ROOMBA_PROTOCOL),                                   // IRMP_START_BIT_ROOMBA
+#endif
+#if IRMP_SUPPORT_ACP24_PROTOCOL == 1
+    IRMP_PROTOCOL_BIT (IRMP_ACP24_PROTOCOL),                                    // IRMP_START_BIT_ACP24
+#endif
+#if IRMP_SUPPORT_PENTAX_PROTOCOL == 1
+    IRMP_PROTOCOL_BIT (IRMP_PENTAX_PROTOCOL),                                   // IRMP_START_BIT_PENTAX
+#endif
+#if IRMP_SUPPORT_NIKON_PROTOCOL == 1
+    IRMP_PROTOCOL_BIT (IRMP_NIKON_PROTOCOL),                                    // IRMP_START_BIT_NIKON
+#endif
 #if IRMP_SUPPORT_SAMSUNG_PROTOCOL == 1
-    if (irmp_param.protocol == IRMP_SAMSUNG_PROTOCOL && irmp_bit >= SAMSUNG_ID_OFFSET && irmp_bit < SAMSUNG_ID_OFFSET + SAMSUNG_ID_LEN)
-    {
-        irmp_tmp_id |= (((uint_fast16_t) (value)) << (irmp_bit - SAMSUNG_ID_OFFSET));                       // store with LSB first
-    }
-    else
+    IRMP_PROTOCOL_BIT (IRMP_SAMSUNG_PROTOCOL) | IRMP_PROTOCOL_BIT (IRMP_SAMSUNG32_PROTOCOL) |
+    IRMP_PROTOCOL_BIT (IRMP_SAMSUNG48_PROTOCOL),                                // IRMP_START_BIT_SAMSUNG
+#endif
+#if IRMP_SUPPORT_SAMSUNGAH_PROTOCOL == 1
+    IRMP_PROTOCOL_BIT (IRMP_SAMSUNGAH_PROTOCOL),                                // IRMP_START_BIT_SAMSUNGAH
+#endif
+#if IRMP_SUPPORT_MATSUSHITA_PROTOCOL == 1
+    IRMP_PROTOCOL_BIT (IRMP_MATSUSHITA_PROTOCOL) | IRMP_PROTOCOL_BIT (IRMP_TECHNICS_PROTOCOL), // IRMP_START_BIT_MATSUSHITA
 #endif
-
 #if IRMP_SUPPORT_KASEIKYO_PROTOCOL == 1
-    if (irmp_param.protocol == IRMP_KASEIKYO_PROTOCOL)
-    {
-        if (irmp_bit >= 20 && irmp_bit < 24)
-        {
-            irmp_tmp_command |= (((uint_fast16_t) (value)) << (irmp_bit - 8));  // store 4 system bits (genre 1) in upper nibble with LSB first
-        }
-        else if (irmp_bit >= 24 && irmp_bit < 28)
-        {
-            genre2 |= (((uint_fast8_t) (value)) << (irmp_bit - 20));            // store 4 system bits (genre 2) in upper nibble with LSB first
-        }
-
-        if (irmp_bit < KASEIKYO_COMPLETE_DATA_LEN)
-        {
-            if (value)
-            {
-                xor_check[irmp_bit / 8] |= 1 << (irmp_bit % 8);
-            }
-            else
-            {
-                xor_check[irmp_bit / 8] &= ~(1 << (irmp_bit % 8));
-            }
-        }
-    }
-    else
+    IRMP_PROTOCOL_BIT (IRMP_KASEIKYO_PROTOCOL) | IRMP_PROTOCOL_BIT (IRMP_PANASONIC_PROTOCOL), // IRMP_START_BIT_KASEIKYO
+#endif
+#if IRMP_SUPPORT_PANASONIC_PROTOCOL == 1
+    IRMP_PROTOCOL_BIT (IRMP_PANASONIC_PROTOCOL),                                // IRMP_START_BIT_PANASONIC
 #endif
-
 #if IRMP_SUPPORT_MITSU_HEAVY_PROTOCOL == 1
-    if (irmp_param.protocol == IRMP_MITSU_HEAVY_PROTOCOL)                           // squeeze 64 bits into 16 bits:
-    {
-        if (irmp_bit == 72 )
-        {                                                                           // irmp_tmp_address, irmp_tmp_command received: check parity & compress
-            mitsu_parity = PARITY_CHECK_OK;
+    IRMP_PROTOCOL_BIT (IRMP_MITSU_HEAVY_PROTOCOL),                              // IRMP_START_BIT_MITSU_HEAVY
+#endif
+#if IRMP_SUPPORT_VINCENT_PROTOCOL == 1
+    IRMP_PROTOCOL_BIT (IRMP_VINCENT_PROTOCOL),                                  // IRMP_START_BIT_VINCENT
+#endif
+#if IRMP_SUPPORT_METZ_PROTOCOL == 1
+    IRMP_PROTOCOL_BIT (IRMP_METZ_PROTOCOL),                                     // IRMP_START_BIT_METZ
+#endif
+#if IRMP_SUPPORT_RF_GEN24_PROTOCOL == 1
+    IRMP_PROTOCOL_BIT (RF_GEN24_PROTOCOL),                                        // IRMP_START_BIT_RF_GEN24_0
+    IRMP_PROTOCOL_BIT (RF_GEN24_PROTOCOL),                                        // IRMP_START_BIT_RF_GEN24_1
+#endif
+#if IRMP_SUPPORT_RF_X10_PROTOCOL == 1
+    IRMP_PROTOCOL_BIT (RF_X10_PROTOCOL),                                        // IRMP_START_BIT_RF_X10
+#endif
+#if IRMP_SUPPORT_RF_MEDION_PROTOCOL == 1
+    IRMP_PROTOCOL_BIT (RF_MEDION_PROTOCOL),                                     // IRMP_START_BIT_RF_MEDION
+#endif
+#if IRMP_SUPPORT_RECS80_PROTOCOL == 1
+    IRMP_PROTOCOL_BIT (IRMP_RECS80_PROTOCOL),                                   // IRMP_START_BIT_RECS80
+#endif
+#if IRMP_SUPPORT_S100_PROTOCOL == 1
+    IRMP_PROTOCOL_BIT (IRMP_S100_PROTOCOL),                                     // IRMP_START_BIT_S100
+#endif
+#if IRMP_SUPPORT_RC5_PROTOCOL == 1
+    IRMP_PROTOCOL_BIT (IRMP_RC5_PROTOCOL) | IRMP_PROTOCOL_BIT (IRMP_FDC_PROTOCOL) |
+    IRMP_PROTOCOL_BIT (IRMP_RCCAR_PROTOCOL),                                    // IRMP_START_BIT_RC5
+#endif
+#if IRMP_SUPPORT_RCII_PROTOCOL == 1
+    IRMP_PROTOCOL_BIT (IRMP_RCII_PROTOCOL),                                     // IRMP_START_BIT_RCII
+#endif
+#if IRMP_SUPPORT_DENON_PROTOCOL == 1
+    IRMP_PROTOCOL_BIT (IRMP_DENON_PROTOCOL),                                    // IRMP_START_BIT_DENON
+#endif
+#if IRMP_SUPPORT_THOMSON_PROTOCOL == 1
+    IRMP_PROTOCOL_BIT (IRMP_THOMSON_PROTOCOL),                                  // IRMP_START_BIT_THOMSON
+#endif
+#if IRMP_SUPPORT_BOSE_PROTOCOL == 1
+    IRMP_PROTOCOL_BIT (IRMP_BOSE_PROTOCOL),                                     // IRMP_START_BIT_BOSE
+#endif
+#if IRMP_SUPPORT_RC6_PROTOCOL == 1
+    IRMP_PROTOCOL_BIT (IRMP_RC6_PROTOCOL) | IRMP_PROTOCOL_BIT (IRMP_RC6A_PROTOCOL) |
+    IRMP_PROTOCOL_BIT (IRMP_RC6A20_PROTOCOL) | IRMP_PROTOCOL_BIT (IRMP_RC6A28_PROTOCOL), // IRMP_START_BIT_RC6
+#endif
+#if IRMP_SUPPORT_RECS80EXT_PROTOCOL == 1
+    IRMP_PROTOCOL_BIT (IRMP_RECS80EXT_PROTOCOL),                                // IRMP_START_BIT_RECS80EXT
+#endif
+#if IRMP_SUPPORT_NUBERT_PROTOCOL == 1
+    IRMP_PROTOCOL_BIT (IRMP_NUBERT_PROTOCOL),                                   // IRMP_START_BIT_NUBERT
+#endif
+#if IRMP_SUPPORT_FAN_PROTOCOL == 1
+    IRMP_PROTOCOL_BIT (IRMP_FAN_PROTOCOL),                                      // IRMP_START_BIT_FAN
+#endif
+#if IRMP_SUPPORT_SPEAKER_PROTOCOL == 1
+    IRMP_PROTOCOL_BIT (IRMP_SPEAKER_PROTOCOL),                                  // IRMP_START_BIT_SPEAKER
+#endif
+#if IRMP_SUPPORT_BANG_OLUFSEN_PROTOCOL == 1
+    IRMP_PROTOCOL_BIT (IRMP_BANG_OLUFSEN_PROTOCOL),                             // IRMP_START_BIT_BANG_OLUFSEN
+#endif
+#if IRMP_SUPPORT_GRUNDIG_NOKIA_IR60_PROTOCOL == 1
+    IRMP_PROTOCOL_BIT (IRMP_GRUNDIG_PROTOCOL) | IRMP_PROTOCOL_BIT (IRMP_NOKIA_PROTOCOL) |
+    IRMP_PROTOCOL_BIT (IRMP_IR60_PROTOCOL),                                     // IRMP_START_BIT_GRUNDIG_NOKIA_IR60
+#endif
+#if IRMP_SUPPORT_MERLIN_PROTOCOL == 1
+    IRMP_PROTOCOL_BIT (IRMP_MERLIN_PROTOCOL),                                   // IRMP_START_BIT_MERLIN
+#endif
+#if IRMP_SUPPORT_SIEMENS_OR_RUWIDO_PROTOCOL == 1
+    IRMP_PROTOCOL_BIT (IRMP_SIEMENS_PROTOCOL) | IRMP_PROTOCOL_BIT (IRMP_RUWIDO_PROTOCOL), // IRMP_START_BIT_SIEMENS_OR_RUWIDO
+#endif
+#if IRMP_SUPPORT_FDC_PROTOCOL == 1
+    IRMP_PROTOCOL_BIT (IRMP_FDC_PROTOCOL),                                      // IRMP_START_BIT_FDC
+#endif
+#if IRMP_SUPPORT_RCCAR_PROTOCOL == 1
+    IRMP_PROTOCOL_BIT (IRMP_RCCAR_PROTOCOL),                                    // IRMP_START_BIT_RCCAR
+#endif
+#if IRMP_SUPPORT_KATHREIN_PROTOCOL == 1
+    IRMP_PROTOCOL_BIT (IRMP_KATHREIN_PROTOCOL),                                 // IRMP_START_BIT_KATHREIN
+#endif
+#if IRMP_SUPPORT_NETBOX_PROTOCOL == 1
+    IRMP_PROTOCOL_BIT (IRMP_NETBOX_PROTOCOL),                                   // IRMP_START_BIT_NETBOX
+#endif
+#if IRMP_SUPPORT_LEGO_PROTOCOL == 1
+    IRMP_PROTOCOL_BIT (IRMP_LEGO_PROTOCOL),                                     // IRMP_START_BIT_LEGO
+#endif
+#if IRMP_SUPPORT_IRMP16_PROTOCOL == 1
+    IRMP_PROTOCOL_BIT (IRMP_IRMP16_PROTOCOL),                                   // IRMP_START_BIT_IRMP16
+#endif
+#if IRMP_SUPPORT_GREE_PROTOCOL == 1
+    IRMP_PROTOCOL_BIT (IRMP_GREE_PROTOCOL),                                     // IRMP_START_BIT_GREE
+#endif
+#if IRMP_SUPPORT_A1TVBOX_PROTOCOL == 1
+    IRMP_PROTOCOL_BIT (IRMP_A1TVBOX_PROTOCOL),                                  // IRMP_START_BIT_A1TVBOX
+#endif
+#if IRMP_SUPPORT_ORTEK_PROTOCOL == 1
+    IRMP_PROTOCOL_BIT (IRMP_ORTEK_PROTOCOL),                                    // IRMP_START_BIT_ORTEK
+#endif
+#if IRMP_SUPPORT_RCMM_PROTOCOL == 1
+    IRMP_PROTOCOL_BIT (IRMP_RCMM32_PROTOCOL) | IRMP_PROTOCOL_BIT (IRMP_RCMM24_PROTOCOL) |
+    IRMP_PROTOCOL_BIT (IRMP_RCMM12_PROTOCOL),                                   // IRMP_START_BIT_RCMM
+#endif
+};
 
-            check = irmp_tmp_address >> 8;                                          // inverted upper byte == lower byte?
-            check = ~ check;
+static IRMP_PROTOCOL_MASK               irmp_protocol_mask      = IRMP_PROTOCOL_MASK_ALL;   // enabled protocols
+static IRMP_START_BIT_MASK              irmp_start_bit_enabled  = (IRMP_START_BIT_MASK) ~0; // start bit checks of enabled protocols
+
+#define irmp_protocol_enabled(p)        ((irmp_protocol_mask & IRMP_PROTOCOL_BIT (p)) != 0)
+
+#if !defined(IRMP_DISABLE_INTERRUPTS)                                   // define IRMP_IRQ_STATE and both macros for other targets
+#  if defined(__AVR__)
+#    define IRMP_IRQ_STATE                      uint8_t
+#    define IRMP_DISABLE_INTERRUPTS(s)          { s = SREG; cli (); }
+#    define IRMP_RESTORE_INTERRUPTS(s)          { SREG = s; }
+#  elif defined(__GNUC__) && (defined(__ARM_ARCH_6M__) || defined(__ARM_ARCH_7M__) || defined(__ARM_ARCH_7EM__) || defined(__ARM_ARCH_8M_MAIN__))
+#    define IRMP_IRQ_STATE                      uint32_t
+#    define IRMP_DISABLE_INTERRUPTS(s)          { __asm__ __volatile__ ("mrs %0, primask" : "=r" (s)); __asm__ __volatile__ ("cpsid i" ::: "memory"); }
+#    define IRMP_RESTORE_INTERRUPTS(s)          { __asm__ __volatile__ ("msr primask, %0" :: "r" (s) : "memory"); }
+#  elif defined(ARDUINO)
+#    define IRMP_IRQ_STATE                      uint8_t
+#    define IRMP_DISABLE_INTERRUPTS(s)          { s = 0; noInterrupts (); }
+#    define IRMP_RESTORE_INTERRUPTS(s)          { (void) s; interrupts (); }
+#  else                                                                 // e.g. analyzer: irmp_ISR() does not interrupt the caller
+#    define IRMP_IRQ_STATE                      uint8_t
+#    define IRMP_DISABLE_INTERRUPTS(s)          { s = 0; }
+#    define IRMP_RESTORE_INTERRUPTS(s)          { (void) s; }
+#  endif
+#endif
 
-            if (check == (irmp_tmp_address & 0xFF))
-            {                                                                       // ok:
-                irmp_tmp_address <<= 8;                                             // throw away upper byte
-            }
-            else
-            {
-                mitsu_parity = PARITY_CHECK_FAILED;
-            }
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ *  Set protocol mask
+ *  @details  enables the protocols in mask, disables all others. Protocols not enabled in irmpconfig.h cannot be enabled here.
+ *            irmp_ISR() skips the start bit checks which cannot lead to an enabled protocol, irmp_get_data() drops frames of
+ *            disabled protocols sharing a start bit with an enabled one. A frame being received may still use the old mask.
+ *            Both masks are written with interrupts disabled, so irmp_ISR() never sees a half written mask. On targets
+ *            without IRMP_DISABLE_INTERRUPTS(), call it with the IR timer interrupt disabled.
+ *  @param    bitmask of protocols, bit n = IRMP_PROTOCOL_BIT (n), IRMP_PROTOCOL_MASK_ALL enables all
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+void
+irmp_set_protocol_mask (IRMP_PROTOCOL_MASK mask)
+{
+    IRMP_PROTOCOL_MASK  protocols;
+    IRMP_START_BIT_MASK enabled = 0;
+    uint_fast8_t        idx;
+    IRMP_IRQ_STATE      irq_state;
 
-            check = irmp_tmp_command >> 8;                                          // inverted upper byte == lower byte?
-            check = ~ check;
-            if (check == (irmp_tmp_command & 0xFF))
-            {                                                                       // ok:  pack together
-                irmp_tmp_address |= irmp_tmp_command & 0xFF;                        // byte 1, byte2 in irmp_tmp_address, irmp_tmp_command can be used for byte 3
-            }
-            else
-            {
-                mitsu_parity = PARITY_CHECK_FAILED;
-            }
-            irmp_tmp_command = 0;
-        }
+    for (idx = 0; idx < IRMP_START_BIT_ENTRIES; idx++)
+    {
+        memcpy_P (&protocols, &irmp_start_bit_protocols[idx], sizeof (IRMP_PROTOCOL_MASK));
 
-        if (irmp_bit >= 72 )
-        {                                                                           // receive 3. word in irmp_tmp_command
-            irmp_tmp_command <<= 1;
-            irmp_tmp_command |= value;
+        if (protocols & mask)
+        {
+            enabled |= (IRMP_START_BIT_MASK) 1 << idx;
         }
     }
-    else
-#endif // IRMP_SUPPORT_MITSU_HEAVY_PROTOCOL
-    {
-        ;
-    }
 
-    irmp_bit++;
+    IRMP_DISABLE_INTERRUPTS (irq_state);
+    irmp_protocol_mask      = mask;
+    irmp_start_bit_enabled  = enabled;
+    IRMP_RESTORE_INTERRUPTS (irq_state);
 }
 
 /*---------------------------------------------------------------------------------------------------------------------------------------------------
- *  store bit
- *  @details  store bit in temp address or temp command
- *  @param    value to store: 0 or 1
+ *  Get protocol mask
+ *  @details  returns the mask set by irmp_set_protocol_mask()
+ *  @return   bitmask of protocols, IRMP_PROTOCOL_MASK_ALL after reset
  *---------------------------------------------------------------------------------------------------------------------------------------------------
  */
-#if IRMP_SUPPORT_RC5_PROTOCOL == 1 && (IRMP_SUPPORT_FDC_PROTOCOL == 1 || IRMP_SUPPORT_RCCAR_PROTOCOL == 1)
-static void
-irmp_store_bit2 (uint_fast8_t value)
+IRMP_PROTOCOL_MASK
+irmp_get_protocol_mask (void)
 {
-    uint_fast8_t irmp_bit2;
-
-    if (irmp_param.protocol)
-    {
-        irmp_bit2 = irmp_bit - 2;
-    }
-    else
-    {
-        irmp_bit2 = irmp_bit - 1;
-    }
-
-    if (irmp_bit2 >= irmp_param2.address_offset && irmp_bit2 < irmp_param2.address_end)
-    {
-        irmp_tmp_address2 |= (((uint_fast16_t) (value)) << (irmp_bit2 - irmp_param2.address_offset));   // CV wants cast
-    }
-    else if (irmp_bit2 >= irmp_param2.command_offset && irmp_bit2 < irmp_param2.command_end)
-    {
-        irmp_tmp_command2 |= (((uint_fast16_t) (value)) << (irmp_bit2 - irmp_param2.command_offset));   // CV wants cast
-    }
+    return irmp_protocol_mask;
 }
-#endif // IRMP_SUPPORT_RC5_PROTOCOL == 1 && (IRMP_SUPPORT_FDC_PROTOCOL == 1 || IRMP_SUPPORT_RCCAR_PROTOCOL == 1)
+#endif // IRMP_ENABLE_PROTOCOL_MASK == 1
 
-#if defined(ANALYZE)
-static uint32_t s_curSample = 0;
-static uint32_t s_startBitSample = 0;
+#if IRMP_FRAME_QUEUE_SIZE > 0 || IRMP_ENABLE_DATA_EX == 1
+#  define IRMP_USE_TICK_COUNTER                 1                       // irmp_ISR() counts ticks for timestamps
+#else
+#  define IRMP_USE_TICK_COUNTER                 0
+#endif
+
+#if !defined(IRMP_USE_IDLE_FAST_PATH)                                   // -DIRMP_USE_IDLE_FAST_PATH=0 for comparison in benchmark
+#  if IRMP_LOGGING == 1 || IRMP_ENABLE_HASH_DECODER == 1
+#    define IRMP_USE_IDLE_FAST_PATH             0                       // these need every single tick
+#  else
+#    define IRMP_USE_IDLE_FAST_PATH             1                       // irmp_ISR() returns early if there is nothing to do
+#  endif
 #endif
 
+#if IRMP_FRAME_QUEUE_SIZE > 0
 /*---------------------------------------------------------------------------------------------------------------------------------------------------
- *  ISR routine
- *  @details  ISR routine, called 10000 to 20000 times per second
+ *  Frame queue
+ *  @details  ring buffer with one producer, irmp_ISR(), and one consumer, irmp_get_data(). irmp_ISR() only writes irmp_queue_head,
+ *            irmp_get_data() only writes irmp_queue_tail, so no locking is needed. Both indexes run freely,
+ *            the number of queued frames is (uint8_t) (irmp_queue_head - irmp_queue_tail).
  *---------------------------------------------------------------------------------------------------------------------------------------------------
  */
-    static uint_fast8_t     irmp_start_bit_detected;                                // flag: start bit detected
-    static uint_fast8_t     wait_for_space;                                         // flag: wait for data bit space
-    static uint_fast8_t     wait_for_start_space;                                   // flag: wait for start bit space
-#if __SIZEOF_INT__ == 4
-    static uint_fast16_t irmp_pulse_time;                                            // count bit time for pulse
-#else
-    static uint_fast8_t irmp_pulse_time;                                            // count bit time for pulse
+typedef struct
+{
+    IRMP_DATA                                   data;                   // frame as returned by irmp_get_data()
+    uint32_t                                    ticks;                  // irmp_tick_counter at end of frame
+#if IRMP_ENABLE_DATA_EX == 1
+    uint32_t                                    start_ticks;            // irmp_tick_counter at begin of start bit
+    uint32_t                                    gap_ticks;              // ticks since end of previous frame
 #endif
-    static PAUSE_LEN        irmp_pause_time;                                        // count bit time for pause
-    static uint_fast16_t    key_repetition_len;                                     // SIRCS repeats frame 2-5 times with 45 ms pause
-    static uint_fast8_t     repetition_frame_number;
-
-#if defined(ARDUINO)
-#include "irmpArduinoExt.hpp" // Must be included after declaration of irmp_start_bit_detected etc.
+#if IRMP_FRAME_BITS > 0
+    IRMP_FRAME                                  frame;                  // data bits, see irmp_get_frame()
 #endif
+} IRMP_QUEUE_ENTRY;
 
-/*
- * 4 us idle, 45 us at start of each pulse @16 MHz ATmega 328p
- */
-#if defined(ESP8266) || defined(ESP32)
-bool IRAM_ATTR irmp_ISR(void)
+#if defined(__GNUC__)
+#  define IRMP_QUEUE_BARRIER()                  __asm__ __volatile__ ("" ::: "memory")  // keep entry accesses on their side of the index update
 #else
-#  ifdef __cplusplus
-bool irmp_ISR(void)
-#  else
-uint_fast8_t irmp_ISR(void)
-#  endif
+#  define IRMP_QUEUE_BARRIER()
 #endif
+#endif // IRMP_FRAME_QUEUE_SIZE > 0
 
+#if IRMP_ENABLE_CONTEXT == 1
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ *  Decoder context
+ *  @details  holds everything which is a static variable if IRMP_ENABLE_CONTEXT is 0.
+ *            The members keep the names of these variables. The macros below map each name to the member of the
+ *            current context irmp_ctx, so the decoder code itself is the same for both variants.
+ *            Members with a start value != 0 are set by irmp_init_ctx(), see also irmp_default_context.
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+struct irmp_context
 {
-    static uint_fast16_t    last_irmp_address = 0xFFFF;                             // save last irmp address to recognize key repetition
+    uint_fast16_t                               last_irmp_address;      // save last irmp address to recognize key repetition
+#if IRMP_32_BIT == 1
+    uint_fast32_t                               last_irmp_command;      // save last irmp command to recognize key repetition
+#else
+    uint_fast16_t                               last_irmp_command;      // save last irmp command to recognize key repetition
+#endif
 #if IRMP_ENABLE_RELEASE_DETECTION == 1
-    static uint_fast8_t     key_released = TRUE;
+    uint_fast8_t                                key_released;
 #endif
+#if IRMP_SUPPORT_DENON_PROTOCOL == 1
+    uint_fast16_t                               denon_repetition_len;   // denon repetition len of 2nd auto generated frame
+    uint_fast16_t                               last_irmp_denon_command;// save last irmp command to recognize DENON frame repetition
+#endif
+
+    uint_fast8_t                                irmp_bit;               // current bit position
+    IRMP_PARAMETER                              irmp_param;
+#if IRMP_SUPPORT_RC5_PROTOCOL == 1 && (IRMP_SUPPORT_FDC_PROTOCOL == 1 || IRMP_SUPPORT_RCCAR_PROTOCOL == 1)
+    IRMP_PARAMETER                              irmp_param2;
+#endif
+    volatile uint_fast8_t                       irmp_ir_detected;
+    volatile uint_fast8_t                       irmp_protocol;
+    volatile uint_fast16_t                      irmp_address;
 #if IRMP_32_BIT == 1
-    static uint_fast32_t    last_irmp_command = 0xFFFFFFFF;                         // save last irmp command to recognize key repetition
+    uint_fast32_t                               irmp_command;
 #else
-    static uint_fast16_t    last_irmp_command = 0xFFFF;                             // save last irmp command to recognize key repetition
+    uint_fast16_t                               irmp_command;
 #endif
-#if IRMP_SUPPORT_DENON_PROTOCOL == 1
-    static uint_fast16_t    last_irmp_denon_command;                                // save last irmp command to recognize DENON frame repetition
-    static uint_fast16_t    denon_repetition_len = 0xFFFF;                          // denon repetition len of 2nd auto generated frame
+    volatile uint_fast16_t                      irmp_id;                // only used for SAMSUNG protocol
+    uint_fast8_t                                irmp_flags;
+
+    uint_fast16_t                               irmp_tmp_address;       // ir address
+#if IRMP_32_BIT == 1
+    uint_fast32_t                               irmp_tmp_command;       // ir command
+#else
+    uint_fast16_t                               irmp_tmp_command;       // ir command
+#endif
+#if (IRMP_SUPPORT_RC5_PROTOCOL == 1 && (IRMP_SUPPORT_FDC_PROTOCOL == 1 || IRMP_SUPPORT_RCCAR_PROTOCOL == 1)) || IRMP_SUPPORT_NEC42_PROTOCOL == 1
+    uint_fast16_t                               irmp_tmp_address2;      // ir address
+    uint_fast16_t                               irmp_tmp_command2;      // ir command
+#endif
+#if IRMP_FRAME_BITS == 0
+#if IRMP_SUPPORT_LGAIR_PROTOCOL == 1
+    uint_fast16_t                               irmp_lgair_address;     // ir address
+    uint_fast16_t                               irmp_lgair_command;     // ir command
+#endif
+#if IRMP_SUPPORT_MELINERA_PROTOCOL == 1
+    uint_fast16_t                               irmp_melinera_command;  // ir command
+#endif
+#endif // IRMP_FRAME_BITS == 0
+#if IRMP_SUPPORT_SAMSUNG_PROTOCOL == 1
+    uint_fast16_t                               irmp_tmp_id;            // ir id (only SAMSUNG)
+#endif
+#if IRMP_SUPPORT_KASEIKYO_PROTOCOL == 1
+    uint8_t                                     xor_check[6];           // check kaseikyo "parity" bits
+    uint_fast8_t                                genre2;                 // save genre2 bits here, later copied to MSB in flags
+#endif
+#if IRMP_SUPPORT_ORTEK_PROTOCOL == 1
+    uint_fast8_t                                parity;                 // number of '1' of the first 14 bits, check if even.
+#endif
+#if IRMP_SUPPORT_MITSU_HEAVY_PROTOCOL == 1
+    uint_fast8_t                                check;
+    uint_fast8_t                                mitsu_parity;
+#endif
+#if IRMP_SUPPORT_GRUNDIG_NOKIA_IR60_PROTOCOL == 1
+    uint_fast8_t                                first_bit;
+#endif
+
+    uint_fast8_t                                irmp_start_bit_detected;// flag: start bit detected
+    uint_fast8_t                                wait_for_space;         // flag: wait for data bit space
+    uint_fast8_t                                wait_for_start_space;   // flag: wait for start bit space
+#if __SIZEOF_INT__ == 4
+    uint_fast16_t                               irmp_pulse_time;        // count bit time for pulse
+#else
+    uint_fast8_t                                irmp_pulse_time;        // count bit time for pulse
+#endif
+    PAUSE_LEN                                   irmp_pause_time;        // count bit time for pause
+    uint_fast16_t                               key_repetition_len;     // SIRCS repeats frame 2-5 times with 45 ms pause
+#if IRMP_USE_IDLE_FAST_PATH == 1
+    uint_fast8_t                                irmp_steady_idle;       // flag: nothing to do but counting key_repetition_len
 #endif
+    uint_fast8_t                                repetition_frame_number;
 #if IRMP_SUPPORT_RC5_PROTOCOL == 1 || IRMP_SUPPORT_S100_PROTOCOL == 1
-    static uint_fast8_t     rc5_cmd_bit6;                                           // bit 6 of RC5 command is the inverted 2nd start bit
+    uint_fast8_t                                rc5_cmd_bit6;           // bit 6 of RC5 command is the inverted 2nd start bit
 #endif
 #if IRMP_SUPPORT_MANCHESTER == 1
-    static PAUSE_LEN        last_pause;                                             // last pause value
+    PAUSE_LEN                                   last_pause;             // last pause value
 #endif
 #if IRMP_SUPPORT_MANCHESTER == 1 || IRMP_SUPPORT_BANG_OLUFSEN_PROTOCOL == 1
-    static uint_fast8_t     last_value;                                             // last bit value
+    uint_fast8_t                                last_value;             // last bit value
 #endif
 #if IRMP_SUPPORT_RCII_PROTOCOL == 1
-    static uint_fast8_t     waiting_for_2nd_pulse = 0;
-#endif
-#if IRMP_SUPPORT_RF_GEN24_PROTOCOL == 1
-    uint_fast8_t            bit_0 = 0;
+    uint_fast8_t                                waiting_for_2nd_pulse;
+#endif
+#if IRMP_FRAME_QUEUE_SIZE > 0
+    IRMP_QUEUE_ENTRY                            irmp_queue[IRMP_FRAME_QUEUE_SIZE];
+    volatile uint8_t                            irmp_queue_head;        // index of next entry to write, changed by irmp_ISR() only
+    volatile uint8_t                            irmp_queue_tail;        // index of next entry to read, changed by irmp_get_data() only
+    volatile uint16_t                           irmp_queue_overflows;   // number of frames lost because the queue was full
+#endif
+#if IRMP_USE_TICK_COUNTER == 1
+    uint32_t                                    irmp_tick_counter;      // number of ticks since start, for timestamps
+#endif
+#if IRMP_ENABLE_DATA_EX == 1
+    uint32_t                                    irmp_start_bit_ticks;   // tick count at begin of current start bit
+    uint32_t                                    irmp_frame_start_ticks; // tick count at begin of detected frame
+    uint32_t                                    irmp_frame_end_ticks;   // tick count at end of detected frame
+    uint32_t                                    irmp_frame_gap_ticks;   // ticks between previous and detected frame
+    uint32_t                                    irmp_last_frame_end_ticks; // tick count at end of previous frame
+    uint_fast8_t                                irmp_last_frame_valid;  // TRUE: irmp_last_frame_end_ticks is valid
+#endif
+#if IRMP_ENABLE_CANDIDATES == 1
+    uint8_t                                     irmp_candidate_buf[IRMP_CANDIDATE_BUFFER_LEN]; // pulse and pause lengths of current frame
+    uint_fast8_t                                irmp_candidate_len;     // number of entries in irmp_candidate_buf
+    uint_fast16_t                               irmp_candidate_run;     // length of current pulse or pause
+    uint_fast8_t                                irmp_candidate_level;   // level of current pulse or pause
+    uint_fast8_t                                irmp_candidate_state;   // IRMP_CANDIDATE_IDLE, IRMP_CANDIDATE_RECORDING or IRMP_CANDIDATE_DECODING
+    uint_fast8_t                                irmp_candidate_replaying; // TRUE: irmp_ISR_input() gets recorded ticks
+    IRMP_START_BIT_MASK                         irmp_candidate_mask;    // start bit candidates not tried yet
+#endif
+#if IRMP_RAW_CAPTURE_LEN > 0
+    IRMP_RAW_FRAME                              irmp_raw_frames[2];     // irmp_ISR() records into irmp_raw_frames[irmp_raw_write]
+    uint_fast16_t                               irmp_raw_run;           // length of current pulse or pause
+    uint_fast8_t                                irmp_raw_level;         // level of current pulse or pause
+    uint_fast8_t                                irmp_raw_recording;     // flag: recording a frame
+    volatile uint8_t                            irmp_raw_write;         // index of buffer being recorded, changed by irmp_ISR() only
+    volatile uint8_t                            irmp_raw_ready;         // flag: other buffer holds a new frame, see irmp_get_raw_frame()
+    volatile uint8_t                            irmp_raw_held;          // flag: application reads other buffer
+#endif
+#if IRMP_ENABLE_HASH_DECODER == 1
+    uint32_t                                    irmp_hash;              // hash of current frame
+    uint32_t                                    irmp_hash_last;         // hash of last frame, for repetition detection
+    uint_fast16_t                               irmp_hash_prev[2];      // length of last pulse [0] and last pause [1]
+    uint_fast16_t                               irmp_hash_run;          // length of current pulse or pause
+    uint_fast16_t                               irmp_hash_gap;          // ticks since end of last frame
+    uint_fast8_t                                irmp_hash_len;          // number of pulses and pauses, max. 255
+    uint_fast8_t                                irmp_hash_level;        // level of current pulse or pause
+    uint_fast8_t                                irmp_hash_state;        // IRMP_HASH_IDLE, IRMP_HASH_RECORDING, IRMP_HASH_COMPLETE or IRMP_HASH_DROPPED
+    uint_fast8_t                                irmp_hash_repetition;   // flag: frame started shortly after the last one
+#if IRMP_ENABLE_DATA_EX == 1
+    uint32_t                                    irmp_hash_start_ticks;  // tick count at begin of current frame
+#endif
+#endif
+#if IRMP_SYMBOL_LUT_LEN > 0
+    uint8_t                                     irmp_symbol_lut[IRMP_SYMBOL_LUT_LEN];   // see irmp_symbol_lut_fill()
+#endif
+#if IRMP_FRAME_BITS > 0
+    uint8_t                                     irmp_frame_acc[IRMP_FRAME_BITS / 8];    // data bits of current frame, see irmp_store_bit()
+    uint_fast8_t                                irmp_frame_acc_len;     // number of data bits of detected frame
+    IRMP_FRAME                                  irmp_frame;             // frame last returned by irmp_get_data()
 #endif
-    uint_fast8_t            irmp_input;                                             // input value
+};
 
-#if defined(ANALYZE)
-    time_counter++;
-#endif // ANALYZE
+#ifdef __cplusplus
+static IRMP_CONTEXT                             irmp_default_context;   // start values are set by irmp_default_context_init
 
-#if IRMP_HIGH_ACTIVE == 1
-    irmp_input = ! input(IRMP_PIN);
+static struct IRMP_DEFAULT_CONTEXT_INIT
+{
+    IRMP_DEFAULT_CONTEXT_INIT () { irmp_init_ctx (&irmp_default_context); }
+}                                               irmp_default_context_init;
 #else
-    irmp_input = input(IRMP_PIN);
+static IRMP_CONTEXT                             irmp_default_context =  // same start values as set by irmp_init_ctx()
+{
+    .last_irmp_address      = 0xFFFF,
+#if IRMP_32_BIT == 1
+    .last_irmp_command      = 0xFFFFFFFF,
+#else
+    .last_irmp_command      = 0xFFFF,
+#endif
+#if IRMP_ENABLE_RELEASE_DETECTION == 1
+    .key_released           = TRUE,
+#endif
+#if IRMP_SUPPORT_DENON_PROTOCOL == 1
+    .denon_repetition_len   = 0xFFFF,
+#endif
+};
 #endif
 
-#if IRMP_USE_CALLBACK == 1
-    if (irmp_callback_ptr)
-    {
-        static uint_fast8_t last_inverted_input;
-
-        if (last_inverted_input != !irmp_input)
-        {
-            (*irmp_callback_ptr) (! irmp_input);
-            last_inverted_input = !irmp_input;
-        }
-    }
-#endif // IRMP_USE_CALLBACK == 1
+static IRMP_THREAD_LOCAL IRMP_CONTEXT *         irmp_ctx = &irmp_default_context;   // context used by the decoder functions
+
+#define irmp_bit                                (irmp_ctx->irmp_bit)
+#define irmp_param                              (irmp_ctx->irmp_param)
+#define irmp_param2                             (irmp_ctx->irmp_param2)
+#define irmp_ir_detected                        (irmp_ctx->irmp_ir_detected)
+#define irmp_protocol                           (irmp_ctx->irmp_protocol)
+#define irmp_address                            (irmp_ctx->irmp_address)
+#define irmp_command                            (irmp_ctx->irmp_command)
+#define irmp_id                                 (irmp_ctx->irmp_id)
+#define irmp_flags                              (irmp_ctx->irmp_flags)
+#define irmp_tmp_address                        (irmp_ctx->irmp_tmp_address)
+#define irmp_tmp_command                        (irmp_ctx->irmp_tmp_command)
+#define irmp_tmp_address2                       (irmp_ctx->irmp_tmp_address2)
+#define irmp_tmp_command2                       (irmp_ctx->irmp_tmp_command2)
+#define irmp_lgair_address                      (irmp_ctx->irmp_lgair_address)
+#define irmp_lgair_command                      (irmp_ctx->irmp_lgair_command)
+#define irmp_melinera_command                   (irmp_ctx->irmp_melinera_command)
+#define irmp_tmp_id                             (irmp_ctx->irmp_tmp_id)
+#define xor_check                               (irmp_ctx->xor_check)
+#define genre2                                  (irmp_ctx->genre2)
+#define parity                                  (irmp_ctx->parity)
+#define check                                   (irmp_ctx->check)
+#define mitsu_parity                            (irmp_ctx->mitsu_parity)
+#define first_bit                               (irmp_ctx->first_bit)
+#define irmp_start_bit_detected                 (irmp_ctx->irmp_start_bit_detected)
+#define wait_for_space                          (irmp_ctx->wait_for_space)
+#define wait_for_start_space                    (irmp_ctx->wait_for_start_space)
+#define irmp_pulse_time                         (irmp_ctx->irmp_pulse_time)
+#define irmp_pause_time                         (irmp_ctx->irmp_pause_time)
+#define key_repetition_len                      (irmp_ctx->key_repetition_len)
+#if IRMP_USE_IDLE_FAST_PATH == 1
+#define irmp_steady_idle                        (irmp_ctx->irmp_steady_idle)
+#endif
+#define repetition_frame_number                 (irmp_ctx->repetition_frame_number)
+#define last_irmp_address                       (irmp_ctx->last_irmp_address)
+#define last_irmp_command                       (irmp_ctx->last_irmp_command)
+#define key_released                            (irmp_ctx->key_released)
+#define last_irmp_denon_command                 (irmp_ctx->last_irmp_denon_command)
+#define denon_repetition_len                    (irmp_ctx->denon_repetition_len)
+#define rc5_cmd_bit6                            (irmp_ctx->rc5_cmd_bit6)
+#define last_pause                              (irmp_ctx->last_pause)
+#define last_value                              (irmp_ctx->last_value)
+#define waiting_for_2nd_pulse                   (irmp_ctx->waiting_for_2nd_pulse)
+#define irmp_queue                              (irmp_ctx->irmp_queue)
+#define irmp_queue_head                         (irmp_ctx->irmp_queue_head)
+#define irmp_queue_tail                         (irmp_ctx->irmp_queue_tail)
+#define irmp_queue_overflows                    (irmp_ctx->irmp_queue_overflows)
+#define irmp_tick_counter                       (irmp_ctx->irmp_tick_counter)
+#define irmp_start_bit_ticks                    (irmp_ctx->irmp_start_bit_ticks)
+#define irmp_frame_start_ticks                  (irmp_ctx->irmp_frame_start_ticks)
+#define irmp_frame_end_ticks                    (irmp_ctx->irmp_frame_end_ticks)
+#define irmp_frame_gap_ticks                    (irmp_ctx->irmp_frame_gap_ticks)
+#define irmp_last_frame_end_ticks               (irmp_ctx->irmp_last_frame_end_ticks)
+#define irmp_last_frame_valid                   (irmp_ctx->irmp_last_frame_valid)
+#define irmp_candidate_buf                      (irmp_ctx->irmp_candidate_buf)
+#define irmp_candidate_len                      (irmp_ctx->irmp_candidate_len)
+#define irmp_candidate_run                      (irmp_ctx->irmp_candidate_run)
+#define irmp_candidate_level                    (irmp_ctx->irmp_candidate_level)
+#define irmp_candidate_state                    (irmp_ctx->irmp_candidate_state)
+#define irmp_candidate_replaying                (irmp_ctx->irmp_candidate_replaying)
+#define irmp_candidate_mask                     (irmp_ctx->irmp_candidate_mask)
+#define irmp_raw_frames                         (irmp_ctx->irmp_raw_frames)
+#define irmp_raw_run                            (irmp_ctx->irmp_raw_run)
+#define irmp_raw_level                          (irmp_ctx->irmp_raw_level)
+#define irmp_raw_recording                      (irmp_ctx->irmp_raw_recording)
+#define irmp_raw_write                          (irmp_ctx->irmp_raw_write)
+#define irmp_raw_ready                          (irmp_ctx->irmp_raw_ready)
+#define irmp_raw_held                           (irmp_ctx->irmp_raw_held)
+#define irmp_hash                               (irmp_ctx->irmp_hash)
+#define irmp_hash_last                          (irmp_ctx->irmp_hash_last)
+#define irmp_hash_prev                          (irmp_ctx->irmp_hash_prev)
+#define irmp_hash_run                           (irmp_ctx->irmp_hash_run)
+#define irmp_hash_gap                           (irmp_ctx->irmp_hash_gap)
+#define irmp_hash_len                           (irmp_ctx->irmp_hash_len)
+#define irmp_hash_level                         (irmp_ctx->irmp_hash_level)
+#define irmp_hash_state                         (irmp_ctx->irmp_hash_state)
+#define irmp_hash_repetition                    (irmp_ctx->irmp_hash_repetition)
+#define irmp_hash_start_ticks                   (irmp_ctx->irmp_hash_start_ticks)
+#define irmp_symbol_lut                         (irmp_ctx->irmp_symbol_lut)
+#define irmp_frame_acc                          (irmp_ctx->irmp_frame_acc)
+#define irmp_frame_acc_len                      (irmp_ctx->irmp_frame_acc_len)
+#define irmp_frame                              (irmp_ctx->irmp_frame)
+
+#else // IRMP_ENABLE_CONTEXT == 0
 
-#if defined(ARDUINO)
-#  if !defined(NO_LED_FEEDBACK_CODE)
-    irmp_DoLEDFeedback(irmp_input);
-#  endif
-#endif
+static uint_fast8_t                             irmp_bit;               // current bit position
+static IRMP_PARAMETER                           irmp_param;
 
-    irmp_log(irmp_input);                                                       // log ir signal, if IRMP_LOGGING defined
+#if IRMP_SUPPORT_RC5_PROTOCOL == 1 && (IRMP_SUPPORT_FDC_PROTOCOL == 1 || IRMP_SUPPORT_RCCAR_PROTOCOL == 1)
+static IRMP_PARAMETER                           irmp_param2;
+#endif
 
+static volatile uint_fast8_t                    irmp_ir_detected = FALSE;
+static volatile uint_fast8_t                    irmp_protocol;
+static volatile uint_fast16_t                   irmp_address;
+#if IRMP_32_BIT == 1
+static uint_fast32_t                            irmp_command;
+#else
+static uint_fast16_t                            irmp_command; // removed volatile, because it is only used in irmp_get_data and therefore volatile makes no sense
+#endif
+static volatile uint_fast16_t                   irmp_id;                // only used for SAMSUNG protocol
+static uint_fast8_t                             irmp_flags; // removed volatile, because it is only used in irmp_get_data and therefore volatile makes no sense
+#if IRMP_FRAME_QUEUE_SIZE > 0
+static IRMP_QUEUE_ENTRY                         irmp_queue[IRMP_FRAME_QUEUE_SIZE];
+static volatile uint8_t                         irmp_queue_head;        // index of next entry to write, changed by irmp_ISR() only
+static volatile uint8_t                         irmp_queue_tail;        // index of next entry to read, changed by irmp_get_data() only
+static volatile uint16_t                        irmp_queue_overflows;   // number of frames lost because the queue was full
+#endif
+#if IRMP_USE_TICK_COUNTER == 1
+static uint32_t                                 irmp_tick_counter;      // number of ticks since start, for timestamps
+#endif
+#if IRMP_ENABLE_DATA_EX == 1
+static uint32_t                                 irmp_start_bit_ticks;   // tick count at begin of current start bit
+static uint32_t                                 irmp_frame_start_ticks; // tick count at begin of detected frame
+static uint32_t                                 irmp_frame_end_ticks;   // tick count at end of detected frame
+static uint32_t                                 irmp_frame_gap_ticks;   // ticks between previous and detected frame
+static uint32_t                                 irmp_last_frame_end_ticks; // tick count at end of previous frame
+static uint_fast8_t                             irmp_last_frame_valid;  // TRUE: irmp_last_frame_end_ticks is valid
+#endif
+#if IRMP_ENABLE_CANDIDATES == 1
+static uint8_t                                  irmp_candidate_buf[IRMP_CANDIDATE_BUFFER_LEN]; // pulse and pause lengths of current frame
+static uint_fast8_t                             irmp_candidate_len;     // number of entries in irmp_candidate_buf
+static uint_fast16_t                            irmp_candidate_run;     // length of current pulse or pause
+static uint_fast8_t                             irmp_candidate_level;   // level of current pulse or pause
+static uint_fast8_t                             irmp_candidate_state;   // IRMP_CANDIDATE_IDLE, IRMP_CANDIDATE_RECORDING or IRMP_CANDIDATE_DECODING
+static uint_fast8_t                             irmp_candidate_replaying; // TRUE: irmp_ISR_input() gets recorded ticks
+static IRMP_START_BIT_MASK                      irmp_candidate_mask;    // start bit candidates not tried yet
+#endif
+#if IRMP_RAW_CAPTURE_LEN > 0
+static IRMP_RAW_FRAME                           irmp_raw_frames[2];     // irmp_ISR() records into irmp_raw_frames[irmp_raw_write]
+static uint_fast16_t                            irmp_raw_run;           // length of current pulse or pause
+static uint_fast8_t                             irmp_raw_level;         // level of current pulse or pause
+static uint_fast8_t                             irmp_raw_recording;     // flag: recording a frame
+static volatile uint8_t                         irmp_raw_write;         // index of buffer being recorded, changed by irmp_ISR() only
+static volatile uint8_t                         irmp_raw_ready;         // flag: other buffer holds a new frame, see irmp_get_raw_frame()
+static volatile uint8_t                         irmp_raw_held;          // flag: application reads other buffer
+#endif
+#if IRMP_ENABLE_HASH_DECODER == 1
+static uint32_t                                 irmp_hash;              // hash of current frame
+static uint32_t                                 irmp_hash_last;         // hash of last frame, for repetition detection
+static uint_fast16_t                            irmp_hash_prev[2];      // length of last pulse [0] and last pause [1]
+static uint_fast16_t                            irmp_hash_run;          // length of current pulse or pause
+static uint_fast16_t                            irmp_hash_gap;          // ticks since end of last frame
+static uint_fast8_t                             irmp_hash_len;          // number of pulses and pauses, max. 255
+static uint_fast8_t                             irmp_hash_level;        // level of current pulse or pause
+static uint_fast8_t                             irmp_hash_state;        // IRMP_HASH_IDLE, IRMP_HASH_RECORDING, IRMP_HASH_COMPLETE or IRMP_HASH_DROPPED
+static uint_fast8_t                             irmp_hash_repetition;   // flag: frame started shortly after the last one
+#if IRMP_ENABLE_DATA_EX == 1
+static uint32_t                                 irmp_hash_start_ticks;  // tick count at begin of current frame
+#endif
+#endif
+#if IRMP_SYMBOL_LUT_LEN > 0
+static uint8_t                                  irmp_symbol_lut[IRMP_SYMBOL_LUT_LEN];   // see irmp_symbol_lut_fill()
+#endif
+#if IRMP_FRAME_BITS > 0
+static uint8_t                                  irmp_frame_acc[IRMP_FRAME_BITS / 8];    // data bits of current frame, see irmp_store_bit()
+static uint_fast8_t                             irmp_frame_acc_len;     // number of data bits of detected frame
+static IRMP_FRAME                               irmp_frame;             // frame last returned by irmp_get_data()
+#endif
+#endif // IRMP_ENABLE_CONTEXT
+// static volatile uint_fast8_t                 irmp_busy_flag;
 #if IRMP_AUTODETECT_REPEATRATE
-    if (delta_detection < 0xFFFF)
-        delta_detection++;
-#if IRMP_ENABLE_RELEASE_DETECTION == 1
-    if (! key_released && delta_detection * (1000000 / F_INTERRUPTS) / 1000 >= upper_border)
-        {
-            irmp_address        = last_irmp_address;
-            irmp_command        = last_irmp_command;
-            irmp_flags          = IRMP_FLAG_RELEASE;
-            irmp_ir_detected    = TRUE;
-            key_released        = TRUE;
-        }
+volatile uint_fast16_t                          delta_detection = 0;    // interval between two detections in ticks
+volatile uint32_t                               pass_on_delta_detection = 0xFFFF;    // interval between two detections in ticks
+volatile uint_fast16_t                          tmp_delta = 0xFFFF;
+volatile uint_fast8_t                           delta = 0;              // interval between two detections in ms
+volatile uint_fast8_t                           min_delta = 170;  // detected repeat rate, preset to greatest known repeat rate
+static volatile uint_fast8_t                    previous_irmp_protocol = 0;
+volatile uint_fast8_t                           same_key = 0;
+volatile uint_fast8_t                           keep_same_key = 0;
+volatile uint_fast8_t                           timeout = 1;
+volatile uint_fast8_t                           upper_border = 176;     // repeatrate plus jitter (threshold for timeout)
 #endif
+
+#if defined(__MBED__)
+// DigitalIn inputPin(IRMP_PIN, PullUp);                                // this requires mbed.h and source to be compiled as cpp
+gpio_t                                          gpioIRin;               // use low level c function instead
 #endif
 
-    if (! irmp_ir_detected)                                                     // ir code already detected?
-    {                                                                           // no...
-        if (! irmp_start_bit_detected)                                          // start bit detected?
-        {                                                                       // no...
-            if (! irmp_input)                                                   // receiving burst?
-            {                                                                   // yes...
-//              irmp_busy_flag = TRUE;
+
 #if defined(ANALYZE)
-                if (! irmp_pulse_time)
-                {
-                    s_startBitSample = s_curSample;
-                    ANALYZE_PRINTF2("%8.3fms [starting pulse]\n", (double) (time_counter * 1000) / F_INTERRUPTS);
-                }
-#endif // ANALYZE
-                irmp_pulse_time++;                                              // increment counter
-            }
-            else
-            {                                                                   // no...
-                if (irmp_pulse_time)                                            // it's dark....
-                {                                                               // set flags for counting the time of darkness...
-                    irmp_start_bit_detected = 1;
-                    wait_for_start_space    = 1;
-                    wait_for_space          = 0;
-                    irmp_tmp_command        = 0;
-                    irmp_tmp_address        = 0;
-#if IRMP_SUPPORT_KASEIKYO_PROTOCOL == 1
-                    genre2                  = 0;
-#endif
-#if IRMP_SUPPORT_SAMSUNG_PROTOCOL == 1
-                    irmp_tmp_id = 0;
+#define input(x)                                (x)
+static uint_fast8_t                             IRMP_PIN;
 #endif
 
-#if IRMP_SUPPORT_RC5_PROTOCOL == 1 && (IRMP_SUPPORT_FDC_PROTOCOL == 1 || IRMP_SUPPORT_RCCAR_PROTOCOL == 1) || IRMP_SUPPORT_NEC42_PROTOCOL == 1
-                    irmp_tmp_command2       = 0;
-                    irmp_tmp_address2       = 0;
-#endif
-#if IRMP_SUPPORT_LGAIR_PROTOCOL == 1
-                    irmp_lgair_command      = 0;
-                    irmp_lgair_address      = 0;
-#endif
-#if IRMP_SUPPORT_MELINERA_PROTOCOL == 1
-                    irmp_melinera_command   = 0;
-#endif
-                    irmp_bit                = 0xff;
-                    irmp_pause_time         = 1;                                // 1st pause: set to 1, not to 0!
-#if IRMP_SUPPORT_RC5_PROTOCOL == 1 || IRMP_SUPPORT_S100_PROTOCOL == 1
-                    rc5_cmd_bit6            = 0;                                // fm 2010-03-07: bugfix: reset it after incomplete RC5 frame!
-#endif
-                }
-                else
-                {
-                    if (key_repetition_len < 0xFFFF)                            // avoid overflow of counter
-                    {
-                        key_repetition_len++;
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ *  Initialize IRMP decoder
+ *  @details  Configures IRMP input pin
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+#if !defined(ANALYZE)
+#if ! defined(ARDUINO)
+void
+irmp_init (void)
+{
+#if defined(PIC_CCS) || defined(PIC_C18)                                // PIC: do nothing
+#elif defined(PIC_XC32)
+#  if defined(IRMP_ANSELBIT)
+    IRMP_ANSELBIT = 0;
+#  endif
+#elif defined (ARM_STM32_HAL)                                           // STM32 with Hal Library: do nothing
+#elif defined (ARM_STM32)                                               // STM32
+    GPIO_InitTypeDef     GPIO_InitStructure;
 
-#if IRMP_ENABLE_RELEASE_DETECTION == 1
-#if !IRMP_AUTODETECT_REPEATRATE
-                        if (! key_released && key_repetition_len > IRMP_KEY_RELEASE_LEN)
-                        {
-                            irmp_address        = last_irmp_address;
-                            irmp_command        = last_irmp_command;
-                            irmp_flags          = IRMP_FLAG_RELEASE;
-                            irmp_ir_detected    = TRUE;
-                            key_released        = TRUE;
-                        }
-#endif
-#endif
+    /* GPIOx clock enable */
+#  if defined (ARM_STM32L1XX)
+    RCC_AHBPeriphClockCmd(IRMP_PORT_RCC, ENABLE);
+#  elif defined (ARM_STM32F10X)
+    RCC_APB2PeriphClockCmd(IRMP_PORT_RCC, ENABLE);
+#  elif defined (ARM_STM32F30X)
+    RCC_AHBPeriphClockCmd(IRMP_PORT_RCC, ENABLE);
+#  elif defined (ARM_STM32F4XX)
+    RCC_AHB1PeriphClockCmd(IRMP_PORT_RCC, ENABLE);
+#  endif
 
-#if IRMP_SUPPORT_DENON_PROTOCOL == 1
-                        if (denon_repetition_len < 0xFFFF)                      // avoid overflow of counter
-                        {
-                            denon_repetition_len++;
+    /* GPIO Configuration */
+    GPIO_InitStructure.GPIO_Pin = IRMP_BIT;
+#  if defined (ARM_STM32L1XX) || defined (ARM_STM32F4XX)
+    GPIO_InitStructure.GPIO_Mode = GPIO_Mode_IN;
+    GPIO_InitStructure.GPIO_Speed = GPIO_Speed_2MHz;
+    GPIO_InitStructure.GPIO_OType = GPIO_OType_PP;
+    GPIO_InitStructure.GPIO_PuPd = GPIO_PuPd_NOPULL;
+#  elif defined (ARM_STM32F10X)
+    GPIO_InitStructure.GPIO_Speed = GPIO_Speed_2MHz;
+    GPIO_InitStructure.GPIO_Mode = GPIO_Mode_IN_FLOATING;
+#  elif defined (ARM_STM32F30X)
+    GPIO_InitStructure.GPIO_Mode = GPIO_Mode_IN;
+    GPIO_InitStructure.GPIO_Speed = GPIO_Speed_2MHz;
+    GPIO_InitStructure.GPIO_PuPd = GPIO_PuPd_NOPULL;
+#  endif
+    GPIO_Init(IRMP_PORT, &GPIO_InitStructure);
 
-                            if (denon_repetition_len >= DENON_AUTO_REPETITION_PAUSE_LEN && last_irmp_denon_command != 0)
-                            {
-                                ANALYZE_PRINTF2 ("%8.3fms warning: did not receive inverted command repetition\n",
-                                                (double) (time_counter * 1000) / F_INTERRUPTS);
-                                last_irmp_denon_command = 0;
-                                denon_repetition_len = 0xFFFF;
-                            }
-                        }
-#endif // IRMP_SUPPORT_DENON_PROTOCOL == 1
-                    }
-                }
-            }
-        }
-        else
-        {
-            if (wait_for_start_space)                                           // we have received start bit...
-            {                                                                   // ...and are counting the time of darkness
-                if (irmp_input)                                                 // still dark?
-                {                                                               // yes
-                    irmp_pause_time++;                                          // increment counter
+#elif defined (ARM_STM32_OPENCM3)                                       // ARM_STM32_OPENCM3
 
-#if IRMP_SUPPORT_NIKON_PROTOCOL == 1
-                    if (((irmp_pulse_time < NIKON_START_BIT_PULSE_LEN_MIN || irmp_pulse_time > NIKON_START_BIT_PULSE_LEN_MAX) && irmp_pause_time > IRMP_TIMEOUT_LEN) ||
-                         irmp_pause_time > IRMP_TIMEOUT_NIKON_LEN)
-#else
-                    if (irmp_pause_time > IRMP_TIMEOUT_LEN)                     // timeout?
-#endif
-                    {                                                           // yes...
-#if IRMP_SUPPORT_JVC_PROTOCOL == 1
-                        if (irmp_protocol == IRMP_JVC_PROTOCOL)                 // don't show eror if JVC protocol, irmp_pulse_time has been set below!
-                        {
-                            ;
-                        }
-                        else
-#endif // IRMP_SUPPORT_JVC_PROTOCOL == 1
-                        {
-                            ANALYZE_PRINTF4 ("%8.3fms error 1: pause after start bit pulse %d too long: %d\n", (double) (time_counter * 1000) / F_INTERRUPTS, irmp_pulse_time, irmp_pause_time);
-                            ANALYZE_ONLY_NORMAL_PUTCHAR ('\n');
-                        }
+    /* GPIOx clock enable */
+#  if defined (STM32L1) || defined (STM32F1) || defined (STM32F3) || defined (STM32F4)
+    rcc_periph_clock_enable(IRMP_PORT_RCC);
+#  endif
 
-                        irmp_start_bit_detected = 0;                            // reset flags, let's wait for another start bit
-                        irmp_pulse_time         = 0;
-                        irmp_pause_time         = 0;
-                    }
-                }
-                else
-                {                                                               // receiving first data pulse!
-                    IRMP_PARAMETER * irmp_param_p;
-                    irmp_param_p = (IRMP_PARAMETER *) 0;
-                    irmp_bit = 0;
+    /* GPIO Configuration */
+#  if defined (STM32L1) || defined (STM32F4) || defined (STM32F3)
+    gpio_mode_setup(IRMP_PORT, GPIO_MODE_INPUT, GPIO_PUPD_NONE, IRMP_BIT);
+    gpio_set_output_options(IRMP_PORT, GPIO_OTYPE_PP, GPIO_OSPEED_2MHZ, IRMP_BIT);
+#  elif defined (STM32F1)
+    gpio_set_mode(IRMP_PORT, GPIO_MODE_INPUT, GPIO_CNF_INPUT_FLOAT, IRMP_BIT);
+#  endif
 
-#if IRMP_SUPPORT_RC5_PROTOCOL == 1 && (IRMP_SUPPORT_FDC_PROTOCOL == 1 || IRMP_SUPPORT_RCCAR_PROTOCOL == 1)
-                    irmp_param2.protocol = 0;
-#endif
+#elif defined(STELLARIS_ARM_CORTEX_M4)
+    // Enable the GPIO port
+    ROM_SysCtlPeripheralEnable(IRMP_PORT_PERIPH);
 
-                    ANALYZE_PRINTF4 ("%8.3fms [start-bit: pulse = %2d, pause = %2d]\n", (double) (time_counter * 1000) / F_INTERRUPTS, irmp_pulse_time, irmp_pause_time);
+    // Set as an input
+    ROM_GPIODirModeSet(IRMP_PORT_BASE, IRMP_PORT_PIN, GPIO_DIR_MODE_IN);
+    ROM_GPIOPadConfigSet(IRMP_PORT_BASE, IRMP_PORT_PIN, GPIO_STRENGTH_2MA, GPIO_PIN_TYPE_STD_WPU);
 
-#if IRMP_SUPPORT_SIRCS_PROTOCOL == 1
-                    if (irmp_pulse_time >= SIRCS_START_BIT_PULSE_LEN_MIN && irmp_pulse_time <= SIRCS_START_BIT_PULSE_LEN_MAX &&
-                        irmp_pause_time >= SIRCS_START_BIT_PAUSE_LEN_MIN && irmp_pause_time <= SIRCS_START_BIT_PAUSE_LEN_MAX)
-                    {                                                           // it's SIRCS
-                        ANALYZE_PRINTF5 ("protocol = SIRCS, start bit timings: pulse: %3d - %3d, pause: %3d - %3d\n",
-                                        SIRCS_START_BIT_PULSE_LEN_MIN, SIRCS_START_BIT_PULSE_LEN_MAX,
-                                        SIRCS_START_BIT_PAUSE_LEN_MIN, SIRCS_START_BIT_PAUSE_LEN_MAX);
-                        irmp_param_p = (IRMP_PARAMETER *) &sircs_param;
-                    }
-                    else
-#endif // IRMP_SUPPORT_SIRCS_PROTOCOL == 1
+#elif defined(__SDCC_stm8)                                              // STM8
+    IRMP_GPIO_STRUCT->DDR &= ~(1<<IRMP_BIT);                            // pin is input
+    IRMP_GPIO_STRUCT->CR1 |= (1<<IRMP_BIT);                             // activate pullup
 
-#if IRMP_SUPPORT_JVC_PROTOCOL == 1
-                    if (irmp_protocol == IRMP_JVC_PROTOCOL &&                                                       // last protocol was JVC, awaiting repeat frame
-                        irmp_pulse_time >= JVC_START_BIT_PULSE_LEN_MIN && irmp_pulse_time <= JVC_START_BIT_PULSE_LEN_MAX &&
-                        irmp_pause_time >= JVC_REPEAT_START_BIT_PAUSE_LEN_MIN && irmp_pause_time <= JVC_REPEAT_START_BIT_PAUSE_LEN_MAX)
-                    {
-                        ANALYZE_PRINTF5 ("protocol = NEC or JVC (type 1) repeat frame, start bit timings: pulse: %3d - %3d, pause: %3d - %3d\n",
-                                        JVC_START_BIT_PULSE_LEN_MIN, JVC_START_BIT_PULSE_LEN_MAX,
-                                        JVC_REPEAT_START_BIT_PAUSE_LEN_MIN, JVC_REPEAT_START_BIT_PAUSE_LEN_MAX);
-                        irmp_param_p = (IRMP_PARAMETER *) &nec_param;
-                    }
-                    else
-#endif // IRMP_SUPPORT_JVC_PROTOCOL == 1
+#elif defined (TEENSY_ARM_CORTEX_M4)                                    // TEENSY
+    pinMode(IRMP_PIN, INPUT);
 
-#if IRMP_SUPPORT_NEC_PROTOCOL == 1
-                    if (irmp_pulse_time >= NEC_START_BIT_PULSE_LEN_MIN && irmp_pulse_time <= NEC_START_BIT_PULSE_LEN_MAX &&
-                        irmp_pause_time >= NEC_START_BIT_PAUSE_LEN_MIN && irmp_pause_time <= NEC_START_BIT_PAUSE_LEN_MAX)
-                    {
-#if IRMP_SUPPORT_NEC42_PROTOCOL == 1
-                        ANALYZE_PRINTF5 ("protocol = NEC42, start bit timings: pulse: %3d - %3d, pause: %3d - %3d\n",
-                                        NEC_START_BIT_PULSE_LEN_MIN, NEC_START_BIT_PULSE_LEN_MAX,
-                                        NEC_START_BIT_PAUSE_LEN_MIN, NEC_START_BIT_PAUSE_LEN_MAX);
-                        irmp_param_p = (IRMP_PARAMETER *) &nec42_param;
-#else
-                        ANALYZE_PRINTF5 ("protocol = NEC, start bit timings: pulse: %3d - %3d, pause: %3d - %3d\n",
-                                        NEC_START_BIT_PULSE_LEN_MIN, NEC_START_BIT_PULSE_LEN_MAX,
-                                        NEC_START_BIT_PAUSE_LEN_MIN, NEC_START_BIT_PAUSE_LEN_MAX);
-                        irmp_param_p = (IRMP_PARAMETER *) &nec_param;
-#endif
-                    }
-                    else if (irmp_pulse_time >= NEC_START_BIT_PULSE_LEN_MIN        && irmp_pulse_time <= NEC_START_BIT_PULSE_LEN_MAX &&
-                             irmp_pause_time >= NEC_REPEAT_START_BIT_PAUSE_LEN_MIN && irmp_pause_time <= NEC_REPEAT_START_BIT_PAUSE_LEN_MAX)
-                    {                                                           // it's NEC
-#if IRMP_SUPPORT_JVC_PROTOCOL == 1
-                        if (irmp_protocol == IRMP_JVC_PROTOCOL)                 // last protocol was JVC, awaiting repeat frame
-                        {                                                       // some jvc remote controls use nec repetition frame for jvc repetition frame
-                            ANALYZE_PRINTF5 ("protocol = JVC repeat frame type 2, start bit timings: pulse: %3d - %3d, pause: %3d - %3d\n",
-                                            NEC_START_BIT_PULSE_LEN_MIN, NEC_START_BIT_PULSE_LEN_MAX,
-                                            NEC_REPEAT_START_BIT_PAUSE_LEN_MIN, NEC_REPEAT_START_BIT_PAUSE_LEN_MAX);
-                            irmp_param_p = (IRMP_PARAMETER *) &nec_param;
-                        }
-                        else
-#endif // IRMP_SUPPORT_JVC_PROTOCOL == 1
-                        {
-                            ANALYZE_PRINTF5 ("protocol = NEC (repetition frame), start bit timings: pulse: %3d - %3d, pause: %3d - %3d\n",
-                                            NEC_START_BIT_PULSE_LEN_MIN, NEC_START_BIT_PULSE_LEN_MAX,
-                                            NEC_REPEAT_START_BIT_PAUSE_LEN_MIN, NEC_REPEAT_START_BIT_PAUSE_LEN_MAX);
-
-                            irmp_param_p = (IRMP_PARAMETER *) &nec_rep_param;
-                        }
-                    }
-                    else
+#elif defined(__xtensa__)                                               // ESP8266
+    pinMode(IRMP_BIT_NUMBER, INPUT);
+                                                                        // select pin function
+#  if (IRMP_BIT_NUMBER == 12)
+    PIN_FUNC_SELECT(PERIPHS_IO_MUX_MTDI_U, FUNC_GPIO12);
+//  doesn't work for me:
+//  # elif (IRMP_BIT_NUMBER == 13)
+//  PIN_FUNC_SELECT(PERIPHS_IO_MUX_MTCK_U , FUNC_GPIO13);
+#  else
+#   warning Please add PIN_FUNC_SELECT when necessary.
+#  endif
+    GPIO_DIS_OUTPUT(IRMP_BIT_NUMBER);
 
-#if IRMP_SUPPORT_JVC_PROTOCOL == 1
-                    if (irmp_protocol == IRMP_JVC_PROTOCOL &&                   // last protocol was JVC, awaiting repeat frame
-                        irmp_pulse_time >= NEC_START_BIT_PULSE_LEN_MIN && irmp_pulse_time <= NEC_START_BIT_PULSE_LEN_MAX &&
-                        irmp_pause_time >= NEC_0_PAUSE_LEN_MIN         && irmp_pause_time <= NEC_0_PAUSE_LEN_MAX)
-                    {                                                           // it's JVC repetition type 3
-                        ANALYZE_PRINTF5 ("protocol = JVC repeat frame type 3, start bit timings: pulse: %3d - %3d, pause: %3d - %3d\n",
-                                        NEC_START_BIT_PULSE_LEN_MIN, NEC_START_BIT_PULSE_LEN_MAX,
-                                        NEC_0_PAUSE_LEN_MIN, NEC_0_PAUSE_LEN_MAX);
-                        irmp_param_p = (IRMP_PARAMETER *) &nec_param;
-                    }
-                    else
-#endif // IRMP_SUPPORT_JVC_PROTOCOL == 1
+#elif defined(__MBED__)
+    gpio_init_in_ex(&gpioIRin, IRMP_PIN, IRMP_PINMODE);                 // initialize input for IR diode
 
-#endif // IRMP_SUPPORT_NEC_PROTOCOL == 1
+#elif defined(_CHIBIOS_HAL_)
+    // ChibiOS HAL automatically initializes all pins according to the board config file, no need to repeat here
 
-#if IRMP_SUPPORT_TELEFUNKEN_PROTOCOL == 1
-                    if (irmp_pulse_time >= TELEFUNKEN_START_BIT_PULSE_LEN_MIN && irmp_pulse_time <= TELEFUNKEN_START_BIT_PULSE_LEN_MAX &&
-                        irmp_pause_time >= TELEFUNKEN_START_BIT_PAUSE_LEN_MIN && irmp_pause_time <= TELEFUNKEN_START_BIT_PAUSE_LEN_MAX)
-                    {
-                        ANALYZE_PRINTF5 ("protocol = TELEFUNKEN, start bit timings: pulse: %3d - %3d, pause: %3d - %3d\n",
-                                        TELEFUNKEN_START_BIT_PULSE_LEN_MIN, TELEFUNKEN_START_BIT_PULSE_LEN_MAX,
-                                        TELEFUNKEN_START_BIT_PAUSE_LEN_MIN, TELEFUNKEN_START_BIT_PAUSE_LEN_MAX);
-                        irmp_param_p = (IRMP_PARAMETER *) &telefunken_param;
-                    }
-                    else
-#endif // IRMP_SUPPORT_TELEFUNKEN_PROTOCOL == 1
+#elif defined(PICO_RP2040)
+    /* GPIO Configuration */
+    gpio_init(IRMP_BIT);
+    gpio_pull_up(IRMP_BIT);
 
-#if IRMP_SUPPORT_ROOMBA_PROTOCOL == 1
-                    if (irmp_pulse_time >= ROOMBA_START_BIT_PULSE_LEN_MIN && irmp_pulse_time <= ROOMBA_START_BIT_PULSE_LEN_MAX &&
-                        irmp_pause_time >= ROOMBA_START_BIT_PAUSE_LEN_MIN && irmp_pause_time <= ROOMBA_START_BIT_PAUSE_LEN_MAX)
-                    {
-                        ANALYZE_PRINTF5 ("protocol = ROOMBA, start bit timings: pulse: %3d - %3d, pause: %3d - %3d\n",
-                                        ROOMBA_START_BIT_PULSE_LEN_MIN, ROOMBA_START_BIT_PULSE_LEN_MAX,
-                                        ROOMBA_START_BIT_PAUSE_LEN_MIN, ROOMBA_START_BIT_PAUSE_LEN_MAX);
-                        irmp_param_p = (IRMP_PARAMETER *) &roomba_param;
-                    }
-                    else
-#endif // IRMP_SUPPORT_ROOMBA_PROTOCOL == 1
+#else                                                                   // AVR
+    IRMP_PORT &= ~(1<<IRMP_BIT);                                        // deactivate pullup
+    IRMP_DDR &= ~(1<<IRMP_BIT);                                         // set pin to input
+#endif
 
-#if IRMP_SUPPORT_ACP24_PROTOCOL == 1
-                    if (irmp_pulse_time >= ACP24_START_BIT_PULSE_LEN_MIN && irmp_pulse_time <= ACP24_START_BIT_PULSE_LEN_MAX &&
-                        irmp_pause_time >= ACP24_START_BIT_PAUSE_LEN_MIN && irmp_pause_time <= ACP24_START_BIT_PAUSE_LEN_MAX)
-                    {
-                        ANALYZE_PRINTF5 ("protocol = ACP24, start bit timings: pulse: %3d - %3d, pause: %3d - %3d\n",
-                                        ACP24_START_BIT_PULSE_LEN_MIN, ACP24_START_BIT_PULSE_LEN_MAX,
-                                        ACP24_START_BIT_PAUSE_LEN_MIN, ACP24_START_BIT_PAUSE_LEN_MAX);
-                        irmp_param_p = (IRMP_PARAMETER *) &acp24_param;
-                    }
-                    else
-#endif // IRMP_SUPPORT_ROOMBA_PROTOCOL == 1
+#if IRMP_LOGGING == 1
+    irmp_uart_init ();
+#endif
+}
+#endif // ! defined(ARDUINO)
+#endif // if !defined(ANALYZE)
 
-#if IRMP_SUPPORT_PENTAX_PROTOCOL == 1
-                    if (irmp_pulse_time >= PENTAX_START_BIT_PULSE_LEN_MIN && irmp_pulse_time <= PENTAX_START_BIT_PULSE_LEN_MAX &&
-                        irmp_pause_time >= PENTAX_START_BIT_PAUSE_LEN_MIN && irmp_pause_time <= PENTAX_START_BIT_PAUSE_LEN_MAX)
-                    {
-                        ANALYZE_PRINTF5 ("protocol = PENTAX, start bit timings: pulse: %3d - %3d, pause: %3d - %3d\n",
-                                        PENTAX_START_BIT_PULSE_LEN_MIN, PENTAX_START_BIT_PULSE_LEN_MAX,
-                                        PENTAX_START_BIT_PAUSE_LEN_MIN, PENTAX_START_BIT_PAUSE_LEN_MAX);
-                        irmp_param_p = (IRMP_PARAMETER *) &pentax_param;
-                    }
-                    else
-#endif // IRMP_SUPPORT_PENTAX_PROTOCOL == 1
+#if IRMP_FRAME_BITS > 0
+#if IRMP_SUPPORT_MELINERA_PROTOCOL == 1 || IRMP_SUPPORT_LGAIR_PROTOCOL == 1 || (IRMP_SUPPORT_ACP24_PROTOCOL == 1 && IRMP_FRAME_BITS >= 128)
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ *  Get bits of frame buffer
+ *  @details  reads bits of the current frame from irmp_frame_acc, 1st bit is MSB of the result
+ *  @param    offset of 1st bit
+ *  @param    number of bits, max. 16
+ *  @return   bits
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+static uint_fast16_t
+irmp_frame_acc_get (uint_fast8_t offset, uint_fast8_t len)
+{
+    uint_fast16_t value = 0;
 
-#if IRMP_SUPPORT_NIKON_PROTOCOL == 1
-                    if (irmp_pulse_time >= NIKON_START_BIT_PULSE_LEN_MIN && irmp_pulse_time <= NIKON_START_BIT_PULSE_LEN_MAX &&
-                        irmp_pause_time >= NIKON_START_BIT_PAUSE_LEN_MIN && irmp_pause_time <= NIKON_START_BIT_PAUSE_LEN_MAX)
-                    {
-                        ANALYZE_PRINTF5 ("protocol = NIKON, start bit timings: pulse: %3d - %3d, pause: %3u - %3u\n",
-                                        NIKON_START_BIT_PULSE_LEN_MIN, NIKON_START_BIT_PULSE_LEN_MAX,
-                                        (unsigned int) NIKON_START_BIT_PAUSE_LEN_MIN, (unsigned int) NIKON_START_BIT_PAUSE_LEN_MAX);
-                        irmp_param_p = (IRMP_PARAMETER *) &nikon_param;
-                    }
-                    else
-#endif // IRMP_SUPPORT_NIKON_PROTOCOL == 1
+    for ( ; len > 0; len--, offset++)
+    {
+        value <<= 1;
 
-#if IRMP_SUPPORT_SAMSUNG_PROTOCOL == 1
-                    if (irmp_pulse_time >= SAMSUNG_START_BIT_PULSE_LEN_MIN && irmp_pulse_time <= SAMSUNG_START_BIT_PULSE_LEN_MAX &&
-                        irmp_pause_time >= SAMSUNG_START_BIT_PAUSE_LEN_MIN && irmp_pause_time <= SAMSUNG_START_BIT_PAUSE_LEN_MAX)
-                    {                                                           // it's SAMSUNG
-                        ANALYZE_PRINTF5 ("protocol = SAMSUNG, start bit timings: pulse: %3d - %3d, pause: %3d - %3d\n",
-                                        SAMSUNG_START_BIT_PULSE_LEN_MIN, SAMSUNG_START_BIT_PULSE_LEN_MAX,
-                                        SAMSUNG_START_BIT_PAUSE_LEN_MIN, SAMSUNG_START_BIT_PAUSE_LEN_MAX);
-                        irmp_param_p = (IRMP_PARAMETER *) &samsung_param;
-                    }
-                    else
-#endif // IRMP_SUPPORT_SAMSUNG_PROTOCOL == 1
+        if (irmp_frame_acc[offset >> 3] & (0x80 >> (offset & 0x07)))
+        {
+            value |= 1;
+        }
+    }
 
-#if IRMP_SUPPORT_SAMSUNGAH_PROTOCOL == 1
-                    if (irmp_pulse_time >= SAMSUNGAH_START_BIT_PULSE_LEN_MIN && irmp_pulse_time <= SAMSUNGAH_START_BIT_PULSE_LEN_MAX &&
-                        irmp_pause_time >= SAMSUNGAH_START_BIT_PAUSE_LEN_MIN && irmp_pause_time <= SAMSUNGAH_START_BIT_PAUSE_LEN_MAX)
-                    {                                                           // it's SAMSUNGAH
-                        ANALYZE_PRINTF5 ("protocol = SAMSUNGAH, start bit timings: pulse: %3d - %3d, pause: %3d - %3d\n",
-                                        SAMSUNGAH_START_BIT_PULSE_LEN_MIN, SAMSUNGAH_START_BIT_PULSE_LEN_MAX,
-                                        SAMSUNGAH_START_BIT_PAUSE_LEN_MIN, SAMSUNGAH_START_BIT_PAUSE_LEN_MAX);
-                        irmp_param_p = (IRMP_PARAMETER *) &samsungah_param;
-                    }
-                    else
-#endif // IRMP_SUPPORT_SAMSUNGAH_PROTOCOL == 1
+    return value;
+}
+#endif // IRMP_SUPPORT_MELINERA_PROTOCOL == 1 || IRMP_SUPPORT_LGAIR_PROTOCOL == 1 || (IRMP_SUPPORT_ACP24_PROTOCOL == 1 && IRMP_FRAME_BITS >= 128)
 
-#if IRMP_SUPPORT_MATSUSHITA_PROTOCOL == 1
-                    if (irmp_pulse_time >= MATSUSHITA_START_BIT_PULSE_LEN_MIN && irmp_pulse_time <= MATSUSHITA_START_BIT_PULSE_LEN_MAX &&
-                        irmp_pause_time >= MATSUSHITA_START_BIT_PAUSE_LEN_MIN && irmp_pause_time <= MATSUSHITA_START_BIT_PAUSE_LEN_MAX)
-                    {                                                           // it's MATSUSHITA
-                        ANALYZE_PRINTF5 ("protocol = MATSUSHITA, start bit timings: pulse: %3d - %3d, pause: %3d - %3d\n",
-                                        MATSUSHITA_START_BIT_PULSE_LEN_MIN, MATSUSHITA_START_BIT_PULSE_LEN_MAX,
-                                        MATSUSHITA_START_BIT_PAUSE_LEN_MIN, MATSUSHITA_START_BIT_PAUSE_LEN_MAX);
-                        irmp_param_p = (IRMP_PARAMETER *) &matsushita_param;
-                    }
-                    else
-#endif // IRMP_SUPPORT_MATSUSHITA_PROTOCOL == 1
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ *  Store frame buffer
+ *  @details  copies the data bits of the detected frame, see irmp_get_frame()
+ *  @param    pointer to frame
+ *  @param    protocol as returned by irmp_get_data()
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+static void
+irmp_frame_store (IRMP_FRAME * frame_p, uint_fast8_t protocol)
+{
+    frame_p->protocol = protocol;
+    frame_p->len      = irmp_frame_acc_len;
+    memcpy (frame_p->bits, irmp_frame_acc, IRMP_FRAME_BITS / 8);
+}
 
-#if IRMP_SUPPORT_KASEIKYO_PROTOCOL == 1
-                    if (irmp_pulse_time >= KASEIKYO_START_BIT_PULSE_LEN_MIN && irmp_pulse_time <= KASEIKYO_START_BIT_PULSE_LEN_MAX &&
-                        irmp_pause_time >= KASEIKYO_START_BIT_PAUSE_LEN_MIN && irmp_pause_time <= KASEIKYO_START_BIT_PAUSE_LEN_MAX)
-                    {                                                           // it's KASEIKYO
-                        ANALYZE_PRINTF5 ("protocol = KASEIKYO, start bit timings: pulse: %3d - %3d, pause: %3d - %3d\n",
-                                        KASEIKYO_START_BIT_PULSE_LEN_MIN, KASEIKYO_START_BIT_PULSE_LEN_MAX,
-                                        KASEIKYO_START_BIT_PAUSE_LEN_MIN, KASEIKYO_START_BIT_PAUSE_LEN_MAX);
-                        irmp_param_p = (IRMP_PARAMETER *) &kaseikyo_param;
-                    }
-                    else
-#endif // IRMP_SUPPORT_KASEIKYO_PROTOCOL == 1
+#if IRMP_SUPPORT_ACP24_PROTOCOL == 1 && IRMP_FRAME_BITS >= 128
+// ACP24-Frame:
+//           1         2         3         4         5         6
+// 0123456789012345678901234567890123456789012345678901234567890123456789
+// N VVMMM    ? ???    t vmA x                 y                     TTTT
+//
+// irmp_data_p->command:
+//
+//         5432109876543210
+//         NAVVvMMMmtxyTTTT
+static IRMP_CONSTEXPR PROGMEM uint8_t irmp_acp24_bits[16] =             // frame bit of command bit 15 ... 0
+{
+    0, 24, 2, 3, 22, 4, 5, 6, 23, 20, 26, 44, 66, 67, 68, 69
+};
 
-#if IRMP_SUPPORT_PANASONIC_PROTOCOL == 1
-                    if (irmp_pulse_time >= PANASONIC_START_BIT_PULSE_LEN_MIN && irmp_pulse_time <= PANASONIC_START_BIT_PULSE_LEN_MAX &&
-                        irmp_pause_time >= PANASONIC_START_BIT_PAUSE_LEN_MIN && irmp_pause_time <= PANASONIC_START_BIT_PAUSE_LEN_MAX)
-                    {                                                           // it's PANASONIC
-                        ANALYZE_PRINTF5 ("protocol = PANASONIC, start bit timings: pulse: %3d - %3d, pause: %3d - %3d\n",
-                                        PANASONIC_START_BIT_PULSE_LEN_MIN, PANASONIC_START_BIT_PULSE_LEN_MAX,
-                                        PANASONIC_START_BIT_PAUSE_LEN_MIN, PANASONIC_START_BIT_PAUSE_LEN_MAX);
-                        irmp_param_p = (IRMP_PARAMETER *) &panasonic_param;
-                    }
-                    else
-#endif // IRMP_SUPPORT_PANASONIC_PROTOCOL == 1
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ *  Get ACP24 command
+ *  @details  squeezes the 70 bits of an ACP24 frame in the frame buffer into 16 bits
+ *  @return   command
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+static uint_fast16_t
+irmp_acp24_get_command (void)
+{
+    uint8_t         bits[16];
+    uint_fast16_t   command = 0;
+    uint_fast8_t    idx;
 
-#if IRMP_SUPPORT_MITSU_HEAVY_PROTOCOL == 1
-                    if (irmp_pulse_time >= MITSU_HEAVY_START_BIT_PULSE_LEN_MIN && irmp_pulse_time <= MITSU_HEAVY_START_BIT_PULSE_LEN_MAX &&
-                        irmp_pause_time >= MITSU_HEAVY_START_BIT_PAUSE_LEN_MIN && irmp_pause_time <= MITSU_HEAVY_START_BIT_PAUSE_LEN_MAX)
-                    {                                                           // it's MITSU_HEAVY
-                        ANALYZE_PRINTF5 ("protocol = MITSU_HEAVY, start bit timings: pulse: %3d - %3d, pause: %3d - %3d\n",
-                                        MITSU_HEAVY_START_BIT_PULSE_LEN_MIN, MITSU_HEAVY_START_BIT_PULSE_LEN_MAX,
-                                        MITSU_HEAVY_START_BIT_PAUSE_LEN_MIN, MITSU_HEAVY_START_BIT_PAUSE_LEN_MAX);
-                        irmp_param_p = (IRMP_PARAMETER *) &mitsu_heavy_param;
-                    }
-                    else
-#endif // IRMP_SUPPORT_MITSU_HEAVY_PROTOCOL == 1
+    memcpy_P (bits, irmp_acp24_bits, sizeof (bits));
 
-#if IRMP_SUPPORT_VINCENT_PROTOCOL == 1
-                    if (irmp_pulse_time >= VINCENT_START_BIT_PULSE_LEN_MIN && irmp_pulse_time <= VINCENT_START_BIT_PULSE_LEN_MAX &&
-                        irmp_pause_time >= VINCENT_START_BIT_PAUSE_LEN_MIN && irmp_pause_time <= VINCENT_START_BIT_PAUSE_LEN_MAX)
-                    {                                                           // it's VINCENT
-                        ANALYZE_PRINTF5 ("protocol = VINCENT, start bit timings: pulse: %3d - %3d, pause: %3d - %3d\n",
-                                        VINCENT_START_BIT_PULSE_LEN_MIN, VINCENT_START_BIT_PULSE_LEN_MAX,
-                                        VINCENT_START_BIT_PAUSE_LEN_MIN, VINCENT_START_BIT_PAUSE_LEN_MAX);
-                        irmp_param_p = (IRMP_PARAMETER *) &vincent_param;
-                    }
-                    else
-#endif // IRMP_SUPPORT_VINCENT_PROTOCOL == 1
+    for (idx = 0; idx < 16; idx++)
+    {
+        command = (command << 1) | irmp_frame_acc_get (bits[idx], 1);
+    }
 
-#if IRMP_SUPPORT_METZ_PROTOCOL == 1
-                    if (irmp_pulse_time >= METZ_START_BIT_PULSE_LEN_MIN && irmp_pulse_time <= METZ_START_BIT_PULSE_LEN_MAX &&
-                        irmp_pause_time >= METZ_START_BIT_PAUSE_LEN_MIN && irmp_pause_time <= METZ_START_BIT_PAUSE_LEN_MAX)
-                    {
-                        ANALYZE_PRINTF5 ("protocol = METZ, start bit timings: pulse: %3d - %3d, pause: %3d - %3d\n",
-                                        METZ_START_BIT_PULSE_LEN_MIN, METZ_START_BIT_PULSE_LEN_MAX,
-                                        METZ_START_BIT_PAUSE_LEN_MIN, METZ_START_BIT_PAUSE_LEN_MAX);
-                        irmp_param_p = (IRMP_PARAMETER *) &metz_param;
-                    }
-                    else
-#endif // IRMP_SUPPORT_METZ_PROTOCOL == 1
+    return command;
+}
+#endif // IRMP_SUPPORT_ACP24_PROTOCOL == 1 && IRMP_FRAME_BITS >= 128
+#endif // IRMP_FRAME_BITS > 0
 
-#if IRMP_SUPPORT_RF_GEN24_PROTOCOL == 1                                         // RF_GEN24 has no start bit
-                    if (irmp_pulse_time >= RF_GEN24_0_PULSE_LEN_MIN && irmp_pulse_time <= RF_GEN24_0_PULSE_LEN_MAX &&
-                        irmp_pause_time >= RF_GEN24_0_PAUSE_LEN_MIN && irmp_pause_time <= RF_GEN24_0_PAUSE_LEN_MAX)
-                    {
-                        ANALYZE_PRINTF1 ("protocol = RF_GEN24\n");
-                        irmp_param_p = (IRMP_PARAMETER *) &rf_gen24_param;
-                        bit_0 = 0;
-                    }
-                    else
-                    if (irmp_pulse_time >= RF_GEN24_1_PULSE_LEN_MIN && irmp_pulse_time <= RF_GEN24_1_PULSE_LEN_MAX &&
-                        irmp_pause_time >= RF_GEN24_1_PAUSE_LEN_MIN && irmp_pause_time <= RF_GEN24_1_PAUSE_LEN_MAX)
-                    {
-                        ANALYZE_PRINTF1 ("protocol = RF_GEN24\n");
-                        irmp_param_p = (IRMP_PARAMETER *) &rf_gen24_param;
-                        bit_0 = 1;
-                    }
-                    else
-#endif // IRMP_SUPPORT_RF_GEN24_PROTOCOL == 1
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ *  Get IRMP data
+ *  @details  gets decoded IRMP data
+ *  @param    pointer in order to store IRMP data
+ *  @return    TRUE: successful, FALSE: failed
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+#if IRMP_FRAME_QUEUE_SIZE > 0
+static uint_fast8_t
+irmp_convert_data (IRMP_DATA * irmp_data_p)                             // called by irmp_ISR() at end of frame, see irmp_queue_put()
+#elif IRMP_ENABLE_CONTEXT == 1
+static uint_fast8_t
+irmp_get_data_current (IRMP_DATA * irmp_data_p)                         // works on irmp_ctx, see irmp_get_data_ctx()
+#else
+#  ifdef __cplusplus
+bool
+#else
+uint_fast8_t
+#endif
+irmp_get_data (IRMP_DATA * irmp_data_p)
+#endif
+{
+    uint_fast8_t   tReturnCode = FALSE;
 
-#if IRMP_SUPPORT_RF_X10_PROTOCOL == 1
-                    if (irmp_pulse_time >= RF_X10_START_BIT_PULSE_LEN_MIN && irmp_pulse_time <= RF_X10_START_BIT_PULSE_LEN_MAX &&
-                        irmp_pause_time >= RF_X10_START_BIT_PAUSE_LEN_MIN && irmp_pause_time <= RF_X10_START_BIT_PAUSE_LEN_MAX)
-                    {
-                        ANALYZE_PRINTF5 ("protocol = RF_X10, start bit timings: pulse: %3d - %3d, pause: %3d - %3d\n",
-                                        RF_X10_START_BIT_PULSE_LEN_MIN, RF_X10_START_BIT_PULSE_LEN_MAX,
-                                        RF_X10_START_BIT_PAUSE_LEN_MIN, RF_X10_START_BIT_PAUSE_LEN_MAX);
-                        irmp_param_p = (IRMP_PARAMETER *) &rf_x10_param;
-                    }
-                    else
-#endif // IRMP_SUPPORT_RF_X10_PROTOCOL == 1
+    if (irmp_ir_detected)
+    {
+        switch (irmp_protocol)
+        {
+#if IRMP_SUPPORT_SAMSUNG_PROTOCOL == 1
+            case IRMP_SAMSUNG_PROTOCOL:
+                if ((irmp_command >> 8) == (~irmp_command & 0x00FF))
+                {
+                    irmp_command &= 0xff;
+//                    irmp_command |= irmp_id << 8; // for samsung32 irmp_id looks to be the same as irmp_command
+                    tReturnCode = TRUE;
+                }
+                break;
 
-#if IRMP_SUPPORT_RF_MEDION_PROTOCOL == 1
-                    if (irmp_pulse_time >= RF_MEDION_START_BIT_PULSE_LEN_MIN && irmp_pulse_time <= RF_MEDION_START_BIT_PULSE_LEN_MAX &&
-                        irmp_pause_time >= RF_MEDION_START_BIT_PAUSE_LEN_MIN && irmp_pause_time <= RF_MEDION_START_BIT_PAUSE_LEN_MAX)
-                    {
-                        ANALYZE_PRINTF5 ("protocol = RF_MEDION, start bit timings: pulse: %3d - %3d, pause: %3d - %3d\n",
-                                        RF_MEDION_START_BIT_PULSE_LEN_MIN, RF_MEDION_START_BIT_PULSE_LEN_MAX,
-                                        RF_MEDION_START_BIT_PAUSE_LEN_MIN, RF_MEDION_START_BIT_PAUSE_LEN_MAX);
-                        irmp_param_p = (IRMP_PARAMETER *) &rf_medion_param;
-                    }
-                    else
-#endif // IRMP_SUPPORT_RF_MEDION_PROTOCOL == 1
+#  if IRMP_SUPPORT_SAMSUNG48_PROTOCOL == 1
+            case IRMP_SAMSUNG48_PROTOCOL:
+                irmp_command = (irmp_command & 0x00FF) | ((irmp_id & 0x00FF) << 8);
+                tReturnCode = TRUE;
+                break;
+#  endif
+#endif
 
-#if IRMP_SUPPORT_RECS80_PROTOCOL == 1
-                    if (irmp_pulse_time >= RECS80_START_BIT_PULSE_LEN_MIN && irmp_pulse_time <= RECS80_START_BIT_PULSE_LEN_MAX &&
-                        irmp_pause_time >= RECS80_START_BIT_PAUSE_LEN_MIN && irmp_pause_time <= RECS80_START_BIT_PAUSE_LEN_MAX)
-                    {                                                           // it's RECS80
-                        ANALYZE_PRINTF5 ("protocol = RECS80, start bit timings: pulse: %3d - %3d, pause: %3d - %3d\n",
-                                        RECS80_START_BIT_PULSE_LEN_MIN, RECS80_START_BIT_PULSE_LEN_MAX,
-                                        RECS80_START_BIT_PAUSE_LEN_MIN, RECS80_START_BIT_PAUSE_LEN_MAX);
-                        irmp_param_p = (IRMP_PARAMETER *) &recs80_param;
-                    }
-                    else
-#endif // IRMP_SUPPORT_RECS80_PROTOCOL == 1
+#if IRMP_SUPPORT_SIRCS_PROTOCOL == 1
+            case IRMP_SIRCS_PROTOCOL:
+                // Concatenate high byte of command and low byte of address
+                irmp_address <<= 7;
+                irmp_address = irmp_address | irmp_command >> 8;
+                // Command is 7 bytes, so add the 8.th bit of command to address
+                irmp_address <<= 1;
+                if ((irmp_command & 0x80))
+                {
+                    irmp_address++;
+                }
+                irmp_command &= 0x7F;
+                tReturnCode = TRUE;
+                break;
+#endif
 
-#if IRMP_SUPPORT_S100_PROTOCOL == 1
-                    if (((irmp_pulse_time >= S100_START_BIT_LEN_MIN     && irmp_pulse_time <= S100_START_BIT_LEN_MAX) ||
-                         (irmp_pulse_time >= 2 * S100_START_BIT_LEN_MIN && irmp_pulse_time <= 2 * S100_START_BIT_LEN_MAX)) &&
-                        ((irmp_pause_time >= S100_START_BIT_LEN_MIN     && irmp_pause_time <= S100_START_BIT_LEN_MAX) ||
-                         (irmp_pause_time >= 2 * S100_START_BIT_LEN_MIN && irmp_pause_time <= 2 * S100_START_BIT_LEN_MAX)))
-                    {                                                           // it's S100
-                        ANALYZE_PRINTF9 ("protocol = S100, start bit timings: pulse: %3d - %3d, pause: %3d - %3d or pulse: %3d - %3d, pause: %3d - %3d\n",
-                                        S100_START_BIT_LEN_MIN, S100_START_BIT_LEN_MAX,
-                                        2 * S100_START_BIT_LEN_MIN, 2 * S100_START_BIT_LEN_MAX,
-                                        S100_START_BIT_LEN_MIN, S100_START_BIT_LEN_MAX,
-                                        2 * S100_START_BIT_LEN_MIN, 2 * S100_START_BIT_LEN_MAX);
-
-                        irmp_param_p = (IRMP_PARAMETER *) &s100_param;
-                        last_pause = irmp_pause_time;
-
-                        if ((irmp_pulse_time > S100_START_BIT_LEN_MAX && irmp_pulse_time <= 2 * S100_START_BIT_LEN_MAX) ||
-                            (irmp_pause_time > S100_START_BIT_LEN_MAX && irmp_pause_time <= 2 * S100_START_BIT_LEN_MAX))
-                        {
-                          last_value  = 0;
-                          rc5_cmd_bit6 = 1<<6;
-                        }
-                        else
-                        {
-                          last_value  = 1;
-                        }
+#if IRMP_SUPPORT_NEC_PROTOCOL == 1
+            case IRMP_NEC_PROTOCOL:
+                if ((irmp_command >> 8) == (~irmp_command & 0x00FF))
+                {
+                    if ((irmp_address >> 8) == (~irmp_address & 0x00FF))
+                    {
+                        irmp_address &= 0xff;
                     }
-                    else
-#endif // IRMP_SUPPORT_S100_PROTOCOL == 1
+                    irmp_command &= 0xff;
+                }
+                else if (irmp_address == 0x87EE)
+                {
+                    ANALYZE_PRINTF1 ("APPLE protocol detected\n");
+                    irmp_protocol = IRMP_APPLE_PROTOCOL;
+                    irmp_address = (irmp_command & 0xFF00) >> 8; // address was received in command!
+                    irmp_command &= 0x00FF;
+                }
+                else
+                {
+                    ANALYZE_PRINTF1 ("ONKYO protocol detected\n");
+                    irmp_protocol = IRMP_ONKYO_PROTOCOL;
+                }
+                tReturnCode = TRUE;
+                break;
+#endif
 
-#if IRMP_SUPPORT_RC5_PROTOCOL == 1
-                    if (((irmp_pulse_time >= RC5_START_BIT_LEN_MIN     && irmp_pulse_time <= RC5_START_BIT_LEN_MAX) ||
-                         (irmp_pulse_time >= 2 * RC5_START_BIT_LEN_MIN && irmp_pulse_time <= 2 * RC5_START_BIT_LEN_MAX)) &&
-                        ((irmp_pause_time >= RC5_START_BIT_LEN_MIN     && irmp_pause_time <= RC5_START_BIT_LEN_MAX) ||
-                         (irmp_pause_time >= 2 * RC5_START_BIT_LEN_MIN && irmp_pause_time <= 2 * RC5_START_BIT_LEN_MAX)))
-                    {                                                           // it's RC5
-#if IRMP_SUPPORT_FDC_PROTOCOL == 1
-                        if (irmp_pulse_time >= FDC_START_BIT_PULSE_LEN_MIN && irmp_pulse_time <= FDC_START_BIT_PULSE_LEN_MAX &&
-                            irmp_pause_time >= FDC_START_BIT_PAUSE_LEN_MIN && irmp_pause_time <= FDC_START_BIT_PAUSE_LEN_MAX)
-                        {
-                            ANALYZE_PRINTF1 ("protocol = RC5 or FDC\n");
-                            ANALYZE_PRINTF5 ("FDC start bit timings: pulse: %3d - %3d, pause: %3d - %3d\n",
-                                            FDC_START_BIT_PULSE_LEN_MIN, FDC_START_BIT_PULSE_LEN_MAX,
-                                            FDC_START_BIT_PAUSE_LEN_MIN, FDC_START_BIT_PAUSE_LEN_MAX);
-                            ANALYZE_PRINTF5 ("RC5 start bit timings: pulse: %3d - %3d, pause: %3d - %3d\n",
-                                            RC5_START_BIT_LEN_MIN, RC5_START_BIT_LEN_MAX,
-                                            RC5_START_BIT_LEN_MIN, RC5_START_BIT_LEN_MAX);
-                            memcpy_P (&irmp_param2, &fdc_param, sizeof (IRMP_PARAMETER));
-                        }
-                        else
-#endif // IRMP_SUPPORT_FDC_PROTOCOL == 1
+#if IRMP_SUPPORT_VINCENT_PROTOCOL == 1
+            case IRMP_VINCENT_PROTOCOL:
+                if ((irmp_command >> 8) == (irmp_command & 0x00FF))
+                {
+                    irmp_command &= 0xff;
+                    tReturnCode = TRUE;
+                }
+                break;
+#endif
 
-#if IRMP_SUPPORT_RCCAR_PROTOCOL == 1
-                        if (irmp_pulse_time >= RCCAR_START_BIT_PULSE_LEN_MIN && irmp_pulse_time <= RCCAR_START_BIT_PULSE_LEN_MAX &&
-                            irmp_pause_time >= RCCAR_START_BIT_PAUSE_LEN_MIN && irmp_pause_time <= RCCAR_START_BIT_PAUSE_LEN_MAX)
-                        {
-                            ANALYZE_PRINTF1 ("protocol = RC5 or RCCAR\n");
-                            ANALYZE_PRINTF5 ("RCCAR start bit timings: pulse: %3d - %3d, pause: %3d - %3d\n",
-                                            RCCAR_START_BIT_PULSE_LEN_MIN, RCCAR_START_BIT_PULSE_LEN_MAX,
-                                            RCCAR_START_BIT_PAUSE_LEN_MIN, RCCAR_START_BIT_PAUSE_LEN_MAX);
-                            ANALYZE_PRINTF5 ("RC5 start bit timings: pulse: %3d - %3d, pause: %3d - %3d\n",
-                                            RC5_START_BIT_LEN_MIN, RC5_START_BIT_LEN_MAX,
-                                            RC5_START_BIT_LEN_MIN, RC5_START_BIT_LEN_MAX);
-                            memcpy_P (&irmp_param2, &rccar_param, sizeof (IRMP_PARAMETER));
-                        }
-                        else
-#endif // IRMP_SUPPORT_RCCAR_PROTOCOL == 1
-                        {
-                            ANALYZE_PRINTF9 ("protocol = RC5, start bit timings: pulse: %3d - %3d, pause: %3d - %3d or pulse: %3d - %3d, pause: %3d - %3d\n",
-                                            RC5_START_BIT_LEN_MIN, RC5_START_BIT_LEN_MAX,
-                                            2 * RC5_START_BIT_LEN_MIN, 2 * RC5_START_BIT_LEN_MAX,
-                                            RC5_START_BIT_LEN_MIN, RC5_START_BIT_LEN_MAX,
-                                            2 * RC5_START_BIT_LEN_MIN, 2 * RC5_START_BIT_LEN_MAX);
-                        }
+#if IRMP_SUPPORT_KASEIKYO_PROTOCOL == 1
+            case IRMP_KASEIKYO_PROTOCOL:
+                /*
+                 * Todo AJ 14.7.22 The bit before the command (not existent bit 16 of command) is skipped and I have a Panasonic remote where it is 1 for 2 buttons
+                 * and the 4 LSB command bits are always zero for this remote
+                 */
+                if( irmp_address == 0x2002) // PANASONIC_VENDOR_ID_CODE
+                {
+                    ANALYZE_PRINTF1 ("Kaseikyo_Panasonic protocol detected\n");
+                    irmp_protocol = IRMP_PANASONIC_PROTOCOL;
+                    irmp_command = irmp_command >> 4; // remove the 4 zero bits
+                    irmp_address = (irmp_command & 0xF00) >> 8; // LSB address (genre1) was received in command!
+                    irmp_address |= irmp_flags & 0xF0; // MSB of address(genre2 bits) are located in MSB of the flag byte
+                    irmp_command &= 0x00FF;
+                }
+                tReturnCode = TRUE;
+                break;
+#endif
 
-                        irmp_param_p = (IRMP_PARAMETER *) &rc5_param;
-                        last_pause = irmp_pause_time;
+#if IRMP_SUPPORT_BOSE_PROTOCOL == 1
+            case IRMP_BOSE_PROTOCOL:
+                if ((irmp_command >> 8) == (~irmp_command & 0x00FF))
+                {
+                    irmp_command &= 0xff;
+                    tReturnCode = TRUE;
+                }
+                break;
+#endif
 
-                        if ((irmp_pulse_time > RC5_START_BIT_LEN_MAX && irmp_pulse_time <= 2 * RC5_START_BIT_LEN_MAX) ||
-                            (irmp_pause_time > RC5_START_BIT_LEN_MAX && irmp_pause_time <= 2 * RC5_START_BIT_LEN_MAX))
-                        {
-                            last_value  = 0;
-                            rc5_cmd_bit6 = 1<<6;
-                        }
-                        else
-                        {
-                            last_value  = 1;
-                        }
+#if IRMP_SUPPORT_MERLIN_PROTOCOL == 1
+            case IRMP_MERLIN_PROTOCOL:
+                if (irmp_bit == 10)
+                {
+                    tReturnCode = TRUE;
+                }
+                else if (irmp_bit >= 19 && ((irmp_bit - 3) % 8 == 0))
+                {
+                    if (((irmp_command >> 1) & 1) != (irmp_command & 1))
+                    {
+                        irmp_command >>= 1;
+                        irmp_command |= ((irmp_address & 1) << (irmp_bit - 12));
+                        irmp_address >>= 1;
+                        tReturnCode = TRUE;
                     }
-                    else
-#endif // IRMP_SUPPORT_RC5_PROTOCOL == 1
+                }
+                break;
+#endif
 
-#if IRMP_SUPPORT_RCII_PROTOCOL == 1
-                    if ((irmp_pulse_time >= RCII_START_BIT_PULSE_LEN_MIN && irmp_pulse_time <= RCII_START_BIT_PULSE_LEN_MAX) &&
-                        (irmp_pause_time >= RCII_START_BIT_PAUSE_LEN_MIN && irmp_pause_time <= RCII_START_BIT_PAUSE_LEN_MAX))
-                    {                                                           // it's RCII
-                        ANALYZE_PRINTF5 ("protocol = RCII, start bit timings: pulse: %3d - %3d, pause: %3d - %3d\n",
-                                        RCII_START_BIT_PULSE_LEN_MIN, RCII_START_BIT_PULSE_LEN_MAX,
-                                        RCII_START_BIT_PAUSE_LEN_MIN, RCII_START_BIT_PAUSE_LEN_MAX)
-                        irmp_param_p = (IRMP_PARAMETER *) &rcii_param;
-                        last_pause = irmp_pause_time;
-                        waiting_for_2nd_pulse = 1;
-                        last_value  = 1;
-                    }
-                    else
-#endif // IRMP_SUPPORT_RCII_PROTOCOL == 1
+#if IRMP_SUPPORT_SIEMENS_OR_RUWIDO_PROTOCOL == 1
+            case IRMP_SIEMENS_PROTOCOL:
+            case IRMP_RUWIDO_PROTOCOL:
+                if (((irmp_command >> 1) & 0x0001) == (~irmp_command & 0x0001))
+                {
+                    irmp_command >>= 1;
+                    tReturnCode = TRUE;
+                }
+                break;
+#endif
+#if IRMP_SUPPORT_KATHREIN_PROTOCOL == 1
+            case IRMP_KATHREIN_PROTOCOL:
+                if (irmp_command != 0x0000)
+                {
+                    tReturnCode = TRUE;
+                }
+                break;
+#endif
+#if IRMP_SUPPORT_RC5_PROTOCOL == 1
+            case IRMP_RC5_PROTOCOL:
+                irmp_address &= ~0x20;                              // clear toggle bit
+                tReturnCode = TRUE;
+                break;
+#endif
+#if IRMP_SUPPORT_S100_PROTOCOL == 1
+            case IRMP_S100_PROTOCOL:
+                irmp_address &= ~0x20;                              // clear toggle bit
+                tReturnCode = TRUE;
+                break;
+#endif
+#if IRMP_SUPPORT_IR60_PROTOCOL == 1
+            case IRMP_IR60_PROTOCOL:
+                if (irmp_command != 0x007d)                         // 0x007d (== 62<<1 + 1) is start instruction frame
+                {
+                    tReturnCode = TRUE;
+                }
+                else
+                {
+                    ANALYZE_PRINTF1("Info IR60: got start instruction frame\n");
+                }
+                break;
+#endif
+#if IRMP_SUPPORT_RCCAR_PROTOCOL == 1
+            case IRMP_RCCAR_PROTOCOL:
+                // frame in irmp_data:
+                // Bit 12 11 10 9  8  7  6  5  4  3  2  1  0
+                //     V  D7 D6 D5 D4 D3 D2 D1 D0 A1 A0 C1 C0   //         10 9  8  7  6  5  4  3  2  1  0
+                irmp_address = (irmp_command & 0x000C) >> 2;    // addr:   0  0  0  0  0  0  0  0  0  A1 A0
+                irmp_command = ((irmp_command & 0x1000) >> 2) | // V-Bit:  V  0  0  0  0  0  0  0  0  0  0
+                               ((irmp_command & 0x0003) << 8) | // C-Bits: 0  C1 C0 0  0  0  0  0  0  0  0
+                               ((irmp_command & 0x0FF0) >> 4);  // D-Bits:          D7 D6 D5 D4 D3 D2 D1 D0
+                tReturnCode = TRUE;                                     // Summe:  V  C1 C0 D7 D6 D5 D4 D3 D2 D1 D0
+                break;
+#endif
 
-#if IRMP_SUPPORT_DENON_PROTOCOL == 1
-                    if ( (irmp_pulse_time >= DENON_PULSE_LEN_MIN && irmp_pulse_time <= DENON_PULSE_LEN_MAX) &&
-                        ((irmp_pause_time >= DENON_1_PAUSE_LEN_MIN && irmp_pause_time <= DENON_1_PAUSE_LEN_MAX) ||
-                         (irmp_pause_time >= DENON_0_PAUSE_LEN_MIN && irmp_pause_time <= DENON_0_PAUSE_LEN_MAX)))
-                    {                                                           // it's DENON
-                        ANALYZE_PRINTF7 ("protocol = DENON, start bit timings: pulse: %3d - %3d, pause: %3d - %3d or %3d - %3d\n",
-                                        DENON_PULSE_LEN_MIN, DENON_PULSE_LEN_MAX,
-                                        DENON_1_PAUSE_LEN_MIN, DENON_1_PAUSE_LEN_MAX,
-                                        DENON_0_PAUSE_LEN_MIN, DENON_0_PAUSE_LEN_MAX);
-                        irmp_param_p = (IRMP_PARAMETER *) &denon_param;
+#if IRMP_SUPPORT_NETBOX_PROTOCOL == 1                           // squeeze code to 8 bit, upper bit indicates release-key
+            case IRMP_NETBOX_PROTOCOL:
+                if (irmp_command & 0x1000)                      // last bit set?
+                {
+                    if ((irmp_command & 0x1f) == 0x15)          // key pressed: 101 01 (LSB)
+                    {
+                        irmp_command >>= 5;
+                        irmp_command &= 0x7F;
+                        tReturnCode = TRUE;
                     }
-                    else
-#endif // IRMP_SUPPORT_DENON_PROTOCOL == 1
-
-#if IRMP_SUPPORT_THOMSON_PROTOCOL == 1
-                    if ( (irmp_pulse_time >= THOMSON_PULSE_LEN_MIN && irmp_pulse_time <= THOMSON_PULSE_LEN_MAX) &&
-                        ((irmp_pause_time >= THOMSON_1_PAUSE_LEN_MIN && irmp_pause_time <= THOMSON_1_PAUSE_LEN_MAX) ||
-                         (irmp_pause_time >= THOMSON_0_PAUSE_LEN_MIN && irmp_pause_time <= THOMSON_0_PAUSE_LEN_MAX)))
-                    {                                                           // it's THOMSON
-                        ANALYZE_PRINTF7 ("protocol = THOMSON, start bit timings: pulse: %3d - %3d, pause: %3d - %3d or %3d - %3d\n",
-                                        THOMSON_PULSE_LEN_MIN, THOMSON_PULSE_LEN_MAX,
-                                        THOMSON_1_PAUSE_LEN_MIN, THOMSON_1_PAUSE_LEN_MAX,
-                                        THOMSON_0_PAUSE_LEN_MIN, THOMSON_0_PAUSE_LEN_MAX);
-                        irmp_param_p = (IRMP_PARAMETER *) &thomson_param;
+                    else if ((irmp_command & 0x1f) == 0x10)     // key released: 000 01 (LSB)
+                    {
+                        irmp_command >>= 5;
+                        irmp_command |= 0x80;
+                        tReturnCode = TRUE;
                     }
                     else
-#endif // IRMP_SUPPORT_THOMSON_PROTOCOL == 1
-
-#if IRMP_SUPPORT_BOSE_PROTOCOL == 1
-                    if (irmp_pulse_time >= BOSE_START_BIT_PULSE_LEN_MIN && irmp_pulse_time <= BOSE_START_BIT_PULSE_LEN_MAX &&
-                        irmp_pause_time >= BOSE_START_BIT_PAUSE_LEN_MIN && irmp_pause_time <= BOSE_START_BIT_PAUSE_LEN_MAX)
                     {
-                        ANALYZE_PRINTF5 ("protocol = BOSE, start bit timings: pulse: %3d - %3d, pause: %3d - %3d\n",
-                                        BOSE_START_BIT_PULSE_LEN_MIN, BOSE_START_BIT_PULSE_LEN_MAX,
-                                        BOSE_START_BIT_PAUSE_LEN_MIN, BOSE_START_BIT_PAUSE_LEN_MAX);
-                        irmp_param_p = (IRMP_PARAMETER *) &bose_param;
+                        ANALYZE_PRINTF1("error NETBOX: bit6/7 must be 0/1\n");
                     }
-                    else
-#endif // IRMP_SUPPORT_BOSE_PROTOCOL == 1
+                }
+                else
+                {
+                    ANALYZE_PRINTF1("error NETBOX: last bit not set\n");
+                }
+                break;
+#endif
+#if IRMP_SUPPORT_LEGO_PROTOCOL == 1
+            case IRMP_LEGO_PROTOCOL:
+            {
+                uint_fast8_t crc = 0x0F ^ ((irmp_command & 0xF000) >> 12) ^ ((irmp_command & 0x0F00) >> 8) ^ ((irmp_command & 0x00F0) >> 4);
 
-#if IRMP_SUPPORT_RC6_PROTOCOL == 1
-                    if (irmp_pulse_time >= RC6_START_BIT_PULSE_LEN_MIN && irmp_pulse_time <= RC6_START_BIT_PULSE_LEN_MAX &&
-                        irmp_pause_time >= RC6_START_BIT_PAUSE_LEN_MIN && irmp_pause_time <= RC6_START_BIT_PAUSE_LEN_MAX)
-                    {                                                           // it's RC6
-                        ANALYZE_PRINTF5 ("protocol = RC6, start bit timings: pulse: %3d - %3d, pause: %3d - %3d\n",
-                                        RC6_START_BIT_PULSE_LEN_MIN, RC6_START_BIT_PULSE_LEN_MAX,
-                                        RC6_START_BIT_PAUSE_LEN_MIN, RC6_START_BIT_PAUSE_LEN_MAX);
-                        irmp_param_p = (IRMP_PARAMETER *) &rc6_param;
-                        last_pause = 0;
-                        last_value = 1;
-                    }
-                    else
-#endif // IRMP_SUPPORT_RC6_PROTOCOL == 1
+                if ((irmp_command & 0x000F) == crc)
+                {
+                    irmp_command >>= 4;
+                    tReturnCode = TRUE;
+                }
+                else
+                {
+                    ANALYZE_PRINTF1 ("CRC error in LEGO protocol\n");
+                    // rtc = TRUE;                              // don't accept codes with CRC errors
+                }
+                break;
+            }
+#endif
 
-#if IRMP_SUPPORT_RECS80EXT_PROTOCOL == 1
-                    if (irmp_pulse_time >= RECS80EXT_START_BIT_PULSE_LEN_MIN && irmp_pulse_time <= RECS80EXT_START_BIT_PULSE_LEN_MAX &&
-                        irmp_pause_time >= RECS80EXT_START_BIT_PAUSE_LEN_MIN && irmp_pause_time <= RECS80EXT_START_BIT_PAUSE_LEN_MAX)
-                    {                                                           // it's RECS80EXT
-                        ANALYZE_PRINTF5 ("protocol = RECS80EXT, start bit timings: pulse: %3d - %3d, pause: %3d - %3d\n",
-                                        RECS80EXT_START_BIT_PULSE_LEN_MIN, RECS80EXT_START_BIT_PULSE_LEN_MAX,
-                                        RECS80EXT_START_BIT_PAUSE_LEN_MIN, RECS80EXT_START_BIT_PAUSE_LEN_MAX);
-                        irmp_param_p = (IRMP_PARAMETER *) &recs80ext_param;
-                    }
-                    else
-#endif // IRMP_SUPPORT_RECS80EXT_PROTOCOL == 1
+#if IRMP_SUPPORT_METZ_PROTOCOL == 1
+            case IRMP_METZ_PROTOCOL:
+                irmp_address &= ~0x40;                              // clear toggle bit
+                if (((~irmp_address) & 0x07) == (irmp_address >> 3) && ((~irmp_command) & 0x3f) == (irmp_command >> 6))
+                {
+                    irmp_address >>= 3;
+                    irmp_command >>= 6;
+                    tReturnCode = TRUE;
+                }
+                break;
+#endif
 
-#if IRMP_SUPPORT_NUBERT_PROTOCOL == 1
-                    if (irmp_pulse_time >= NUBERT_START_BIT_PULSE_LEN_MIN && irmp_pulse_time <= NUBERT_START_BIT_PULSE_LEN_MAX &&
-                        irmp_pause_time >= NUBERT_START_BIT_PAUSE_LEN_MIN && irmp_pause_time <= NUBERT_START_BIT_PAUSE_LEN_MAX)
-                    {                                                           // it's NUBERT
-                        ANALYZE_PRINTF5 ("protocol = NUBERT, start bit timings: pulse: %3d - %3d, pause: %3d - %3d\n",
-                                        NUBERT_START_BIT_PULSE_LEN_MIN, NUBERT_START_BIT_PULSE_LEN_MAX,
-                                        NUBERT_START_BIT_PAUSE_LEN_MIN, NUBERT_START_BIT_PAUSE_LEN_MAX);
-                        irmp_param_p = (IRMP_PARAMETER *) &nubert_param;
-                    }
-                    else
-#endif // IRMP_SUPPORT_NUBERT_PROTOCOL == 1
 
-#if IRMP_SUPPORT_FAN_PROTOCOL == 1
-                    if (irmp_pulse_time >= FAN_START_BIT_PULSE_LEN_MIN && irmp_pulse_time <= FAN_START_BIT_PULSE_LEN_MAX &&
-                        irmp_pause_time >= FAN_START_BIT_PAUSE_LEN_MIN && irmp_pause_time <= FAN_START_BIT_PAUSE_LEN_MAX)
-                    {                                                           // it's FAN
-                        ANALYZE_PRINTF5 ("protocol = FAN, start bit timings: pulse: %3d - %3d, pause: %3d - %3d\n",
-                                        FAN_START_BIT_PULSE_LEN_MIN, FAN_START_BIT_PULSE_LEN_MAX,
-                                        FAN_START_BIT_PAUSE_LEN_MIN, FAN_START_BIT_PAUSE_LEN_MAX);
-                        irmp_param_p = (IRMP_PARAMETER *) &fan_param;
-                    }
-                    else
-#endif // IRMP_SUPPORT_FAN_PROTOCOL == 1
+#if IRMP_SUPPORT_RF_X10_PROTOCOL == 1 || IRMP_SUPPORT_RF_MEDION_PROTOCOL == 1
+            case RF_X10_PROTOCOL:
+            case RF_MEDION_PROTOCOL:
+            {
+                uint8_t channel;
+                uint8_t checksum;
 
-#if IRMP_SUPPORT_SPEAKER_PROTOCOL == 1
-                    if (irmp_pulse_time >= SPEAKER_START_BIT_PULSE_LEN_MIN && irmp_pulse_time <= SPEAKER_START_BIT_PULSE_LEN_MAX &&
-                        irmp_pause_time >= SPEAKER_START_BIT_PAUSE_LEN_MIN && irmp_pause_time <= SPEAKER_START_BIT_PAUSE_LEN_MAX)
-                    {                                                           // it's SPEAKER
-                        ANALYZE_PRINTF5 ("protocol = SPEAKER, start bit timings: pulse: %3d - %3d, pause: %3d - %3d\n",
-                                        SPEAKER_START_BIT_PULSE_LEN_MIN, SPEAKER_START_BIT_PULSE_LEN_MAX,
-                                        SPEAKER_START_BIT_PAUSE_LEN_MIN, SPEAKER_START_BIT_PAUSE_LEN_MAX);
-                        irmp_param_p = (IRMP_PARAMETER *) &speaker_param;
-                    }
-                    else
-#endif // IRMP_SUPPORT_SPEAKER_PROTOCOL == 1
+                channel = irmp_command & 0x0F;                      // lower nibble: RF channel 0-15
+                irmp_command >>= 4;                                 // shift out channel
 
-#if IRMP_SUPPORT_BANG_OLUFSEN_PROTOCOL == 1
-                    if (irmp_pulse_time >= BANG_OLUFSEN_START_BIT1_PULSE_LEN_MIN && irmp_pulse_time <= BANG_OLUFSEN_START_BIT1_PULSE_LEN_MAX &&
-                        irmp_pause_time >= BANG_OLUFSEN_START_BIT1_PAUSE_LEN_MIN && irmp_pause_time <= BANG_OLUFSEN_START_BIT1_PAUSE_LEN_MAX)
-                    {                                                           // it's BANG_OLUFSEN
-                        ANALYZE_PRINTF1 ("protocol = BANG_OLUFSEN\n");
-                        ANALYZE_PRINTF5 ("start bit 1 timings: pulse: %3d - %3d, pause: %3d - %3d\n",
-                                        BANG_OLUFSEN_START_BIT1_PULSE_LEN_MIN, BANG_OLUFSEN_START_BIT1_PULSE_LEN_MAX,
-                                        BANG_OLUFSEN_START_BIT1_PAUSE_LEN_MIN, BANG_OLUFSEN_START_BIT1_PAUSE_LEN_MAX);
-                        ANALYZE_PRINTF5 ("start bit 2 timings: pulse: %3d - %3d, pause: %3d - %3d\n",
-                                        BANG_OLUFSEN_START_BIT2_PULSE_LEN_MIN, BANG_OLUFSEN_START_BIT2_PULSE_LEN_MAX,
-                                        BANG_OLUFSEN_START_BIT2_PAUSE_LEN_MIN, BANG_OLUFSEN_START_BIT2_PAUSE_LEN_MAX);
-                        ANALYZE_PRINTF5 ("start bit 3 timings: pulse: %3d - %3d, pause: %3d - %3d\n",
-                                        BANG_OLUFSEN_START_BIT3_PULSE_LEN_MIN, BANG_OLUFSEN_START_BIT3_PULSE_LEN_MAX,
-                                        BANG_OLUFSEN_START_BIT3_PAUSE_LEN_MIN, BANG_OLUFSEN_START_BIT3_PAUSE_LEN_MAX);
-                        ANALYZE_PRINTF5 ("start bit 4 timings: pulse: %3d - %3d, pause: %3d - %3d\n",
-                                        BANG_OLUFSEN_START_BIT4_PULSE_LEN_MIN, BANG_OLUFSEN_START_BIT4_PULSE_LEN_MAX,
-                                        BANG_OLUFSEN_START_BIT4_PAUSE_LEN_MIN, BANG_OLUFSEN_START_BIT4_PAUSE_LEN_MAX);
-                        irmp_param_p = (IRMP_PARAMETER *) &bang_olufsen_param;
-                        last_value = 0;
-                    }
-                    else
-#endif // IRMP_SUPPORT_BANG_OLUFSEN_PROTOCOL == 1
+                checksum = irmp_address;                            // get checksum
 
-#if IRMP_SUPPORT_GRUNDIG_NOKIA_IR60_PROTOCOL == 1
-                    if (irmp_pulse_time >= GRUNDIG_NOKIA_IR60_START_BIT_LEN_MIN && irmp_pulse_time <= GRUNDIG_NOKIA_IR60_START_BIT_LEN_MAX &&
-                        irmp_pause_time >= GRUNDIG_NOKIA_IR60_PRE_PAUSE_LEN_MIN && irmp_pause_time <= GRUNDIG_NOKIA_IR60_PRE_PAUSE_LEN_MAX)
-                    {                                                           // it's GRUNDIG
-                        ANALYZE_PRINTF5 ("protocol = GRUNDIG, pre bit timings: pulse: %3d - %3d, pause: %3d - %3d\n",
-                                        GRUNDIG_NOKIA_IR60_START_BIT_LEN_MIN, GRUNDIG_NOKIA_IR60_START_BIT_LEN_MAX,
-                                        GRUNDIG_NOKIA_IR60_PRE_PAUSE_LEN_MIN, GRUNDIG_NOKIA_IR60_PRE_PAUSE_LEN_MAX);
-                        irmp_param_p = (IRMP_PARAMETER *) &grundig_param;
-                        last_pause = irmp_pause_time;
-                        last_value  = 1;
-                    }
-                    else
-#endif // IRMP_SUPPORT_GRUNDIG_NOKIA_IR60_PROTOCOL == 1
+                if (((irmp_command + (0x0055 + (channel << 4))) & 0x7F) == checksum)
+                {                                                   // checksum correct?
+                    irmp_address = channel + 1;                     // set address to channel + 1
+                    tReturnCode = TRUE;
+                }
+                break;
+            }
+#endif
 
-#if IRMP_SUPPORT_MERLIN_PROTOCOL == 1 // check MERLIN before RUWIDO!
-                    if (irmp_pulse_time >= MERLIN_START_BIT_PULSE_LEN_MIN && irmp_pulse_time <= MERLIN_START_BIT_PULSE_LEN_MAX &&
-                        irmp_pause_time >= MERLIN_START_BIT_PAUSE_LEN_MIN && irmp_pause_time <= MERLIN_START_BIT_PAUSE_LEN_MAX)
-                    {                                                           // it's MERLIN
-                        ANALYZE_PRINTF5 ("protocol = MERLIN, start bit timings: pulse: %3d - %3d, pause: %3d - %3d\n",
-                                        MERLIN_START_BIT_PULSE_LEN_MIN, MERLIN_START_BIT_PULSE_LEN_MAX,
-                                        MERLIN_START_BIT_PAUSE_LEN_MIN, MERLIN_START_BIT_PAUSE_LEN_MAX);
-                        irmp_param_p = (IRMP_PARAMETER *) &merlin_param;
-                        last_pause = irmp_pause_time;
-                        last_value = 1;
-                    }
-                    else
-#endif // IRMP_SUPPORT_MERLIN_PROTOCOL == 1
+#if IRMP_SUPPORT_ACP24_PROTOCOL == 1 && IRMP_FRAME_BITS >= 128
+            case IRMP_ACP24_PROTOCOL:
+                irmp_address = 0;
+                irmp_command = irmp_acp24_get_command ();
+                tReturnCode = TRUE;
+                break;
+#endif
 
-#if IRMP_SUPPORT_SIEMENS_OR_RUWIDO_PROTOCOL == 1
-                    if (((irmp_pulse_time >= SIEMENS_OR_RUWIDO_START_BIT_PULSE_LEN_MIN && irmp_pulse_time <= SIEMENS_OR_RUWIDO_START_BIT_PULSE_LEN_MAX) ||
-                         (irmp_pulse_time >= 2 * SIEMENS_OR_RUWIDO_START_BIT_PULSE_LEN_MIN && irmp_pulse_time <= 2 * SIEMENS_OR_RUWIDO_START_BIT_PULSE_LEN_MAX)) &&
-                        ((irmp_pause_time >= SIEMENS_OR_RUWIDO_START_BIT_PAUSE_LEN_MIN && irmp_pause_time <= SIEMENS_OR_RUWIDO_START_BIT_PAUSE_LEN_MAX) ||
-                         (irmp_pause_time >= 2 * SIEMENS_OR_RUWIDO_START_BIT_PAUSE_LEN_MIN && irmp_pause_time <= 2 * SIEMENS_OR_RUWIDO_START_BIT_PAUSE_LEN_MAX)))
-                    {                                                           // it's RUWIDO or SIEMENS
-                        ANALYZE_PRINTF9 ("protocol = RUWIDO, start bit timings: pulse: %3d - %3d or %3d - %3d, pause: %3d - %3d or %3d - %3d\n",
-                                        SIEMENS_OR_RUWIDO_START_BIT_PULSE_LEN_MIN,   SIEMENS_OR_RUWIDO_START_BIT_PULSE_LEN_MAX,
-                                        2 * SIEMENS_OR_RUWIDO_START_BIT_PULSE_LEN_MIN, 2 * SIEMENS_OR_RUWIDO_START_BIT_PULSE_LEN_MAX,
-                                        SIEMENS_OR_RUWIDO_START_BIT_PAUSE_LEN_MIN,   SIEMENS_OR_RUWIDO_START_BIT_PAUSE_LEN_MAX,
-                                        2 * SIEMENS_OR_RUWIDO_START_BIT_PAUSE_LEN_MIN, 2 * SIEMENS_OR_RUWIDO_START_BIT_PAUSE_LEN_MAX);
-                        irmp_param_p = (IRMP_PARAMETER *) &ruwido_param;
-                        last_pause = irmp_pause_time;
-                        last_value  = 1;
-                    }
-                    else
-#endif // IRMP_SUPPORT_SIEMENS_OR_RUWIDO_PROTOCOL == 1
+#if IRMP_SUPPORT_MITSU_HEAVY_PROTOCOL == 1 && IRMP_FRAME_BITS >= 128
+            case IRMP_MITSU_HEAVY_PROTOCOL:                         // bytes 5 ... 10: 3 bytes, each followed by its inverted value
+                if ((uint8_t) ~irmp_frame_acc[5] == irmp_frame_acc[6] &&
+                    (uint8_t) ~irmp_frame_acc[7] == irmp_frame_acc[8] &&
+                    (uint8_t) ~irmp_frame_acc[9] == irmp_frame_acc[10])
+                {
+                    irmp_address = (irmp_frame_acc[6] << 8) | irmp_frame_acc[8];
+                    irmp_command = irmp_frame_acc[10];
+                    tReturnCode = TRUE;
+                }
+                else
+                {
+                    ANALYZE_PRINTF1 ("error MITSU_HEAVY: parity check failed\n");
+                }
+                break;
+#endif
 
-#if IRMP_SUPPORT_FDC_PROTOCOL == 1
-                    if (irmp_pulse_time >= FDC_START_BIT_PULSE_LEN_MIN && irmp_pulse_time <= FDC_START_BIT_PULSE_LEN_MAX &&
-                        irmp_pause_time >= FDC_START_BIT_PAUSE_LEN_MIN && irmp_pause_time <= FDC_START_BIT_PAUSE_LEN_MAX)
-                    {
-                        ANALYZE_PRINTF5 ("protocol = FDC, start bit timings: pulse: %3d - %3d, pause: %3d - %3d\n",
-                                        FDC_START_BIT_PULSE_LEN_MIN, FDC_START_BIT_PULSE_LEN_MAX,
-                                        FDC_START_BIT_PAUSE_LEN_MIN, FDC_START_BIT_PAUSE_LEN_MAX);
-                        irmp_param_p = (IRMP_PARAMETER *) &fdc_param;
-                    }
-                    else
-#endif // IRMP_SUPPORT_FDC_PROTOCOL == 1
+            default:
+            {
+                tReturnCode = TRUE;
+                break;
+            }
+        }
 
-#if IRMP_SUPPORT_RCCAR_PROTOCOL == 1
-                    if (irmp_pulse_time >= RCCAR_START_BIT_PULSE_LEN_MIN && irmp_pulse_time <= RCCAR_START_BIT_PULSE_LEN_MAX &&
-                        irmp_pause_time >= RCCAR_START_BIT_PAUSE_LEN_MIN && irmp_pause_time <= RCCAR_START_BIT_PAUSE_LEN_MAX)
-                    {
-                        ANALYZE_PRINTF5 ("protocol = RCCAR, start bit timings: pulse: %3d - %3d, pause: %3d - %3d\n",
-                                        RCCAR_START_BIT_PULSE_LEN_MIN, RCCAR_START_BIT_PULSE_LEN_MAX,
-                                        RCCAR_START_BIT_PAUSE_LEN_MIN, RCCAR_START_BIT_PAUSE_LEN_MAX);
-                        irmp_param_p = (IRMP_PARAMETER *) &rccar_param;
-                    }
-                    else
-#endif // IRMP_SUPPORT_RCCAR_PROTOCOL == 1
+#if IRMP_ENABLE_PROTOCOL_MASK == 1
+        if (tReturnCode && ! irmp_protocol_enabled (irmp_protocol))
+        {
+            ANALYZE_PRINTF2 ("protocol %d disabled by protocol mask, frame ignored\n", irmp_protocol);
+            tReturnCode = FALSE;
+        }
+#endif
 
-#if IRMP_SUPPORT_KATHREIN_PROTOCOL == 1
-                    if (irmp_pulse_time >= KATHREIN_START_BIT_PULSE_LEN_MIN && irmp_pulse_time <= KATHREIN_START_BIT_PULSE_LEN_MAX &&
-                        irmp_pause_time >= KATHREIN_START_BIT_PAUSE_LEN_MIN && irmp_pause_time <= KATHREIN_START_BIT_PAUSE_LEN_MAX)
-                    {                                                           // it's KATHREIN
-                        ANALYZE_PRINTF5 ("protocol = KATHREIN, start bit timings: pulse: %3d - %3d, pause: %3d - %3d\n",
-                                        KATHREIN_START_BIT_PULSE_LEN_MIN, KATHREIN_START_BIT_PULSE_LEN_MAX,
-                                        KATHREIN_START_BIT_PAUSE_LEN_MIN, KATHREIN_START_BIT_PAUSE_LEN_MAX);
-                        irmp_param_p = (IRMP_PARAMETER *) &kathrein_param;
-                    }
-                    else
-#endif // IRMP_SUPPORT_KATHREIN_PROTOCOL == 1
+        if (tReturnCode)
+        {
+            irmp_data_p->protocol = irmp_protocol;
+            irmp_data_p->address  = irmp_address;
+            irmp_data_p->command  = irmp_command;
+#if IRMP_FRAME_BITS > 0 && IRMP_FRAME_QUEUE_SIZE == 0
+            irmp_frame_store (&irmp_frame, irmp_protocol);
+#endif
 
-#if IRMP_SUPPORT_NETBOX_PROTOCOL == 1
-                    if (irmp_pulse_time >= NETBOX_START_BIT_PULSE_LEN_MIN && irmp_pulse_time <= NETBOX_START_BIT_PULSE_LEN_MAX &&
-                        irmp_pause_time >= NETBOX_START_BIT_PAUSE_LEN_MIN && irmp_pause_time <= NETBOX_START_BIT_PAUSE_LEN_MAX)
-                    {                                                           // it's NETBOX
-                        ANALYZE_PRINTF5 ("protocol = NETBOX, start bit timings: pulse: %3d - %3d, pause: %3d - %3d\n",
-                                        NETBOX_START_BIT_PULSE_LEN_MIN, NETBOX_START_BIT_PULSE_LEN_MAX,
-                                        NETBOX_START_BIT_PAUSE_LEN_MIN, NETBOX_START_BIT_PAUSE_LEN_MAX);
-                        irmp_param_p = (IRMP_PARAMETER *) &netbox_param;
-                    }
-                    else
-#endif // IRMP_SUPPORT_NETBOX_PROTOCOL == 1
+#if IRMP_AUTODETECT_REPEATRATE
+            tmp_delta = (pass_on_delta_detection * (1000000 / F_INTERRUPTS)) / 1000; // ms, this division is not precise
+            if (tmp_delta > 0xFF ) // reduce to uint8_t
+                delta = 0xFF;
+            else
+                delta = tmp_delta;
+            if (irmp_protocol != previous_irmp_protocol) { // reset
+                min_delta = 170;
+                upper_border = min_delta * (100 + JITTER_COMPENSATION) / 100 + 1;
+                timeout = 1;
+                keep_same_key = 0;
+                previous_irmp_protocol = irmp_protocol;
+            } else {
+                if (!(irmp_protocol == IRMP_NEC_PROTOCOL && delta < 75)) { // if NEC, ignore first short interval
+                    if (delta < min_delta && same_key)
+                        min_delta = delta;
+                }
+                upper_border = min_delta * (100 + JITTER_COMPENSATION) / 100 + 1;
+                timeout = (delta >= upper_border);
+                if (irmp_protocol == IRMP_RC5_PROTOCOL || irmp_protocol == IRMP_RC6_PROTOCOL || irmp_protocol == IRMP_RC6A_PROTOCOL || irmp_protocol == IRMP_RECS80_PROTOCOL \
+                    || irmp_protocol == IRMP_RECS80EXT_PROTOCOL || irmp_protocol == IRMP_RCMM24_PROTOCOL || irmp_protocol == IRMP_RCMM32_PROTOCOL \
+                    || irmp_protocol == IRMP_THOMSON_PROTOCOL || irmp_protocol == IRMP_S100_PROTOCOL || irmp_protocol == IRMP_METZ_PROTOCOL) {
+                    if (same_key) // same_key is false, if toggle; not using timeout helps detecting repeats after misdetection and timeout isn't needed for discerning repetition
+                        irmp_flags |= IRMP_FLAG_REPETITION;
+                } else {
+                    if (same_key && !timeout)
+                        irmp_flags |= IRMP_FLAG_REPETITION;
+                }
+                keep_same_key = same_key;
+                same_key = 0;
+            }
+#endif
 
-#if IRMP_SUPPORT_LEGO_PROTOCOL == 1
-                    if (irmp_pulse_time >= LEGO_START_BIT_PULSE_LEN_MIN && irmp_pulse_time <= LEGO_START_BIT_PULSE_LEN_MAX &&
-                        irmp_pause_time >= LEGO_START_BIT_PAUSE_LEN_MIN && irmp_pause_time <= LEGO_START_BIT_PAUSE_LEN_MAX)
-                    {
-                        ANALYZE_PRINTF5 ("protocol = LEGO, start bit timings: pulse: %3d - %3d, pause: %3d - %3d\n",
-                                        LEGO_START_BIT_PULSE_LEN_MIN, LEGO_START_BIT_PULSE_LEN_MAX,
-                                        LEGO_START_BIT_PAUSE_LEN_MIN, LEGO_START_BIT_PAUSE_LEN_MAX);
-                        irmp_param_p = (IRMP_PARAMETER *) &lego_param;
-                    }
-                    else
-#endif // IRMP_SUPPORT_LEGO_PROTOCOL == 1
+            irmp_data_p->flags    = irmp_flags;
+        }
+        else
+        {
+            irmp_protocol = IRMP_UNKNOWN_PROTOCOL;
+        }
 
-#if IRMP_SUPPORT_IRMP16_PROTOCOL == 1
-                    if (irmp_pulse_time >= IRMP16_START_BIT_PULSE_LEN_MIN && irmp_pulse_time <= IRMP16_START_BIT_PULSE_LEN_MAX &&
-                        irmp_pause_time >= IRMP16_START_BIT_PAUSE_LEN_MIN && irmp_pause_time <= IRMP16_START_BIT_PAUSE_LEN_MAX)
-                    {
-                        ANALYZE_PRINTF5 ("protocol = IRMP16, start bit timings: pulse: %3d - %3d, pause: %3d - %3d\n",
-                                        IRMP16_START_BIT_PULSE_LEN_MIN, IRMP16_START_BIT_PULSE_LEN_MAX,
-                                        IRMP16_START_BIT_PAUSE_LEN_MIN, IRMP16_START_BIT_PAUSE_LEN_MAX);
-                        irmp_param_p = (IRMP_PARAMETER *) &irmp16_param;
-                    }
-                    else
-#endif // IRMP_SUPPORT_IRMP16_PROTOCOL == 1
+        irmp_command  = 0;                                      // don't reset irmp_protocol here, needed for detection of NEC & JVC repetition frames!
+        irmp_address  = 0;
+        irmp_flags    = 0;
 
-#if IRMP_SUPPORT_GREE_PROTOCOL == 1
-                    if (irmp_pulse_time >= GREE_START_BIT_PULSE_LEN_MIN && irmp_pulse_time <= GREE_START_BIT_PULSE_LEN_MAX &&
-                        irmp_pause_time >= GREE_START_BIT_PAUSE_LEN_MIN && irmp_pause_time <= GREE_START_BIT_PAUSE_LEN_MAX)
-                    {
-                        ANALYZE_PRINTF5 ("protocol = GREE, start bit timings: pulse: %3d - %3d, pause: %3d - %3d\n",
-                                        GREE_START_BIT_PULSE_LEN_MIN, GREE_START_BIT_PULSE_LEN_MAX,
-                                        GREE_START_BIT_PAUSE_LEN_MIN, GREE_START_BIT_PAUSE_LEN_MAX);
-                        irmp_param_p = (IRMP_PARAMETER *) &gree_param;
-                    }
-                    else
-#endif // IRMP_SUPPORT_GREE_PROTOCOL == 1
+        irmp_ir_detected = FALSE;
+    }
 
-#if IRMP_SUPPORT_A1TVBOX_PROTOCOL == 1
-                    if (irmp_pulse_time >= A1TVBOX_START_BIT_PULSE_LEN_MIN && irmp_pulse_time <= A1TVBOX_START_BIT_PULSE_LEN_MAX &&
-                        irmp_pause_time >= A1TVBOX_START_BIT_PAUSE_LEN_MIN && irmp_pause_time <= A1TVBOX_START_BIT_PAUSE_LEN_MAX)
-                    {                                                           // it's A1TVBOX
-                        ANALYZE_PRINTF5 ("protocol = A1TVBOX, start bit timings: pulse: %3d - %3d, pause: %3d - %3d\n",
-                                        A1TVBOX_START_BIT_PULSE_LEN_MIN, A1TVBOX_START_BIT_PULSE_LEN_MAX,
-                                        A1TVBOX_START_BIT_PAUSE_LEN_MIN, A1TVBOX_START_BIT_PAUSE_LEN_MAX);
-                        irmp_param_p = (IRMP_PARAMETER *) &a1tvbox_param;
-                        last_pause = 0;
-                        last_value = 1;
-                    }
-                    else
-#endif // IRMP_SUPPORT_A1TVBOX_PROTOCOL == 1
+    return tReturnCode;
+}
 
-#if IRMP_SUPPORT_ORTEK_PROTOCOL == 1
-                    if (irmp_pulse_time >= ORTEK_START_BIT_PULSE_LEN_MIN && irmp_pulse_time <= ORTEK_START_BIT_PULSE_LEN_MAX &&
-                        irmp_pause_time >= ORTEK_START_BIT_PAUSE_LEN_MIN && irmp_pause_time <= ORTEK_START_BIT_PAUSE_LEN_MAX)
-                    {                                                           // it's ORTEK (Hama)
-                        ANALYZE_PRINTF5 ("protocol = ORTEK, start bit timings: pulse: %3d - %3d, pause: %3d - %3d\n",
-                                        ORTEK_START_BIT_PULSE_LEN_MIN, ORTEK_START_BIT_PULSE_LEN_MAX,
-                                        ORTEK_START_BIT_PAUSE_LEN_MIN, ORTEK_START_BIT_PAUSE_LEN_MAX);
-                        irmp_param_p = (IRMP_PARAMETER *) &ortek_param;
-                        last_pause  = 0;
-                        last_value  = 1;
-                        parity      = 0;
-                    }
-                    else
-#endif // IRMP_SUPPORT_ORTEK_PROTOCOL == 1
+#if IRMP_ENABLE_DATA_EX == 1
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ *  Store timestamps of detected frame
+ *  @details  called by irmp_ISR() when irmp_ir_detected gets TRUE. A release frame has no signal, it gets the current
+ *            tick count as start and end and does not count as previous frame.
+ *  @param    tick count at begin of start bit
+ *  @param    TRUE: received frame, FALSE: release frame
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+static void
+irmp_store_frame_ticks (uint32_t start_ticks, uint_fast8_t is_frame)
+{
+    irmp_frame_start_ticks  = start_ticks;
+    irmp_frame_end_ticks    = irmp_tick_counter;
+    irmp_frame_gap_ticks    = irmp_last_frame_valid ? (uint32_t) (start_ticks - irmp_last_frame_end_ticks) : IRMP_GAP_UNKNOWN;
 
-#if IRMP_SUPPORT_RCMM_PROTOCOL == 1
-                    if (irmp_pulse_time >= RCMM32_START_BIT_PULSE_LEN_MIN && irmp_pulse_time <= RCMM32_START_BIT_PULSE_LEN_MAX &&
-                        irmp_pause_time >= RCMM32_START_BIT_PAUSE_LEN_MIN && irmp_pause_time <= RCMM32_START_BIT_PAUSE_LEN_MAX)
-                    {                                                           // it's RCMM
-                        ANALYZE_PRINTF5 ("protocol = RCMM, start bit timings: pulse: %3d - %3d, pause: %3d - %3d\n",
-                                        RCMM32_START_BIT_PULSE_LEN_MIN, RCMM32_START_BIT_PULSE_LEN_MAX,
-                                        RCMM32_START_BIT_PAUSE_LEN_MIN, RCMM32_START_BIT_PAUSE_LEN_MAX);
-                        irmp_param_p = (IRMP_PARAMETER *) &rcmm_param;
-                    }
-                    else
-#endif // IRMP_SUPPORT_RCMM_PROTOCOL == 1
-                    {
-                        ANALYZE_PRINTF1 ("protocol = UNKNOWN\n");
-                        irmp_start_bit_detected = 0;                            // wait for another start bit...
-                        irmp_param.protocol = 0;                                // reset protocol
-                    }
+    if (is_frame)
+    {
+        irmp_last_frame_end_ticks   = irmp_tick_counter;
+        irmp_last_frame_valid       = TRUE;
+    }
+}
 
-                    if (irmp_start_bit_detected)
-                    {
-                        memcpy_P (&irmp_param, irmp_param_p, sizeof (IRMP_PARAMETER));
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ *  Get tick count
+ *  @details  reads irmp_tick_counter twice, because 32 bit access is not atomic on 8 and 16 bit CPUs
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+static uint32_t
+irmp_get_ticks_current (void)
+{
+    uint32_t        ticks;
 
-                        if (! (irmp_param.flags & IRMP_PARAM_FLAG_IS_MANCHESTER))
-                        {
-                            ANALYZE_PRINTF3 ("pulse_1: %3d - %3d\n", irmp_param.pulse_1_len_min, irmp_param.pulse_1_len_max);
-                            ANALYZE_PRINTF3 ("pause_1: %3d - %3d\n", irmp_param.pause_1_len_min, irmp_param.pause_1_len_max);
-                        }
-                        else
-                        {
-                            ANALYZE_PRINTF5 ("pulse: %3d - %3d or %3d - %3d\n", irmp_param.pulse_1_len_min, irmp_param.pulse_1_len_max,
-                                            2 * irmp_param.pulse_1_len_min, 2 * irmp_param.pulse_1_len_max);
-                            ANALYZE_PRINTF5 ("pause: %3d - %3d or %3d - %3d\n", irmp_param.pause_1_len_min, irmp_param.pause_1_len_max,
-                                            2 * irmp_param.pause_1_len_min, 2 * irmp_param.pause_1_len_max);
-                        }
+    do
+    {
+        ticks = *(volatile uint32_t *) &irmp_tick_counter;
+    } while (ticks != *(volatile uint32_t *) &irmp_tick_counter);
 
-#if IRMP_SUPPORT_RC5_PROTOCOL == 1 && (IRMP_SUPPORT_FDC_PROTOCOL == 1 || IRMP_SUPPORT_RCCAR_PROTOCOL == 1)
-                        if (irmp_param2.protocol)
-                        {
-                            ANALYZE_PRINTF3 ("pulse_0: %3d - %3d\n", irmp_param2.pulse_0_len_min, irmp_param2.pulse_0_len_max);
-                            ANALYZE_PRINTF3 ("pause_0: %3d - %3d\n", irmp_param2.pause_0_len_min, irmp_param2.pause_0_len_max);
-                            ANALYZE_PRINTF3 ("pulse_1: %3d - %3d\n", irmp_param2.pulse_1_len_min, irmp_param2.pulse_1_len_max);
-                            ANALYZE_PRINTF3 ("pause_1: %3d - %3d\n", irmp_param2.pause_1_len_min, irmp_param2.pause_1_len_max);
-                        }
-#endif
+    return ticks;
+}
+#endif // IRMP_ENABLE_DATA_EX == 1
 
+#if IRMP_FRAME_QUEUE_SIZE > 0
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ *  Store detected frame in queue
+ *  @details  called by irmp_ISR(), converts the frame like irmp_get_data() without queue and clears irmp_ir_detected,
+ *            so irmp_ISR() continues decoding at the next call.
+ *  @return   TRUE: frame stored, FALSE: frame invalid or queue full
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+static uint_fast8_t
+irmp_queue_put (void)
+{
+    IRMP_DATA       irmp_data;
+    uint8_t         head = irmp_queue_head;
 
-#if IRMP_SUPPORT_RC6_PROTOCOL == 1
-                        if (irmp_param.protocol == IRMP_RC6_PROTOCOL)
-                        {
-                            ANALYZE_PRINTF3 ("pulse_toggle: %3d - %3d\n", RC6_TOGGLE_BIT_LEN_MIN, RC6_TOGGLE_BIT_LEN_MAX);
-                        }
+    if (! irmp_convert_data (&irmp_data))
+    {
+        return FALSE;
+    }
+
+    if ((uint8_t) (head - irmp_queue_tail) >= IRMP_FRAME_QUEUE_SIZE)
+    {
+        if (irmp_queue_overflows < 0xFFFF)
+        {
+            irmp_queue_overflows++;
+        }
+        return FALSE;
+    }
+
+    irmp_queue[head & (IRMP_FRAME_QUEUE_SIZE - 1)].data         = irmp_data;
+    irmp_queue[head & (IRMP_FRAME_QUEUE_SIZE - 1)].ticks        = irmp_tick_counter;
+#if IRMP_ENABLE_DATA_EX == 1
+    irmp_queue[head & (IRMP_FRAME_QUEUE_SIZE - 1)].start_ticks  = irmp_frame_start_ticks;
+    irmp_queue[head & (IRMP_FRAME_QUEUE_SIZE - 1)].gap_ticks    = irmp_frame_gap_ticks;
 #endif
+#if IRMP_FRAME_BITS > 0
+    irmp_frame_store (&irmp_queue[head & (IRMP_FRAME_QUEUE_SIZE - 1)].frame, irmp_data.protocol);
+#endif
+    IRMP_QUEUE_BARRIER ();
+    irmp_queue_head = head + 1;
+    return TRUE;
+}
 
-                        if (! (irmp_param.flags & IRMP_PARAM_FLAG_IS_MANCHESTER))
-                        {
-                            ANALYZE_PRINTF3 ("pulse_0: %3d - %3d\n", irmp_param.pulse_0_len_min, irmp_param.pulse_0_len_max);
-                            ANALYZE_PRINTF3 ("pause_0: %3d - %3d\n", irmp_param.pause_0_len_min, irmp_param.pause_0_len_max);
-                        }
-                        else
-                        {
-                            ANALYZE_PRINTF5 ("pulse: %3d - %3d or %3d - %3d\n", irmp_param.pulse_0_len_min, irmp_param.pulse_0_len_max,
-                                            2 * irmp_param.pulse_0_len_min, 2 * irmp_param.pulse_0_len_max);
-                            ANALYZE_PRINTF5 ("pause: %3d - %3d or %3d - %3d\n", irmp_param.pause_0_len_min, irmp_param.pause_0_len_max,
-                                            2 * irmp_param.pause_0_len_min, 2 * irmp_param.pause_0_len_max);
-                        }
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ *  Get oldest entry from queue
+ *  @param    pointer in order to store the entry
+ *  @return   TRUE: successful, FALSE: queue empty
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+static uint_fast8_t
+irmp_queue_get_entry (IRMP_QUEUE_ENTRY * entry_p)
+{
+    uint8_t         tail = irmp_queue_tail;
 
-#if IRMP_SUPPORT_BANG_OLUFSEN_PROTOCOL == 1
-                        if (irmp_param.protocol == IRMP_BANG_OLUFSEN_PROTOCOL)
-                        {
-                            ANALYZE_PRINTF3 ("pulse_r: %3d - %3d\n", irmp_param.pulse_0_len_min, irmp_param.pulse_0_len_max);
-                            ANALYZE_PRINTF3 ("pause_r: %3d - %3d\n", BANG_OLUFSEN_R_PAUSE_LEN_MIN, BANG_OLUFSEN_R_PAUSE_LEN_MAX);
-                        }
+    if (tail == irmp_queue_head)
+    {
+        return FALSE;
+    }
+
+    IRMP_QUEUE_BARRIER ();
+    *entry_p = irmp_queue[tail & (IRMP_FRAME_QUEUE_SIZE - 1)];
+    IRMP_QUEUE_BARRIER ();
+    irmp_queue_tail = tail + 1;
+#if IRMP_FRAME_BITS > 0
+    irmp_frame = entry_p->frame;
 #endif
+    return TRUE;
+}
 
-                        ANALYZE_PRINTF2 ("command_offset: %2d\n", irmp_param.command_offset);
-                        ANALYZE_PRINTF2 ("command_len:    %3d\n", irmp_param.command_end - irmp_param.command_offset);
-                        ANALYZE_PRINTF2 ("complete_len:   %3d\n", irmp_param.complete_len);
-                        ANALYZE_PRINTF2 ("stop_bit:       %3d\n", irmp_param.stop_bit);
-                    }
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ *  Get oldest frame from queue
+ *  @param    pointer in order to store IRMP data
+ *  @param    pointer in order to store the tick count at end of frame, may be 0
+ *  @return   TRUE: successful, FALSE: queue empty
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+static uint_fast8_t
+irmp_queue_get (IRMP_DATA * irmp_data_p, uint32_t * ticks_p)
+{
+    IRMP_QUEUE_ENTRY    entry;
 
-#if IRMP_SUPPORT_MANCHESTER == 1
-                    if ((irmp_param.flags & IRMP_PARAM_FLAG_IS_MANCHESTER) &&
-                         irmp_param.protocol != IRMP_RUWIDO_PROTOCOL && // Manchester, but not RUWIDO
-                         irmp_param.protocol != IRMP_RC6_PROTOCOL /*** &&    // Manchester, but not RC6
-                         irmp_param.protocol != IRMP_RCII_PROTOCOL ****/)     // Manchester, but not RCII
-                    {
-                        if (irmp_pause_time > irmp_param.pulse_1_len_max && irmp_pause_time <= 2 * irmp_param.pulse_1_len_max)
-                        {
-                            ANALYZE_PRINTF5 ("%8.3fms [bit %2d: pulse = %3d, pause = %3d] ", (double) (time_counter * 1000) / F_INTERRUPTS, irmp_bit, irmp_pulse_time, irmp_pause_time);
-                            ANALYZE_PUTCHAR ((irmp_param.flags & IRMP_PARAM_FLAG_1ST_PULSE_IS_1) ? '0' : '1');
-                            ANALYZE_NEWLINE ();
-                            irmp_store_bit ((irmp_param.flags & IRMP_PARAM_FLAG_1ST_PULSE_IS_1) ? 0 : 1);
-                        }
-                        else if (! last_value)  // && irmp_pause_time >= irmp_param.pause_1_len_min && irmp_pause_time <= irmp_param.pause_1_len_max)
-                        {
-                            ANALYZE_PRINTF5 ("%8.3fms [bit %2d: pulse = %3d, pause = %3d] ", (double) (time_counter * 1000) / F_INTERRUPTS, irmp_bit, irmp_pulse_time, irmp_pause_time);
-                            ANALYZE_PUTCHAR ((irmp_param.flags & IRMP_PARAM_FLAG_1ST_PULSE_IS_1) ? '1' : '0');
-                            ANALYZE_NEWLINE ();
-                            irmp_store_bit ((irmp_param.flags & IRMP_PARAM_FLAG_1ST_PULSE_IS_1) ? 1 : 0);
-                        }
-                    }
-                    else
-#endif // IRMP_SUPPORT_MANCHESTER == 1
+    if (! irmp_queue_get_entry (&entry))
+    {
+        return FALSE;
+    }
 
-#if IRMP_SUPPORT_SERIAL == 1
-                    if (irmp_param.flags & IRMP_PARAM_FLAG_IS_SERIAL)
-                    {
-                        ; // do nothing
-                    }
-                    else
-#endif // IRMP_SUPPORT_SERIAL == 1
+    *irmp_data_p = entry.data;
 
+    if (ticks_p)
+    {
+        *ticks_p = entry.ticks;
+    }
 
-#if IRMP_SUPPORT_DENON_PROTOCOL == 1
-                    if (irmp_param.protocol == IRMP_DENON_PROTOCOL)
-                    {
-                        ANALYZE_PRINTF5 ("%8.3fms [bit %2d: pulse = %3d, pause = %3d] ", (double) (time_counter * 1000) / F_INTERRUPTS, irmp_bit, irmp_pulse_time, irmp_pause_time);
+    return TRUE;
+}
 
-                        if (irmp_pause_time >= DENON_1_PAUSE_LEN_MIN && irmp_pause_time <= DENON_1_PAUSE_LEN_MAX)
-                        {                                                       // pause timings correct for "1"?
-                            ANALYZE_PUTCHAR ('1');                              // yes, store 1
-                            ANALYZE_NEWLINE ();
-                            irmp_store_bit (1);
-                        }
-                        else // if (irmp_pause_time >= DENON_0_PAUSE_LEN_MIN && irmp_pause_time <= DENON_0_PAUSE_LEN_MAX)
-                        {                                                       // pause timings correct for "0"?
-                            ANALYZE_PUTCHAR ('0');                              // yes, store 0
-                            ANALYZE_NEWLINE ();
-                            irmp_store_bit (0);
-                        }
-                    }
-                    else
-#endif // IRMP_SUPPORT_DENON_PROTOCOL == 1
-#if IRMP_SUPPORT_THOMSON_PROTOCOL == 1
-                    if (irmp_param.protocol == IRMP_THOMSON_PROTOCOL)
-                    {
-                        ANALYZE_PRINTF5 ("%8.3fms [bit %2d: pulse = %3d, pause = %3d] ", (double) (time_counter * 1000) / F_INTERRUPTS, irmp_bit, irmp_pulse_time, irmp_pause_time);
+static uint16_t
+irmp_queue_get_overflows (void)
+{
+    uint16_t        overflows;
 
-                        if (irmp_pause_time >= THOMSON_1_PAUSE_LEN_MIN && irmp_pause_time <= THOMSON_1_PAUSE_LEN_MAX)
-                        {                                                       // pause timings correct for "1"?
-                          ANALYZE_PUTCHAR ('1');                                // yes, store 1
-                          ANALYZE_NEWLINE ();
-                          irmp_store_bit (1);
-                        }
-                        else // if (irmp_pause_time >= THOMSON_0_PAUSE_LEN_MIN && irmp_pause_time <= THOMSON_0_PAUSE_LEN_MAX)
-                        {                                                       // pause timings correct for "0"?
-                          ANALYZE_PUTCHAR ('0');                                // yes, store 0
-                          ANALYZE_NEWLINE ();
-                          irmp_store_bit (0);
-                        }
-                    }
-                    else
-#endif // IRMP_SUPPORT_THOMSON_PROTOCOL == 1
-#if IRMP_SUPPORT_RF_GEN24_PROTOCOL == 1
-                    if (irmp_param.protocol == RF_GEN24_PROTOCOL)
-                    {
-                        ANALYZE_PRINTF5 ("%8.3fms [bit %2d: pulse = %3d, pause = %3d] ", (double) (time_counter * 1000) / F_INTERRUPTS, irmp_bit, irmp_pulse_time, irmp_pause_time);
-                        ANALYZE_PUTCHAR (bit_0 + '0');
-                        ANALYZE_NEWLINE ();
-                        irmp_store_bit (bit_0);                                 // start bit is data bit
-                    }
-                    else
-#endif // IRMP_SUPPORT_RF_GEN24_PROTOCOL == 1
-                    {
-                        ;                                                       // else do nothing
-                    }
+    do
+    {
+        overflows = irmp_queue_overflows;
+    } while (overflows != irmp_queue_overflows);                            // 16 bit access is not atomic on 8 bit CPUs
 
-                    irmp_pulse_time = 1;                                        // set counter to 1, not 0
-                    irmp_pause_time = 0;
-                    wait_for_start_space = 0;
-                }
-            }
-            else if (wait_for_space)                                            // the data section....
-            {                                                                   // counting the time of darkness....
-                uint_fast8_t got_light = FALSE;
+    return overflows;
+}
 
-                if (irmp_input)                                                 // still dark?
-                {                                                               // yes...
-                    irmp_pause_time++;                                          // increment counter
+#if IRMP_ENABLE_CONTEXT == 1
+static uint_fast8_t
+irmp_get_data_current (IRMP_DATA * irmp_data_p)                         // works on irmp_ctx, see irmp_get_data_ctx()
+{
+    return irmp_queue_get (irmp_data_p, (uint32_t *) 0);
+}
+#else
+#  ifdef __cplusplus
+bool
+#else
+uint_fast8_t
+#endif
+irmp_get_data (IRMP_DATA * irmp_data_p)
+{
+    return irmp_queue_get (irmp_data_p, (uint32_t *) 0);
+}
 
-                    if (irmp_bit == irmp_param.complete_len && irmp_param.stop_bit == 1 && irmp_pause_time > ((irmp_param.flags & IRMP_PARAM_FLAG_IS_MANCHESTER) ? 0 : STOP_BIT_PAUSE_LEN_MIN))
-                    {
-                        if (
-#if IRMP_SUPPORT_MANCHESTER == 1
-                            (irmp_param.flags & IRMP_PARAM_FLAG_IS_MANCHESTER) ||
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ *  Get IRMP data and time of the frame
+ *  @details  same as irmp_get_data(), but also returns the tick count (1 / F_INTERRUPTS) at the end of the frame,
+ *            the frame may have been received a while ago
+ *  @param    pointer in order to store IRMP data
+ *  @param    pointer in order to store the tick count
+ *  @return   TRUE: successful, FALSE: failed
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+#  ifdef __cplusplus
+bool
+#else
+uint_fast8_t
 #endif
-#if IRMP_SUPPORT_SERIAL == 1
-                            (irmp_param.flags & IRMP_PARAM_FLAG_IS_SERIAL) ||
+irmp_get_data_timestamp (IRMP_DATA * irmp_data_p, uint32_t * ticks_p)
+{
+    return irmp_queue_get (irmp_data_p, ticks_p);
+}
+
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ *  Get number of lost frames
+ *  @return   number of frames lost because the queue was full, stops at 0xFFFF
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+uint16_t
+irmp_get_queue_overflows (void)
+{
+    return irmp_queue_get_overflows ();
+}
+#endif // IRMP_ENABLE_CONTEXT == 1
+#endif // IRMP_FRAME_QUEUE_SIZE > 0
+
+#if IRMP_ENABLE_DATA_EX == 1
+static uint_fast8_t
+irmp_get_data_ex_current (IRMP_DATA_EX * irmp_data_ex_p)                 // works on irmp_ctx, see irmp_get_data_ex_ctx()
+{
+    uint_fast8_t        rtc;
+#if IRMP_FRAME_QUEUE_SIZE > 0
+    IRMP_QUEUE_ENTRY    entry;
+
+    rtc = irmp_queue_get_entry (&entry);
+
+    if (rtc)
+    {
+        irmp_data_ex_p->data        = entry.data;
+        irmp_data_ex_p->start_ticks = entry.start_ticks;
+        irmp_data_ex_p->end_ticks   = entry.ticks;
+        irmp_data_ex_p->gap_ticks   = entry.gap_ticks;
+    }
+#else
+    rtc = FALSE;
+
+    if (irmp_ir_detected)
+    {                                                                       // irmp_ISR() does not change them until irmp_get_data() clears irmp_ir_detected
+        irmp_data_ex_p->start_ticks = irmp_frame_start_ticks;
+        irmp_data_ex_p->end_ticks   = irmp_frame_end_ticks;
+        irmp_data_ex_p->gap_ticks   = irmp_frame_gap_ticks;
+#  if IRMP_ENABLE_CONTEXT == 1
+        rtc = irmp_get_data_current (&irmp_data_ex_p->data);
+#  else
+        rtc = irmp_get_data (&irmp_data_ex_p->data);
+#  endif
+    }
 #endif
-                            (irmp_pulse_time >= irmp_param.pulse_0_len_min && irmp_pulse_time <= irmp_param.pulse_0_len_max))
-                        {
-                            if (! (irmp_param.flags & IRMP_PARAM_FLAG_IS_MANCHESTER))
-                            {
-                                ANALYZE_PRINTF1 ("stop bit detected\n");
 
-#if IRMP_SUPPORT_MELINERA_PROTOCOL == 1
-                                if (irmp_param.protocol == IRMP_MELINERA_PROTOCOL)
-                                {
-                                    irmp_tmp_command = irmp_melinera_command;  // set command
-                                    irmp_tmp_address = 0;                      // no address
-                                }
+#if IRMP_FRAME_BITS > 0
+    if (rtc)
+    {                                                                       // irmp_frame is the frame just returned
+        irmp_data_ex_p->payload_len = irmp_frame.len;
+        memcpy (irmp_data_ex_p->payload, irmp_frame.bits, IRMP_FRAME_BITS / 8);
+        memset (irmp_data_ex_p->payload + IRMP_FRAME_BITS / 8, 0, (IRMP_PAYLOAD_BITS - IRMP_FRAME_BITS) / 8);
+    }
+#else
+    irmp_data_ex_p->payload_len = 0;
 #endif
-                            }
+    return rtc;
+}
 
-                            irmp_param.stop_bit = 0;
-                        }
-                        else
-                        {
-                            ANALYZE_PRINTF5 ("error: stop bit timing wrong, irmp_bit = %d, irmp_pulse_time = %d, pulse_0_len_min = %d, pulse_0_len_max = %d\n",
-                                            irmp_bit, irmp_pulse_time, irmp_param.pulse_0_len_min, irmp_param.pulse_0_len_max);
-                            irmp_start_bit_detected = 0;                        // wait for another start bit...
-                            irmp_pulse_time         = 0;
-                            irmp_pause_time         = 0;
-                        }
-                    }
-                    else
+#if IRMP_ENABLE_CONTEXT == 0
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ *  Get IRMP data with timestamps
+ *  @details  same as irmp_get_data(), but also returns the tick count (1 / F_INTERRUPTS) at begin of start bit, at end of frame
+ *            and the gap to the end of the previous frame. Latency is irmp_get_ticks() - end_ticks.
+ *            With IRMP_FRAME_BITS, payload holds the data bits of the frame, e.g. the whole state of an air conditioner.
+ *  @param    pointer in order to store IRMP data and timestamps
+ *  @return   TRUE: successful, FALSE: failed
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+#  ifdef __cplusplus
+bool
+#else
+uint_fast8_t
+#endif
+irmp_get_data_ex (IRMP_DATA_EX * irmp_data_ex_p)
+{
+    return irmp_get_data_ex_current (irmp_data_ex_p);
+}
 
-#if IRMP_SUPPORT_SIRCS_PROTOCOL == 1
-                    if (irmp_param.protocol == IRMP_SIRCS_PROTOCOL &&                           // Sony has a variable number of bits:
-                        irmp_pause_time > SIRCS_PAUSE_LEN_MAX &&                                // minimum is 12
-                        irmp_bit >= 12 - 1)                                                     // pause too long?
-                    {                                                                           // yes, break and close this frame
-                        irmp_param.complete_len = irmp_bit + 1;                                 // set new complete length
-                        got_light = TRUE;                                                       // this is a lie, but helps (generates stop bit)
-                        irmp_tmp_address |= (irmp_bit - SIRCS_MINIMUM_DATA_LEN + 1) << 8;       // new: store number of additional bits in upper byte of address!
-                        irmp_param.command_end = irmp_param.command_offset + irmp_bit + 1;      // correct command length
-                        irmp_pause_time = SIRCS_PAUSE_LEN_MAX - 1;                              // correct pause length
-                    }
-                    else
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ *  Get tick count
+ *  @return   number of irmp_ISR() calls since start, wraps around after 2^32 ticks
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+uint32_t
+irmp_get_ticks (void)
+{
+    return irmp_get_ticks_current ();
+}
+#endif // IRMP_ENABLE_CONTEXT == 0
+#endif // IRMP_ENABLE_DATA_EX == 1
+
+#if IRMP_USE_CALLBACK == 1
+void
+irmp_set_callback_ptr (void (*cb)(uint_fast8_t))
+{
+    irmp_callback_ptr = cb;
+}
+#endif // IRMP_USE_CALLBACK == 1
+
+#if IRMP_ENABLE_CONTEXT == 0
+// these statics must not be volatile, because they are only used by irmp_store_bit(), which is called by irmp_ISR()
+static uint_fast16_t irmp_tmp_address;                                      // ir address
+#if IRMP_32_BIT == 1
+static uint_fast32_t irmp_tmp_command;                                      // ir command
+#else
+static uint_fast16_t irmp_tmp_command;                                      // ir command
 #endif
-#if IRMP_SUPPORT_MERLIN_PROTOCOL == 1
-                    if (irmp_param.protocol == IRMP_MERLIN_PROTOCOL &&                          // Merlin has a variable number of bits:
-                        irmp_pause_time > MERLIN_START_BIT_PAUSE_LEN_MAX &&                     // minimum is 8
-                        irmp_bit >= 8 - 1)                                                      // pause too long?
-                    {                                                                           // yes, break and close this frame
-                        irmp_param.complete_len = irmp_bit;                                     // set new complete length
-                        got_light = TRUE;                                                       // this is a lie, but helps (generates stop bit)
-                        irmp_pause_time = MERLIN_BIT_PAUSE_LEN_MAX - 1;                         // correct pause length
-                    }
-                    else
+
+#if (IRMP_SUPPORT_RC5_PROTOCOL == 1 && (IRMP_SUPPORT_FDC_PROTOCOL == 1 || IRMP_SUPPORT_RCCAR_PROTOCOL == 1)) || IRMP_SUPPORT_NEC42_PROTOCOL == 1
+static uint_fast16_t irmp_tmp_address2;                                     // ir address
+static uint_fast16_t irmp_tmp_command2;                                     // ir command
 #endif
-#if IRMP_SUPPORT_FAN_PROTOCOL == 1
-                    if (irmp_param.protocol == IRMP_FAN_PROTOCOL &&                             // FAN has no stop bit.
-                        irmp_bit >= FAN_COMPLETE_DATA_LEN - 1)                                  // last bit in frame
-                    {                                                                           // yes, break and close this frame
-                        if (irmp_pulse_time <= FAN_0_PULSE_LEN_MAX && irmp_pause_time >= FAN_0_PAUSE_LEN_MIN)
-                        {
-                            ANALYZE_PRINTF1 ("Generating virtual stop bit\n");
-                            got_light = TRUE;                                                   // this is a lie, but helps (generates stop bit)
-                        }
-                        else if (irmp_pulse_time >= FAN_1_PULSE_LEN_MIN && irmp_pause_time >= FAN_1_PAUSE_LEN_MIN)
-                        {
-                            ANALYZE_PRINTF1 ("Generating virtual stop bit\n");
-                            got_light = TRUE;                                                   // this is a lie, but helps (generates stop bit)
-                        }
-                    }
-                    else
+
+#if IRMP_FRAME_BITS == 0
+#if IRMP_SUPPORT_LGAIR_PROTOCOL == 1
+static uint_fast16_t irmp_lgair_address;                                    // ir address
+static uint_fast16_t irmp_lgair_command;                                    // ir command
 #endif
-#if IRMP_SUPPORT_SERIAL == 1
-                    // NETBOX generates no stop bit, here is the timeout condition:
-                    if ((irmp_param.flags & IRMP_PARAM_FLAG_IS_SERIAL) && irmp_param.protocol == IRMP_NETBOX_PROTOCOL &&
-                        irmp_pause_time >= NETBOX_PULSE_LEN * (NETBOX_COMPLETE_DATA_LEN - irmp_bit))
-                    {
-                        got_light = TRUE;                                                       // this is a lie, but helps (generates stop bit)
-                    }
-                    else
+
+#if IRMP_SUPPORT_MELINERA_PROTOCOL == 1
+static uint_fast16_t irmp_melinera_command;                                 // ir command
 #endif
-#if IRMP_SUPPORT_GRUNDIG_NOKIA_IR60_PROTOCOL == 1
-                    if (irmp_param.protocol == IRMP_GRUNDIG_PROTOCOL && !irmp_param.stop_bit)
-                    {
-                        if (irmp_pause_time > IR60_TIMEOUT_LEN && (irmp_bit == 5 || irmp_bit == 6))
-                        {
-                            ANALYZE_PRINTF1 ("Switching to IR60 protocol\n");
-                            got_light = TRUE;                                       // this is a lie, but generates a stop bit ;-)
-                            irmp_param.stop_bit = TRUE;                             // set flag
+#endif // IRMP_FRAME_BITS == 0
 
-                            irmp_param.protocol         = IRMP_IR60_PROTOCOL;       // change protocol
-                            irmp_param.complete_len     = IR60_COMPLETE_DATA_LEN;   // correct complete len
-                            irmp_param.address_offset   = IR60_ADDRESS_OFFSET;
-                            irmp_param.address_end      = IR60_ADDRESS_OFFSET + IR60_ADDRESS_LEN;
-                            irmp_param.command_offset   = IR60_COMMAND_OFFSET;
-                            irmp_param.command_end      = IR60_COMMAND_OFFSET + IR60_COMMAND_LEN;
+#if IRMP_SUPPORT_SAMSUNG_PROTOCOL == 1
+static uint_fast16_t irmp_tmp_id;                                           // ir id (only SAMSUNG)
+#endif
+#if IRMP_SUPPORT_KASEIKYO_PROTOCOL == 1
+static uint8_t      xor_check[6];                                           // check kaseikyo "parity" bits
+static uint_fast8_t genre2;                                                 // save genre2 bits here, later copied to MSB in flags
+#endif
 
-                            irmp_tmp_command <<= 1;
-                            irmp_tmp_command |= first_bit;
-                        }
-                        else if (irmp_pause_time >= 2 * irmp_param.pause_1_len_max && irmp_bit >= GRUNDIG_COMPLETE_DATA_LEN - 2)
-                        {                                                           // special manchester decoder
-                            irmp_param.complete_len = GRUNDIG_COMPLETE_DATA_LEN;    // correct complete len
-                            got_light = TRUE;                                       // this is a lie, but generates a stop bit ;-)
-                            irmp_param.stop_bit = TRUE;                             // set flag
-                        }
-                        else if (irmp_bit >= GRUNDIG_COMPLETE_DATA_LEN)
-                        {
-                            ANALYZE_PRINTF2 ("Switching to NOKIA protocol, irmp_bit = %d\n", irmp_bit);
-                            irmp_param.protocol         = IRMP_NOKIA_PROTOCOL;      // change protocol
-                            irmp_param.address_offset   = NOKIA_ADDRESS_OFFSET;
-                            irmp_param.address_end      = NOKIA_ADDRESS_OFFSET + NOKIA_ADDRESS_LEN;
-                            irmp_param.command_offset   = NOKIA_COMMAND_OFFSET;
-                            irmp_param.command_end      = NOKIA_COMMAND_OFFSET + NOKIA_COMMAND_LEN;
+#if IRMP_SUPPORT_ORTEK_PROTOCOL == 1
+static uint_fast8_t  parity;                                                // number of '1' of the first 14 bits, check if even.
+#endif
 
-                            if (irmp_tmp_command & 0x300)
-                            {
-                                irmp_tmp_address = (irmp_tmp_command >> 8);
-                                irmp_tmp_command &= 0xFF;
-                            }
-                        }
-                    }
-                    else
+#if IRMP_SUPPORT_MITSU_HEAVY_PROTOCOL == 1
+static uint_fast8_t  check;                                                 // number of '1' of the first 14 bits, check if even.
+static uint_fast8_t  mitsu_parity;                                          // number of '1' of the first 14 bits, check if even.
 #endif
-#if IRMP_SUPPORT_SIEMENS_OR_RUWIDO_PROTOCOL == 1
-                    if (irmp_param.protocol == IRMP_RUWIDO_PROTOCOL && !irmp_param.stop_bit)
-                    {
-                        if (irmp_pause_time >= 2 * irmp_param.pause_1_len_max && irmp_bit >= RUWIDO_COMPLETE_DATA_LEN - 2)
-                        {                                                           // special manchester decoder
-                            irmp_param.complete_len = RUWIDO_COMPLETE_DATA_LEN;     // correct complete len
-                            got_light = TRUE;                                       // this is a lie, but generates a stop bit ;-)
-                            irmp_param.stop_bit = TRUE;                             // set flag
-                        }
-                        else if (irmp_bit >= RUWIDO_COMPLETE_DATA_LEN)
-                        {
-                            ANALYZE_PRINTF1 ("Switching to SIEMENS protocol\n");
-                            irmp_param.protocol         = IRMP_SIEMENS_PROTOCOL;    // change protocol
-                            irmp_param.address_offset   = SIEMENS_ADDRESS_OFFSET;
-                            irmp_param.address_end      = SIEMENS_ADDRESS_OFFSET + SIEMENS_ADDRESS_LEN;
-                            irmp_param.command_offset   = SIEMENS_COMMAND_OFFSET;
-                            irmp_param.command_end      = SIEMENS_COMMAND_OFFSET + SIEMENS_COMMAND_LEN;
-
-                            //                   76543210
-                            // RUWIDO:  AAAAAAAAACCCCCCCp
-                            // SIEMENS: AAAAAAAAAAACCCCCCCCCCp
-                            irmp_tmp_address <<= 2;
-                            irmp_tmp_address |= (irmp_tmp_command >> 6);
-                            irmp_tmp_command &= 0x003F;
-                            irmp_tmp_command |= last_value;
-                        }
-                    }
-                    else
-#endif
-#if IRMP_SUPPORT_ROOMBA_PROTOCOL == 1
-                    if (irmp_param.protocol == IRMP_ROOMBA_PROTOCOL &&                          // Roomba has no stop bit
-                        irmp_bit >= ROOMBA_COMPLETE_DATA_LEN - 1)                               // it's the last data bit...
-                    {                                                                           // break and close this frame
-                        if (irmp_pulse_time >= ROOMBA_1_PULSE_LEN_MIN && irmp_pulse_time <= ROOMBA_1_PULSE_LEN_MAX)
-                        {
-                            irmp_pause_time = ROOMBA_1_PAUSE_LEN_EXACT;
-                        }
-                        else if (irmp_pulse_time >= ROOMBA_0_PULSE_LEN_MIN && irmp_pulse_time <= ROOMBA_0_PULSE_LEN_MAX)
-                        {
-                            irmp_pause_time = ROOMBA_0_PAUSE_LEN;
-                        }
+#endif // IRMP_ENABLE_CONTEXT == 0
 
-                        got_light = TRUE;                                                       // this is a lie, but helps (generates stop bit)
-                    }
-                    else
-#endif
-#if IRMP_SUPPORT_MANCHESTER == 1
-                    if ((irmp_param.flags & IRMP_PARAM_FLAG_IS_MANCHESTER) &&
-                        (irmp_param.protocol != IRMP_RC6_PROTOCOL || irmp_param.complete_len != RC6_COMPLETE_DATA_LEN_LONG) && // not RC6A
-                        irmp_pause_time >= 2 * irmp_param.pause_1_len_max && irmp_bit >= irmp_param.complete_len - 2 && !irmp_param.stop_bit)
-                    {                                                       // special manchester decoder
-                        got_light = TRUE;                                   // this is a lie, but generates a stop bit ;-)
-                        irmp_param.stop_bit = TRUE;                         // set flag
-                    }
-                    else if ((irmp_param.flags & IRMP_PARAM_FLAG_IS_MANCHESTER) &&
-                        irmp_param.protocol == IRMP_RC6_PROTOCOL && irmp_param.complete_len == RC6_COMPLETE_DATA_LEN_LONG && // RC6A
-                            irmp_pause_time >= 2 * irmp_param.pause_1_len_max) // this pause indicates the end
-                    {                                                       // special manchester decoder
-                        got_light = TRUE;                                   // this is a lie, but generates a stop bit ;-)
-                        irmp_param.stop_bit = TRUE;                         // set flag
-                        irmp_param.complete_len = irmp_bit + 1;             // at least 1 more bit will be added at last position
-                    }
-                    else
-#endif // IRMP_SUPPORT_MANCHESTER == 1
-                    if (irmp_pause_time > IRMP_TIMEOUT_LEN)                 // timeout?
-                    {                                                       // yes...
-                        if (irmp_bit == irmp_param.complete_len - 1 && irmp_param.stop_bit == 0)
-                        {
-                            irmp_bit++;
-                        }
-#if IRMP_SUPPORT_NEC_PROTOCOL == 1
-                        else if ((irmp_param.protocol == IRMP_NEC_PROTOCOL || irmp_param.protocol == IRMP_NEC42_PROTOCOL) && irmp_bit == 0)
-                        {                                                               // it was a non-standard repetition frame
-                            ANALYZE_PRINTF1 ("Detected non-standard repetition frame, switching to NEC repetition\n");
-                            if (key_repetition_len < NEC_FRAME_REPEAT_PAUSE_LEN_MAX)
-                            {
-                                irmp_param.stop_bit     = TRUE;                         // set flag
-                                irmp_param.protocol     = IRMP_NEC_PROTOCOL;            // switch protocol
-                                irmp_param.complete_len = irmp_bit;                     // patch length: 16 or 17
-                                irmp_tmp_address = last_irmp_address;                   // address is last address
-                                irmp_tmp_command = last_irmp_command;                   // command is last command
-                                irmp_flags |= IRMP_FLAG_REPETITION;
-                                key_repetition_len = 0;
-                            }
-                            else
-                            {
-                                ANALYZE_PRINTF3 ("ignoring NEC repetition frame: timeout occured, key_repetition_len = %u > %u\n",
-                                                (unsigned int) key_repetition_len, (unsigned int) NEC_FRAME_REPEAT_PAUSE_LEN_MAX);
-                                irmp_ir_detected = FALSE;
-                            }
-                        }
-#endif // IRMP_SUPPORT_NEC_PROTOCOL == 1
-#if IRMP_SUPPORT_JVC_PROTOCOL == 1
-                        else if (irmp_param.protocol == IRMP_NEC_PROTOCOL && (irmp_bit == 16 || irmp_bit == 17))      // it was a JVC stop bit
-                        {
-                            ANALYZE_PRINTF2 ("Switching to JVC protocol, irmp_bit = %d\n", irmp_bit);
-                            irmp_param.stop_bit     = TRUE;                                     // set flag
-                            irmp_param.protocol     = IRMP_JVC_PROTOCOL;                        // switch protocol
-                            irmp_param.complete_len = irmp_bit;                                 // patch length: 16 or 17
-                            irmp_tmp_command        = (irmp_tmp_address >> 4);                  // set command: upper 12 bits are command bits
-                            irmp_tmp_address        = irmp_tmp_address & 0x000F;                // lower 4 bits are address bits
-                            irmp_start_bit_detected = 1;                                        // tricky: don't wait for another start bit...
-                        }
-#endif // IRMP_SUPPORT_JVC_PROTOCOL == 1
-#if IRMP_SUPPORT_LGAIR_PROTOCOL == 1
-                        else if (irmp_param.protocol == IRMP_NEC_PROTOCOL && (irmp_bit == 28 || irmp_bit == 29))      // it was a LGAIR stop bit
-                        {
-                            ANALYZE_PRINTF2 ("Switching to LGAIR protocol, irmp_bit = %d\n", irmp_bit);
-                            irmp_param.stop_bit     = TRUE;                                     // set flag
-                            irmp_param.protocol     = IRMP_LGAIR_PROTOCOL;                      // switch protocol
-                            irmp_param.complete_len = irmp_bit;                                 // patch length: 16 or 17
-                            irmp_tmp_command        = irmp_lgair_command;                       // set command: upper 8 bits are command bits
-                            irmp_tmp_address        = irmp_lgair_address;                       // lower 4 bits are address bits
-                            irmp_start_bit_detected = 1;                                        // tricky: don't wait for another start bit...
-                        }
-#endif // IRMP_SUPPORT_LGAIR_PROTOCOL == 1
+#if IRMP_SYMBOL_LUT_LEN > 0
+#define IRMP_SYMBOL_0                           0x01                    // pulse and pause fit a "0"
+#define IRMP_SYMBOL_1                           0x02                    // pulse and pause fit a "1"
+#define IRMP_SYMBOL_PAUSE_SHIFT                 2                       // bits 2 and 3 of a table entry are for the pause
 
-#if IRMP_SUPPORT_NEC42_PROTOCOL == 1
-#if IRMP_SUPPORT_NEC_PROTOCOL == 1
-                        else if (irmp_param.protocol == IRMP_NEC42_PROTOCOL && irmp_bit == 32)      // it was a NEC stop bit
-                        {
-                            ANALYZE_PRINTF1 ("Switching to NEC protocol\n");
-                            irmp_param.stop_bit     = TRUE;                                     // set flag
-                            irmp_param.protocol     = IRMP_NEC_PROTOCOL;                        // switch protocol
-                            irmp_param.complete_len = irmp_bit;                                 // patch length: 16 or 17
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ *  Set range in symbol table
+ *  @details  sets mask in the entries min ... max, as far as they exist
+ *  @param    min length in ticks
+ *  @param    max length in ticks
+ *  @param    mask to set
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+static void
+irmp_symbol_lut_set (uint_fast16_t min, uint_fast16_t max, uint_fast8_t mask)
+{
+    for ( ; min <= max && min < IRMP_SYMBOL_LUT_LEN; min++)
+    {
+        irmp_symbol_lut[min] |= mask;
+    }
+}
 
-                            //        0123456789ABC0123456789ABC0123456701234567
-                            // NEC42: AAAAAAAAAAAAAaaaaaaaaaaaaaCCCCCCCCcccccccc
-                            // NEC:   AAAAAAAAaaaaaaaaCCCCCCCCcccccccc
-                            irmp_tmp_address        |= (irmp_tmp_address2 & 0x0007) << 13;      // fm 2012-02-13: 12 -> 13
-                            irmp_tmp_command        = (irmp_tmp_address2 >> 3) | (irmp_tmp_command << 10);
-                        }
-#endif // IRMP_SUPPORT_NEC_PROTOCOL == 1
-#if IRMP_SUPPORT_LGAIR_PROTOCOL == 1
-                        else if (irmp_param.protocol == IRMP_NEC42_PROTOCOL && irmp_bit == 28)      // it was a NEC stop bit
-                        {
-                            ANALYZE_PRINTF1 ("Switching to LGAIR protocol\n");
-                            irmp_param.stop_bit     = TRUE;                                     // set flag
-                            irmp_param.protocol     = IRMP_LGAIR_PROTOCOL;                      // switch protocol
-                            irmp_param.complete_len = irmp_bit;                                 // patch length: 16 or 17
-                            irmp_tmp_address        = irmp_lgair_address;
-                            irmp_tmp_command        = irmp_lgair_command;
-                        }
-#endif // IRMP_SUPPORT_LGAIR_PROTOCOL == 1
-#if IRMP_SUPPORT_JVC_PROTOCOL == 1
-                        else if (irmp_param.protocol == IRMP_NEC42_PROTOCOL && (irmp_bit == 16 || irmp_bit == 17))  // it was a JVC stop bit
-                        {
-                            ANALYZE_PRINTF2 ("Switching to JVC protocol, irmp_bit = %d\n", irmp_bit);
-                            irmp_param.stop_bit     = TRUE;                                     // set flag
-                            irmp_param.protocol     = IRMP_JVC_PROTOCOL;                        // switch protocol
-                            irmp_param.complete_len = irmp_bit;                                 // patch length: 16 or 17
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ *  Fill symbol table
+ *  @details  called when irmp_param gets the timings of a pulse distance or pulse width protocol. Entry n tells which of the
+ *            timing ranges contain n ticks: bit 0 pulse of "0", bit 1 pulse of "1", bit 2 pause of "0", bit 3 pause of "1".
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+static void
+irmp_symbol_lut_fill (void)
+{
+    memset (irmp_symbol_lut, 0, IRMP_SYMBOL_LUT_LEN);
+    irmp_symbol_lut_set (irmp_param.pulse_0_len_min, irmp_param.pulse_0_len_max, IRMP_SYMBOL_0);
+    irmp_symbol_lut_set (irmp_param.pulse_1_len_min, irmp_param.pulse_1_len_max, IRMP_SYMBOL_1);
+    irmp_symbol_lut_set (irmp_param.pause_0_len_min, irmp_param.pause_0_len_max, IRMP_SYMBOL_0 << IRMP_SYMBOL_PAUSE_SHIFT);
+    irmp_symbol_lut_set (irmp_param.pause_1_len_min, irmp_param.pause_1_len_max, IRMP_SYMBOL_1 << IRMP_SYMBOL_PAUSE_SHIFT);
+}
 
-                            //        0123456789ABC0123456789ABC0123456701234567
-                            // NEC42: AAAAAAAAAAAAAaaaaaaaaaaaaaCCCCCCCCcccccccc
-                            // JVC:   AAAACCCCCCCCCCCC
-                            irmp_tmp_command        = (irmp_tmp_address >> 4) | (irmp_tmp_address2 << 9);   // set command: upper 12 bits are command bits
-                            irmp_tmp_address        = irmp_tmp_address & 0x000F;                            // lower 4 bits are address bits
-                        }
-#endif // IRMP_SUPPORT_JVC_PROTOCOL == 1
-#endif // IRMP_SUPPORT_NEC42_PROTOCOL == 1
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ *  Get symbol of data bit
+ *  @details  looks up the pulse and pause lengths in the symbol table, longer ones are compared with irmp_param
+ *  @param    pulse length in ticks
+ *  @param    pause length in ticks
+ *  @return   IRMP_SYMBOL_1 and/or IRMP_SYMBOL_0 if the timings fit, else 0
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+static uint_fast8_t
+irmp_symbol_get (uint_fast16_t pulse_time, uint_fast16_t pause_time)
+{
+    uint_fast8_t pulse_mask;
+    uint_fast8_t pause_mask;
 
-#if IRMP_SUPPORT_SAMSUNG48_PROTOCOL == 1
-                        else if (irmp_param.protocol == IRMP_SAMSUNG48_PROTOCOL && irmp_bit == 32)          // it was a SAMSUNG32 stop bit
-                        {
-                            ANALYZE_PRINTF1 ("Switching to SAMSUNG32 protocol\n");
-                            irmp_param.protocol         = IRMP_SAMSUNG32_PROTOCOL;
-                            irmp_param.command_offset   = SAMSUNG32_COMMAND_OFFSET;
-                            irmp_param.command_end      = SAMSUNG32_COMMAND_OFFSET + SAMSUNG32_COMMAND_LEN;
-                            irmp_param.complete_len     = SAMSUNG32_COMPLETE_DATA_LEN;
-                        }
-#endif // IRMP_SUPPORT_SAMSUNG_PROTOCOL == 1
+    if (pulse_time < IRMP_SYMBOL_LUT_LEN)
+    {
+        pulse_mask = irmp_symbol_lut[pulse_time];
+    }
+    else
+    {
+        pulse_mask = ((pulse_time >= irmp_param.pulse_0_len_min && pulse_time <= irmp_param.pulse_0_len_max) ? IRMP_SYMBOL_0 : 0) |
+                     ((pulse_time >= irmp_param.pulse_1_len_min && pulse_time <= irmp_param.pulse_1_len_max) ? IRMP_SYMBOL_1 : 0);
+    }
 
-#if IRMP_SUPPORT_RCMM_PROTOCOL == 1
-                        else if (irmp_param.protocol == IRMP_RCMM32_PROTOCOL && (irmp_bit == 12 || irmp_bit == 24))  // it was a RCMM stop bit
-                        {
-                            if (irmp_bit == 12)
-                            {
-                                irmp_tmp_command = (irmp_tmp_address & 0xFF);                   // set command: lower 8 bits are command bits
-                                irmp_tmp_address >>= 8;                                         // upper 4 bits are address bits
+    if (pause_time < IRMP_SYMBOL_LUT_LEN)
+    {
+        pause_mask = irmp_symbol_lut[pause_time] >> IRMP_SYMBOL_PAUSE_SHIFT;
+    }
+    else
+    {
+        pause_mask = ((pause_time >= irmp_param.pause_0_len_min && pause_time <= irmp_param.pause_0_len_max) ? IRMP_SYMBOL_0 : 0) |
+                     ((pause_time >= irmp_param.pause_1_len_min && pause_time <= irmp_param.pause_1_len_max) ? IRMP_SYMBOL_1 : 0);
+    }
 
-                                ANALYZE_PRINTF2 ("Switching to RCMM12 protocol, irmp_bit = %d\n", irmp_bit);
-                                irmp_param.protocol     = IRMP_RCMM12_PROTOCOL;                 // switch protocol
-                            }
-                            else // if ((irmp_bit == 24)
-                            {
-                                ANALYZE_PRINTF2 ("Switching to RCMM24 protocol, irmp_bit = %d\n", irmp_bit);
-                                irmp_param.protocol     = IRMP_RCMM24_PROTOCOL;                 // switch protocol
-                            }
-                            irmp_param.stop_bit     = TRUE;                                     // set flag
-                            irmp_param.complete_len = irmp_bit;                                 // patch length
-                        }
-#endif // IRMP_SUPPORT_RCMM_PROTOCOL == 1
+    return pulse_mask & pause_mask;
+}
+#endif // IRMP_SYMBOL_LUT_LEN > 0
 
-#if IRMP_SUPPORT_TECHNICS_PROTOCOL == 1
-                        else if (irmp_param.protocol == IRMP_MATSUSHITA_PROTOCOL && irmp_bit == 22)  // it was a TECHNICS stop bit
-                        {
-                            ANALYZE_PRINTF2 ("Switching to TECHNICS protocol, irmp_bit = %d\n", irmp_bit);
-                            // Situation:
-                            // The first 12 bits have been stored in irmp_tmp_command (LSB first)
-                            // The following 10 bits have been stored in irmp_tmp_address (LSB first)
-                            // The code of TECHNICS is:
-                            //   cccccccccccCCCCCCCCCCC (11 times c and 11 times C)
-                            //   ccccccccccccaaaaaaaaaa
-                            // where C is inverted value of c
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ *  store bit
+ *  @details  store bit in temp address or temp command
+ *  @param    value to store: 0 or 1
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+// verhindert, dass irmp_store_bit() inline compiliert wird:
+// static void irmp_store_bit (uint_fast8_t) __attribute__ ((noinline));
 
-                            irmp_tmp_address <<= 1;
-                            if (irmp_tmp_command & (1<<11))
-                            {
-                                irmp_tmp_address |= 1;
-                                irmp_tmp_command &= ~(1<<11);
-                            }
+static void
+irmp_store_bit (uint_fast8_t value)
+{
+#if IRMP_FRAME_BITS > 0
+    if (value && irmp_bit < IRMP_FRAME_BITS)                                                        // buffer is cleared at start bit
+    {
+        irmp_frame_acc[irmp_bit >> 3] |= 0x80 >> (irmp_bit & 0x07);
+    }
+#endif
 
-                            if (irmp_tmp_command == ((~irmp_tmp_address) & 0x07FF))
-                            {
-                                irmp_tmp_address = 0;
+#if IRMP_SUPPORT_ACP24_PROTOCOL == 1 && IRMP_FRAME_BITS < 128                                      // else see irmp_acp24_get_command()
+    if (irmp_param.protocol == IRMP_ACP24_PROTOCOL)                                                 // squeeze 64 bits into 16 bits:
+    {
+        if (value)
+        {
+            // ACP24-Frame:
+            //           1         2         3         4         5         6
+            // 0123456789012345678901234567890123456789012345678901234567890123456789
+            // N VVMMM    ? ???    t vmA x                 y                     TTTT
+            //
+            // irmp_data_p->command:
+            //
+            //         5432109876543210
+            //         NAVVvMMMmtxyTTTT
 
-                                irmp_param.protocol     = IRMP_TECHNICS_PROTOCOL;                   // switch protocol
-                                irmp_param.complete_len = irmp_bit;                                 // patch length
-                            }
-                            else
-                            {
-                                ANALYZE_PRINTF1 ("error 8: TECHNICS frame error\n");
-                                ANALYZE_ONLY_NORMAL_PUTCHAR ('\n');
-                                irmp_start_bit_detected = 0;                    // wait for another start bit...
-                                irmp_pulse_time         = 0;
-                                irmp_pause_time         = 0;
-                            }
-                        }
-#endif // IRMP_SUPPORT_TECHNICS_PROTOCOL == 1
-                        else
-                        {
-                            ANALYZE_PRINTF3 ("error 2: pause %d after data bit %d too long\n", irmp_pause_time, irmp_bit);
-                            ANALYZE_ONLY_NORMAL_PUTCHAR ('\n');
-                            irmp_start_bit_detected = 0;                    // wait for another start bit...
-                            irmp_pulse_time         = 0;
-                            irmp_pause_time         = 0;
-                        }
-                    }
+            switch (irmp_bit)
+            {
+                case  0: irmp_tmp_command |= (1<<15); break;                                        // N
+                case  2: irmp_tmp_command |= (1<<13); break;                                        // V
+                case  3: irmp_tmp_command |= (1<<12); break;                                        // V
+                case  4: irmp_tmp_command |= (1<<10); break;                                        // M
+                case  5: irmp_tmp_command |= (1<< 9); break;                                        // M
+                case  6: irmp_tmp_command |= (1<< 8); break;                                        // M
+                case 20: irmp_tmp_command |= (1<< 6); break;                                        // t
+                case 22: irmp_tmp_command |= (1<<11); break;                                        // v
+                case 23: irmp_tmp_command |= (1<< 7); break;                                        // m
+                case 24: irmp_tmp_command |= (1<<14); break;                                        // A
+                case 26: irmp_tmp_command |= (1<< 5); break;                                        // x
+                case 44: irmp_tmp_command |= (1<< 4); break;                                        // y
+                case 66: irmp_tmp_command |= (1<< 3); break;                                        // T
+                case 67: irmp_tmp_command |= (1<< 2); break;                                        // T
+                case 68: irmp_tmp_command |= (1<< 1); break;                                        // T
+                case 69: irmp_tmp_command |= (1<< 0); break;                                        // T
+            }
+        }
+    }
+    else
+#endif // IRMP_SUPPORT_ACP24_PROTOCOL == 1 && IRMP_FRAME_BITS < 128
+
+#if IRMP_SUPPORT_ORTEK_PROTOCOL == 1
+    if (irmp_param.protocol == IRMP_ORTEK_PROTOCOL)
+    {
+        if (irmp_bit < 14)
+        {
+            if (value)
+            {
+                parity++;
+            }
+        }
+        else if (irmp_bit == 14)
+        {
+            if (value)                                                                                      // value == 1: even parity
+            {
+                if (parity & 0x01)
+                {
+                    parity = PARITY_CHECK_FAILED;
                 }
                 else
-                {                                                               // got light now!
-                    got_light = TRUE;
+                {
+                    parity = PARITY_CHECK_OK;
                 }
-
-                if (got_light)
+            }
+            else
+            {
+                if (parity & 0x01)                                                                          // value == 0: odd parity
                 {
-                    ANALYZE_PRINTF5 ("%8.3fms [bit %2d: pulse = %3d, pause = %3d] ", (double) (time_counter * 1000) / F_INTERRUPTS, irmp_bit, irmp_pulse_time, irmp_pause_time);
-
-#if IRMP_SUPPORT_MANCHESTER == 1
-                    if ((irmp_param.flags & IRMP_PARAM_FLAG_IS_MANCHESTER))                                     // Manchester
-                    {
-#if IRMP_SUPPORT_MERLIN_PROTOCOL == 1
-                        if (irmp_param.complete_len == irmp_bit && irmp_param.protocol == IRMP_MERLIN_PROTOCOL)
-                        {
-                            if (last_value == 0)
-                            {
-                                if (irmp_pulse_time >= 2 * irmp_param.pulse_1_len_min && irmp_pulse_time <= 2 * irmp_param.pulse_1_len_max &&
-                                    last_pause >= irmp_param.pause_1_len_min && last_pause <= irmp_param.pulse_1_len_max)
-                                {
-                                    irmp_param.complete_len += 2;
-                                    irmp_store_bit(0);
-                                    irmp_store_bit(1);
-                                    ANALYZE_PUTCHAR ('0');
-                                    ANALYZE_PUTCHAR ('1');
-                                    ANALYZE_NEWLINE ();
-                                }
-                            }
-                            else
-                            {
-                                if (last_pause >= 2 * irmp_param.pause_1_len_min && last_pause <= 2 * irmp_param.pulse_1_len_max)
-                                {
-                                    if (irmp_pulse_time >= irmp_param.pulse_1_len_min && irmp_pulse_time <= irmp_param.pulse_1_len_max)
-                                    {
-                                        irmp_param.complete_len++;
-                                        irmp_store_bit(0);
-                                        ANALYZE_PUTCHAR ('0');
-                                        ANALYZE_NEWLINE ();
-                                    }
-                                    else if (irmp_pulse_time >= 2 * irmp_param.pulse_1_len_min && irmp_pulse_time <= 2 * irmp_param.pulse_1_len_max)
-                                    {
-                                        irmp_param.complete_len += 2;
-                                        irmp_store_bit(0);
-                                        irmp_store_bit(1);
-                                        ANALYZE_PUTCHAR ('0');
-                                        ANALYZE_PUTCHAR ('1');
-                                        ANALYZE_NEWLINE ();
-                                    }
-                                }
-                            }
-                        }
-                        else
-#endif
-#if 1
-                        if (irmp_pulse_time > irmp_param.pulse_1_len_max /* && irmp_pulse_time <= 2 * irmp_param.pulse_1_len_max */)
-#else // better, but some IR-RCs use asymmetric timings :-/
-                        if (irmp_pulse_time > irmp_param.pulse_1_len_max && irmp_pulse_time <= 2 * irmp_param.pulse_1_len_max &&
-                            irmp_pause_time <= 2 * irmp_param.pause_1_len_max)
+                    parity = PARITY_CHECK_OK;
+                }
+                else
+                {
+                    parity = PARITY_CHECK_FAILED;
+                }
+            }
+        }
+    }
+    else
 #endif
-                        {
-#if IRMP_SUPPORT_RC6_PROTOCOL == 1
-                            if (irmp_param.protocol == IRMP_RC6_PROTOCOL && irmp_param.complete_len == irmp_bit + 1) // RC6A
-                            {
-                                    irmp_param.complete_len++; // this is the last position and 2 bits (instead of only 1) will be added
-                            }
+    {
+        ;
+    }
 
-                            if (irmp_param.protocol == IRMP_RC6_PROTOCOL && irmp_bit == 4 && irmp_pulse_time > RC6_TOGGLE_BIT_LEN_MIN)         // RC6 toggle bit
-                            {
-                                ANALYZE_PUTCHAR ('T');
+#if IRMP_SUPPORT_GRUNDIG_NOKIA_IR60_PROTOCOL == 1
+    if (irmp_bit == 0 && irmp_param.protocol == IRMP_GRUNDIG_PROTOCOL)
+    {
+        first_bit = value;
+    }
+    else
+#endif
 
-                                if (irmp_param.complete_len == RC6_COMPLETE_DATA_LEN_LONG)                      // RC6 mode 6A
-                                {
-                                    irmp_store_bit (1);
-                                    last_value = 1;
-                                }
-                                else                                                                            // RC6 mode 0
-                                {
-                                    irmp_store_bit (0);
-                                    last_value = 0;
-                                }
-                                ANALYZE_NEWLINE ();
-                            }
-                            else
-#endif // IRMP_SUPPORT_RC6_PROTOCOL == 1
-                            {
-                                ANALYZE_PUTCHAR ((irmp_param.flags & IRMP_PARAM_FLAG_1ST_PULSE_IS_1) ? '0' : '1');
-                                irmp_store_bit ((irmp_param.flags & IRMP_PARAM_FLAG_1ST_PULSE_IS_1) ? 0  :  1 );
+    if (irmp_bit >= irmp_param.address_offset && irmp_bit < irmp_param.address_end)
+    {
+        if (irmp_param.lsb_first)
+        {
+            irmp_tmp_address |= (((uint_fast16_t) (value)) << (irmp_bit - irmp_param.address_offset));      // CV wants cast
+        }
+        else
+        {
+            irmp_tmp_address <<= 1;
+            irmp_tmp_address |= value;
+        }
+    }
+    else if (irmp_bit >= irmp_param.command_offset && irmp_bit < irmp_param.command_end)
+    {
+        if (irmp_param.lsb_first)
+        {
+#if IRMP_SUPPORT_SAMSUNG48_PROTOCOL == 1
+            if (irmp_param.protocol == IRMP_SAMSUNG48_PROTOCOL && irmp_bit >= 32)
+            {
+                irmp_tmp_id |= (((uint_fast16_t) (value)) << (irmp_bit - 32));                              // CV wants cast
+            }
+            else
+#endif
+            {
+                irmp_tmp_command |= (((uint_fast16_t) (value)) << (irmp_bit - irmp_param.command_offset));  // CV wants cast
+            }
+        }
+        else
+        {
+            irmp_tmp_command <<= 1;
+            irmp_tmp_command |= value;
+        }
+    }
 
-#if IRMP_SUPPORT_RC6_PROTOCOL == 1
-                                if (irmp_param.protocol == IRMP_RC6_PROTOCOL && irmp_bit == 4 && irmp_pulse_time > RC6_TOGGLE_BIT_LEN_MIN)      // RC6 toggle bit
-                                {
-                                    ANALYZE_PUTCHAR ('T');
-                                    irmp_store_bit (1);
+#if IRMP_SUPPORT_LGAIR_PROTOCOL == 1 && IRMP_FRAME_BITS == 0                                         // else taken from frame buffer
+    if (irmp_param.protocol == IRMP_NEC_PROTOCOL || irmp_param.protocol == IRMP_NEC42_PROTOCOL)
+    {
+        if (irmp_bit < 8)
+        {
+            irmp_lgair_address <<= 1;                                                                       // LGAIR uses MSB
+            irmp_lgair_address |= value;
+        }
+        else if (irmp_bit < 24)
+        {
+            irmp_lgair_command <<= 1;                                                                       // LGAIR uses MSB
+            irmp_lgair_command |= value;
+        }
+    }
+    // NO else!
+#endif
 
-                                    if (irmp_pause_time > 2 * irmp_param.pause_1_len_max)
-                                    {
-                                        last_value = 0;
-                                    }
-                                    else
-                                    {
-                                        last_value = 1;
-                                    }
-                                    ANALYZE_NEWLINE ();
-                                }
-                                else
-#endif // IRMP_SUPPORT_RC6_PROTOCOL == 1
-                                {
-                                    ANALYZE_PUTCHAR ((irmp_param.flags & IRMP_PARAM_FLAG_1ST_PULSE_IS_1) ? '1' : '0');
-                                    irmp_store_bit ((irmp_param.flags & IRMP_PARAM_FLAG_1ST_PULSE_IS_1) ? 1 :   0 );
+#if IRMP_SUPPORT_MELINERA_PROTOCOL == 1 && IRMP_FRAME_BITS == 0                                      // else taken from frame buffer
+    if (irmp_param.protocol == IRMP_NEC_PROTOCOL || irmp_param.protocol == IRMP_NEC42_PROTOCOL || irmp_param.protocol == IRMP_MELINERA_PROTOCOL)
+    {
+        irmp_melinera_command <<= 1;                                                                        // MELINERA uses MSB
+        irmp_melinera_command |= value;
+    }
+#endif
 
-#if IRMP_SUPPORT_RC5_PROTOCOL == 1 && IRMP_SUPPORT_RCII_PROTOCOL == 1 && (IRMP_SUPPORT_FDC_PROTOCOL == 1 || IRMP_SUPPORT_RCCAR_PROTOCOL == 1)
-                                    if (! irmp_param2.protocol)
+#if IRMP_SUPPORT_NEC42_PROTOCOL == 1
+    if (irmp_param.protocol == IRMP_NEC42_PROTOCOL && irmp_bit >= 13 && irmp_bit < 26)
+    {
+        irmp_tmp_address2 |= (((uint_fast16_t) (value)) << (irmp_bit - 13));                                // CV wants cast
+    }
+    else
 #endif
-                                    {
-                                        ANALYZE_NEWLINE ();
-                                    }
-                                    last_value = (irmp_param.flags & IRMP_PARAM_FLAG_1ST_PULSE_IS_1) ? 1 : 0;
-                                }
-                            }
-                        }
-                        else if (irmp_pulse_time >= irmp_param.pulse_1_len_min && irmp_pulse_time <= irmp_param.pulse_1_len_max
-                                 /* && irmp_pause_time <= 2 * irmp_param.pause_1_len_max */)
-                        {
-                            uint_fast8_t manchester_value;
 
-                            if (last_pause > irmp_param.pause_1_len_max && last_pause <= 2 * irmp_param.pause_1_len_max)
-                            {
-                                manchester_value = last_value ? 0 : 1;
-                                last_value  = manchester_value;
-                            }
-                            else
-                            {
-                                manchester_value = last_value;
-                            }
+#if IRMP_SUPPORT_SAMSUNG_PROTOCOL == 1
+    if (irmp_param.protocol == IRMP_SAMSUNG_PROTOCOL && irmp_bit >= SAMSUNG_ID_OFFSET && irmp_bit < SAMSUNG_ID_OFFSET + SAMSUNG_ID_LEN)
+    {
+        irmp_tmp_id |= (((uint_fast16_t) (value)) << (irmp_bit - SAMSUNG_ID_OFFSET));                       // store with LSB first
+    }
+    else
+#endif
 
-                            ANALYZE_PUTCHAR (manchester_value + '0');
+#if IRMP_SUPPORT_KASEIKYO_PROTOCOL == 1
+    if (irmp_param.protocol == IRMP_KASEIKYO_PROTOCOL)
+    {
+        if (irmp_bit >= 20 && irmp_bit < 24)
+        {
+            irmp_tmp_command |= (((uint_fast16_t) (value)) << (irmp_bit - 8));  // store 4 system bits (genre 1) in upper nibble with LSB first
+        }
+        else if (irmp_bit >= 24 && irmp_bit < 28)
+        {
+            genre2 |= (((uint_fast8_t) (value)) << (irmp_bit - 20));            // store 4 system bits (genre 2) in upper nibble with LSB first
+        }
 
-#if IRMP_SUPPORT_RC5_PROTOCOL == 1 && (IRMP_SUPPORT_FDC_PROTOCOL == 1 || IRMP_SUPPORT_RCCAR_PROTOCOL == 1)
-                            if (! irmp_param2.protocol)
+        if (irmp_bit < KASEIKYO_COMPLETE_DATA_LEN)
+        {
+            if (value)
+            {
+                xor_check[irmp_bit / 8] |= 1 << (irmp_bit % 8);
+            }
+            else
+            {
+                xor_check[irmp_bit / 8] &= ~(1 << (irmp_bit % 8));
+            }
+        }
+    }
+    else
 #endif
-                            {
-                                ANALYZE_NEWLINE ();
-                            }
 
-#if IRMP_SUPPORT_RC6_PROTOCOL == 1
-                            if (irmp_param.protocol == IRMP_RC6_PROTOCOL && irmp_bit == 1 && manchester_value == 1)     // RC6 mode != 0 ???
-                            {
-                                ANALYZE_PRINTF1 ("Switching to RC6A protocol\n");
-                                irmp_param.complete_len = RC6_COMPLETE_DATA_LEN_LONG;
-                                irmp_param.address_offset = 5;
-                                irmp_param.address_end = irmp_param.address_offset + 15;
-                                irmp_param.command_offset = irmp_param.address_end + 1;                                 // skip 1 system bit, changes like a toggle bit
-                                irmp_param.command_end = irmp_param.command_offset + 16 - 1;
-                                irmp_tmp_address = 0;
-                            }
-#endif // IRMP_SUPPORT_RC6_PROTOCOL == 1
+#if IRMP_SUPPORT_MITSU_HEAVY_PROTOCOL == 1 && IRMP_FRAME_BITS < 128                                 // else see irmp_get_data()
+    if (irmp_param.protocol == IRMP_MITSU_HEAVY_PROTOCOL)                           // squeeze 64 bits into 16 bits:
+    {
+        if (irmp_bit == 72 )
+        {                                                                           // irmp_tmp_address, irmp_tmp_command received: check parity & compress
+            mitsu_parity = PARITY_CHECK_OK;
 
-                            irmp_store_bit (manchester_value);
-                        }
-                        else
-                        {
-#if IRMP_SUPPORT_RC5_PROTOCOL == 1 && IRMP_SUPPORT_FDC_PROTOCOL == 1
-                            if (irmp_param2.protocol == IRMP_FDC_PROTOCOL &&
-                                irmp_pulse_time >= FDC_PULSE_LEN_MIN && irmp_pulse_time <= FDC_PULSE_LEN_MAX &&
-                                ((irmp_pause_time >= FDC_1_PAUSE_LEN_MIN && irmp_pause_time <= FDC_1_PAUSE_LEN_MAX) ||
-                                 (irmp_pause_time >= FDC_0_PAUSE_LEN_MIN && irmp_pause_time <= FDC_0_PAUSE_LEN_MAX)))
-                            {
-                                ANALYZE_PUTCHAR ('?');
-                                irmp_param.protocol = 0;                // switch to FDC, see below
-                            }
-                            else
-#endif // IRMP_SUPPORT_FDC_PROTOCOL == 1
-#if IRMP_SUPPORT_RC5_PROTOCOL == 1 && IRMP_SUPPORT_RCCAR_PROTOCOL == 1
-                            if (irmp_param2.protocol == IRMP_RCCAR_PROTOCOL &&
-                                irmp_pulse_time >= RCCAR_PULSE_LEN_MIN && irmp_pulse_time <= RCCAR_PULSE_LEN_MAX &&
-                                ((irmp_pause_time >= RCCAR_1_PAUSE_LEN_MIN && irmp_pause_time <= RCCAR_1_PAUSE_LEN_MAX) ||
-                                 (irmp_pause_time >= RCCAR_0_PAUSE_LEN_MIN && irmp_pause_time <= RCCAR_0_PAUSE_LEN_MAX)))
-                            {
-                                ANALYZE_PUTCHAR ('?');
-                                irmp_param.protocol = 0;                // switch to RCCAR, see below
-                            }
-                            else
-#endif // IRMP_SUPPORT_RCCAR_PROTOCOL == 1
-                            {
-                                ANALYZE_PUTCHAR ('?');
-                                ANALYZE_NEWLINE ();
-                                ANALYZE_PRINTF4 ("error 3 manchester: timing not correct: data bit %d,  pulse: %d, pause: %d\n", irmp_bit, irmp_pulse_time, irmp_pause_time);
-                                ANALYZE_ONLY_NORMAL_PUTCHAR ('\n');
-                                irmp_start_bit_detected = 0;                            // reset flags and wait for next start bit
-                                irmp_pause_time         = 0;
-                            }
-                        }
+            check = irmp_tmp_address >> 8;                                          // inverted upper byte == lower byte?
+            check = ~ check;
 
-#if IRMP_SUPPORT_RC5_PROTOCOL == 1 && IRMP_SUPPORT_FDC_PROTOCOL == 1
-                        if (irmp_param2.protocol == IRMP_FDC_PROTOCOL && irmp_pulse_time >= FDC_PULSE_LEN_MIN && irmp_pulse_time <= FDC_PULSE_LEN_MAX)
-                        {
-                            if (irmp_pause_time >= FDC_1_PAUSE_LEN_MIN && irmp_pause_time <= FDC_1_PAUSE_LEN_MAX)
-                            {
-                                ANALYZE_PRINTF1 ("   1 (FDC)\n");
-                                irmp_store_bit2 (1);
-                            }
-                            else if (irmp_pause_time >= FDC_0_PAUSE_LEN_MIN && irmp_pause_time <= FDC_0_PAUSE_LEN_MAX)
-                            {
-                                ANALYZE_PRINTF1 ("   0 (FDC)\n");
-                                irmp_store_bit2 (0);
-                            }
+            if (check == (irmp_tmp_address & 0xFF))
+            {                                                                       // ok:
+                irmp_tmp_address <<= 8;                                             // throw away upper byte
+            }
+            else
+            {
+                mitsu_parity = PARITY_CHECK_FAILED;
+            }
 
-                            if (! irmp_param.protocol)
-                            {
-                                ANALYZE_PRINTF1 ("Switching to FDC protocol\n");
-                                memcpy (&irmp_param, &irmp_param2, sizeof (IRMP_PARAMETER));
-                                irmp_param2.protocol = 0;
-                                irmp_tmp_address = irmp_tmp_address2;
-                                irmp_tmp_command = irmp_tmp_command2;
-                            }
-                        }
-#endif // IRMP_SUPPORT_FDC_PROTOCOL == 1
-#if IRMP_SUPPORT_RC5_PROTOCOL == 1 && IRMP_SUPPORT_RCCAR_PROTOCOL == 1
-                        if (irmp_param2.protocol == IRMP_RCCAR_PROTOCOL && irmp_pulse_time >= RCCAR_PULSE_LEN_MIN && irmp_pulse_time <= RCCAR_PULSE_LEN_MAX)
-                        {
-                            if (irmp_pause_time >= RCCAR_1_PAUSE_LEN_MIN && irmp_pause_time <= RCCAR_1_PAUSE_LEN_MAX)
-                            {
-                                ANALYZE_PRINTF1 ("   1 (RCCAR)\n");
-                                irmp_store_bit2 (1);
-                            }
-                            else if (irmp_pause_time >= RCCAR_0_PAUSE_LEN_MIN && irmp_pause_time <= RCCAR_0_PAUSE_LEN_MAX)
-                            {
-                                ANALYZE_PRINTF1 ("   0 (RCCAR)\n");
-                                irmp_store_bit2 (0);
-                            }
+            check = irmp_tmp_command >> 8;                                          // inverted upper byte == lower byte?
+            check = ~ check;
+            if (check == (irmp_tmp_command & 0xFF))
+            {                                                                       // ok:  pack together
+                irmp_tmp_address |= irmp_tmp_command & 0xFF;                        // byte 1, byte2 in irmp_tmp_address, irmp_tmp_command can be used for byte 3
+            }
+            else
+            {
+                mitsu_parity = PARITY_CHECK_FAILED;
+            }
+            irmp_tmp_command = 0;
+        }
 
-                            if (! irmp_param.protocol)
-                            {
-                                ANALYZE_PRINTF1 ("Switching to RCCAR protocol\n");
-                                memcpy (&irmp_param, &irmp_param2, sizeof (IRMP_PARAMETER));
-                                irmp_param2.protocol = 0;
-                                irmp_tmp_address = irmp_tmp_address2;
-                                irmp_tmp_command = irmp_tmp_command2;
-                            }
-                        }
-#endif // IRMP_SUPPORT_RCCAR_PROTOCOL == 1
+        if (irmp_bit >= 72 )
+        {                                                                           // receive 3. word in irmp_tmp_command
+            irmp_tmp_command <<= 1;
+            irmp_tmp_command |= value;
+        }
+    }
+    else
+#endif // IRMP_SUPPORT_MITSU_HEAVY_PROTOCOL == 1 && IRMP_FRAME_BITS < 128
+    {
+        ;
+    }
 
-                        last_pause      = irmp_pause_time;
-                        wait_for_space  = 0;
-                    }
-                    else
-#endif // IRMP_SUPPORT_MANCHESTER == 1
+    irmp_bit++;
+}
 
-#if IRMP_SUPPORT_SERIAL == 1
-                    if (irmp_param.flags & IRMP_PARAM_FLAG_IS_SERIAL)
-                    {
-                        while (irmp_bit < irmp_param.complete_len && irmp_pulse_time > irmp_param.pulse_1_len_max)
-                        {
-                            ANALYZE_PUTCHAR ('1');
-                            irmp_store_bit (1);
+#if IRMP_FRAME_BITS >= 128 && (IRMP_SUPPORT_ACP24_PROTOCOL == 1 || IRMP_SUPPORT_MITSU_HEAVY_PROTOCOL == 1)
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ *  Fold frame buffer
+ *  @details  irmp_get_data() extracts address and command of ACP24 and MITSU_HEAVY from the frame buffer, but irmp_ISR() needs
+ *            a key of the frame to detect repetitions. Folds the buffer into irmp_tmp_address and irmp_tmp_command.
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+static void
+irmp_frame_acc_fold (void)
+{
+    uint_fast8_t    idx;
 
-                            if (irmp_pulse_time >= irmp_param.pulse_1_len_min)
-                            {
-                                irmp_pulse_time -= irmp_param.pulse_1_len_min;
-                            }
-                            else
-                            {
-                                irmp_pulse_time = 0;
-                            }
-                        }
+    irmp_tmp_address = 0;
+    irmp_tmp_command = 0;
 
-                        while (irmp_bit < irmp_param.complete_len && irmp_pause_time > irmp_param.pause_1_len_max)
-                        {
-                            ANALYZE_PUTCHAR ('0');
-                            irmp_store_bit (0);
+    for (idx = 0; idx < IRMP_FRAME_BITS / 8; idx += 2)
+    {
+        irmp_tmp_address = (uint16_t) ((irmp_tmp_address << 3) | (irmp_tmp_address >> 13)) ^ irmp_frame_acc[idx];
+        irmp_tmp_command = (uint16_t) ((irmp_tmp_command << 5) | (irmp_tmp_command >> 11)) ^ irmp_frame_acc[idx + 1];
+    }
+}
+#endif
 
-                            if (irmp_pause_time >= irmp_param.pause_1_len_min)
-                            {
-                                irmp_pause_time -= irmp_param.pause_1_len_min;
-                            }
-                            else
-                            {
-                                irmp_pause_time = 0;
-                            }
-                        }
-                        ANALYZE_NEWLINE ();
-                        wait_for_space = 0;
-                    }
-                    else
-#endif // IRMP_SUPPORT_SERIAL == 1
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ *  store bit
+ *  @details  store bit in temp address or temp command
+ *  @param    value to store: 0 or 1
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+#if IRMP_SUPPORT_RC5_PROTOCOL == 1 && (IRMP_SUPPORT_FDC_PROTOCOL == 1 || IRMP_SUPPORT_RCCAR_PROTOCOL == 1)
+static void
+irmp_store_bit2 (uint_fast8_t value)
+{
+    uint_fast8_t irmp_bit2;
 
-#if IRMP_SUPPORT_SAMSUNG_PROTOCOL == 1
-                    if (irmp_param.protocol == IRMP_SAMSUNG_PROTOCOL && irmp_bit == 16)       // Samsung: 16th bit
-                    {
-                        if (irmp_pulse_time >= SAMSUNG_PULSE_LEN_MIN && irmp_pulse_time <= SAMSUNG_PULSE_LEN_MAX &&
-                            irmp_pause_time >= SAMSUNG_START_BIT_PAUSE_LEN_MIN && irmp_pause_time <= SAMSUNG_START_BIT_PAUSE_LEN_MAX)
-                        {
-                            ANALYZE_PRINTF1 ("SYNC\n");
-                            wait_for_space = 0;
-                            irmp_bit++;
-                        }
-                        else  if (irmp_pulse_time >= SAMSUNG_PULSE_LEN_MIN && irmp_pulse_time <= SAMSUNG_PULSE_LEN_MAX)
-                        {
-#if IRMP_SUPPORT_SAMSUNG48_PROTOCOL == 1
-                            ANALYZE_PRINTF1 ("Switching to SAMSUNG48 protocol ");
-                            irmp_param.protocol         = IRMP_SAMSUNG48_PROTOCOL;
-                            irmp_param.command_offset   = SAMSUNG48_COMMAND_OFFSET;
-                            irmp_param.command_end      = SAMSUNG48_COMMAND_OFFSET + SAMSUNG48_COMMAND_LEN;
-                            irmp_param.complete_len     = SAMSUNG48_COMPLETE_DATA_LEN;
-#else
+    if (irmp_param.protocol)
+    {
+        irmp_bit2 = irmp_bit - 2;
+    }
+    else
+    {
+        irmp_bit2 = irmp_bit - 1;
+    }
+
+    if (irmp_bit2 >= irmp_param2.address_offset && irmp_bit2 < irmp_param2.address_end)
+    {
+        irmp_tmp_address2 |= (((uint_fast16_t) (value)) << (irmp_bit2 - irmp_param2.address_offset));   // CV wants cast
+    }
+    else if (irmp_bit2 >= irmp_param2.command_offset && irmp_bit2 < irmp_param2.command_end)
+    {
+        irmp_tmp_command2 |= (((uint_fast16_t) (value)) << (irmp_bit2 - irmp_param2.command_offset));   // CV wants cast
+    }
+}
+#endif // IRMP_SUPPORT_RC5_PROTOCOL == 1 && (IRMP_SUPPORT_FDC_PROTOCOL == 1 || IRMP_SUPPORT_RCCAR_PROTOCOL == 1)
+
+#if defined(ANALYZE)
+static IRMP_THREAD_LOCAL uint32_t s_curSample = 0;
+static IRMP_THREAD_LOCAL uint32_t s_startBitSample = 0;
+#endif
+
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ *  ISR routine
+ *  @details  ISR routine, called 10000 to 20000 times per second
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+#if IRMP_ENABLE_CONTEXT == 0
+    static uint_fast8_t     irmp_start_bit_detected;                                // flag: start bit detected
+    static uint_fast8_t     wait_for_space;                                         // flag: wait for data bit space
+    static uint_fast8_t     wait_for_start_space;                                   // flag: wait for start bit space
+#if __SIZEOF_INT__ == 4
+    static uint_fast16_t irmp_pulse_time;                                            // count bit time for pulse
+#else
+    static uint_fast8_t irmp_pulse_time;                                            // count bit time for pulse
+#endif
+    static PAUSE_LEN        irmp_pause_time;                                        // count bit time for pause
+    static uint_fast16_t    key_repetition_len;                                     // SIRCS repeats frame 2-5 times with 45 ms pause
+#if IRMP_USE_IDLE_FAST_PATH == 1
+    static uint_fast8_t     irmp_steady_idle;                                       // flag: nothing to do but counting key_repetition_len
+#endif
+    static uint_fast8_t     repetition_frame_number;
+#if IRMP_ENABLE_RELEASE_DETECTION == 1
+    static uint_fast8_t     key_released = TRUE;
+#endif
+#if IRMP_SUPPORT_DENON_PROTOCOL == 1
+    static uint_fast16_t    last_irmp_denon_command;                                // save last irmp command to recognize DENON frame repetition
+    static uint_fast16_t    denon_repetition_len = 0xFFFF;                          // denon repetition len of 2nd auto generated frame
+#endif
+#endif // IRMP_ENABLE_CONTEXT == 0
+
+#if defined(ARDUINO)
+#include "irmpArduinoExt.hpp" // Must be included after declaration of irmp_start_bit_detected etc.
+#endif
+
+#if IRMP_ENABLE_CANDIDATES == 1
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ *  Start bit candidates
+ *  @details  irmp_ISR_input() records the pulses and pauses of a frame from its start bit on. The start bit check takes the first
+ *            matching protocol and keeps the following candidates in irmp_candidate_mask. If the frame fails, irmp_candidate_replay()
+ *            feeds the recorded ticks into irmp_ISR_input() again, now the start bit check takes the next matching candidate.
+ *            So every candidate sees the same ticks, and the first one which accepts the frame wins.
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+#define IRMP_CANDIDATE_IDLE                     0                       // not recording, no replay possible
+#define IRMP_CANDIDATE_RECORDING                1                       // recording start bit, no candidate chosen yet
+#define IRMP_CANDIDATE_DECODING                 2                       // recording frame, decoding it with a candidate
+
+static uint_fast8_t     irmp_ISR_input (uint_fast8_t irmp_raw_input);
+static uint_fast16_t    irmp_get_skip_len (uint_fast8_t irmp_input);
+static void             irmp_skip_ticks (uint_fast8_t irmp_input, uint_fast16_t len);
+
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ *  Record ticks
+ *  @details  called by irmp_ISR_input() and irmp_skip_ticks(), appends len ticks of irmp_input to the recorded frame
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+static void
+irmp_candidate_record (uint_fast8_t irmp_input, uint_fast16_t len)
+{
+    if (irmp_candidate_state == IRMP_CANDIDATE_IDLE || irmp_candidate_replaying)
+    {
+        return;
+    }
+
+    if (irmp_input == irmp_candidate_level)
+    {
+        irmp_candidate_run = (irmp_candidate_run < 0xFFFF - len) ? irmp_candidate_run + len : 0xFFFF;
+    }
+    else if (irmp_candidate_run <= 0xFF && irmp_candidate_len < IRMP_CANDIDATE_BUFFER_LEN)
+    {
+        irmp_candidate_buf[irmp_candidate_len++] = irmp_candidate_run;
+        irmp_candidate_level = irmp_input;
+        irmp_candidate_run = len;
+    }
+    else
+    {                                                                           // frame too long, no replay
+        irmp_candidate_state = IRMP_CANDIDATE_IDLE;
+    }
+}
+
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ *  Move tick counters
+ *  @details  replayed ticks must not be counted twice
+ *  @param    number of ticks to add, negative: rewind
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+static void
+irmp_candidate_move_counters (int32_t ticks)
+{
+#if IRMP_USE_TICK_COUNTER == 1
+    irmp_tick_counter += (uint32_t) ticks;
+#endif
+#if defined(ANALYZE)
+    time_counter += ticks;
+#endif
+#if IRMP_AUTODETECT_REPEATRATE
+    ticks += delta_detection;
+    delta_detection = (ticks < 0) ? 0 : ((ticks > 0xFFFF) ? 0xFFFF : ticks);
+#endif
+}
+
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ *  Check length of replayed frame
+ *  @details  called while replaying. If the candidate has got all its bits and more pulses have been recorded, the candidate
+ *            must not take the frame, e.g. NUBERT must not take a FAN frame followed by its repetition.
+ *            Manchester frames are not checked, their last bit may end with a pulse.
+ *  @param    index of replayed pulse or pause
+ *  @return   TRUE: more pulses recorded than the candidate expects
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+static uint_fast8_t
+irmp_candidate_too_short (uint_fast8_t idx)
+{
+    uint_fast8_t    pulses;
+
+    if (irmp_bit != irmp_param.complete_len || (irmp_param.flags & IRMP_PARAM_FLAG_IS_MANCHESTER))
+    {
+        return FALSE;
+    }
+
+    pulses = irmp_candidate_len / 2 - idx / 2;                                  // pulses after idx, even indexes up to the current run
+    return pulses > 0;
+}
+
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ *  Replay recorded frame for the next candidates
+ *  @details  called by irmp_ISR_input() if a frame failed and irmp_candidate_mask is not empty. If every candidate fails,
+ *            the decoder waits for the next start bit, as after the first failure. At most IRMP_CANDIDATE_MAX_REPLAYS candidates
+ *            are tried, each one gets at most IRMP_CANDIDATE_BUFFER_LEN + 1 pulses and pauses.
+ *  @return   TRUE: a candidate accepted the frame
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+static uint_fast8_t
+irmp_candidate_replay (void)
+{
+    uint_fast8_t    frame_ready = FALSE;
+    uint_fast8_t    failed;
+    uint_fast8_t    idx;
+    uint_fast8_t    irmp_input;
+    uint_fast8_t    level;
+    uint_fast16_t   ticks;
+    uint_fast16_t   skip_len;
+    int32_t         total;
+    int32_t         fed;
+    uint_fast8_t    replays = 0;
+
+    total = irmp_candidate_run;                                                 // all recorded ticks have been fed once
+
+    for (idx = 0; idx < irmp_candidate_len; idx++)
+    {
+        total += irmp_candidate_buf[idx];
+    }
+
+    fed = total;
+
+    do
+    {
+        irmp_candidate_move_counters (- fed);
+        ANALYZE_PRINTF2 ("%8.3fms replaying frame for next start bit candidate\n", (double) (time_counter * 1000) / F_INTERRUPTS);
+
+        failed                      = FALSE;
+        fed                         = 0;
+        irmp_start_bit_detected     = 0;
+        irmp_pulse_time             = 0;
+        irmp_pause_time             = 0;
+        irmp_candidate_state        = IRMP_CANDIDATE_RECORDING;                 // start bit check takes irmp_candidate_mask
+        irmp_candidate_replaying    = TRUE;
+
+        for (idx = 0; idx <= irmp_candidate_len && irmp_candidate_state != IRMP_CANDIDATE_IDLE; idx++)
+        {
+            irmp_input  = idx & 1;                                              // recording starts with a pulse
+#if IRMP_HIGH_ACTIVE == 1
+            level       = ! irmp_input;
+#else
+            level       = irmp_input;
+#endif
+            ticks       = (idx < irmp_candidate_len) ? irmp_candidate_buf[idx] : irmp_candidate_run;
+
+            while (ticks && irmp_candidate_state != IRMP_CANDIDATE_IDLE)
+            {
+                if (irmp_candidate_state == IRMP_CANDIDATE_DECODING && irmp_start_bit_detected && irmp_candidate_too_short (idx))
+                {                                                               // candidate would end before the recorded frame
+                    ANALYZE_PRINTF1 ("candidate rejected: recorded frame is longer\n");
+                    ANALYZE_ONLY_NORMAL_PUTCHAR ('\n');
+                    failed = TRUE;
+                    irmp_candidate_state = IRMP_CANDIDATE_IDLE;
+                    break;
+                }
+
+                ticks--;
+                fed++;
+
+                if (irmp_ISR_input (level))
+                {
+                    frame_ready = TRUE;
+                    irmp_candidate_state = IRMP_CANDIDATE_IDLE;
+                    break;
+                }
+
+                if (irmp_candidate_state == IRMP_CANDIDATE_DECODING && ! irmp_start_bit_detected)
+                {                                                               // candidate failed
+                    failed = TRUE;
+                    irmp_candidate_state = IRMP_CANDIDATE_IDLE;
+                    break;
+                }
+
+                skip_len = irmp_get_skip_len (irmp_input);
+
+                if (skip_len > ticks)
+                {
+                    skip_len = ticks;
+                }
+
+                if (skip_len)
+                {
+                    irmp_skip_ticks (irmp_input, skip_len);
+                    ticks -= skip_len;
+                    fed += skip_len;
+                }
+            }
+        }
+
+        irmp_candidate_replaying = FALSE;
+        replays++;
+    } while (failed && irmp_candidate_mask && replays < IRMP_CANDIDATE_MAX_REPLAYS);
+
+    if (failed)
+    {                                                                           // no candidate left: wait for next start bit
+        irmp_start_bit_detected = 0;
+        irmp_pulse_time         = 0;
+        irmp_pause_time         = 0;
+    }
+
+    irmp_candidate_move_counters (total - fed);                                 // ticks after the end of the frame are lost
+    return frame_ready;
+}
+#endif // IRMP_ENABLE_CANDIDATES == 1
+
+#if IRMP_RAW_CAPTURE_LEN > 0
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ *  Raw frame capture
+ *  @details  irmp_raw_record() records every frame into irmp_raw_frames[irmp_raw_write], independent of the decoder. At the end of
+ *            the frame, the buffers are swapped if the application neither holds nor has still to fetch the other one, else the
+ *            frame is dropped. irmp_ISR() only writes irmp_raw_write and sets irmp_raw_ready, irmp_get_raw_frame() only
+ *            clears irmp_raw_ready and writes irmp_raw_held, so no locking is needed.
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+#if IRMP_RAW_CAPTURE_16_BIT == 1
+#  define IRMP_RAW_TICKS_MAX                    0xFFFF
+#else
+#  define IRMP_RAW_TICKS_MAX                    0xFF
+#endif
+#define IRMP_RAW_MIN_FRAME_LEN                  3                       // pulse, pause, pulse: a single pulse is noise
+
+#if defined(__GNUC__)
+#  define IRMP_RAW_BARRIER()                    __asm__ __volatile__ ("" ::: "memory")  // keep buffer accesses on their side of the flag update
+#else
+#  define IRMP_RAW_BARRIER()
+#endif
+
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ *  Record ticks
+ *  @details  called by irmp_ISR_input() and irmp_skip_ticks(), appends len ticks of irmp_input to the recorded frame
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+static void
+irmp_raw_record (uint_fast8_t irmp_input, uint_fast16_t len)
+{
+    IRMP_RAW_FRAME *    frame_p = &irmp_raw_frames[irmp_raw_write];
+
+    if (! irmp_raw_recording)
+    {
+        if (irmp_input)                                                         // wait for first pulse
+        {
+            return;
+        }
+
+        irmp_raw_recording  = TRUE;
+        irmp_raw_level      = irmp_input;
+        irmp_raw_run        = 0;
+        frame_p->len        = 0;
+        frame_p->overflow   = FALSE;
+    }
+
+    if (irmp_input != irmp_raw_level)                                           // edge: store last pulse or pause
+    {
+        if (frame_p->len < IRMP_RAW_CAPTURE_LEN)
+        {
+            frame_p->ticks[frame_p->len++] = (irmp_raw_run < IRMP_RAW_TICKS_MAX) ? irmp_raw_run : IRMP_RAW_TICKS_MAX;
+        }
+        else
+        {
+            frame_p->overflow = TRUE;
+        }
+
+        irmp_raw_level  = irmp_input;
+        irmp_raw_run    = 0;
+    }
+
+    irmp_raw_run = (irmp_raw_run < 0xFFFF - len) ? irmp_raw_run + len : 0xFFFF;
+
+    if (irmp_input && irmp_raw_run > IRMP_TIMEOUT_LEN)                          // end of frame
+    {
+        irmp_raw_recording = FALSE;
+
+        if (frame_p->len >= IRMP_RAW_MIN_FRAME_LEN && ! irmp_raw_ready && ! irmp_raw_held)
+        {
+            irmp_raw_write ^= 1;
+            IRMP_RAW_BARRIER ();
+            irmp_raw_ready = TRUE;
+        }
+    }
+}
+
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ *  Get raw frame
+ *  @details  returns the last frame recorded by irmp_ISR() without copying it. The frame stays valid until the next call,
+ *            irmp_ISR() drops new frames until then. So call it again soon, even if the frame is not needed any more.
+ *  @return   pointer to frame, NULL if there is no new frame
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+#if IRMP_ENABLE_CONTEXT == 1
+static const IRMP_RAW_FRAME *
+irmp_get_raw_frame_current (void)                                               // works on irmp_ctx, see irmp_get_raw_frame_ctx()
+#else
+const IRMP_RAW_FRAME *
+irmp_get_raw_frame (void)
+#endif
+{
+    irmp_raw_held = FALSE;                                                      // release frame of last call
+
+    if (irmp_raw_ready)
+    {
+        irmp_raw_held = TRUE;                                                   // set before clearing irmp_raw_ready, see irmp_raw_record()
+        IRMP_RAW_BARRIER ();
+        irmp_raw_ready = FALSE;
+        return &irmp_raw_frames[irmp_raw_write ^ 1];
+    }
+
+    return (const IRMP_RAW_FRAME *) 0;
+}
+#endif // IRMP_RAW_CAPTURE_LEN > 0
+
+#if IRMP_FRAME_BITS > 0
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ *  Get data bits of frame
+ *  @details  returns the data bits of the frame last returned by irmp_get_data(), irmp_get_data_ex() etc. without copying them.
+ *            They stay valid until the next of these calls. Frames without data bits, e.g. NEC repetition frames, have len 0.
+ *  @return   pointer to frame
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+#if IRMP_ENABLE_CONTEXT == 1
+static const IRMP_FRAME *
+irmp_get_frame_current (void)                                                   // works on irmp_ctx, see irmp_get_frame_ctx()
+#else
+const IRMP_FRAME *
+irmp_get_frame (void)
+#endif
+{
+    return &irmp_frame;
+}
+#endif // IRMP_FRAME_BITS > 0
+
+#if IRMP_ENABLE_HASH_DECODER == 1
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ *  Hash decoder
+ *  @details  irmp_hash_record() follows every frame independent of the decoder and hashes it edge by edge: each pulse is compared
+ *            with the previous pulse, each pause with the previous pause. The results 0 (shorter), 1 (about equal) and 2 (longer)
+ *            are added to a 32 bit FNV-1 hash, so the hash does not depend on the exact timing. Only the last pulse and pause
+ *            are kept, not the frame. If the decoder detects the frame, the hash is dropped, else irmp_hash_put() returns it
+ *            as IRMP_HASH_PROTOCOL after the decoder has given up.
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+#define IRMP_HASH_IDLE                          0                       // waiting for pulse
+#define IRMP_HASH_RECORDING                     1                       // hashing a frame
+#define IRMP_HASH_COMPLETE                      2                       // frame ended, waiting for decoder
+#define IRMP_HASH_DROPPED                       3                       // frame detected by decoder, waiting for end of frame
+
+#define IRMP_HASH_FNV_BASIS                     2166136261UL
+#define IRMP_HASH_FNV_PRIME                     16777619UL
+#define IRMP_HASH_MIN_LEN                       6                       // min. number of pulses and pauses, shorter frames are noise
+#define IRMP_HASH_DECODER_TIMEOUT_LEN           (2 * IRMP_TIMEOUT_LEN)  // pause after which a decoder still waiting for light is ignored
+
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ *  Add pulse or pause to hash
+ *  @param    length of pulse or pause in ticks
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+static void
+irmp_hash_add (uint_fast16_t len)
+{
+    uint32_t        prev = irmp_hash_prev[irmp_hash_level];
+    uint_fast8_t    value;
+
+    if (irmp_hash_len >= 2)                                                     // there is a previous pulse or pause to compare with
+    {
+        if ((uint32_t) len * 5 < prev * 4)
+        {
+            value = 0;                                                          // shorter than 80 %
+        }
+        else if (prev * 5 < (uint32_t) len * 4)
+        {
+            value = 2;                                                          // longer than 125 %
+        }
+        else
+        {
+            value = 1;
+        }
+
+        irmp_hash = (irmp_hash * IRMP_HASH_FNV_PRIME) ^ value;
+    }
+
+    irmp_hash_prev[irmp_hash_level] = len;
+
+    if (irmp_hash_len < 0xFF)
+    {
+        irmp_hash_len++;
+    }
+}
+
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ *  Record ticks
+ *  @details  called by irmp_ISR_input() and irmp_skip_ticks(), hashes len ticks of irmp_input
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+static void
+irmp_hash_record (uint_fast8_t irmp_input, uint_fast16_t len)
+{
+    if (irmp_hash_state == IRMP_HASH_IDLE || irmp_hash_state == IRMP_HASH_COMPLETE)
+    {
+        if (irmp_input)                                                         // dark: count gap after last frame
+        {
+            irmp_hash_gap = (irmp_hash_gap < 0xFFFF - len) ? irmp_hash_gap + len : 0xFFFF;
+            return;
+        }
+
+        irmp_hash_state         = IRMP_HASH_RECORDING;                          // start of frame, an unfinished one is dropped
+        irmp_hash_repetition    = (irmp_hash_gap < IRMP_KEY_REPETITION_LEN);
+        irmp_hash               = IRMP_HASH_FNV_BASIS;
+        irmp_hash_len           = 0;
+        irmp_hash_level         = irmp_input;
+        irmp_hash_run           = 0;
+#if IRMP_ENABLE_DATA_EX == 1
+        irmp_hash_start_ticks   = irmp_tick_counter;
+#endif
+    }
+
+    if (irmp_input != irmp_hash_level)                                          // edge: add last pulse or pause
+    {
+        if (irmp_hash_state == IRMP_HASH_RECORDING)
+        {
+            irmp_hash_add (irmp_hash_run);
+        }
+        irmp_hash_level = irmp_input;
+        irmp_hash_run   = 0;
+    }
+
+    irmp_hash_run = (irmp_hash_run < 0xFFFF - len) ? irmp_hash_run + len : 0xFFFF;
+
+    if (irmp_input && irmp_hash_run > IRMP_TIMEOUT_LEN)                         // end of frame, the pause is not hashed
+    {
+        irmp_hash_state = (irmp_hash_state == IRMP_HASH_RECORDING && irmp_hash_len >= IRMP_HASH_MIN_LEN) ? IRMP_HASH_COMPLETE : IRMP_HASH_IDLE;
+        irmp_hash_gap   = irmp_hash_run;
+    }
+}
+
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ *  Return hash as frame
+ *  @details  called by irmp_ISR_input() after the decoder, returns a complete hash if the decoder has no frame and is idle
+ *            or still waits for light after a pause much longer than any protocol uses.
+ *            With IRMP_ENABLE_CANDIDATES, the hash waits until the candidate replay has tried every candidate.
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+static void
+irmp_hash_put (void)
+{
+#if IRMP_ENABLE_CANDIDATES == 1
+    if (irmp_candidate_replaying || irmp_candidate_state != IRMP_CANDIDATE_IDLE)
+    {
+        return;                                                                 // decoder may still find a protocol
+    }
+#endif
+
+    if (irmp_hash_state == IRMP_HASH_COMPLETE && ! irmp_ir_detected &&
+        (! irmp_start_bit_detected || irmp_hash_gap > IRMP_HASH_DECODER_TIMEOUT_LEN))  // decoder has given up or hangs in a pause
+    {
+        irmp_protocol       = IRMP_HASH_PROTOCOL;
+        irmp_address        = (uint16_t) (irmp_hash >> 16);
+        irmp_command        = (uint16_t) irmp_hash;
+        irmp_flags          = (irmp_hash_repetition && irmp_hash == irmp_hash_last) ? IRMP_FLAG_REPETITION : 0;
+        irmp_ir_detected    = TRUE;
+        irmp_hash_last      = irmp_hash;
+        irmp_hash_state     = IRMP_HASH_IDLE;
+#if IRMP_ENABLE_DATA_EX == 1
+        irmp_store_frame_ticks (irmp_hash_start_ticks, TRUE);
+#endif
+        ANALYZE_PRINTF3 ("%8.3fms unknown frame, hash = 0x%08lx\n", (double) (time_counter * 1000) / F_INTERRUPTS, (unsigned long) irmp_hash);
+    }
+}
+
+#if IRMP_ENABLE_FEED_DURATION == 1
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ *  Get number of following ticks which the hash decoder does not need, see irmp_get_skip_len()
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+static uint_fast16_t
+irmp_hash_get_skip_len (uint_fast8_t irmp_input)
+{
+    if (irmp_hash_state == IRMP_HASH_COMPLETE)
+    {
+        if (! irmp_start_bit_detected)
+        {
+            return 0;                                                           // irmp_hash_put() returns hash with next tick
+        }
+        return (irmp_hash_gap < IRMP_HASH_DECODER_TIMEOUT_LEN) ? IRMP_HASH_DECODER_TIMEOUT_LEN - irmp_hash_gap : 0;
+    }
+
+    if ((irmp_hash_state == IRMP_HASH_RECORDING || irmp_hash_state == IRMP_HASH_DROPPED) && irmp_input)
+    {                                                                           // counting pause, stop before end of frame
+        return (irmp_hash_run < IRMP_TIMEOUT_LEN) ? IRMP_TIMEOUT_LEN - irmp_hash_run : 0;
+    }
+
+    return 0xFFFF;
+}
+#endif // IRMP_ENABLE_FEED_DURATION == 1
+#endif // IRMP_ENABLE_HASH_DECODER == 1
+
+/*
+ * 4 us idle, 45 us at start of each pulse @16 MHz ATmega 328p
+ */
+#if IRMP_ENABLE_CONTEXT == 1 || IRMP_ENABLE_FEED_DURATION == 1
+#  if defined(ESP8266) || defined(ESP32)
+static uint_fast8_t IRAM_ATTR irmp_ISR_input(uint_fast8_t irmp_raw_input)   // input level given by caller, see irmp_ISR_ctx() and irmp_feed_duration()
+#  else
+static uint_fast8_t irmp_ISR_input(uint_fast8_t irmp_raw_input)             // input level given by caller, see irmp_ISR_ctx() and irmp_feed_duration()
+#  endif
+#elif defined(ESP8266) || defined(ESP32)
+bool IRAM_ATTR irmp_ISR(void)
+#else
+#  ifdef __cplusplus
+bool irmp_ISR(void)
+#  else
+uint_fast8_t irmp_ISR(void)
+#  endif
+#endif
+
+{
+#if IRMP_ENABLE_CONTEXT == 0
+    static uint_fast16_t    last_irmp_address = 0xFFFF;                             // save last irmp address to recognize key repetition
+#if IRMP_32_BIT == 1
+    static uint_fast32_t    last_irmp_command = 0xFFFFFFFF;                         // save last irmp command to recognize key repetition
+#else
+    static uint_fast16_t    last_irmp_command = 0xFFFF;                             // save last irmp command to recognize key repetition
+#endif
+#if IRMP_SUPPORT_RC5_PROTOCOL == 1 || IRMP_SUPPORT_S100_PROTOCOL == 1
+    static uint_fast8_t     rc5_cmd_bit6;                                           // bit 6 of RC5 command is the inverted 2nd start bit
+#endif
+#if IRMP_SUPPORT_MANCHESTER == 1
+    static PAUSE_LEN        last_pause;                                             // last pause value
+#endif
+#if IRMP_SUPPORT_MANCHESTER == 1 || IRMP_SUPPORT_BANG_OLUFSEN_PROTOCOL == 1
+    static uint_fast8_t     last_value;                                             // last bit value
+#endif
+#if IRMP_SUPPORT_RCII_PROTOCOL == 1
+    static uint_fast8_t     waiting_for_2nd_pulse = 0;
+#endif
+#endif // IRMP_ENABLE_CONTEXT == 0
+#if IRMP_SUPPORT_RF_GEN24_PROTOCOL == 1
+    uint_fast8_t            bit_0 = 0;
+#endif
+    uint_fast8_t            irmp_input;                                             // input value
+    uint_fast8_t            frame_ready;                                            // TRUE: frame ready for irmp_get_data()
+
+#if defined(ANALYZE)
+    time_counter++;
+#endif // ANALYZE
+
+#if IRMP_USE_TICK_COUNTER == 1
+    irmp_tick_counter++;
+#endif
+
+#if IRMP_ENABLE_CONTEXT == 1 || IRMP_ENABLE_FEED_DURATION == 1
+#  if IRMP_HIGH_ACTIVE == 1
+    irmp_input = ! irmp_raw_input;
+#  else
+    irmp_input = irmp_raw_input;
+#  endif
+#elif IRMP_HIGH_ACTIVE == 1
+    irmp_input = ! input(IRMP_PIN);
+#else
+    irmp_input = input(IRMP_PIN);
+#endif
+
+#if IRMP_USE_IDLE_FAST_PATH == 1
+    if (irmp_steady_idle)
+    {                                                                           // nothing pending, see end of irmp_ISR()
+        if (irmp_input)                                                         // still dark?
+        {                                                                       // yes, same as the idle branch below, but without any check
+            if (key_repetition_len < 0xFFFF)                                    // avoid overflow of counter
+            {
+                key_repetition_len++;
+            }
+#if defined(STELLARIS_ARM_CORTEX_M4)
+            TimerIntClear(TIMER1_BASE, TIMER_TIMA_TIMEOUT);
+#endif
+#if IRMP_USE_IDLE_CALL == 1
+            if (key_repetition_len > IRMP_KEY_REPETITION_LEN)
+            {
+                irmp_idle();
+            }
+#endif
+            return (FALSE);
+        }
+        irmp_steady_idle = FALSE;                                               // first pulse: full processing from here on
+    }
+#endif // IRMP_USE_IDLE_FAST_PATH == 1
+
+#if IRMP_ENABLE_CANDIDATES == 1
+    irmp_candidate_record (irmp_input, 1);
+
+    if (! irmp_candidate_replaying)                                             // replayed ticks have been seen already
+#endif
+    {
+#if IRMP_RAW_CAPTURE_LEN > 0
+        irmp_raw_record (irmp_input, 1);
+#endif
+#if IRMP_ENABLE_HASH_DECODER == 1
+        irmp_hash_record (irmp_input, 1);
+#endif
+
+#if IRMP_USE_CALLBACK == 1
+        if (irmp_callback_ptr)
+        {
+            static uint_fast8_t last_inverted_input;
+
+            if (last_inverted_input != !irmp_input)
+            {
+                (*irmp_callback_ptr) (! irmp_input);
+                last_inverted_input = !irmp_input;
+            }
+        }
+#endif // IRMP_USE_CALLBACK == 1
+
+#if defined(ARDUINO)
+#  if !defined(NO_LED_FEEDBACK_CODE)
+        irmp_DoLEDFeedback(irmp_input);
+#  endif
+#endif
+
+        irmp_log(irmp_input);                                                   // log ir signal, if IRMP_LOGGING defined
+    }
+
+#if IRMP_AUTODETECT_REPEATRATE
+    if (delta_detection < 0xFFFF)
+        delta_detection++;
+#if IRMP_ENABLE_RELEASE_DETECTION == 1
+    if (! key_released && ! irmp_ir_detected && delta_detection * (1000000 / F_INTERRUPTS) / 1000 >= upper_border)   // do not overwrite a waiting frame
+        {
+            irmp_address        = last_irmp_address;
+            irmp_command        = last_irmp_command;
+            irmp_flags          = IRMP_FLAG_RELEASE;
+            irmp_ir_detected    = TRUE;
+            key_released        = TRUE;
+#if IRMP_ENABLE_DATA_EX == 1
+            irmp_store_frame_ticks (irmp_tick_counter, FALSE);
+#endif
+        }
+#endif
+#endif
+
+    if (! irmp_ir_detected)                                                     // ir code already detected?
+    {                                                                           // no...
+        if (! irmp_start_bit_detected)                                          // start bit detected?
+        {                                                                       // no...
+            if (! irmp_input)                                                   // receiving burst?
+            {                                                                   // yes...
+//              irmp_busy_flag = TRUE;
+#if defined(ANALYZE)
+                if (! irmp_pulse_time)
+                {
+                    s_startBitSample = s_curSample;
+                    ANALYZE_PRINTF2("%8.3fms [starting pulse]\n", (double) (time_counter * 1000) / F_INTERRUPTS);
+                }
+#endif // ANALYZE
+                irmp_pulse_time++;                                              // increment counter
+            }
+            else
+            {                                                                   // no...
+                if (irmp_pulse_time)                                            // it's dark....
+                {                                                               // set flags for counting the time of darkness...
+#if IRMP_ENABLE_DATA_EX == 1
+                    irmp_start_bit_ticks    = irmp_tick_counter - irmp_pulse_time;
+#endif
+#if IRMP_ENABLE_CANDIDATES == 1
+                    if (! irmp_candidate_replaying)
+                    {                                                           // start recording with the start bit pulse
+                        irmp_candidate_buf[0]   = irmp_pulse_time;
+                        irmp_candidate_len      = 1;
+                        irmp_candidate_level    = irmp_input;
+                        irmp_candidate_run      = 1;
+                        irmp_candidate_state    = (irmp_pulse_time <= 0xFF) ? IRMP_CANDIDATE_RECORDING : IRMP_CANDIDATE_IDLE;
+                    }
+#endif
+                    irmp_start_bit_detected = 1;
+                    wait_for_start_space    = 1;
+                    wait_for_space          = 0;
+                    irmp_tmp_command        = 0;
+                    irmp_tmp_address        = 0;
+#if IRMP_SUPPORT_KASEIKYO_PROTOCOL == 1
+                    genre2                  = 0;
+#endif
+#if IRMP_SUPPORT_SAMSUNG_PROTOCOL == 1
+                    irmp_tmp_id = 0;
+#endif
+
+#if IRMP_SUPPORT_RC5_PROTOCOL == 1 && (IRMP_SUPPORT_FDC_PROTOCOL == 1 || IRMP_SUPPORT_RCCAR_PROTOCOL == 1) || IRMP_SUPPORT_NEC42_PROTOCOL == 1
+                    irmp_tmp_command2       = 0;
+                    irmp_tmp_address2       = 0;
+#endif
+#if IRMP_FRAME_BITS > 0
+                    memset (irmp_frame_acc, 0, IRMP_FRAME_BITS / 8);
+#else
+#if IRMP_SUPPORT_LGAIR_PROTOCOL == 1
+                    irmp_lgair_command      = 0;
+                    irmp_lgair_address      = 0;
+#endif
+#if IRMP_SUPPORT_MELINERA_PROTOCOL == 1
+                    irmp_melinera_command   = 0;
+#endif
+#endif // IRMP_FRAME_BITS > 0
+                    irmp_bit                = 0xff;
+                    irmp_pause_time         = 1;                                // 1st pause: set to 1, not to 0!
+#if IRMP_SUPPORT_RC5_PROTOCOL == 1 || IRMP_SUPPORT_S100_PROTOCOL == 1
+                    rc5_cmd_bit6            = 0;                                // fm 2010-03-07: bugfix: reset it after incomplete RC5 frame!
+#endif
+                }
+                else
+                {
+                    if (key_repetition_len < 0xFFFF)                            // avoid overflow of counter
+                    {
+                        key_repetition_len++;
+
+#if IRMP_ENABLE_RELEASE_DETECTION == 1
+#if !IRMP_AUTODETECT_REPEATRATE
+                        if (! key_released && key_repetition_len > IRMP_KEY_RELEASE_LEN)
+                        {
+                            irmp_address        = last_irmp_address;
+                            irmp_command        = last_irmp_command;
+                            irmp_flags          = IRMP_FLAG_RELEASE;
+                            irmp_ir_detected    = TRUE;
+                            key_released        = TRUE;
+#if IRMP_ENABLE_DATA_EX == 1
+                            irmp_store_frame_ticks (irmp_tick_counter, FALSE);
+#endif
+                        }
+#endif
+#endif
+
+#if IRMP_SUPPORT_DENON_PROTOCOL == 1
+                        if (denon_repetition_len < 0xFFFF)                      // avoid overflow of counter
+                        {
+                            denon_repetition_len++;
+
+                            if (denon_repetition_len >= DENON_AUTO_REPETITION_PAUSE_LEN && last_irmp_denon_command != 0)
+                            {
+                                ANALYZE_PRINTF2 ("%8.3fms warning: did not receive inverted command repetition\n",
+                                                (double) (time_counter * 1000) / F_INTERRUPTS);
+                                last_irmp_denon_command = 0;
+                                denon_repetition_len = 0xFFFF;
+                            }
+                        }
+#endif // IRMP_SUPPORT_DENON_PROTOCOL == 1
+                    }
+                }
+            }
+        }
+        else
+        {
+            if (wait_for_start_space)                                           // we have received start bit...
+            {                                                                   // ...and are counting the time of darkness
+                if (irmp_input)                                                 // still dark?
+                {                                                               // yes
+                    irmp_pause_time++;                                          // increment counter
+
+#if IRMP_SUPPORT_NIKON_PROTOCOL == 1
+                    if (((irmp_pulse_time < NIKON_START_BIT_PULSE_LEN_MIN || irmp_pulse_time > NIKON_START_BIT_PULSE_LEN_MAX) && irmp_pause_time > IRMP_TIMEOUT_LEN) ||
+                         irmp_pause_time > IRMP_TIMEOUT_NIKON_LEN)
+#else
+                    if (irmp_pause_time > IRMP_TIMEOUT_LEN)                     // timeout?
+#endif
+                    {                                                           // yes...
+#if IRMP_SUPPORT_JVC_PROTOCOL == 1
+                        if (irmp_protocol == IRMP_JVC_PROTOCOL)                 // don't show eror if JVC protocol, irmp_pulse_time has been set below!
+                        {
+                            ;
+                        }
+                        else
+#endif // IRMP_SUPPORT_JVC_PROTOCOL == 1
+                        {
+                            ANALYZE_PRINTF4 ("%8.3fms error 1: pause after start bit pulse %d too long: %d\n", (double) (time_counter * 1000) / F_INTERRUPTS, irmp_pulse_time, irmp_pause_time);
+                            ANALYZE_ONLY_NORMAL_PUTCHAR ('\n');
+                        }
+
+                        irmp_start_bit_detected = 0;                            // reset flags, let's wait for another start bit
+                        irmp_pulse_time         = 0;
+                        irmp_pause_time         = 0;
+                    }
+                }
+                else
+                {                                                               // receiving first data pulse!
+                    IRMP_PARAMETER * irmp_param_p;
+                    IRMP_START_BIT_MASK candidates;
+                    uint_fast8_t        idx;
+                    irmp_param_p = (IRMP_PARAMETER *) 0;
+                    irmp_bit = 0;
+
+#if IRMP_SUPPORT_RC5_PROTOCOL == 1 && (IRMP_SUPPORT_FDC_PROTOCOL == 1 || IRMP_SUPPORT_RCCAR_PROTOCOL == 1)
+                    irmp_param2.protocol = 0;
+#endif
+
+                    ANALYZE_PRINTF4 ("%8.3fms [start-bit: pulse = %2d, pause = %2d]\n", (double) (time_counter * 1000) / F_INTERRUPTS, irmp_pulse_time, irmp_pause_time);
+
+                    candidates = irmp_start_bit_candidates_get (irmp_pulse_time);
+
+#if IRMP_ENABLE_CANDIDATES == 1
+                    if (irmp_candidate_replaying && irmp_candidate_state == IRMP_CANDIDATE_RECORDING)
+                    {
+                        candidates = irmp_candidate_mask;                                       // replay: candidates not tried yet
+                    }
+#endif
+
+#if IRMP_ENABLE_PROTOCOL_MASK == 1
+                    candidates &= irmp_start_bit_enabled;                                       // skip disabled protocols
+#endif
+
+                    while (candidates && ! irmp_param_p)                                        // check candidates in order of priority, first match wins
+                    {
+                        idx = irmp_start_bit_first (candidates);
+                        candidates &= candidates - 1;                                           // clear it, the rest has lower priority
+
+                        switch (idx)
+                        {
+#if IRMP_SUPPORT_SIRCS_PROTOCOL == 1
+                            case IRMP_START_BIT_SIRCS:
+                                if (irmp_pulse_time >= SIRCS_START_BIT_PULSE_LEN_MIN && irmp_pulse_time <= SIRCS_START_BIT_PULSE_LEN_MAX &&
+                                    irmp_pause_time >= SIRCS_START_BIT_PAUSE_LEN_MIN && irmp_pause_time <= SIRCS_START_BIT_PAUSE_LEN_MAX)
+                                {                                                           // it's SIRCS
+                                    ANALYZE_PRINTF5 ("protocol = SIRCS, start bit timings: pulse: %3d - %3d, pause: %3d - %3d\n",
+                                                    SIRCS_START_BIT_PULSE_LEN_MIN, SIRCS_START_BIT_PULSE_LEN_MAX,
+                                                    SIRCS_START_BIT_PAUSE_LEN_MIN, SIRCS_START_BIT_PAUSE_LEN_MAX);
+                                    irmp_param_p = (IRMP_PARAMETER *) &sircs_param;
+                                }
+                                break;
+#endif // IRMP_SUPPORT_SIRCS_PROTOCOL == 1
+
+#if IRMP_SUPPORT_JVC_PROTOCOL == 1
+                            case IRMP_START_BIT_JVC:
+                                if (irmp_protocol == IRMP_JVC_PROTOCOL &&                                                       // last protocol was JVC, awaiting repeat frame
+                                    irmp_pulse_time >= JVC_START_BIT_PULSE_LEN_MIN && irmp_pulse_time <= JVC_START_BIT_PULSE_LEN_MAX &&
+                                    irmp_pause_time >= JVC_REPEAT_START_BIT_PAUSE_LEN_MIN && irmp_pause_time <= JVC_REPEAT_START_BIT_PAUSE_LEN_MAX)
+                                {
+                                    ANALYZE_PRINTF5 ("protocol = NEC or JVC (type 1) repeat frame, start bit timings: pulse: %3d - %3d, pause: %3d - %3d\n",
+                                                    JVC_START_BIT_PULSE_LEN_MIN, JVC_START_BIT_PULSE_LEN_MAX,
+                                                    JVC_REPEAT_START_BIT_PAUSE_LEN_MIN, JVC_REPEAT_START_BIT_PAUSE_LEN_MAX);
+                                    irmp_param_p = (IRMP_PARAMETER *) &nec_param;
+                                }
+                                break;
+#endif // IRMP_SUPPORT_JVC_PROTOCOL == 1
+
+#if IRMP_SUPPORT_NEC_PROTOCOL == 1
+                            case IRMP_START_BIT_NEC:
+                                if (irmp_pulse_time >= NEC_START_BIT_PULSE_LEN_MIN && irmp_pulse_time <= NEC_START_BIT_PULSE_LEN_MAX &&
+                                    irmp_pause_time >= NEC_START_BIT_PAUSE_LEN_MIN && irmp_pause_time <= NEC_START_BIT_PAUSE_LEN_MAX)
+                                {
+#if IRMP_SUPPORT_NEC42_PROTOCOL == 1
+                                    ANALYZE_PRINTF5 ("protocol = NEC42, start bit timings: pulse: %3d - %3d, pause: %3d - %3d\n",
+                                                    NEC_START_BIT_PULSE_LEN_MIN, NEC_START_BIT_PULSE_LEN_MAX,
+                                                    NEC_START_BIT_PAUSE_LEN_MIN, NEC_START_BIT_PAUSE_LEN_MAX);
+                                    irmp_param_p = (IRMP_PARAMETER *) &nec42_param;
+#else
+                                    ANALYZE_PRINTF5 ("protocol = NEC, start bit timings: pulse: %3d - %3d, pause: %3d - %3d\n",
+                                                    NEC_START_BIT_PULSE_LEN_MIN, NEC_START_BIT_PULSE_LEN_MAX,
+                                                    NEC_START_BIT_PAUSE_LEN_MIN, NEC_START_BIT_PAUSE_LEN_MAX);
+                                    irmp_param_p = (IRMP_PARAMETER *) &nec_param;
+#endif
+                                }
+                                else if (irmp_pulse_time >= NEC_START_BIT_PULSE_LEN_MIN        && irmp_pulse_time <= NEC_START_BIT_PULSE_LEN_MAX &&
+                                         irmp_pause_time >= NEC_REPEAT_START_BIT_PAUSE_LEN_MIN && irmp_pause_time <= NEC_REPEAT_START_BIT_PAUSE_LEN_MAX)
+                                {                                                           // it's NEC
+#if IRMP_SUPPORT_JVC_PROTOCOL == 1
+                                    if (irmp_protocol == IRMP_JVC_PROTOCOL)                 // last protocol was JVC, awaiting repeat frame
+                                    {                                                       // some jvc remote controls use nec repetition frame for jvc repetition frame
+                                        ANALYZE_PRINTF5 ("protocol = JVC repeat frame type 2, start bit timings: pulse: %3d - %3d, pause: %3d - %3d\n",
+                                                        NEC_START_BIT_PULSE_LEN_MIN, NEC_START_BIT_PULSE_LEN_MAX,
+                                                        NEC_REPEAT_START_BIT_PAUSE_LEN_MIN, NEC_REPEAT_START_BIT_PAUSE_LEN_MAX);
+                                        irmp_param_p = (IRMP_PARAMETER *) &nec_param;
+                                    }
+                                    else
+#endif // IRMP_SUPPORT_JVC_PROTOCOL == 1
+                                    {
+                                        ANALYZE_PRINTF5 ("protocol = NEC (repetition frame), start bit timings: pulse: %3d - %3d, pause: %3d - %3d\n",
+                                                        NEC_START_BIT_PULSE_LEN_MIN, NEC_START_BIT_PULSE_LEN_MAX,
+                                                        NEC_REPEAT_START_BIT_PAUSE_LEN_MIN, NEC_REPEAT_START_BIT_PAUSE_LEN_MAX);
+
+                                        irmp_param_p = (IRMP_PARAMETER *) &nec_rep_param;
+                                    }
+                                }
+#if IRMP_SUPPORT_JVC_PROTOCOL == 1
+                                else if (irmp_protocol == IRMP_JVC_PROTOCOL &&              // last protocol was JVC, awaiting repeat frame
+                                    irmp_pulse_time >= NEC_START_BIT_PULSE_LEN_MIN && irmp_pulse_time <= NEC_START_BIT_PULSE_LEN_MAX &&
+                                    irmp_pause_time >= NEC_0_PAUSE_LEN_MIN         && irmp_pause_time <= NEC_0_PAUSE_LEN_MAX)
+                                {                                                           // it's JVC repetition type 3
+                                    ANALYZE_PRINTF5 ("protocol = JVC repeat frame type 3, start bit timings: pulse: %3d - %3d, pause: %3d - %3d\n",
+                                                    NEC_START_BIT_PULSE_LEN_MIN, NEC_START_BIT_PULSE_LEN_MAX,
+                                                    NEC_0_PAUSE_LEN_MIN, NEC_0_PAUSE_LEN_MAX);
+                                    irmp_param_p = (IRMP_PARAMETER *) &nec_param;
+                                }
+#endif // IRMP_SUPPORT_JVC_PROTOCOL == 1
+                                break;
+#endif // IRMP_SUPPORT_NEC_PROTOCOL == 1
+
+#if IRMP_SUPPORT_TELEFUNKEN_PROTOCOL == 1
+                            case IRMP_START_BIT_TELEFUNKEN:
+                                if (irmp_pulse_time >= TELEFUNKEN_START_BIT_PULSE_LEN_MIN && irmp_pulse_time <= TELEFUNKEN_START_BIT_PULSE_LEN_MAX &&
+                                    irmp_pause_time >= TELEFUNKEN_START_BIT_PAUSE_LEN_MIN && irmp_pause_time <= TELEFUNKEN_START_BIT_PAUSE_LEN_MAX)
+                                {
+                                    ANALYZE_PRINTF5 ("protocol = TELEFUNKEN, start bit timings: pulse: %3d - %3d, pause: %3d - %3d\n",
+                                                    TELEFUNKEN_START_BIT_PULSE_LEN_MIN, TELEFUNKEN_START_BIT_PULSE_LEN_MAX,
+                                                    TELEFUNKEN_START_BIT_PAUSE_LEN_MIN, TELEFUNKEN_START_BIT_PAUSE_LEN_MAX);
+                                    irmp_param_p = (IRMP_PARAMETER *) &telefunken_param;
+                                }
+                                break;
+#endif // IRMP_SUPPORT_TELEFUNKEN_PROTOCOL == 1
+
+#if IRMP_SUPPORT_ROOMBA_PROTOCOL == 1
+                            case IRMP_START_BIT_ROOMBA:
+                                if (irmp_pulse_time >= ROOMBA_START_BIT_PULSE_LEN_MIN && irmp_pulse_time <= ROOMBA_START_BIT_PULSE_LEN_MAX &&
+                                    irmp_pause_time >= ROOMBA_START_BIT_PAUSE_LEN_MIN && irmp_pause_time <= ROOMBA_START_BIT_PAUSE_LEN_MAX)
+                                {
+                                    ANALYZE_PRINTF5 ("protocol = ROOMBA, start bit timings: pulse: %3d - %3d, pause: %3d - %3d\n",
+                                                    ROOMBA_START_BIT_PULSE_LEN_MIN, ROOMBA_START_BIT_PULSE_LEN_MAX,
+                                                    ROOMBA_START_BIT_PAUSE_LEN_MIN, ROOMBA_START_BIT_PAUSE_LEN_MAX);
+                                    irmp_param_p = (IRMP_PARAMETER *) &roomba_param;
+                                }
+                                break;
+#endif // IRMP_SUPPORT_ROOMBA_PROTOCOL == 1
+
+#if IRMP_SUPPORT_ACP24_PROTOCOL == 1
+                            case IRMP_START_BIT_ACP24:
+                                if (irmp_pulse_time >= ACP24_START_BIT_PULSE_LEN_MIN && irmp_pulse_time <= ACP24_START_BIT_PULSE_LEN_MAX &&
+                                    irmp_pause_time >= ACP24_START_BIT_PAUSE_LEN_MIN && irmp_pause_time <= ACP24_START_BIT_PAUSE_LEN_MAX)
+                                {
+                                    ANALYZE_PRINTF5 ("protocol = ACP24, start bit timings: pulse: %3d - %3d, pause: %3d - %3d\n",
+                                                    ACP24_START_BIT_PULSE_LEN_MIN, ACP24_START_BIT_PULSE_LEN_MAX,
+                                                    ACP24_START_BIT_PAUSE_LEN_MIN, ACP24_START_BIT_PAUSE_LEN_MAX);
+                                    irmp_param_p = (IRMP_PARAMETER *) &acp24_param;
+                                }
+                                break;
+#endif // IRMP_SUPPORT_ROOMBA_PROTOCOL == 1
+
+#if IRMP_SUPPORT_PENTAX_PROTOCOL == 1
+                            case IRMP_START_BIT_PENTAX:
+                                if (irmp_pulse_time >= PENTAX_START_BIT_PULSE_LEN_MIN && irmp_pulse_time <= PENTAX_START_BIT_PULSE_LEN_MAX &&
+                                    irmp_pause_time >= PENTAX_START_BIT_PAUSE_LEN_MIN && irmp_pause_time <= PENTAX_START_BIT_PAUSE_LEN_MAX)
+                                {
+                                    ANALYZE_PRINTF5 ("protocol = PENTAX, start bit timings: pulse: %3d - %3d, pause: %3d - %3d\n",
+                                                    PENTAX_START_BIT_PULSE_LEN_MIN, PENTAX_START_BIT_PULSE_LEN_MAX,
+                                                    PENTAX_START_BIT_PAUSE_LEN_MIN, PENTAX_START_BIT_PAUSE_LEN_MAX);
+                                    irmp_param_p = (IRMP_PARAMETER *) &pentax_param;
+                                }
+                                break;
+#endif // IRMP_SUPPORT_PENTAX_PROTOCOL == 1
+
+#if IRMP_SUPPORT_NIKON_PROTOCOL == 1
+                            case IRMP_START_BIT_NIKON:
+                                if (irmp_pulse_time >= NIKON_START_BIT_PULSE_LEN_MIN && irmp_pulse_time <= NIKON_START_BIT_PULSE_LEN_MAX &&
+                                    irmp_pause_time >= NIKON_START_BIT_PAUSE_LEN_MIN && irmp_pause_time <= NIKON_START_BIT_PAUSE_LEN_MAX)
+                                {
+                                    ANALYZE_PRINTF5 ("protocol = NIKON, start bit timings: pulse: %3d - %3d, pause: %3u - %3u\n",
+                                                    NIKON_START_BIT_PULSE_LEN_MIN, NIKON_START_BIT_PULSE_LEN_MAX,
+                                                    (unsigned int) NIKON_START_BIT_PAUSE_LEN_MIN, (unsigned int) NIKON_START_BIT_PAUSE_LEN_MAX);
+                                    irmp_param_p = (IRMP_PARAMETER *) &nikon_param;
+                                }
+                                break;
+#endif // IRMP_SUPPORT_NIKON_PROTOCOL == 1
+
+#if IRMP_SUPPORT_SAMSUNG_PROTOCOL == 1
+                            case IRMP_START_BIT_SAMSUNG:
+                                if (irmp_pulse_time >= SAMSUNG_START_BIT_PULSE_LEN_MIN && irmp_pulse_time <= SAMSUNG_START_BIT_PULSE_LEN_MAX &&
+                                    irmp_pause_time >= SAMSUNG_START_BIT_PAUSE_LEN_MIN && irmp_pause_time <= SAMSUNG_START_BIT_PAUSE_LEN_MAX)
+                                {                                                           // it's SAMSUNG
+                                    ANALYZE_PRINTF5 ("protocol = SAMSUNG, start bit timings: pulse: %3d - %3d, pause: %3d - %3d\n",
+                                                    SAMSUNG_START_BIT_PULSE_LEN_MIN, SAMSUNG_START_BIT_PULSE_LEN_MAX,
+                                                    SAMSUNG_START_BIT_PAUSE_LEN_MIN, SAMSUNG_START_BIT_PAUSE_LEN_MAX);
+                                    irmp_param_p = (IRMP_PARAMETER *) &samsung_param;
+                                }
+                                break;
+#endif // IRMP_SUPPORT_SAMSUNG_PROTOCOL == 1
+
+#if IRMP_SUPPORT_SAMSUNGAH_PROTOCOL == 1
+                            case IRMP_START_BIT_SAMSUNGAH:
+                                if (irmp_pulse_time >= SAMSUNGAH_START_BIT_PULSE_LEN_MIN && irmp_pulse_time <= SAMSUNGAH_START_BIT_PULSE_LEN_MAX &&
+                                    irmp_pause_time >= SAMSUNGAH_START_BIT_PAUSE_LEN_MIN && irmp_pause_time <= SAMSUNGAH_START_BIT_PAUSE_LEN_MAX)
+                                {                                                           // it's SAMSUNGAH
+                                    ANALYZE_PRINTF5 ("protocol = SAMSUNGAH, start bit timings: pulse: %3d - %3d, pause: %3d - %3d\n",
+                                                    SAMSUNGAH_START_BIT_PULSE_LEN_MIN, SAMSUNGAH_START_BIT_PULSE_LEN_MAX,
+                                                    SAMSUNGAH_START_BIT_PAUSE_LEN_MIN, SAMSUNGAH_START_BIT_PAUSE_LEN_MAX);
+                                    irmp_param_p = (IRMP_PARAMETER *) &samsungah_param;
+                                }
+                                break;
+#endif // IRMP_SUPPORT_SAMSUNGAH_PROTOCOL == 1
+
+#if IRMP_SUPPORT_MATSUSHITA_PROTOCOL == 1
+                            case IRMP_START_BIT_MATSUSHITA:
+                                if (irmp_pulse_time >= MATSUSHITA_START_BIT_PULSE_LEN_MIN && irmp_pulse_time <= MATSUSHITA_START_BIT_PULSE_LEN_MAX &&
+                                    irmp_pause_time >= MATSUSHITA_START_BIT_PAUSE_LEN_MIN && irmp_pause_time <= MATSUSHITA_START_BIT_PAUSE_LEN_MAX)
+                                {                                                           // it's MATSUSHITA
+                                    ANALYZE_PRINTF5 ("protocol = MATSUSHITA, start bit timings: pulse: %3d - %3d, pause: %3d - %3d\n",
+                                                    MATSUSHITA_START_BIT_PULSE_LEN_MIN, MATSUSHITA_START_BIT_PULSE_LEN_MAX,
+                                                    MATSUSHITA_START_BIT_PAUSE_LEN_MIN, MATSUSHITA_START_BIT_PAUSE_LEN_MAX);
+                                    irmp_param_p = (IRMP_PARAMETER *) &matsushita_param;
+                                }
+                                break;
+#endif // IRMP_SUPPORT_MATSUSHITA_PROTOCOL == 1
+
+#if IRMP_SUPPORT_KASEIKYO_PROTOCOL == 1
+                            case IRMP_START_BIT_KASEIKYO:
+                                if (irmp_pulse_time >= KASEIKYO_START_BIT_PULSE_LEN_MIN && irmp_pulse_time <= KASEIKYO_START_BIT_PULSE_LEN_MAX &&
+                                    irmp_pause_time >= KASEIKYO_START_BIT_PAUSE_LEN_MIN && irmp_pause_time <= KASEIKYO_START_BIT_PAUSE_LEN_MAX)
+                                {                                                           // it's KASEIKYO
+                                    ANALYZE_PRINTF5 ("protocol = KASEIKYO, start bit timings: pulse: %3d - %3d, pause: %3d - %3d\n",
+                                                    KASEIKYO_START_BIT_PULSE_LEN_MIN, KASEIKYO_START_BIT_PULSE_LEN_MAX,
+                                                    KASEIKYO_START_BIT_PAUSE_LEN_MIN, KASEIKYO_START_BIT_PAUSE_LEN_MAX);
+                                    irmp_param_p = (IRMP_PARAMETER *) &kaseikyo_param;
+                                }
+                                break;
+#endif // IRMP_SUPPORT_KASEIKYO_PROTOCOL == 1
+
+#if IRMP_SUPPORT_PANASONIC_PROTOCOL == 1
+                            case IRMP_START_BIT_PANASONIC:
+                                if (irmp_pulse_time >= PANASONIC_START_BIT_PULSE_LEN_MIN && irmp_pulse_time <= PANASONIC_START_BIT_PULSE_LEN_MAX &&
+                                    irmp_pause_time >= PANASONIC_START_BIT_PAUSE_LEN_MIN && irmp_pause_time <= PANASONIC_START_BIT_PAUSE_LEN_MAX)
+                                {                                                           // it's PANASONIC
+                                    ANALYZE_PRINTF5 ("protocol = PANASONIC, start bit timings: pulse: %3d - %3d, pause: %3d - %3d\n",
+                                                    PANASONIC_START_BIT_PULSE_LEN_MIN, PANASONIC_START_BIT_PULSE_LEN_MAX,
+                                                    PANASONIC_START_BIT_PAUSE_LEN_MIN, PANASONIC_START_BIT_PAUSE_LEN_MAX);
+                                    irmp_param_p = (IRMP_PARAMETER *) &panasonic_param;
+                                }
+                                break;
+#endif // IRMP_SUPPORT_PANASONIC_PROTOCOL == 1
+
+#if IRMP_SUPPORT_MITSU_HEAVY_PROTOCOL == 1
+                            case IRMP_START_BIT_MITSU_HEAVY:
+                                if (irmp_pulse_time >= MITSU_HEAVY_START_BIT_PULSE_LEN_MIN && irmp_pulse_time <= MITSU_HEAVY_START_BIT_PULSE_LEN_MAX &&
+                                    irmp_pause_time >= MITSU_HEAVY_START_BIT_PAUSE_LEN_MIN && irmp_pause_time <= MITSU_HEAVY_START_BIT_PAUSE_LEN_MAX)
+                                {                                                           // it's MITSU_HEAVY
+                                    ANALYZE_PRINTF5 ("protocol = MITSU_HEAVY, start bit timings: pulse: %3d - %3d, pause: %3d - %3d\n",
+                                                    MITSU_HEAVY_START_BIT_PULSE_LEN_MIN, MITSU_HEAVY_START_BIT_PULSE_LEN_MAX,
+                                                    MITSU_HEAVY_START_BIT_PAUSE_LEN_MIN, MITSU_HEAVY_START_BIT_PAUSE_LEN_MAX);
+                                    irmp_param_p = (IRMP_PARAMETER *) &mitsu_heavy_param;
+                                }
+                                break;
+#endif // IRMP_SUPPORT_MITSU_HEAVY_PROTOCOL == 1
+
+#if IRMP_SUPPORT_VINCENT_PROTOCOL == 1
+                            case IRMP_START_BIT_VINCENT:
+                                if (irmp_pulse_time >= VINCENT_START_BIT_PULSE_LEN_MIN && irmp_pulse_time <= VINCENT_START_BIT_PULSE_LEN_MAX &&
+                                    irmp_pause_time >= VINCENT_START_BIT_PAUSE_LEN_MIN && irmp_pause_time <= VINCENT_START_BIT_PAUSE_LEN_MAX)
+                                {                                                           // it's VINCENT
+                                    ANALYZE_PRINTF5 ("protocol = VINCENT, start bit timings: pulse: %3d - %3d, pause: %3d - %3d\n",
+                                                    VINCENT_START_BIT_PULSE_LEN_MIN, VINCENT_START_BIT_PULSE_LEN_MAX,
+                                                    VINCENT_START_BIT_PAUSE_LEN_MIN, VINCENT_START_BIT_PAUSE_LEN_MAX);
+                                    irmp_param_p = (IRMP_PARAMETER *) &vincent_param;
+                                }
+                                break;
+#endif // IRMP_SUPPORT_VINCENT_PROTOCOL == 1
+
+#if IRMP_SUPPORT_METZ_PROTOCOL == 1
+                            case IRMP_START_BIT_METZ:
+                                if (irmp_pulse_time >= METZ_START_BIT_PULSE_LEN_MIN && irmp_pulse_time <= METZ_START_BIT_PULSE_LEN_MAX &&
+                                    irmp_pause_time >= METZ_START_BIT_PAUSE_LEN_MIN && irmp_pause_time <= METZ_START_BIT_PAUSE_LEN_MAX)
+                                {
+                                    ANALYZE_PRINTF5 ("protocol = METZ, start bit timings: pulse: %3d - %3d, pause: %3d - %3d\n",
+                                                    METZ_START_BIT_PULSE_LEN_MIN, METZ_START_BIT_PULSE_LEN_MAX,
+                                                    METZ_START_BIT_PAUSE_LEN_MIN, METZ_START_BIT_PAUSE_LEN_MAX);
+                                    irmp_param_p = (IRMP_PARAMETER *) &metz_param;
+                                }
+                                break;
+#endif // IRMP_SUPPORT_METZ_PROTOCOL == 1
+
+#if IRMP_SUPPORT_RF_GEN24_PROTOCOL == 1                                         // RF_GEN24 has no start bit
+                            case IRMP_START_BIT_RF_GEN24_0:
+                                if (irmp_pulse_time >= RF_GEN24_0_PULSE_LEN_MIN && irmp_pulse_time <= RF_GEN24_0_PULSE_LEN_MAX &&
+                                    irmp_pause_time >= RF_GEN24_0_PAUSE_LEN_MIN && irmp_pause_time <= RF_GEN24_0_PAUSE_LEN_MAX)
+                                {
+                                    ANALYZE_PRINTF1 ("protocol = RF_GEN24\n");
+                                    irmp_param_p = (IRMP_PARAMETER *) &rf_gen24_param;
+                                    bit_0 = 0;
+                                }
+                                break;
+                            case IRMP_START_BIT_RF_GEN24_1:
+                                if (irmp_pulse_time >= RF_GEN24_1_PULSE_LEN_MIN && irmp_pulse_time <= RF_GEN24_1_PULSE_LEN_MAX &&
+                                    irmp_pause_time >= RF_GEN24_1_PAUSE_LEN_MIN && irmp_pause_time <= RF_GEN24_1_PAUSE_LEN_MAX)
+                                {
+                                    ANALYZE_PRINTF1 ("protocol = RF_GEN24\n");
+                                    irmp_param_p = (IRMP_PARAMETER *) &rf_gen24_param;
+                                    bit_0 = 1;
+                                }
+                                break;
+#endif // IRMP_SUPPORT_RF_GEN24_PROTOCOL == 1
+
+#if IRMP_SUPPORT_RF_X10_PROTOCOL == 1
+                            case IRMP_START_BIT_RF_X10:
+                                if (irmp_pulse_time >= RF_X10_START_BIT_PULSE_LEN_MIN && irmp_pulse_time <= RF_X10_START_BIT_PULSE_LEN_MAX &&
+                                    irmp_pause_time >= RF_X10_START_BIT_PAUSE_LEN_MIN && irmp_pause_time <= RF_X10_START_BIT_PAUSE_LEN_MAX)
+                                {
+                                    ANALYZE_PRINTF5 ("protocol = RF_X10, start bit timings: pulse: %3d - %3d, pause: %3d - %3d\n",
+                                                    RF_X10_START_BIT_PULSE_LEN_MIN, RF_X10_START_BIT_PULSE_LEN_MAX,
+                                                    RF_X10_START_BIT_PAUSE_LEN_MIN, RF_X10_START_BIT_PAUSE_LEN_MAX);
+                                    irmp_param_p = (IRMP_PARAMETER *) &rf_x10_param;
+                                }
+                                break;
+#endif // IRMP_SUPPORT_RF_X10_PROTOCOL == 1
+
+#if IRMP_SUPPORT_RF_MEDION_PROTOCOL == 1
+                            case IRMP_START_BIT_RF_MEDION:
+                                if (irmp_pulse_time >= RF_MEDION_START_BIT_PULSE_LEN_MIN && irmp_pulse_time <= RF_MEDION_START_BIT_PULSE_LEN_MAX &&
+                                    irmp_pause_time >= RF_MEDION_START_BIT_PAUSE_LEN_MIN && irmp_pause_time <= RF_MEDION_START_BIT_PAUSE_LEN_MAX)
+                                {
+                                    ANALYZE_PRINTF5 ("protocol = RF_MEDION, start bit timings: pulse: %3d - %3d, pause: %3d - %3d\n",
+                                                    RF_MEDION_START_BIT_PULSE_LEN_MIN, RF_MEDION_START_BIT_PULSE_LEN_MAX,
+                                                    RF_MEDION_START_BIT_PAUSE_LEN_MIN, RF_MEDION_START_BIT_PAUSE_LEN_MAX);
+                                    irmp_param_p = (IRMP_PARAMETER *) &rf_medion_param;
+                                }
+                                break;
+#endif // IRMP_SUPPORT_RF_MEDION_PROTOCOL == 1
+
+#if IRMP_SUPPORT_RECS80_PROTOCOL == 1
+                            case IRMP_START_BIT_RECS80:
+                                if (irmp_pulse_time >= RECS80_START_BIT_PULSE_LEN_MIN && irmp_pulse_time <= RECS80_START_BIT_PULSE_LEN_MAX &&
+                                    irmp_pause_time >= RECS80_START_BIT_PAUSE_LEN_MIN && irmp_pause_time <= RECS80_START_BIT_PAUSE_LEN_MAX)
+                                {                                                           // it's RECS80
+                                    ANALYZE_PRINTF5 ("protocol = RECS80, start bit timings: pulse: %3d - %3d, pause: %3d - %3d\n",
+                                                    RECS80_START_BIT_PULSE_LEN_MIN, RECS80_START_BIT_PULSE_LEN_MAX,
+                                                    RECS80_START_BIT_PAUSE_LEN_MIN, RECS80_START_BIT_PAUSE_LEN_MAX);
+                                    irmp_param_p = (IRMP_PARAMETER *) &recs80_param;
+                                }
+                                break;
+#endif // IRMP_SUPPORT_RECS80_PROTOCOL == 1
+
+#if IRMP_SUPPORT_S100_PROTOCOL == 1
+                            case IRMP_START_BIT_S100:
+                                if (((irmp_pulse_time >= S100_START_BIT_LEN_MIN     && irmp_pulse_time <= S100_START_BIT_LEN_MAX) ||
+                                     (irmp_pulse_time >= 2 * S100_START_BIT_LEN_MIN && irmp_pulse_time <= 2 * S100_START_BIT_LEN_MAX)) &&
+                                    ((irmp_pause_time >= S100_START_BIT_LEN_MIN     && irmp_pause_time <= S100_START_BIT_LEN_MAX) ||
+                                     (irmp_pause_time >= 2 * S100_START_BIT_LEN_MIN && irmp_pause_time <= 2 * S100_START_BIT_LEN_MAX)))
+                                {                                                           // it's S100
+                                    ANALYZE_PRINTF9 ("protocol = S100, start bit timings: pulse: %3d - %3d, pause: %3d - %3d or pulse: %3d - %3d, pause: %3d - %3d\n",
+                                                    S100_START_BIT_LEN_MIN, S100_START_BIT_LEN_MAX,
+                                                    2 * S100_START_BIT_LEN_MIN, 2 * S100_START_BIT_LEN_MAX,
+                                                    S100_START_BIT_LEN_MIN, S100_START_BIT_LEN_MAX,
+                                                    2 * S100_START_BIT_LEN_MIN, 2 * S100_START_BIT_LEN_MAX);
+
+                                    irmp_param_p = (IRMP_PARAMETER *) &s100_param;
+                                    last_pause = irmp_pause_time;
+
+                                    if ((irmp_pulse_time > S100_START_BIT_LEN_MAX && irmp_pulse_time <= 2 * S100_START_BIT_LEN_MAX) ||
+                                        (irmp_pause_time > S100_START_BIT_LEN_MAX && irmp_pause_time <= 2 * S100_START_BIT_LEN_MAX))
+                                    {
+                                      last_value  = 0;
+                                      rc5_cmd_bit6 = 1<<6;
+                                    }
+                                    else
+                                    {
+                                      last_value  = 1;
+                                    }
+                                }
+                                break;
+#endif // IRMP_SUPPORT_S100_PROTOCOL == 1
+
+#if IRMP_SUPPORT_RC5_PROTOCOL == 1
+                            case IRMP_START_BIT_RC5:
+                                if (((irmp_pulse_time >= RC5_START_BIT_LEN_MIN     && irmp_pulse_time <= RC5_START_BIT_LEN_MAX) ||
+                                     (irmp_pulse_time >= 2 * RC5_START_BIT_LEN_MIN && irmp_pulse_time <= 2 * RC5_START_BIT_LEN_MAX)) &&
+                                    ((irmp_pause_time >= RC5_START_BIT_LEN_MIN     && irmp_pause_time <= RC5_START_BIT_LEN_MAX) ||
+                                     (irmp_pause_time >= 2 * RC5_START_BIT_LEN_MIN && irmp_pause_time <= 2 * RC5_START_BIT_LEN_MAX)))
+                                {                                                           // it's RC5
+#if IRMP_SUPPORT_FDC_PROTOCOL == 1
+                                    if (irmp_pulse_time >= FDC_START_BIT_PULSE_LEN_MIN && irmp_pulse_time <= FDC_START_BIT_PULSE_LEN_MAX &&
+                                        irmp_pause_time >= FDC_START_BIT_PAUSE_LEN_MIN && irmp_pause_time <= FDC_START_BIT_PAUSE_LEN_MAX)
+                                    {
+                                        ANALYZE_PRINTF1 ("protocol = RC5 or FDC\n");
+                                        ANALYZE_PRINTF5 ("FDC start bit timings: pulse: %3d - %3d, pause: %3d - %3d\n",
+                                                        FDC_START_BIT_PULSE_LEN_MIN, FDC_START_BIT_PULSE_LEN_MAX,
+                                                        FDC_START_BIT_PAUSE_LEN_MIN, FDC_START_BIT_PAUSE_LEN_MAX);
+                                        ANALYZE_PRINTF5 ("RC5 start bit timings: pulse: %3d - %3d, pause: %3d - %3d\n",
+                                                        RC5_START_BIT_LEN_MIN, RC5_START_BIT_LEN_MAX,
+                                                        RC5_START_BIT_LEN_MIN, RC5_START_BIT_LEN_MAX);
+                                        memcpy_P (&irmp_param2, &fdc_param, sizeof (IRMP_PARAMETER));
+                                    }
+                                    else
+#endif // IRMP_SUPPORT_FDC_PROTOCOL == 1
+
+#if IRMP_SUPPORT_RCCAR_PROTOCOL == 1
+                                    if (irmp_pulse_time >= RCCAR_START_BIT_PULSE_LEN_MIN && irmp_pulse_time <= RCCAR_START_BIT_PULSE_LEN_MAX &&
+                                        irmp_pause_time >= RCCAR_START_BIT_PAUSE_LEN_MIN && irmp_pause_time <= RCCAR_START_BIT_PAUSE_LEN_MAX)
+                                    {
+                                        ANALYZE_PRINTF1 ("protocol = RC5 or RCCAR\n");
+                                        ANALYZE_PRINTF5 ("RCCAR start bit timings: pulse: %3d - %3d, pause: %3d - %3d\n",
+                                                        RCCAR_START_BIT_PULSE_LEN_MIN, RCCAR_START_BIT_PULSE_LEN_MAX,
+                                                        RCCAR_START_BIT_PAUSE_LEN_MIN, RCCAR_START_BIT_PAUSE_LEN_MAX);
+                                        ANALYZE_PRINTF5 ("RC5 start bit timings: pulse: %3d - %3d, pause: %3d - %3d\n",
+                                                        RC5_START_BIT_LEN_MIN, RC5_START_BIT_LEN_MAX,
+                                                        RC5_START_BIT_LEN_MIN, RC5_START_BIT_LEN_MAX);
+                                        memcpy_P (&irmp_param2, &rccar_param, sizeof (IRMP_PARAMETER));
+                                    }
+                                    else
+#endif // IRMP_SUPPORT_RCCAR_PROTOCOL == 1
+                                    {
+                                        ANALYZE_PRINTF9 ("protocol = RC5, start bit timings: pulse: %3d - %3d, pause: %3d - %3d or pulse: %3d - %3d, pause: %3d - %3d\n",
+                                                        RC5_START_BIT_LEN_MIN, RC5_START_BIT_LEN_MAX,
+                                                        2 * RC5_START_BIT_LEN_MIN, 2 * RC5_START_BIT_LEN_MAX,
+                                                        RC5_START_BIT_LEN_MIN, RC5_START_BIT_LEN_MAX,
+                                                        2 * RC5_START_BIT_LEN_MIN, 2 * RC5_START_BIT_LEN_MAX);
+                                    }
+
+                                    irmp_param_p = (IRMP_PARAMETER *) &rc5_param;
+                                    last_pause = irmp_pause_time;
+
+                                    if ((irmp_pulse_time > RC5_START_BIT_LEN_MAX && irmp_pulse_time <= 2 * RC5_START_BIT_LEN_MAX) ||
+                                        (irmp_pause_time > RC5_START_BIT_LEN_MAX && irmp_pause_time <= 2 * RC5_START_BIT_LEN_MAX))
+                                    {
+                                        last_value  = 0;
+                                        rc5_cmd_bit6 = 1<<6;
+                                    }
+                                    else
+                                    {
+                                        last_value  = 1;
+                                    }
+                                }
+                                break;
+#endif // IRMP_SUPPORT_RC5_PROTOCOL == 1
+
+#if IRMP_SUPPORT_RCII_PROTOCOL == 1
+                            case IRMP_START_BIT_RCII:
+                                if ((irmp_pulse_time >= RCII_START_BIT_PULSE_LEN_MIN && irmp_pulse_time <= RCII_START_BIT_PULSE_LEN_MAX) &&
+                                    (irmp_pause_time >= RCII_START_BIT_PAUSE_LEN_MIN && irmp_pause_time <= RCII_START_BIT_PAUSE_LEN_MAX))
+                                {                                                           // it's RCII
+                                    ANALYZE_PRINTF5 ("protocol = RCII, start bit timings: pulse: %3d - %3d, pause: %3d - %3d\n",
+                                                    RCII_START_BIT_PULSE_LEN_MIN, RCII_START_BIT_PULSE_LEN_MAX,
+                                                    RCII_START_BIT_PAUSE_LEN_MIN, RCII_START_BIT_PAUSE_LEN_MAX)
+                                    irmp_param_p = (IRMP_PARAMETER *) &rcii_param;
+                                    last_pause = irmp_pause_time;
+                                    waiting_for_2nd_pulse = 1;
+                                    last_value  = 1;
+                                }
+                                break;
+#endif // IRMP_SUPPORT_RCII_PROTOCOL == 1
+
+#if IRMP_SUPPORT_DENON_PROTOCOL == 1
+                            case IRMP_START_BIT_DENON:
+                                if ( (irmp_pulse_time >= DENON_PULSE_LEN_MIN && irmp_pulse_time <= DENON_PULSE_LEN_MAX) &&
+                                    ((irmp_pause_time >= DENON_1_PAUSE_LEN_MIN && irmp_pause_time <= DENON_1_PAUSE_LEN_MAX) ||
+                                     (irmp_pause_time >= DENON_0_PAUSE_LEN_MIN && irmp_pause_time <= DENON_0_PAUSE_LEN_MAX)))
+                                {                                                           // it's DENON
+                                    ANALYZE_PRINTF7 ("protocol = DENON, start bit timings: pulse: %3d - %3d, pause: %3d - %3d or %3d - %3d\n",
+                                                    DENON_PULSE_LEN_MIN, DENON_PULSE_LEN_MAX,
+                                                    DENON_1_PAUSE_LEN_MIN, DENON_1_PAUSE_LEN_MAX,
+                                                    DENON_0_PAUSE_LEN_MIN, DENON_0_PAUSE_LEN_MAX);
+                                    irmp_param_p = (IRMP_PARAMETER *) &denon_param;
+                                }
+                                break;
+#endif // IRMP_SUPPORT_DENON_PROTOCOL == 1
+
+#if IRMP_SUPPORT_THOMSON_PROTOCOL == 1
+                            case IRMP_START_BIT_THOMSON:
+                                if ( (irmp_pulse_time >= THOMSON_PULSE_LEN_MIN && irmp_pulse_time <= THOMSON_PULSE_LEN_MAX) &&
+                                    ((irmp_pause_time >= THOMSON_1_PAUSE_LEN_MIN && irmp_pause_time <= THOMSON_1_PAUSE_LEN_MAX) ||
+                                     (irmp_pause_time >= THOMSON_0_PAUSE_LEN_MIN && irmp_pause_time <= THOMSON_0_PAUSE_LEN_MAX)))
+                                {                                                           // it's THOMSON
+                                    ANALYZE_PRINTF7 ("protocol = THOMSON, start bit timings: pulse: %3d - %3d, pause: %3d - %3d or %3d - %3d\n",
+                                                    THOMSON_PULSE_LEN_MIN, THOMSON_PULSE_LEN_MAX,
+                                                    THOMSON_1_PAUSE_LEN_MIN, THOMSON_1_PAUSE_LEN_MAX,
+                                                    THOMSON_0_PAUSE_LEN_MIN, THOMSON_0_PAUSE_LEN_MAX);
+                                    irmp_param_p = (IRMP_PARAMETER *) &thomson_param;
+                                }
+                                break;
+#endif // IRMP_SUPPORT_THOMSON_PROTOCOL == 1
+
+#if IRMP_SUPPORT_BOSE_PROTOCOL == 1
+                            case IRMP_START_BIT_BOSE:
+                                if (irmp_pulse_time >= BOSE_START_BIT_PULSE_LEN_MIN && irmp_pulse_time <= BOSE_START_BIT_PULSE_LEN_MAX &&
+                                    irmp_pause_time >= BOSE_START_BIT_PAUSE_LEN_MIN && irmp_pause_time <= BOSE_START_BIT_PAUSE_LEN_MAX)
+                                {
+                                    ANALYZE_PRINTF5 ("protocol = BOSE, start bit timings: pulse: %3d - %3d, pause: %3d - %3d\n",
+                                                    BOSE_START_BIT_PULSE_LEN_MIN, BOSE_START_BIT_PULSE_LEN_MAX,
+                                                    BOSE_START_BIT_PAUSE_LEN_MIN, BOSE_START_BIT_PAUSE_LEN_MAX);
+                                    irmp_param_p = (IRMP_PARAMETER *) &bose_param;
+                                }
+                                break;
+#endif // IRMP_SUPPORT_BOSE_PROTOCOL == 1
+
+#if IRMP_SUPPORT_RC6_PROTOCOL == 1
+                            case IRMP_START_BIT_RC6:
+                                if (irmp_pulse_time >= RC6_START_BIT_PULSE_LEN_MIN && irmp_pulse_time <= RC6_START_BIT_PULSE_LEN_MAX &&
+                                    irmp_pause_time >= RC6_START_BIT_PAUSE_LEN_MIN && irmp_pause_time <= RC6_START_BIT_PAUSE_LEN_MAX)
+                                {                                                           // it's RC6
+                                    ANALYZE_PRINTF5 ("protocol = RC6, start bit timings: pulse: %3d - %3d, pause: %3d - %3d\n",
+                                                    RC6_START_BIT_PULSE_LEN_MIN, RC6_START_BIT_PULSE_LEN_MAX,
+                                                    RC6_START_BIT_PAUSE_LEN_MIN, RC6_START_BIT_PAUSE_LEN_MAX);
+                                    irmp_param_p = (IRMP_PARAMETER *) &rc6_param;
+                                    last_pause = 0;
+                                    last_value = 1;
+                                }
+                                break;
+#endif // IRMP_SUPPORT_RC6_PROTOCOL == 1
+
+#if IRMP_SUPPORT_RECS80EXT_PROTOCOL == 1
+                            case IRMP_START_BIT_RECS80EXT:
+                                if (irmp_pulse_time >= RECS80EXT_START_BIT_PULSE_LEN_MIN && irmp_pulse_time <= RECS80EXT_START_BIT_PULSE_LEN_MAX &&
+                                    irmp_pause_time >= RECS80EXT_START_BIT_PAUSE_LEN_MIN && irmp_pause_time <= RECS80EXT_START_BIT_PAUSE_LEN_MAX)
+                                {                                                           // it's RECS80EXT
+                                    ANALYZE_PRINTF5 ("protocol = RECS80EXT, start bit timings: pulse: %3d - %3d, pause: %3d - %3d\n",
+                                                    RECS80EXT_START_BIT_PULSE_LEN_MIN, RECS80EXT_START_BIT_PULSE_LEN_MAX,
+                                                    RECS80EXT_START_BIT_PAUSE_LEN_MIN, RECS80EXT_START_BIT_PAUSE_LEN_MAX);
+                                    irmp_param_p = (IRMP_PARAMETER *) &recs80ext_param;
+                                }
+                                break;
+#endif // IRMP_SUPPORT_RECS80EXT_PROTOCOL == 1
+
+#if IRMP_SUPPORT_NUBERT_PROTOCOL == 1
+                            case IRMP_START_BIT_NUBERT:
+                                if (irmp_pulse_time >= NUBERT_START_BIT_PULSE_LEN_MIN && irmp_pulse_time <= NUBERT_START_BIT_PULSE_LEN_MAX &&
+                                    irmp_pause_time >= NUBERT_START_BIT_PAUSE_LEN_MIN && irmp_pause_time <= NUBERT_START_BIT_PAUSE_LEN_MAX)
+                                {                                                           // it's NUBERT
+                                    ANALYZE_PRINTF5 ("protocol = NUBERT, start bit timings: pulse: %3d - %3d, pause: %3d - %3d\n",
+                                                    NUBERT_START_BIT_PULSE_LEN_MIN, NUBERT_START_BIT_PULSE_LEN_MAX,
+                                                    NUBERT_START_BIT_PAUSE_LEN_MIN, NUBERT_START_BIT_PAUSE_LEN_MAX);
+                                    irmp_param_p = (IRMP_PARAMETER *) &nubert_param;
+                                }
+                                break;
+#endif // IRMP_SUPPORT_NUBERT_PROTOCOL == 1
+
+#if IRMP_SUPPORT_FAN_PROTOCOL == 1
+                            case IRMP_START_BIT_FAN:
+                                if (irmp_pulse_time >= FAN_START_BIT_PULSE_LEN_MIN && irmp_pulse_time <= FAN_START_BIT_PULSE_LEN_MAX &&
+                                    irmp_pause_time >= FAN_START_BIT_PAUSE_LEN_MIN && irmp_pause_time <= FAN_START_BIT_PAUSE_LEN_MAX)
+                                {                                                           // it's FAN
+                                    ANALYZE_PRINTF5 ("protocol = FAN, start bit timings: pulse: %3d - %3d, pause: %3d - %3d\n",
+                                                    FAN_START_BIT_PULSE_LEN_MIN, FAN_START_BIT_PULSE_LEN_MAX,
+                                                    FAN_START_BIT_PAUSE_LEN_MIN, FAN_START_BIT_PAUSE_LEN_MAX);
+                                    irmp_param_p = (IRMP_PARAMETER *) &fan_param;
+                                }
+                                break;
+#endif // IRMP_SUPPORT_FAN_PROTOCOL == 1
+
+#if IRMP_SUPPORT_SPEAKER_PROTOCOL == 1
+                            case IRMP_START_BIT_SPEAKER:
+                                if (irmp_pulse_time >= SPEAKER_START_BIT_PULSE_LEN_MIN && irmp_pulse_time <= SPEAKER_START_BIT_PULSE_LEN_MAX &&
+                                    irmp_pause_time >= SPEAKER_START_BIT_PAUSE_LEN_MIN && irmp_pause_time <= SPEAKER_START_BIT_PAUSE_LEN_MAX)
+                                {                                                           // it's SPEAKER
+                                    ANALYZE_PRINTF5 ("protocol = SPEAKER, start bit timings: pulse: %3d - %3d, pause: %3d - %3d\n",
+                                                    SPEAKER_START_BIT_PULSE_LEN_MIN, SPEAKER_START_BIT_PULSE_LEN_MAX,
+                                                    SPEAKER_START_BIT_PAUSE_LEN_MIN, SPEAKER_START_BIT_PAUSE_LEN_MAX);
+                                    irmp_param_p = (IRMP_PARAMETER *) &speaker_param;
+                                }
+                                break;
+#endif // IRMP_SUPPORT_SPEAKER_PROTOCOL == 1
+
+#if IRMP_SUPPORT_BANG_OLUFSEN_PROTOCOL == 1
+                            case IRMP_START_BIT_BANG_OLUFSEN:
+                                if (irmp_pulse_time >= BANG_OLUFSEN_START_BIT1_PULSE_LEN_MIN && irmp_pulse_time <= BANG_OLUFSEN_START_BIT1_PULSE_LEN_MAX &&
+                                    irmp_pause_time >= BANG_OLUFSEN_START_BIT1_PAUSE_LEN_MIN && irmp_pause_time <= BANG_OLUFSEN_START_BIT1_PAUSE_LEN_MAX)
+                                {                                                           // it's BANG_OLUFSEN
+                                    ANALYZE_PRINTF1 ("protocol = BANG_OLUFSEN\n");
+                                    ANALYZE_PRINTF5 ("start bit 1 timings: pulse: %3d - %3d, pause: %3d - %3d\n",
+                                                    BANG_OLUFSEN_START_BIT1_PULSE_LEN_MIN, BANG_OLUFSEN_START_BIT1_PULSE_LEN_MAX,
+                                                    BANG_OLUFSEN_START_BIT1_PAUSE_LEN_MIN, BANG_OLUFSEN_START_BIT1_PAUSE_LEN_MAX);
+                                    ANALYZE_PRINTF5 ("start bit 2 timings: pulse: %3d - %3d, pause: %3d - %3d\n",
+                                                    BANG_OLUFSEN_START_BIT2_PULSE_LEN_MIN, BANG_OLUFSEN_START_BIT2_PULSE_LEN_MAX,
+                                                    BANG_OLUFSEN_START_BIT2_PAUSE_LEN_MIN, BANG_OLUFSEN_START_BIT2_PAUSE_LEN_MAX);
+                                    ANALYZE_PRINTF5 ("start bit 3 timings: pulse: %3d - %3d, pause: %3d - %3d\n",
+                                                    BANG_OLUFSEN_START_BIT3_PULSE_LEN_MIN, BANG_OLUFSEN_START_BIT3_PULSE_LEN_MAX,
+                                                    BANG_OLUFSEN_START_BIT3_PAUSE_LEN_MIN, BANG_OLUFSEN_START_BIT3_PAUSE_LEN_MAX);
+                                    ANALYZE_PRINTF5 ("start bit 4 timings: pulse: %3d - %3d, pause: %3d - %3d\n",
+                                                    BANG_OLUFSEN_START_BIT4_PULSE_LEN_MIN, BANG_OLUFSEN_START_BIT4_PULSE_LEN_MAX,
+                                                    BANG_OLUFSEN_START_BIT4_PAUSE_LEN_MIN, BANG_OLUFSEN_START_BIT4_PAUSE_LEN_MAX);
+                                    irmp_param_p = (IRMP_PARAMETER *) &bang_olufsen_param;
+                                    last_value = 0;
+                                }
+                                break;
+#endif // IRMP_SUPPORT_BANG_OLUFSEN_PROTOCOL == 1
+
+#if IRMP_SUPPORT_GRUNDIG_NOKIA_IR60_PROTOCOL == 1
+                            case IRMP_START_BIT_GRUNDIG_NOKIA_IR60:
+                                if (irmp_pulse_time >= GRUNDIG_NOKIA_IR60_START_BIT_LEN_MIN && irmp_pulse_time <= GRUNDIG_NOKIA_IR60_START_BIT_LEN_MAX &&
+                                    irmp_pause_time >= GRUNDIG_NOKIA_IR60_PRE_PAUSE_LEN_MIN && irmp_pause_time <= GRUNDIG_NOKIA_IR60_PRE_PAUSE_LEN_MAX)
+                                {                                                           // it's GRUNDIG
+                                    ANALYZE_PRINTF5 ("protocol = GRUNDIG, pre bit timings: pulse: %3d - %3d, pause: %3d - %3d\n",
+                                                    GRUNDIG_NOKIA_IR60_START_BIT_LEN_MIN, GRUNDIG_NOKIA_IR60_START_BIT_LEN_MAX,
+                                                    GRUNDIG_NOKIA_IR60_PRE_PAUSE_LEN_MIN, GRUNDIG_NOKIA_IR60_PRE_PAUSE_LEN_MAX);
+                                    irmp_param_p = (IRMP_PARAMETER *) &grundig_param;
+                                    last_pause = irmp_pause_time;
+                                    last_value  = 1;
+                                }
+                                break;
+#endif // IRMP_SUPPORT_GRUNDIG_NOKIA_IR60_PROTOCOL == 1
+
+#if IRMP_SUPPORT_MERLIN_PROTOCOL == 1 // check MERLIN before RUWIDO!
+                            case IRMP_START_BIT_MERLIN:
+                                if (irmp_pulse_time >= MERLIN_START_BIT_PULSE_LEN_MIN && irmp_pulse_time <= MERLIN_START_BIT_PULSE_LEN_MAX &&
+                                    irmp_pause_time >= MERLIN_START_BIT_PAUSE_LEN_MIN && irmp_pause_time <= MERLIN_START_BIT_PAUSE_LEN_MAX)
+                                {                                                           // it's MERLIN
+                                    ANALYZE_PRINTF5 ("protocol = MERLIN, start bit timings: pulse: %3d - %3d, pause: %3d - %3d\n",
+                                                    MERLIN_START_BIT_PULSE_LEN_MIN, MERLIN_START_BIT_PULSE_LEN_MAX,
+                                                    MERLIN_START_BIT_PAUSE_LEN_MIN, MERLIN_START_BIT_PAUSE_LEN_MAX);
+                                    irmp_param_p = (IRMP_PARAMETER *) &merlin_param;
+                                    last_pause = irmp_pause_time;
+                                    last_value = 1;
+                                }
+                                break;
+#endif // IRMP_SUPPORT_MERLIN_PROTOCOL == 1
+
+#if IRMP_SUPPORT_SIEMENS_OR_RUWIDO_PROTOCOL == 1
+                            case IRMP_START_BIT_SIEMENS_OR_RUWIDO:
+                                if (((irmp_pulse_time >= SIEMENS_OR_RUWIDO_START_BIT_PULSE_LEN_MIN && irmp_pulse_time <= SIEMENS_OR_RUWIDO_START_BIT_PULSE_LEN_MAX) ||
+                                     (irmp_pulse_time >= 2 * SIEMENS_OR_RUWIDO_START_BIT_PULSE_LEN_MIN && irmp_pulse_time <= 2 * SIEMENS_OR_RUWIDO_START_BIT_PULSE_LEN_MAX)) &&
+                                    ((irmp_pause_time >= SIEMENS_OR_RUWIDO_START_BIT_PAUSE_LEN_MIN && irmp_pause_time <= SIEMENS_OR_RUWIDO_START_BIT_PAUSE_LEN_MAX) ||
+                                     (irmp_pause_time >= 2 * SIEMENS_OR_RUWIDO_START_BIT_PAUSE_LEN_MIN && irmp_pause_time <= 2 * SIEMENS_OR_RUWIDO_START_BIT_PAUSE_LEN_MAX)))
+                                {                                                           // it's RUWIDO or SIEMENS
+                                    ANALYZE_PRINTF9 ("protocol = RUWIDO, start bit timings: pulse: %3d - %3d or %3d - %3d, pause: %3d - %3d or %3d - %3d\n",
+                                                    SIEMENS_OR_RUWIDO_START_BIT_PULSE_LEN_MIN,   SIEMENS_OR_RUWIDO_START_BIT_PULSE_LEN_MAX,
+                                                    2 * SIEMENS_OR_RUWIDO_START_BIT_PULSE_LEN_MIN, 2 * SIEMENS_OR_RUWIDO_START_BIT_PULSE_LEN_MAX,
+                                                    SIEMENS_OR_RUWIDO_START_BIT_PAUSE_LEN_MIN,   SIEMENS_OR_RUWIDO_START_BIT_PAUSE_LEN_MAX,
+                                                    2 * SIEMENS_OR_RUWIDO_START_BIT_PAUSE_LEN_MIN, 2 * SIEMENS_OR_RUWIDO_START_BIT_PAUSE_LEN_MAX);
+                                    irmp_param_p = (IRMP_PARAMETER *) &ruwido_param;
+                                    last_pause = irmp_pause_time;
+                                    last_value  = 1;
+                                }
+                                break;
+#endif // IRMP_SUPPORT_SIEMENS_OR_RUWIDO_PROTOCOL == 1
+
+#if IRMP_SUPPORT_FDC_PROTOCOL == 1
+                            case IRMP_START_BIT_FDC:
+                                if (irmp_pulse_time >= FDC_START_BIT_PULSE_LEN_MIN && irmp_pulse_time <= FDC_START_BIT_PULSE_LEN_MAX &&
+                                    irmp_pause_time >= FDC_START_BIT_PAUSE_LEN_MIN && irmp_pause_time <= FDC_START_BIT_PAUSE_LEN_MAX)
+                                {
+                                    ANALYZE_PRINTF5 ("protocol = FDC, start bit timings: pulse: %3d - %3d, pause: %3d - %3d\n",
+                                                    FDC_START_BIT_PULSE_LEN_MIN, FDC_START_BIT_PULSE_LEN_MAX,
+                                                    FDC_START_BIT_PAUSE_LEN_MIN, FDC_START_BIT_PAUSE_LEN_MAX);
+                                    irmp_param_p = (IRMP_PARAMETER *) &fdc_param;
+                                }
+                                break;
+#endif // IRMP_SUPPORT_FDC_PROTOCOL == 1
+
+#if IRMP_SUPPORT_RCCAR_PROTOCOL == 1
+                            case IRMP_START_BIT_RCCAR:
+                                if (irmp_pulse_time >= RCCAR_START_BIT_PULSE_LEN_MIN && irmp_pulse_time <= RCCAR_START_BIT_PULSE_LEN_MAX &&
+                                    irmp_pause_time >= RCCAR_START_BIT_PAUSE_LEN_MIN && irmp_pause_time <= RCCAR_START_BIT_PAUSE_LEN_MAX)
+                                {
+                                    ANALYZE_PRINTF5 ("protocol = RCCAR, start bit timings: pulse: %3d - %3d, pause: %3d - %3d\n",
+                                                    RCCAR_START_BIT_PULSE_LEN_MIN, RCCAR_START_BIT_PULSE_LEN_MAX,
+                                                    RCCAR_START_BIT_PAUSE_LEN_MIN, RCCAR_START_BIT_PAUSE_LEN_MAX);
+                                    irmp_param_p = (IRMP_PARAMETER *) &rccar_param;
+                                }
+                                break;
+#endif // IRMP_SUPPORT_RCCAR_PROTOCOL == 1
+
+#if IRMP_SUPPORT_KATHREIN_PROTOCOL == 1
+                            case IRMP_START_BIT_KATHREIN:
+                                if (irmp_pulse_time >= KATHREIN_START_BIT_PULSE_LEN_MIN && irmp_pulse_time <= KATHREIN_START_BIT_PULSE_LEN_MAX &&
+                                    irmp_pause_time >= KATHREIN_START_BIT_PAUSE_LEN_MIN && irmp_pause_time <= KATHREIN_START_BIT_PAUSE_LEN_MAX)
+                                {                                                           // it's KATHREIN
+                                    ANALYZE_PRINTF5 ("protocol = KATHREIN, start bit timings: pulse: %3d - %3d, pause: %3d - %3d\n",
+                                                    KATHREIN_START_BIT_PULSE_LEN_MIN, KATHREIN_START_BIT_PULSE_LEN_MAX,
+                                                    KATHREIN_START_BIT_PAUSE_LEN_MIN, KATHREIN_START_BIT_PAUSE_LEN_MAX);
+                                    irmp_param_p = (IRMP_PARAMETER *) &kathrein_param;
+                                }
+                                break;
+#endif // IRMP_SUPPORT_KATHREIN_PROTOCOL == 1
+
+#if IRMP_SUPPORT_NETBOX_PROTOCOL == 1
+                            case IRMP_START_BIT_NETBOX:
+                                if (irmp_pulse_time >= NETBOX_START_BIT_PULSE_LEN_MIN && irmp_pulse_time <= NETBOX_START_BIT_PULSE_LEN_MAX &&
+                                    irmp_pause_time >= NETBOX_START_BIT_PAUSE_LEN_MIN && irmp_pause_time <= NETBOX_START_BIT_PAUSE_LEN_MAX)
+                                {                                                           // it's NETBOX
+                                    ANALYZE_PRINTF5 ("protocol = NETBOX, start bit timings: pulse: %3d - %3d, pause: %3d - %3d\n",
+                                                    NETBOX_START_BIT_PULSE_LEN_MIN, NETBOX_START_BIT_PULSE_LEN_MAX,
+                                                    NETBOX_START_BIT_PAUSE_LEN_MIN, NETBOX_START_BIT_PAUSE_LEN_MAX);
+                                    irmp_param_p = (IRMP_PARAMETER *) &netbox_param;
+                                }
+                                break;
+#endif // IRMP_SUPPORT_NETBOX_PROTOCOL == 1
+
+#if IRMP_SUPPORT_LEGO_PROTOCOL == 1
+                            case IRMP_START_BIT_LEGO:
+                                if (irmp_pulse_time >= LEGO_START_BIT_PULSE_LEN_MIN && irmp_pulse_time <= LEGO_START_BIT_PULSE_LEN_MAX &&
+                                    irmp_pause_time >= LEGO_START_BIT_PAUSE_LEN_MIN && irmp_pause_time <= LEGO_START_BIT_PAUSE_LEN_MAX)
+                                {
+                                    ANALYZE_PRINTF5 ("protocol = LEGO, start bit timings: pulse: %3d - %3d, pause: %3d - %3d\n",
+                                                    LEGO_START_BIT_PULSE_LEN_MIN, LEGO_START_BIT_PULSE_LEN_MAX,
+                                                    LEGO_START_BIT_PAUSE_LEN_MIN, LEGO_START_BIT_PAUSE_LEN_MAX);
+                                    irmp_param_p = (IRMP_PARAMETER *) &lego_param;
+                                }
+                                break;
+#endif // IRMP_SUPPORT_LEGO_PROTOCOL == 1
+
+#if IRMP_SUPPORT_IRMP16_PROTOCOL == 1
+                            case IRMP_START_BIT_IRMP16:
+                                if (irmp_pulse_time >= IRMP16_START_BIT_PULSE_LEN_MIN && irmp_pulse_time <= IRMP16_START_BIT_PULSE_LEN_MAX &&
+                                    irmp_pause_time >= IRMP16_START_BIT_PAUSE_LEN_MIN && irmp_pause_time <= IRMP16_START_BIT_PAUSE_LEN_MAX)
+                                {
+                                    ANALYZE_PRINTF5 ("protocol = IRMP16, start bit timings: pulse: %3d - %3d, pause: %3d - %3d\n",
+                                                    IRMP16_START_BIT_PULSE_LEN_MIN, IRMP16_START_BIT_PULSE_LEN_MAX,
+                                                    IRMP16_START_BIT_PAUSE_LEN_MIN, IRMP16_START_BIT_PAUSE_LEN_MAX);
+                                    irmp_param_p = (IRMP_PARAMETER *) &irmp16_param;
+                                }
+                                break;
+#endif // IRMP_SUPPORT_IRMP16_PROTOCOL == 1
+
+#if IRMP_SUPPORT_GREE_PROTOCOL == 1
+                            case IRMP_START_BIT_GREE:
+                                if (irmp_pulse_time >= GREE_START_BIT_PULSE_LEN_MIN && irmp_pulse_time <= GREE_START_BIT_PULSE_LEN_MAX &&
+                                    irmp_pause_time >= GREE_START_BIT_PAUSE_LEN_MIN && irmp_pause_time <= GREE_START_BIT_PAUSE_LEN_MAX)
+                                {
+                                    ANALYZE_PRINTF5 ("protocol = GREE, start bit timings: pulse: %3d - %3d, pause: %3d - %3d\n",
+                                                    GREE_START_BIT_PULSE_LEN_MIN, GREE_START_BIT_PULSE_LEN_MAX,
+                                                    GREE_START_BIT_PAUSE_LEN_MIN, GREE_START_BIT_PAUSE_LEN_MAX);
+                                    irmp_param_p = (IRMP_PARAMETER *) &gree_param;
+                                }
+                                break;
+#endif // IRMP_SUPPORT_GREE_PROTOCOL == 1
+
+#if IRMP_SUPPORT_A1TVBOX_PROTOCOL == 1
+                            case IRMP_START_BIT_A1TVBOX:
+                                if (irmp_pulse_time >= A1TVBOX_START_BIT_PULSE_LEN_MIN && irmp_pulse_time <= A1TVBOX_START_BIT_PULSE_LEN_MAX &&
+                                    irmp_pause_time >= A1TVBOX_START_BIT_PAUSE_LEN_MIN && irmp_pause_time <= A1TVBOX_START_BIT_PAUSE_LEN_MAX)
+                                {                                                           // it's A1TVBOX
+                                    ANALYZE_PRINTF5 ("protocol = A1TVBOX, start bit timings: pulse: %3d - %3d, pause: %3d - %3d\n",
+                                                    A1TVBOX_START_BIT_PULSE_LEN_MIN, A1TVBOX_START_BIT_PULSE_LEN_MAX,
+                                                    A1TVBOX_START_BIT_PAUSE_LEN_MIN, A1TVBOX_START_BIT_PAUSE_LEN_MAX);
+                                    irmp_param_p = (IRMP_PARAMETER *) &a1tvbox_param;
+                                    last_pause = 0;
+                                    last_value = 1;
+                                }
+                                break;
+#endif // IRMP_SUPPORT_A1TVBOX_PROTOCOL == 1
+
+#if IRMP_SUPPORT_ORTEK_PROTOCOL == 1
+                            case IRMP_START_BIT_ORTEK:
+                                if (irmp_pulse_time >= ORTEK_START_BIT_PULSE_LEN_MIN && irmp_pulse_time <= ORTEK_START_BIT_PULSE_LEN_MAX &&
+                                    irmp_pause_time >= ORTEK_START_BIT_PAUSE_LEN_MIN && irmp_pause_time <= ORTEK_START_BIT_PAUSE_LEN_MAX)
+                                {                                                           // it's ORTEK (Hama)
+                                    ANALYZE_PRINTF5 ("protocol = ORTEK, start bit timings: pulse: %3d - %3d, pause: %3d - %3d\n",
+                                                    ORTEK_START_BIT_PULSE_LEN_MIN, ORTEK_START_BIT_PULSE_LEN_MAX,
+                                                    ORTEK_START_BIT_PAUSE_LEN_MIN, ORTEK_START_BIT_PAUSE_LEN_MAX);
+                                    irmp_param_p = (IRMP_PARAMETER *) &ortek_param;
+                                    last_pause  = 0;
+                                    last_value  = 1;
+                                    parity      = 0;
+                                }
+                                break;
+#endif // IRMP_SUPPORT_ORTEK_PROTOCOL == 1
+
+#if IRMP_SUPPORT_RCMM_PROTOCOL == 1
+                            case IRMP_START_BIT_RCMM:
+                                if (irmp_pulse_time >= RCMM32_START_BIT_PULSE_LEN_MIN && irmp_pulse_time <= RCMM32_START_BIT_PULSE_LEN_MAX &&
+                                    irmp_pause_time >= RCMM32_START_BIT_PAUSE_LEN_MIN && irmp_pause_time <= RCMM32_START_BIT_PAUSE_LEN_MAX)
+                                {                                                           // it's RCMM
+                                    ANALYZE_PRINTF5 ("protocol = RCMM, start bit timings: pulse: %3d - %3d, pause: %3d - %3d\n",
+                                                    RCMM32_START_BIT_PULSE_LEN_MIN, RCMM32_START_BIT_PULSE_LEN_MAX,
+                                                    RCMM32_START_BIT_PAUSE_LEN_MIN, RCMM32_START_BIT_PAUSE_LEN_MAX);
+                                    irmp_param_p = (IRMP_PARAMETER *) &rcmm_param;
+                                }
+                                break;
+#endif // IRMP_SUPPORT_RCMM_PROTOCOL == 1
+                        }
+                    }
+
+#if IRMP_ENABLE_CANDIDATES == 1
+                    if (irmp_candidate_state != IRMP_CANDIDATE_IDLE)
+                    {
+                        irmp_candidate_mask     = irmp_param_p ? candidates : 0;            // candidates after the chosen one
+                        irmp_candidate_state    = IRMP_CANDIDATE_DECODING;
+                    }
+#endif
+
+                    if (! irmp_param_p)
+                    {
+                        ANALYZE_PRINTF1 ("protocol = UNKNOWN\n");
+                        irmp_start_bit_detected = 0;                            // wait for another start bit...
+                        irmp_param.protocol = 0;                                // reset protocol
+                    }
+
+                    if (irmp_start_bit_detected)
+                    {
+                        memcpy_P (&irmp_param, irmp_param_p, sizeof (IRMP_PARAMETER));
+
+#if IRMP_SYMBOL_LUT_LEN > 0
+                        if (! (irmp_param.flags & (IRMP_PARAM_FLAG_IS_MANCHESTER | IRMP_PARAM_FLAG_IS_SERIAL)))
+                        {
+                            irmp_symbol_lut_fill ();
+                        }
+#endif
+
+                        if (! (irmp_param.flags & IRMP_PARAM_FLAG_IS_MANCHESTER))
+                        {
+                            ANALYZE_PRINTF3 ("pulse_1: %3d - %3d\n", irmp_param.pulse_1_len_min, irmp_param.pulse_1_len_max);
+                            ANALYZE_PRINTF3 ("pause_1: %3d - %3d\n", irmp_param.pause_1_len_min, irmp_param.pause_1_len_max);
+                        }
+                        else
+                        {
+                            ANALYZE_PRINTF5 ("pulse: %3d - %3d or %3d - %3d\n", irmp_param.pulse_1_len_min, irmp_param.pulse_1_len_max,
+                                            2 * irmp_param.pulse_1_len_min, 2 * irmp_param.pulse_1_len_max);
+                            ANALYZE_PRINTF5 ("pause: %3d - %3d or %3d - %3d\n", irmp_param.pause_1_len_min, irmp_param.pause_1_len_max,
+                                            2 * irmp_param.pause_1_len_min, 2 * irmp_param.pause_1_len_max);
+                        }
+
+#if IRMP_SUPPORT_RC5_PROTOCOL == 1 && (IRMP_SUPPORT_FDC_PROTOCOL == 1 || IRMP_SUPPORT_RCCAR_PROTOCOL == 1)
+                        if (irmp_param2.protocol)
+                        {
+                            ANALYZE_PRINTF3 ("pulse_0: %3d - %3d\n", irmp_param2.pulse_0_len_min, irmp_param2.pulse_0_len_max);
+                            ANALYZE_PRINTF3 ("pause_0: %3d - %3d\n", irmp_param2.pause_0_len_min, irmp_param2.pause_0_len_max);
+                            ANALYZE_PRINTF3 ("pulse_1: %3d - %3d\n", irmp_param2.pulse_1_len_min, irmp_param2.pulse_1_len_max);
+                            ANALYZE_PRINTF3 ("pause_1: %3d - %3d\n", irmp_param2.pause_1_len_min, irmp_param2.pause_1_len_max);
+                        }
+#endif
+
+
+#if IRMP_SUPPORT_RC6_PROTOCOL == 1
+                        if (irmp_param.protocol == IRMP_RC6_PROTOCOL)
+                        {
+                            ANALYZE_PRINTF3 ("pulse_toggle: %3d - %3d\n", RC6_TOGGLE_BIT_LEN_MIN, RC6_TOGGLE_BIT_LEN_MAX);
+                        }
+#endif
+
+                        if (! (irmp_param.flags & IRMP_PARAM_FLAG_IS_MANCHESTER))
+                        {
+                            ANALYZE_PRINTF3 ("pulse_0: %3d - %3d\n", irmp_param.pulse_0_len_min, irmp_param.pulse_0_len_max);
+                            ANALYZE_PRINTF3 ("pause_0: %3d - %3d\n", irmp_param.pause_0_len_min, irmp_param.pause_0_len_max);
+                        }
+                        else
+                        {
+                            ANALYZE_PRINTF5 ("pulse: %3d - %3d or %3d - %3d\n", irmp_param.pulse_0_len_min, irmp_param.pulse_0_len_max,
+                                            2 * irmp_param.pulse_0_len_min, 2 * irmp_param.pulse_0_len_max);
+                            ANALYZE_PRINTF5 ("pause: %3d - %3d or %3d - %3d\n", irmp_param.pause_0_len_min, irmp_param.pause_0_len_max,
+                                            2 * irmp_param.pause_0_len_min, 2 * irmp_param.pause_0_len_max);
+                        }
+
+#if IRMP_SUPPORT_BANG_OLUFSEN_PROTOCOL == 1
+                        if (irmp_param.protocol == IRMP_BANG_OLUFSEN_PROTOCOL)
+                        {
+                            ANALYZE_PRINTF3 ("pulse_r: %3d - %3d\n", irmp_param.pulse_0_len_min, irmp_param.pulse_0_len_max);
+                            ANALYZE_PRINTF3 ("pause_r: %3d - %3d\n", BANG_OLUFSEN_R_PAUSE_LEN_MIN, BANG_OLUFSEN_R_PAUSE_LEN_MAX);
+                        }
+#endif
+
+                        ANALYZE_PRINTF2 ("command_offset: %2d\n", irmp_param.command_offset);
+                        ANALYZE_PRINTF2 ("command_len:    %3d\n", irmp_param.command_end - irmp_param.command_offset);
+                        ANALYZE_PRINTF2 ("complete_len:   %3d\n", irmp_param.complete_len);
+                        ANALYZE_PRINTF2 ("stop_bit:       %3d\n", irmp_param.stop_bit);
+                    }
+
+#if IRMP_SUPPORT_MANCHESTER == 1
+                    if ((irmp_param.flags & IRMP_PARAM_FLAG_IS_MANCHESTER) &&
+                         irmp_param.protocol != IRMP_RUWIDO_PROTOCOL && // Manchester, but not RUWIDO
+                         irmp_param.protocol != IRMP_RC6_PROTOCOL /*** &&    // Manchester, but not RC6
+                         irmp_param.protocol != IRMP_RCII_PROTOCOL ****/)     // Manchester, but not RCII
+                    {
+                        if (irmp_pause_time > irmp_param.pulse_1_len_max && irmp_pause_time <= 2 * irmp_param.pulse_1_len_max)
+                        {
+                            ANALYZE_PRINTF5 ("%8.3fms [bit %2d: pulse = %3d, pause = %3d] ", (double) (time_counter * 1000) / F_INTERRUPTS, irmp_bit, irmp_pulse_time, irmp_pause_time);
+                            ANALYZE_PUTCHAR ((irmp_param.flags & IRMP_PARAM_FLAG_1ST_PULSE_IS_1) ? '0' : '1');
+                            ANALYZE_NEWLINE ();
+                            irmp_store_bit ((irmp_param.flags & IRMP_PARAM_FLAG_1ST_PULSE_IS_1) ? 0 : 1);
+                        }
+                        else if (! last_value)  // && irmp_pause_time >= irmp_param.pause_1_len_min && irmp_pause_time <= irmp_param.pause_1_len_max)
+                        {
+                            ANALYZE_PRINTF5 ("%8.3fms [bit %2d: pulse = %3d, pause = %3d] ", (double) (time_counter * 1000) / F_INTERRUPTS, irmp_bit, irmp_pulse_time, irmp_pause_time);
+                            ANALYZE_PUTCHAR ((irmp_param.flags & IRMP_PARAM_FLAG_1ST_PULSE_IS_1) ? '1' : '0');
+                            ANALYZE_NEWLINE ();
+                            irmp_store_bit ((irmp_param.flags & IRMP_PARAM_FLAG_1ST_PULSE_IS_1) ? 1 : 0);
+                        }
+                    }
+                    else
+#endif // IRMP_SUPPORT_MANCHESTER == 1
+
+#if IRMP_SUPPORT_SERIAL == 1
+                    if (irmp_param.flags & IRMP_PARAM_FLAG_IS_SERIAL)
+                    {
+                        ; // do nothing
+                    }
+                    else
+#endif // IRMP_SUPPORT_SERIAL == 1
+
+
+#if IRMP_SUPPORT_DENON_PROTOCOL == 1
+                    if (irmp_param.protocol == IRMP_DENON_PROTOCOL)
+                    {
+                        ANALYZE_PRINTF5 ("%8.3fms [bit %2d: pulse = %3d, pause = %3d] ", (double) (time_counter * 1000) / F_INTERRUPTS, irmp_bit, irmp_pulse_time, irmp_pause_time);
+
+                        if (irmp_pause_time >= DENON_1_PAUSE_LEN_MIN && irmp_pause_time <= DENON_1_PAUSE_LEN_MAX)
+                        {                                                       // pause timings correct for "1"?
+                            ANALYZE_PUTCHAR ('1');                              // yes, store 1
+                            ANALYZE_NEWLINE ();
+                            irmp_store_bit (1);
+                        }
+                        else // if (irmp_pause_time >= DENON_0_PAUSE_LEN_MIN && irmp_pause_time <= DENON_0_PAUSE_LEN_MAX)
+                        {                                                       // pause timings correct for "0"?
+                            ANALYZE_PUTCHAR ('0');                              // yes, store 0
+                            ANALYZE_NEWLINE ();
+                            irmp_store_bit (0);
+                        }
+                    }
+                    else
+#endif // IRMP_SUPPORT_DENON_PROTOCOL == 1
+#if IRMP_SUPPORT_THOMSON_PROTOCOL == 1
+                    if (irmp_param.protocol == IRMP_THOMSON_PROTOCOL)
+                    {
+                        ANALYZE_PRINTF5 ("%8.3fms [bit %2d: pulse = %3d, pause = %3d] ", (double) (time_counter * 1000) / F_INTERRUPTS, irmp_bit, irmp_pulse_time, irmp_pause_time);
+
+                        if (irmp_pause_time >= THOMSON_1_PAUSE_LEN_MIN && irmp_pause_time <= THOMSON_1_PAUSE_LEN_MAX)
+                        {                                                       // pause timings correct for "1"?
+                          ANALYZE_PUTCHAR ('1');                                // yes, store 1
+                          ANALYZE_NEWLINE ();
+                          irmp_store_bit (1);
+                        }
+                        else // if (irmp_pause_time >= THOMSON_0_PAUSE_LEN_MIN && irmp_pause_time <= THOMSON_0_PAUSE_LEN_MAX)
+                        {                                                       // pause timings correct for "0"?
+                          ANALYZE_PUTCHAR ('0');                                // yes, store 0
+                          ANALYZE_NEWLINE ();
+                          irmp_store_bit (0);
+                        }
+                    }
+                    else
+#endif // IRMP_SUPPORT_THOMSON_PROTOCOL == 1
+#if IRMP_SUPPORT_RF_GEN24_PROTOCOL == 1
+                    if (irmp_param.protocol == RF_GEN24_PROTOCOL)
+                    {
+                        ANALYZE_PRINTF5 ("%8.3fms [bit %2d: pulse = %3d, pause = %3d] ", (double) (time_counter * 1000) / F_INTERRUPTS, irmp_bit, irmp_pulse_time, irmp_pause_time);
+                        ANALYZE_PUTCHAR (bit_0 + '0');
+                        ANALYZE_NEWLINE ();
+                        irmp_store_bit (bit_0);                                 // start bit is data bit
+                    }
+                    else
+#endif // IRMP_SUPPORT_RF_GEN24_PROTOCOL == 1
+                    {
+                        ;                                                       // else do nothing
+                    }
+
+                    irmp_pulse_time = 1;                                        // set counter to 1, not 0
+                    irmp_pause_time = 0;
+                    wait_for_start_space = 0;
+                }
+            }
+            else if (wait_for_space)                                            // the data section....
+            {                                                                   // counting the time of darkness....
+                uint_fast8_t got_light = FALSE;
+
+                if (irmp_input)                                                 // still dark?
+                {                                                               // yes...
+                    irmp_pause_time++;                                          // increment counter
+
+                    if (irmp_bit == irmp_param.complete_len && irmp_param.stop_bit == 1 && irmp_pause_time > ((irmp_param.flags & IRMP_PARAM_FLAG_IS_MANCHESTER) ? 0 : STOP_BIT_PAUSE_LEN_MIN))
+                    {
+                        if (
+#if IRMP_SUPPORT_MANCHESTER == 1
+                            (irmp_param.flags & IRMP_PARAM_FLAG_IS_MANCHESTER) ||
+#endif
+#if IRMP_SUPPORT_SERIAL == 1
+                            (irmp_param.flags & IRMP_PARAM_FLAG_IS_SERIAL) ||
+#endif
+                            (irmp_pulse_time >= irmp_param.pulse_0_len_min && irmp_pulse_time <= irmp_param.pulse_0_len_max))
+                        {
+                            if (! (irmp_param.flags & IRMP_PARAM_FLAG_IS_MANCHESTER))
+                            {
+                                ANALYZE_PRINTF1 ("stop bit detected\n");
+
+#if IRMP_SUPPORT_MELINERA_PROTOCOL == 1
+                                if (irmp_param.protocol == IRMP_MELINERA_PROTOCOL)
+                                {
+#if IRMP_FRAME_BITS > 0
+                                    irmp_tmp_command = (irmp_bit > 16) ? irmp_frame_acc_get (irmp_bit - 16, 16) : irmp_frame_acc_get (0, irmp_bit);
+#else
+                                    irmp_tmp_command = irmp_melinera_command;  // set command
+#endif
+                                    irmp_tmp_address = 0;                      // no address
+                                }
+#endif
+                            }
+
+                            irmp_param.stop_bit = 0;
+                        }
+                        else
+                        {
+                            ANALYZE_PRINTF5 ("error: stop bit timing wrong, irmp_bit = %d, irmp_pulse_time = %d, pulse_0_len_min = %d, pulse_0_len_max = %d\n",
+                                            irmp_bit, irmp_pulse_time, irmp_param.pulse_0_len_min, irmp_param.pulse_0_len_max);
+                            irmp_start_bit_detected = 0;                        // wait for another start bit...
+                            irmp_pulse_time         = 0;
+                            irmp_pause_time         = 0;
+                        }
+                    }
+                    else
+
+#if IRMP_SUPPORT_SIRCS_PROTOCOL == 1
+                    if (irmp_param.protocol == IRMP_SIRCS_PROTOCOL &&                           // Sony has a variable number of bits:
+                        irmp_pause_time > SIRCS_PAUSE_LEN_MAX &&                                // minimum is 12
+                        irmp_bit >= 12 - 1)                                                     // pause too long?
+                    {                                                                           // yes, break and close this frame
+                        irmp_param.complete_len = irmp_bit + 1;                                 // set new complete length
+                        got_light = TRUE;                                                       // this is a lie, but helps (generates stop bit)
+                        irmp_tmp_address |= (irmp_bit - SIRCS_MINIMUM_DATA_LEN + 1) << 8;       // new: store number of additional bits in upper byte of address!
+                        irmp_param.command_end = irmp_param.command_offset + irmp_bit + 1;      // correct command length
+                        irmp_pause_time = SIRCS_PAUSE_LEN_MAX - 1;                              // correct pause length
+                    }
+                    else
+#endif
+#if IRMP_SUPPORT_MERLIN_PROTOCOL == 1
+                    if (irmp_param.protocol == IRMP_MERLIN_PROTOCOL &&                          // Merlin has a variable number of bits:
+                        irmp_pause_time > MERLIN_START_BIT_PAUSE_LEN_MAX &&                     // minimum is 8
+                        irmp_bit >= 8 - 1)                                                      // pause too long?
+                    {                                                                           // yes, break and close this frame
+                        irmp_param.complete_len = irmp_bit;                                     // set new complete length
+                        got_light = TRUE;                                                       // this is a lie, but helps (generates stop bit)
+                        irmp_pause_time = MERLIN_BIT_PAUSE_LEN_MAX - 1;                         // correct pause length
+                    }
+                    else
+#endif
+#if IRMP_SUPPORT_FAN_PROTOCOL == 1
+                    if (irmp_param.protocol == IRMP_FAN_PROTOCOL &&                             // FAN has no stop bit.
+                        irmp_bit >= FAN_COMPLETE_DATA_LEN - 1)                                  // last bit in frame
+                    {                                                                           // yes, break and close this frame
+                        if (irmp_pulse_time <= FAN_0_PULSE_LEN_MAX && irmp_pause_time >= FAN_0_PAUSE_LEN_MIN)
+                        {
+                            ANALYZE_PRINTF1 ("Generating virtual stop bit\n");
+                            got_light = TRUE;                                                   // this is a lie, but helps (generates stop bit)
+                        }
+                        else if (irmp_pulse_time >= FAN_1_PULSE_LEN_MIN && irmp_pause_time >= FAN_1_PAUSE_LEN_MIN)
+                        {
+                            ANALYZE_PRINTF1 ("Generating virtual stop bit\n");
+                            got_light = TRUE;                                                   // this is a lie, but helps (generates stop bit)
+                        }
+                    }
+                    else
+#endif
+#if IRMP_SUPPORT_SERIAL == 1
+                    // NETBOX generates no stop bit, here is the timeout condition:
+                    if ((irmp_param.flags & IRMP_PARAM_FLAG_IS_SERIAL) && irmp_param.protocol == IRMP_NETBOX_PROTOCOL &&
+                        irmp_pause_time >= NETBOX_PULSE_LEN * (NETBOX_COMPLETE_DATA_LEN - irmp_bit))
+                    {
+                        got_light = TRUE;                                                       // this is a lie, but helps (generates stop bit)
+                    }
+                    else
+#endif
+#if IRMP_SUPPORT_GRUNDIG_NOKIA_IR60_PROTOCOL == 1
+                    if (irmp_param.protocol == IRMP_GRUNDIG_PROTOCOL && !irmp_param.stop_bit)
+                    {
+                        if (irmp_pause_time > IR60_TIMEOUT_LEN && (irmp_bit == 5 || irmp_bit == 6))
+                        {
+                            ANALYZE_PRINTF1 ("Switching to IR60 protocol\n");
+                            got_light = TRUE;                                       // this is a lie, but generates a stop bit ;-)
+                            irmp_param.stop_bit = TRUE;                             // set flag
+
+                            irmp_param.protocol         = IRMP_IR60_PROTOCOL;       // change protocol
+                            irmp_param.complete_len     = IR60_COMPLETE_DATA_LEN;   // correct complete len
+                            irmp_param.address_offset   = IR60_ADDRESS_OFFSET;
+                            irmp_param.address_end      = IR60_ADDRESS_OFFSET + IR60_ADDRESS_LEN;
+                            irmp_param.command_offset   = IR60_COMMAND_OFFSET;
+                            irmp_param.command_end      = IR60_COMMAND_OFFSET + IR60_COMMAND_LEN;
+
+                            irmp_tmp_command <<= 1;
+                            irmp_tmp_command |= first_bit;
+                        }
+                        else if (irmp_pause_time >= 2 * irmp_param.pause_1_len_max && irmp_bit >= GRUNDIG_COMPLETE_DATA_LEN - 2)
+                        {                                                           // special manchester decoder
+                            irmp_param.complete_len = GRUNDIG_COMPLETE_DATA_LEN;    // correct complete len
+                            got_light = TRUE;                                       // this is a lie, but generates a stop bit ;-)
+                            irmp_param.stop_bit = TRUE;                             // set flag
+                        }
+                        else if (irmp_bit >= GRUNDIG_COMPLETE_DATA_LEN)
+                        {
+                            ANALYZE_PRINTF2 ("Switching to NOKIA protocol, irmp_bit = %d\n", irmp_bit);
+                            irmp_param.protocol         = IRMP_NOKIA_PROTOCOL;      // change protocol
+                            irmp_param.address_offset   = NOKIA_ADDRESS_OFFSET;
+                            irmp_param.address_end      = NOKIA_ADDRESS_OFFSET + NOKIA_ADDRESS_LEN;
+                            irmp_param.command_offset   = NOKIA_COMMAND_OFFSET;
+                            irmp_param.command_end      = NOKIA_COMMAND_OFFSET + NOKIA_COMMAND_LEN;
+
+                            if (irmp_tmp_command & 0x300)
+                            {
+                                irmp_tmp_address = (irmp_tmp_command >> 8);
+                                irmp_tmp_command &= 0xFF;
+                            }
+                        }
+                    }
+                    else
+#endif
+#if IRMP_SUPPORT_SIEMENS_OR_RUWIDO_PROTOCOL == 1
+                    if (irmp_param.protocol == IRMP_RUWIDO_PROTOCOL && !irmp_param.stop_bit)
+                    {
+                        if (irmp_pause_time >= 2 * irmp_param.pause_1_len_max && irmp_bit >= RUWIDO_COMPLETE_DATA_LEN - 2)
+                        {                                                           // special manchester decoder
+                            irmp_param.complete_len = RUWIDO_COMPLETE_DATA_LEN;     // correct complete len
+                            got_light = TRUE;                                       // this is a lie, but generates a stop bit ;-)
+                            irmp_param.stop_bit = TRUE;                             // set flag
+                        }
+                        else if (irmp_bit >= RUWIDO_COMPLETE_DATA_LEN)
+                        {
+                            ANALYZE_PRINTF1 ("Switching to SIEMENS protocol\n");
+                            irmp_param.protocol         = IRMP_SIEMENS_PROTOCOL;    // change protocol
+                            irmp_param.address_offset   = SIEMENS_ADDRESS_OFFSET;
+                            irmp_param.address_end      = SIEMENS_ADDRESS_OFFSET + SIEMENS_ADDRESS_LEN;
+                            irmp_param.command_offset   = SIEMENS_COMMAND_OFFSET;
+                            irmp_param.command_end      = SIEMENS_COMMAND_OFFSET + SIEMENS_COMMAND_LEN;
+
+                            //                   76543210
+                            // RUWIDO:  AAAAAAAAACCCCCCCp
+                            // SIEMENS: AAAAAAAAAAACCCCCCCCCCp
+                            irmp_tmp_address <<= 2;
+                            irmp_tmp_address |= (irmp_tmp_command >> 6);
+                            irmp_tmp_command &= 0x003F;
+                            irmp_tmp_command |= last_value;
+                        }
+                    }
+                    else
+#endif
+#if IRMP_SUPPORT_ROOMBA_PROTOCOL == 1
+                    if (irmp_param.protocol == IRMP_ROOMBA_PROTOCOL &&                          // Roomba has no stop bit
+                        irmp_bit >= ROOMBA_COMPLETE_DATA_LEN - 1)                               // it's the last data bit...
+                    {                                                                           // break and close this frame
+                        if (irmp_pulse_time >= ROOMBA_1_PULSE_LEN_MIN && irmp_pulse_time <= ROOMBA_1_PULSE_LEN_MAX)
+                        {
+                            irmp_pause_time = ROOMBA_1_PAUSE_LEN_EXACT;
+                        }
+                        else if (irmp_pulse_time >= ROOMBA_0_PULSE_LEN_MIN && irmp_pulse_time <= ROOMBA_0_PULSE_LEN_MAX)
+                        {
+                            irmp_pause_time = ROOMBA_0_PAUSE_LEN;
+                        }
+
+                        got_light = TRUE;                                                       // this is a lie, but helps (generates stop bit)
+                    }
+                    else
+#endif
+#if IRMP_SUPPORT_MANCHESTER == 1
+                    if ((irmp_param.flags & IRMP_PARAM_FLAG_IS_MANCHESTER) &&
+                        (irmp_param.protocol != IRMP_RC6_PROTOCOL || irmp_param.complete_len != RC6_COMPLETE_DATA_LEN_LONG) && // not RC6A
+                        irmp_pause_time >= 2 * irmp_param.pause_1_len_max && irmp_bit >= irmp_param.complete_len - 2 && !irmp_param.stop_bit)
+                    {                                                       // special manchester decoder
+                        got_light = TRUE;                                   // this is a lie, but generates a stop bit ;-)
+                        irmp_param.stop_bit = TRUE;                         // set flag
+                    }
+                    else if ((irmp_param.flags & IRMP_PARAM_FLAG_IS_MANCHESTER) &&
+                        irmp_param.protocol == IRMP_RC6_PROTOCOL && irmp_param.complete_len == RC6_COMPLETE_DATA_LEN_LONG && // RC6A
+                            irmp_pause_time >= 2 * irmp_param.pause_1_len_max) // this pause indicates the end
+                    {                                                       // special manchester decoder
+                        got_light = TRUE;                                   // this is a lie, but generates a stop bit ;-)
+                        irmp_param.stop_bit = TRUE;                         // set flag
+                        irmp_param.complete_len = irmp_bit + 1;             // at least 1 more bit will be added at last position
+                    }
+                    else
+#endif // IRMP_SUPPORT_MANCHESTER == 1
+                    if (irmp_pause_time > IRMP_TIMEOUT_LEN)                 // timeout?
+                    {                                                       // yes...
+                        if (irmp_bit == irmp_param.complete_len - 1 && irmp_param.stop_bit == 0)
+                        {
+                            irmp_bit++;
+                        }
+#if IRMP_SUPPORT_NEC_PROTOCOL == 1
+                        else if ((irmp_param.protocol == IRMP_NEC_PROTOCOL || irmp_param.protocol == IRMP_NEC42_PROTOCOL) && irmp_bit == 0)
+                        {                                                               // it was a non-standard repetition frame
+                            ANALYZE_PRINTF1 ("Detected non-standard repetition frame, switching to NEC repetition\n");
+                            if (key_repetition_len < NEC_FRAME_REPEAT_PAUSE_LEN_MAX)
+                            {
+                                irmp_param.stop_bit     = TRUE;                         // set flag
+                                irmp_param.protocol     = IRMP_NEC_PROTOCOL;            // switch protocol
+                                irmp_param.complete_len = irmp_bit;                     // patch length: 16 or 17
+                                irmp_tmp_address = last_irmp_address;                   // address is last address
+                                irmp_tmp_command = last_irmp_command;                   // command is last command
+                                irmp_flags |= IRMP_FLAG_REPETITION;
+                                key_repetition_len = 0;
+                            }
+                            else
+                            {
+                                ANALYZE_PRINTF3 ("ignoring NEC repetition frame: timeout occured, key_repetition_len = %u > %u\n",
+                                                (unsigned int) key_repetition_len, (unsigned int) NEC_FRAME_REPEAT_PAUSE_LEN_MAX);
+                                irmp_ir_detected = FALSE;
+                            }
+                        }
+#endif // IRMP_SUPPORT_NEC_PROTOCOL == 1
+#if IRMP_SUPPORT_JVC_PROTOCOL == 1
+                        else if (irmp_param.protocol == IRMP_NEC_PROTOCOL && (irmp_bit == 16 || irmp_bit == 17))      // it was a JVC stop bit
+                        {
+                            ANALYZE_PRINTF2 ("Switching to JVC protocol, irmp_bit = %d\n", irmp_bit);
+                            irmp_param.stop_bit     = TRUE;                                     // set flag
+                            irmp_param.protocol     = IRMP_JVC_PROTOCOL;                        // switch protocol
+                            irmp_param.complete_len = irmp_bit;                                 // patch length: 16 or 17
+                            irmp_tmp_command        = (irmp_tmp_address >> 4);                  // set command: upper 12 bits are command bits
+                            irmp_tmp_address        = irmp_tmp_address & 0x000F;                // lower 4 bits are address bits
+                            irmp_start_bit_detected = 1;                                        // tricky: don't wait for another start bit...
+                        }
+#endif // IRMP_SUPPORT_JVC_PROTOCOL == 1
+#if IRMP_SUPPORT_LGAIR_PROTOCOL == 1
+                        else if (irmp_param.protocol == IRMP_NEC_PROTOCOL && (irmp_bit == 28 || irmp_bit == 29))      // it was a LGAIR stop bit
+                        {
+                            ANALYZE_PRINTF2 ("Switching to LGAIR protocol, irmp_bit = %d\n", irmp_bit);
+                            irmp_param.stop_bit     = TRUE;                                     // set flag
+                            irmp_param.protocol     = IRMP_LGAIR_PROTOCOL;                      // switch protocol
+                            irmp_param.complete_len = irmp_bit;                                 // patch length: 16 or 17
+#if IRMP_FRAME_BITS > 0
+                            irmp_tmp_command        = irmp_frame_acc_get (LGAIR_COMMAND_OFFSET, LGAIR_COMMAND_LEN);
+                            irmp_tmp_address        = irmp_frame_acc_get (LGAIR_ADDRESS_OFFSET, LGAIR_ADDRESS_LEN);
+#else
+                            irmp_tmp_command        = irmp_lgair_command;                       // set command: upper 8 bits are command bits
+                            irmp_tmp_address        = irmp_lgair_address;                       // lower 4 bits are address bits
+#endif
+                            irmp_start_bit_detected = 1;                                        // tricky: don't wait for another start bit...
+                        }
+#endif // IRMP_SUPPORT_LGAIR_PROTOCOL == 1
+
+#if IRMP_SUPPORT_NEC42_PROTOCOL == 1
+#if IRMP_SUPPORT_NEC_PROTOCOL == 1
+                        else if (irmp_param.protocol == IRMP_NEC42_PROTOCOL && irmp_bit == 32)      // it was a NEC stop bit
+                        {
+                            ANALYZE_PRINTF1 ("Switching to NEC protocol\n");
+                            irmp_param.stop_bit     = TRUE;                                     // set flag
+                            irmp_param.protocol     = IRMP_NEC_PROTOCOL;                        // switch protocol
+                            irmp_param.complete_len = irmp_bit;                                 // patch length: 16 or 17
+
+                            //        0123456789ABC0123456789ABC0123456701234567
+                            // NEC42: AAAAAAAAAAAAAaaaaaaaaaaaaaCCCCCCCCcccccccc
+                            // NEC:   AAAAAAAAaaaaaaaaCCCCCCCCcccccccc
+                            irmp_tmp_address        |= (irmp_tmp_address2 & 0x0007) << 13;      // fm 2012-02-13: 12 -> 13
+                            irmp_tmp_command        = (irmp_tmp_address2 >> 3) | (irmp_tmp_command << 10);
+                        }
+#endif // IRMP_SUPPORT_NEC_PROTOCOL == 1
+#if IRMP_SUPPORT_LGAIR_PROTOCOL == 1
+                        else if (irmp_param.protocol == IRMP_NEC42_PROTOCOL && irmp_bit == 28)      // it was a NEC stop bit
+                        {
+                            ANALYZE_PRINTF1 ("Switching to LGAIR protocol\n");
+                            irmp_param.stop_bit     = TRUE;                                     // set flag
+                            irmp_param.protocol     = IRMP_LGAIR_PROTOCOL;                      // switch protocol
+                            irmp_param.complete_len = irmp_bit;                                 // patch length: 16 or 17
+#if IRMP_FRAME_BITS > 0
+                            irmp_tmp_address        = irmp_frame_acc_get (LGAIR_ADDRESS_OFFSET, LGAIR_ADDRESS_LEN);
+                            irmp_tmp_command        = irmp_frame_acc_get (LGAIR_COMMAND_OFFSET, LGAIR_COMMAND_LEN);
+#else
+                            irmp_tmp_address        = irmp_lgair_address;
+                            irmp_tmp_command        = irmp_lgair_command;
+#endif
+                        }
+#endif // IRMP_SUPPORT_LGAIR_PROTOCOL == 1
+#if IRMP_SUPPORT_JVC_PROTOCOL == 1
+                        else if (irmp_param.protocol == IRMP_NEC42_PROTOCOL && (irmp_bit == 16 || irmp_bit == 17))  // it was a JVC stop bit
+                        {
+                            ANALYZE_PRINTF2 ("Switching to JVC protocol, irmp_bit = %d\n", irmp_bit);
+                            irmp_param.stop_bit     = TRUE;                                     // set flag
+                            irmp_param.protocol     = IRMP_JVC_PROTOCOL;                        // switch protocol
+                            irmp_param.complete_len = irmp_bit;                                 // patch length: 16 or 17
+
+                            //        0123456789ABC0123456789ABC0123456701234567
+                            // NEC42: AAAAAAAAAAAAAaaaaaaaaaaaaaCCCCCCCCcccccccc
+                            // JVC:   AAAACCCCCCCCCCCC
+                            irmp_tmp_command        = (irmp_tmp_address >> 4) | (irmp_tmp_address2 << 9);   // set command: upper 12 bits are command bits
+                            irmp_tmp_address        = irmp_tmp_address & 0x000F;                            // lower 4 bits are address bits
+                        }
+#endif // IRMP_SUPPORT_JVC_PROTOCOL == 1
+#endif // IRMP_SUPPORT_NEC42_PROTOCOL == 1
+
+#if IRMP_SUPPORT_SAMSUNG48_PROTOCOL == 1
+                        else if (irmp_param.protocol == IRMP_SAMSUNG48_PROTOCOL && irmp_bit == 32)          // it was a SAMSUNG32 stop bit
+                        {
+                            ANALYZE_PRINTF1 ("Switching to SAMSUNG32 protocol\n");
+                            irmp_param.protocol         = IRMP_SAMSUNG32_PROTOCOL;
+                            irmp_param.command_offset   = SAMSUNG32_COMMAND_OFFSET;
+                            irmp_param.command_end      = SAMSUNG32_COMMAND_OFFSET + SAMSUNG32_COMMAND_LEN;
+                            irmp_param.complete_len     = SAMSUNG32_COMPLETE_DATA_LEN;
+                        }
+#endif // IRMP_SUPPORT_SAMSUNG_PROTOCOL == 1
+
+#if IRMP_SUPPORT_RCMM_PROTOCOL == 1
+                        else if (irmp_param.protocol == IRMP_RCMM32_PROTOCOL && (irmp_bit == 12 || irmp_bit == 24))  // it was a RCMM stop bit
+                        {
+                            if (irmp_bit == 12)
+                            {
+                                irmp_tmp_command = (irmp_tmp_address & 0xFF);                   // set command: lower 8 bits are command bits
+                                irmp_tmp_address >>= 8;                                         // upper 4 bits are address bits
+
+                                ANALYZE_PRINTF2 ("Switching to RCMM12 protocol, irmp_bit = %d\n", irmp_bit);
+                                irmp_param.protocol     = IRMP_RCMM12_PROTOCOL;                 // switch protocol
+                            }
+                            else // if ((irmp_bit == 24)
+                            {
+                                ANALYZE_PRINTF2 ("Switching to RCMM24 protocol, irmp_bit = %d\n", irmp_bit);
+                                irmp_param.protocol     = IRMP_RCMM24_PROTOCOL;                 // switch protocol
+                            }
+                            irmp_param.stop_bit     = TRUE;                                     // set flag
+                            irmp_param.complete_len = irmp_bit;                                 // patch length
+                        }
+#endif // IRMP_SUPPORT_RCMM_PROTOCOL == 1
+
+#if IRMP_SUPPORT_TECHNICS_PROTOCOL == 1
+                        else if (irmp_param.protocol == IRMP_MATSUSHITA_PROTOCOL && irmp_bit == 22)  // it was a TECHNICS stop bit
+                        {
+                            ANALYZE_PRINTF2 ("Switching to TECHNICS protocol, irmp_bit = %d\n", irmp_bit);
+                            // Situation:
+                            // The first 12 bits have been stored in irmp_tmp_command (LSB first)
+                            // The following 10 bits have been stored in irmp_tmp_address (LSB first)
+                            // The code of TECHNICS is:
+                            //   cccccccccccCCCCCCCCCCC (11 times c and 11 times C)
+                            //   ccccccccccccaaaaaaaaaa
+                            // where C is inverted value of c
+
+                            irmp_tmp_address <<= 1;
+                            if (irmp_tmp_command & (1<<11))
+                            {
+                                irmp_tmp_address |= 1;
+                                irmp_tmp_command &= ~(1<<11);
+                            }
+
+                            if (irmp_tmp_command == ((~irmp_tmp_address) & 0x07FF))
+                            {
+                                irmp_tmp_address = 0;
+
+                                irmp_param.protocol     = IRMP_TECHNICS_PROTOCOL;                   // switch protocol
+                                irmp_param.complete_len = irmp_bit;                                 // patch length
+                            }
+                            else
+                            {
+                                ANALYZE_PRINTF1 ("error 8: TECHNICS frame error\n");
+                                ANALYZE_ONLY_NORMAL_PUTCHAR ('\n');
+                                irmp_start_bit_detected = 0;                    // wait for another start bit...
+                                irmp_pulse_time         = 0;
+                                irmp_pause_time         = 0;
+                            }
+                        }
+#endif // IRMP_SUPPORT_TECHNICS_PROTOCOL == 1
+                        else
+                        {
+                            ANALYZE_PRINTF3 ("error 2: pause %d after data bit %d too long\n", irmp_pause_time, irmp_bit);
+                            ANALYZE_ONLY_NORMAL_PUTCHAR ('\n');
+                            irmp_start_bit_detected = 0;                    // wait for another start bit...
+                            irmp_pulse_time         = 0;
+                            irmp_pause_time         = 0;
+                        }
+                    }
+                }
+                else
+                {                                                               // got light now!
+                    got_light = TRUE;
+                }
+
+                if (got_light)
+                {
+#if IRMP_SYMBOL_LUT_LEN > 0
+                    uint_fast8_t symbol;
+
+#endif
+                    ANALYZE_PRINTF5 ("%8.3fms [bit %2d: pulse = %3d, pause = %3d] ", (double) (time_counter * 1000) / F_INTERRUPTS, irmp_bit, irmp_pulse_time, irmp_pause_time);
+
+#if IRMP_SUPPORT_MANCHESTER == 1
+                    if ((irmp_param.flags & IRMP_PARAM_FLAG_IS_MANCHESTER))                                     // Manchester
+                    {
+#if IRMP_SUPPORT_MERLIN_PROTOCOL == 1
+                        if (irmp_param.complete_len == irmp_bit && irmp_param.protocol == IRMP_MERLIN_PROTOCOL)
+                        {
+                            if (last_value == 0)
+                            {
+                                if (irmp_pulse_time >= 2 * irmp_param.pulse_1_len_min && irmp_pulse_time <= 2 * irmp_param.pulse_1_len_max &&
+                                    last_pause >= irmp_param.pause_1_len_min && last_pause <= irmp_param.pulse_1_len_max)
+                                {
+                                    irmp_param.complete_len += 2;
+                                    irmp_store_bit(0);
+                                    irmp_store_bit(1);
+                                    ANALYZE_PUTCHAR ('0');
+                                    ANALYZE_PUTCHAR ('1');
+                                    ANALYZE_NEWLINE ();
+                                }
+                            }
+                            else
+                            {
+                                if (last_pause >= 2 * irmp_param.pause_1_len_min && last_pause <= 2 * irmp_param.pulse_1_len_max)
+                                {
+                                    if (irmp_pulse_time >= irmp_param.pulse_1_len_min && irmp_pulse_time <= irmp_param.pulse_1_len_max)
+                                    {
+                                        irmp_param.complete_len++;
+                                        irmp_store_bit(0);
+                                        ANALYZE_PUTCHAR ('0');
+                                        ANALYZE_NEWLINE ();
+                                    }
+                                    else if (irmp_pulse_time >= 2 * irmp_param.pulse_1_len_min && irmp_pulse_time <= 2 * irmp_param.pulse_1_len_max)
+                                    {
+                                        irmp_param.complete_len += 2;
+                                        irmp_store_bit(0);
+                                        irmp_store_bit(1);
+                                        ANALYZE_PUTCHAR ('0');
+                                        ANALYZE_PUTCHAR ('1');
+                                        ANALYZE_NEWLINE ();
+                                    }
+                                }
+                            }
+                        }
+                        else
+#endif
+#if 1
+                        if (irmp_pulse_time > irmp_param.pulse_1_len_max /* && irmp_pulse_time <= 2 * irmp_param.pulse_1_len_max */)
+#else // better, but some IR-RCs use asymmetric timings :-/
+                        if (irmp_pulse_time > irmp_param.pulse_1_len_max && irmp_pulse_time <= 2 * irmp_param.pulse_1_len_max &&
+                            irmp_pause_time <= 2 * irmp_param.pause_1_len_max)
+#endif
+                        {
+#if IRMP_SUPPORT_RC6_PROTOCOL == 1
+                            if (irmp_param.protocol == IRMP_RC6_PROTOCOL && irmp_param.complete_len == irmp_bit + 1) // RC6A
+                            {
+                                    irmp_param.complete_len++; // this is the last position and 2 bits (instead of only 1) will be added
+                            }
+
+                            if (irmp_param.protocol == IRMP_RC6_PROTOCOL && irmp_bit == 4 && irmp_pulse_time > RC6_TOGGLE_BIT_LEN_MIN)         // RC6 toggle bit
+                            {
+                                ANALYZE_PUTCHAR ('T');
+
+                                if (irmp_param.complete_len == RC6_COMPLETE_DATA_LEN_LONG)                      // RC6 mode 6A
+                                {
+                                    irmp_store_bit (1);
+                                    last_value = 1;
+                                }
+                                else                                                                            // RC6 mode 0
+                                {
+                                    irmp_store_bit (0);
+                                    last_value = 0;
+                                }
+                                ANALYZE_NEWLINE ();
+                            }
+                            else
+#endif // IRMP_SUPPORT_RC6_PROTOCOL == 1
+                            {
+                                ANALYZE_PUTCHAR ((irmp_param.flags & IRMP_PARAM_FLAG_1ST_PULSE_IS_1) ? '0' : '1');
+                                irmp_store_bit ((irmp_param.flags & IRMP_PARAM_FLAG_1ST_PULSE_IS_1) ? 0  :  1 );
+
+#if IRMP_SUPPORT_RC6_PROTOCOL == 1
+                                if (irmp_param.protocol == IRMP_RC6_PROTOCOL && irmp_bit == 4 && irmp_pulse_time > RC6_TOGGLE_BIT_LEN_MIN)      // RC6 toggle bit
+                                {
+                                    ANALYZE_PUTCHAR ('T');
+                                    irmp_store_bit (1);
+
+                                    if (irmp_pause_time > 2 * irmp_param.pause_1_len_max)
+                                    {
+                                        last_value = 0;
+                                    }
+                                    else
+                                    {
+                                        last_value = 1;
+                                    }
+                                    ANALYZE_NEWLINE ();
+                                }
+                                else
+#endif // IRMP_SUPPORT_RC6_PROTOCOL == 1
+                                {
+                                    ANALYZE_PUTCHAR ((irmp_param.flags & IRMP_PARAM_FLAG_1ST_PULSE_IS_1) ? '1' : '0');
+                                    irmp_store_bit ((irmp_param.flags & IRMP_PARAM_FLAG_1ST_PULSE_IS_1) ? 1 :   0 );
+
+#if IRMP_SUPPORT_RC5_PROTOCOL == 1 && IRMP_SUPPORT_RCII_PROTOCOL == 1 && (IRMP_SUPPORT_FDC_PROTOCOL == 1 || IRMP_SUPPORT_RCCAR_PROTOCOL == 1)
+                                    if (! irmp_param2.protocol)
+#endif
+                                    {
+                                        ANALYZE_NEWLINE ();
+                                    }
+                                    last_value = (irmp_param.flags & IRMP_PARAM_FLAG_1ST_PULSE_IS_1) ? 1 : 0;
+                                }
+                            }
+                        }
+                        else if (irmp_pulse_time >= irmp_param.pulse_1_len_min && irmp_pulse_time <= irmp_param.pulse_1_len_max
+                                 /* && irmp_pause_time <= 2 * irmp_param.pause_1_len_max */)
+                        {
+                            uint_fast8_t manchester_value;
+
+                            if (last_pause > irmp_param.pause_1_len_max && last_pause <= 2 * irmp_param.pause_1_len_max)
+                            {
+                                manchester_value = last_value ? 0 : 1;
+                                last_value  = manchester_value;
+                            }
+                            else
+                            {
+                                manchester_value = last_value;
+                            }
+
+                            ANALYZE_PUTCHAR (manchester_value + '0');
+
+#if IRMP_SUPPORT_RC5_PROTOCOL == 1 && (IRMP_SUPPORT_FDC_PROTOCOL == 1 || IRMP_SUPPORT_RCCAR_PROTOCOL == 1)
+                            if (! irmp_param2.protocol)
+#endif
+                            {
+                                ANALYZE_NEWLINE ();
+                            }
+
+#if IRMP_SUPPORT_RC6_PROTOCOL == 1
+                            if (irmp_param.protocol == IRMP_RC6_PROTOCOL && irmp_bit == 1 && manchester_value == 1)     // RC6 mode != 0 ???
+                            {
+                                ANALYZE_PRINTF1 ("Switching to RC6A protocol\n");
+                                irmp_param.complete_len = RC6_COMPLETE_DATA_LEN_LONG;
+                                irmp_param.address_offset = 5;
+                                irmp_param.address_end = irmp_param.address_offset + 15;
+                                irmp_param.command_offset = irmp_param.address_end + 1;                                 // skip 1 system bit, changes like a toggle bit
+                                irmp_param.command_end = irmp_param.command_offset + 16 - 1;
+                                irmp_tmp_address = 0;
+                            }
+#endif // IRMP_SUPPORT_RC6_PROTOCOL == 1
+
+                            irmp_store_bit (manchester_value);
+                        }
+                        else
+                        {
+#if IRMP_SUPPORT_RC5_PROTOCOL == 1 && IRMP_SUPPORT_FDC_PROTOCOL == 1
+                            if (irmp_param2.protocol == IRMP_FDC_PROTOCOL &&
+                                irmp_pulse_time >= FDC_PULSE_LEN_MIN && irmp_pulse_time <= FDC_PULSE_LEN_MAX &&
+                                ((irmp_pause_time >= FDC_1_PAUSE_LEN_MIN && irmp_pause_time <= FDC_1_PAUSE_LEN_MAX) ||
+                                 (irmp_pause_time >= FDC_0_PAUSE_LEN_MIN && irmp_pause_time <= FDC_0_PAUSE_LEN_MAX)))
+                            {
+                                ANALYZE_PUTCHAR ('?');
+                                irmp_param.protocol = 0;                // switch to FDC, see below
+                            }
+                            else
+#endif // IRMP_SUPPORT_FDC_PROTOCOL == 1
+#if IRMP_SUPPORT_RC5_PROTOCOL == 1 && IRMP_SUPPORT_RCCAR_PROTOCOL == 1
+                            if (irmp_param2.protocol == IRMP_RCCAR_PROTOCOL &&
+                                irmp_pulse_time >= RCCAR_PULSE_LEN_MIN && irmp_pulse_time <= RCCAR_PULSE_LEN_MAX &&
+                                ((irmp_pause_time >= RCCAR_1_PAUSE_LEN_MIN && irmp_pause_time <= RCCAR_1_PAUSE_LEN_MAX) ||
+                                 (irmp_pause_time >= RCCAR_0_PAUSE_LEN_MIN && irmp_pause_time <= RCCAR_0_PAUSE_LEN_MAX)))
+                            {
+                                ANALYZE_PUTCHAR ('?');
+                                irmp_param.protocol = 0;                // switch to RCCAR, see below
+                            }
+                            else
+#endif // IRMP_SUPPORT_RCCAR_PROTOCOL == 1
+                            {
+                                ANALYZE_PUTCHAR ('?');
+                                ANALYZE_NEWLINE ();
+                                ANALYZE_PRINTF4 ("error 3 manchester: timing not correct: data bit %d,  pulse: %d, pause: %d\n", irmp_bit, irmp_pulse_time, irmp_pause_time);
+                                ANALYZE_ONLY_NORMAL_PUTCHAR ('\n');
+                                irmp_start_bit_detected = 0;                            // reset flags and wait for next start bit
+                                irmp_pause_time         = 0;
+                            }
+                        }
+
+#if IRMP_SUPPORT_RC5_PROTOCOL == 1 && IRMP_SUPPORT_FDC_PROTOCOL == 1
+                        if (irmp_param2.protocol == IRMP_FDC_PROTOCOL && irmp_pulse_time >= FDC_PULSE_LEN_MIN && irmp_pulse_time <= FDC_PULSE_LEN_MAX)
+                        {
+                            if (irmp_pause_time >= FDC_1_PAUSE_LEN_MIN && irmp_pause_time <= FDC_1_PAUSE_LEN_MAX)
+                            {
+                                ANALYZE_PRINTF1 ("   1 (FDC)\n");
+                                irmp_store_bit2 (1);
+                            }
+                            else if (irmp_pause_time >= FDC_0_PAUSE_LEN_MIN && irmp_pause_time <= FDC_0_PAUSE_LEN_MAX)
+                            {
+                                ANALYZE_PRINTF1 ("   0 (FDC)\n");
+                                irmp_store_bit2 (0);
+                            }
+
+                            if (! irmp_param.protocol)
+                            {
+                                ANALYZE_PRINTF1 ("Switching to FDC protocol\n");
+                                memcpy (&irmp_param, &irmp_param2, sizeof (IRMP_PARAMETER));
+#if IRMP_SYMBOL_LUT_LEN > 0
+                                irmp_symbol_lut_fill ();
+#endif
+                                irmp_param2.protocol = 0;
+                                irmp_tmp_address = irmp_tmp_address2;
+                                irmp_tmp_command = irmp_tmp_command2;
+                            }
+                        }
+#endif // IRMP_SUPPORT_FDC_PROTOCOL == 1
+#if IRMP_SUPPORT_RC5_PROTOCOL == 1 && IRMP_SUPPORT_RCCAR_PROTOCOL == 1
+                        if (irmp_param2.protocol == IRMP_RCCAR_PROTOCOL && irmp_pulse_time >= RCCAR_PULSE_LEN_MIN && irmp_pulse_time <= RCCAR_PULSE_LEN_MAX)
+                        {
+                            if (irmp_pause_time >= RCCAR_1_PAUSE_LEN_MIN && irmp_pause_time <= RCCAR_1_PAUSE_LEN_MAX)
+                            {
+                                ANALYZE_PRINTF1 ("   1 (RCCAR)\n");
+                                irmp_store_bit2 (1);
+                            }
+                            else if (irmp_pause_time >= RCCAR_0_PAUSE_LEN_MIN && irmp_pause_time <= RCCAR_0_PAUSE_LEN_MAX)
+                            {
+                                ANALYZE_PRINTF1 ("   0 (RCCAR)\n");
+                                irmp_store_bit2 (0);
+                            }
+
+                            if (! irmp_param.protocol)
+                            {
+                                ANALYZE_PRINTF1 ("Switching to RCCAR protocol\n");
+                                memcpy (&irmp_param, &irmp_param2, sizeof (IRMP_PARAMETER));
+#if IRMP_SYMBOL_LUT_LEN > 0
+                                irmp_symbol_lut_fill ();
+#endif
+                                irmp_param2.protocol = 0;
+                                irmp_tmp_address = irmp_tmp_address2;
+                                irmp_tmp_command = irmp_tmp_command2;
+                            }
+                        }
+#endif // IRMP_SUPPORT_RCCAR_PROTOCOL == 1
+
+                        last_pause      = irmp_pause_time;
+                        wait_for_space  = 0;
+                    }
+                    else
+#endif // IRMP_SUPPORT_MANCHESTER == 1
+
+#if IRMP_SUPPORT_SERIAL == 1
+                    if (irmp_param.flags & IRMP_PARAM_FLAG_IS_SERIAL)
+                    {
+                        while (irmp_bit < irmp_param.complete_len && irmp_pulse_time > irmp_param.pulse_1_len_max)
+                        {
+                            ANALYZE_PUTCHAR ('1');
+                            irmp_store_bit (1);
+
+                            if (irmp_pulse_time >= irmp_param.pulse_1_len_min)
+                            {
+                                irmp_pulse_time -= irmp_param.pulse_1_len_min;
+                            }
+                            else
+                            {
+                                irmp_pulse_time = 0;
+                            }
+                        }
+
+                        while (irmp_bit < irmp_param.complete_len && irmp_pause_time > irmp_param.pause_1_len_max)
+                        {
+                            ANALYZE_PUTCHAR ('0');
+                            irmp_store_bit (0);
+
+                            if (irmp_pause_time >= irmp_param.pause_1_len_min)
+                            {
+                                irmp_pause_time -= irmp_param.pause_1_len_min;
+                            }
+                            else
+                            {
+                                irmp_pause_time = 0;
+                            }
+                        }
+                        ANALYZE_NEWLINE ();
+                        wait_for_space = 0;
+                    }
+                    else
+#endif // IRMP_SUPPORT_SERIAL == 1
+
+#if IRMP_SUPPORT_SAMSUNG_PROTOCOL == 1
+                    if (irmp_param.protocol == IRMP_SAMSUNG_PROTOCOL && irmp_bit == 16)       // Samsung: 16th bit
+                    {
+                        if (irmp_pulse_time >= SAMSUNG_PULSE_LEN_MIN && irmp_pulse_time <= SAMSUNG_PULSE_LEN_MAX &&
+                            irmp_pause_time >= SAMSUNG_START_BIT_PAUSE_LEN_MIN && irmp_pause_time <= SAMSUNG_START_BIT_PAUSE_LEN_MAX)
+                        {
+                            ANALYZE_PRINTF1 ("SYNC\n");
+                            wait_for_space = 0;
+                            irmp_bit++;
+                        }
+                        else  if (irmp_pulse_time >= SAMSUNG_PULSE_LEN_MIN && irmp_pulse_time <= SAMSUNG_PULSE_LEN_MAX)
+                        {
+#if IRMP_SUPPORT_SAMSUNG48_PROTOCOL == 1
+                            ANALYZE_PRINTF1 ("Switching to SAMSUNG48 protocol ");
+                            irmp_param.protocol         = IRMP_SAMSUNG48_PROTOCOL;
+                            irmp_param.command_offset   = SAMSUNG48_COMMAND_OFFSET;
+                            irmp_param.command_end      = SAMSUNG48_COMMAND_OFFSET + SAMSUNG48_COMMAND_LEN;
+                            irmp_param.complete_len     = SAMSUNG48_COMPLETE_DATA_LEN;
+#else
                             ANALYZE_PRINTF1 ("Switching to SAMSUNG32 protocol ");
                             irmp_param.protocol         = IRMP_SAMSUNG32_PROTOCOL;
                             irmp_param.command_offset   = SAMSUNG32_COMMAND_OFFSET;
                             irmp_param.command_end      = SAMSUNG32_COMMAND_OFFSET + SAMSUNG32_COMMAND_LEN;
                             irmp_param.complete_len     = SAMSUNG32_COMPLETE_DATA_LEN;
 #endif
-                            if (irmp_pause_time >= SAMSUNG_1_PAUSE_LEN_MIN && irmp_pause_time <= SAMSUNG_1_PAUSE_LEN_MAX)
-                            {
-                                ANALYZE_PUTCHAR ('1');
-                                ANALYZE_NEWLINE ();
-                                irmp_store_bit (1);
-                                wait_for_space = 0;
-                            }
-                            else
-                            {
-                                ANALYZE_PUTCHAR ('0');
-                                ANALYZE_NEWLINE ();
-                                irmp_store_bit (0);
-                                wait_for_space = 0;
-                            }
-                        }
-                        else
-                        {                                                           // timing incorrect!
-                            ANALYZE_PRINTF4 ("error 3 Samsung: timing not correct: data bit %d,  pulse: %d, pause: %d\n", irmp_bit, irmp_pulse_time, irmp_pause_time);
-                            ANALYZE_ONLY_NORMAL_PUTCHAR ('\n');
-                            irmp_start_bit_detected = 0;                            // reset flags and wait for next start bit
-                            irmp_pause_time         = 0;
-                        }
-                    }
-                    else
-#endif // IRMP_SUPPORT_SAMSUNG_PROTOCOL
+                            if (irmp_pause_time >= SAMSUNG_1_PAUSE_LEN_MIN && irmp_pause_time <= SAMSUNG_1_PAUSE_LEN_MAX)
+                            {
+                                ANALYZE_PUTCHAR ('1');
+                                ANALYZE_NEWLINE ();
+                                irmp_store_bit (1);
+                                wait_for_space = 0;
+                            }
+                            else
+                            {
+                                ANALYZE_PUTCHAR ('0');
+                                ANALYZE_NEWLINE ();
+                                irmp_store_bit (0);
+                                wait_for_space = 0;
+                            }
+                        }
+                        else
+                        {                                                           // timing incorrect!
+                            ANALYZE_PRINTF4 ("error 3 Samsung: timing not correct: data bit %d,  pulse: %d, pause: %d\n", irmp_bit, irmp_pulse_time, irmp_pause_time);
+                            ANALYZE_ONLY_NORMAL_PUTCHAR ('\n');
+                            irmp_start_bit_detected = 0;                            // reset flags and wait for next start bit
+                            irmp_pause_time         = 0;
+                        }
+                    }
+                    else
+#endif // IRMP_SUPPORT_SAMSUNG_PROTOCOL
+
+#if IRMP_SUPPORT_NEC16_PROTOCOL
+#if IRMP_SUPPORT_NEC42_PROTOCOL == 1
+                    if (irmp_param.protocol == IRMP_NEC42_PROTOCOL &&
+#else // IRMP_SUPPORT_NEC_PROTOCOL instead
+                    if (irmp_param.protocol == IRMP_NEC_PROTOCOL &&
+#endif // IRMP_SUPPORT_NEC42_PROTOCOL == 1
+                        irmp_bit == 8 && irmp_pause_time >= NEC_START_BIT_PAUSE_LEN_MIN && irmp_pause_time <= NEC_START_BIT_PAUSE_LEN_MAX)
+                    {
+                        ANALYZE_PRINTF1 ("Switching to NEC16 protocol\n");
+                        irmp_param.protocol         = IRMP_NEC16_PROTOCOL;
+                        irmp_param.address_offset   = NEC16_ADDRESS_OFFSET;
+                        irmp_param.address_end      = NEC16_ADDRESS_OFFSET + NEC16_ADDRESS_LEN;
+                        irmp_param.command_offset   = NEC16_COMMAND_OFFSET;
+                        irmp_param.command_end      = NEC16_COMMAND_OFFSET + NEC16_COMMAND_LEN;
+                        irmp_param.complete_len     = NEC16_COMPLETE_DATA_LEN;
+                        wait_for_space = 0;
+                    }
+                    else
+#endif // IRMP_SUPPORT_NEC16_PROTOCOL
+
+#if IRMP_SUPPORT_BANG_OLUFSEN_PROTOCOL == 1
+                    if (irmp_param.protocol == IRMP_BANG_OLUFSEN_PROTOCOL)
+                    {
+                        if (irmp_pulse_time >= BANG_OLUFSEN_PULSE_LEN_MIN && irmp_pulse_time <= BANG_OLUFSEN_PULSE_LEN_MAX)
+                        {
+                            if (irmp_bit == 1)                                      // Bang & Olufsen: 3rd bit
+                            {
+                                if (irmp_pause_time >= BANG_OLUFSEN_START_BIT3_PAUSE_LEN_MIN && irmp_pause_time <= BANG_OLUFSEN_START_BIT3_PAUSE_LEN_MAX)
+                                {
+                                    ANALYZE_PRINTF1 ("3rd start bit\n");
+                                    wait_for_space = 0;
+                                    irmp_bit++;
+                                }
+                                else
+                                {                                                   // timing incorrect!
+                                    ANALYZE_PRINTF4 ("error 3a B&O: timing not correct: data bit %d,  pulse: %d, pause: %d\n", irmp_bit, irmp_pulse_time, irmp_pause_time);
+                                    ANALYZE_ONLY_NORMAL_PUTCHAR ('\n');
+                                    irmp_start_bit_detected = 0;                    // reset flags and wait for next start bit
+                                    irmp_pause_time         = 0;
+                                }
+                            }
+                            else if (irmp_bit == 19)                                // Bang & Olufsen: trailer bit
+                            {
+                                if (irmp_pause_time >= BANG_OLUFSEN_TRAILER_BIT_PAUSE_LEN_MIN && irmp_pause_time <= BANG_OLUFSEN_TRAILER_BIT_PAUSE_LEN_MAX)
+                                {
+                                    ANALYZE_PRINTF1 ("trailer bit\n");
+                                    wait_for_space = 0;
+                                    irmp_bit++;
+                                }
+                                else
+                                {                                                   // timing incorrect!
+                                    ANALYZE_PRINTF4 ("error 3b B&O: timing not correct: data bit %d,  pulse: %d, pause: %d\n", irmp_bit, irmp_pulse_time, irmp_pause_time);
+                                    ANALYZE_ONLY_NORMAL_PUTCHAR ('\n');
+                                    irmp_start_bit_detected = 0;                    // reset flags and wait for next start bit
+                                    irmp_pause_time         = 0;
+                                }
+                            }
+                            else
+                            {
+                                if (irmp_pause_time >= BANG_OLUFSEN_1_PAUSE_LEN_MIN && irmp_pause_time <= BANG_OLUFSEN_1_PAUSE_LEN_MAX)
+                                {                                                   // pulse & pause timings correct for "1"?
+                                    ANALYZE_PUTCHAR ('1');
+                                    ANALYZE_NEWLINE ();
+                                    irmp_store_bit (1);
+                                    last_value = 1;
+                                    wait_for_space = 0;
+                                }
+                                else if (irmp_pause_time >= BANG_OLUFSEN_0_PAUSE_LEN_MIN && irmp_pause_time <= BANG_OLUFSEN_0_PAUSE_LEN_MAX)
+                                {                                                   // pulse & pause timings correct for "0"?
+                                    ANALYZE_PUTCHAR ('0');
+                                    ANALYZE_NEWLINE ();
+                                    irmp_store_bit (0);
+                                    last_value = 0;
+                                    wait_for_space = 0;
+                                }
+                                else if (irmp_pause_time >= BANG_OLUFSEN_R_PAUSE_LEN_MIN && irmp_pause_time <= BANG_OLUFSEN_R_PAUSE_LEN_MAX)
+                                {
+                                    ANALYZE_PUTCHAR (last_value + '0');
+                                    ANALYZE_NEWLINE ();
+                                    irmp_store_bit (last_value);
+                                    wait_for_space = 0;
+                                }
+                                else
+                                {                                                   // timing incorrect!
+                                    ANALYZE_PRINTF4 ("error 3c B&O: timing not correct: data bit %d,  pulse: %d, pause: %d\n", irmp_bit, irmp_pulse_time, irmp_pause_time);
+                                    ANALYZE_ONLY_NORMAL_PUTCHAR ('\n');
+                                    irmp_start_bit_detected = 0;                    // reset flags and wait for next start bit
+                                    irmp_pause_time         = 0;
+                                }
+                            }
+                        }
+                        else
+                        {                                                           // timing incorrect!
+                            ANALYZE_PRINTF4 ("error 3d B&O: timing not correct: data bit %d,  pulse: %d, pause: %d\n", irmp_bit, irmp_pulse_time, irmp_pause_time);
+                            ANALYZE_ONLY_NORMAL_PUTCHAR ('\n');
+                            irmp_start_bit_detected = 0;                            // reset flags and wait for next start bit
+                            irmp_pause_time         = 0;
+                        }
+                    }
+                    else
+#endif // IRMP_SUPPORT_BANG_OLUFSEN_PROTOCOL
+
+#if IRMP_SUPPORT_RCMM_PROTOCOL == 1
+                    if (irmp_param.protocol == IRMP_RCMM32_PROTOCOL)
+                    {
+                        if (irmp_pause_time >= RCMM32_BIT_00_PAUSE_LEN_MIN && irmp_pause_time <= RCMM32_BIT_00_PAUSE_LEN_MAX)
+                        {
+                            ANALYZE_PUTCHAR ('0');
+                            ANALYZE_PUTCHAR ('0');
+                            irmp_store_bit (0);
+                            irmp_store_bit (0);
+                        }
+                        else if (irmp_pause_time >= RCMM32_BIT_01_PAUSE_LEN_MIN && irmp_pause_time <= RCMM32_BIT_01_PAUSE_LEN_MAX)
+                        {
+                            ANALYZE_PUTCHAR ('0');
+                            ANALYZE_PUTCHAR ('1');
+                            irmp_store_bit (0);
+                            irmp_store_bit (1);
+                        }
+                        else if (irmp_pause_time >= RCMM32_BIT_10_PAUSE_LEN_MIN && irmp_pause_time <= RCMM32_BIT_10_PAUSE_LEN_MAX)
+                        {
+                            ANALYZE_PUTCHAR ('1');
+                            ANALYZE_PUTCHAR ('0');
+                            irmp_store_bit (1);
+                            irmp_store_bit (0);
+                        }
+                        else if (irmp_pause_time >= RCMM32_BIT_11_PAUSE_LEN_MIN && irmp_pause_time <= RCMM32_BIT_11_PAUSE_LEN_MAX)
+                        {
+                            ANALYZE_PUTCHAR ('1');
+                            ANALYZE_PUTCHAR ('1');
+                            irmp_store_bit (1);
+                            irmp_store_bit (1);
+                        }
+
+                        ANALYZE_PRINTF1 ("\n");
+                        wait_for_space = 0;
+                    }
+                    else
+#endif
+
+#if IRMP_SYMBOL_LUT_LEN > 0
+                    if ((symbol = irmp_symbol_get (irmp_pulse_time, irmp_pause_time)) & IRMP_SYMBOL_1)
+#else
+                    if (irmp_pulse_time >= irmp_param.pulse_1_len_min && irmp_pulse_time <= irmp_param.pulse_1_len_max &&
+                        irmp_pause_time >= irmp_param.pause_1_len_min && irmp_pause_time <= irmp_param.pause_1_len_max)
+#endif
+                    {                                                               // pulse & pause timings correct for "1"?
+                        ANALYZE_PUTCHAR ('1');
+                        ANALYZE_NEWLINE ();
+                        irmp_store_bit (1);
+                        wait_for_space = 0;
+                    }
+#if IRMP_SYMBOL_LUT_LEN > 0
+                    else if (symbol & IRMP_SYMBOL_0)
+#else
+                    else if (irmp_pulse_time >= irmp_param.pulse_0_len_min && irmp_pulse_time <= irmp_param.pulse_0_len_max &&
+                             irmp_pause_time >= irmp_param.pause_0_len_min && irmp_pause_time <= irmp_param.pause_0_len_max)
+#endif
+                    {                                                               // pulse & pause timings correct for "0"?
+                        ANALYZE_PUTCHAR ('0');
+                        ANALYZE_NEWLINE ();
+                        irmp_store_bit (0);
+                        wait_for_space = 0;
+                    }
+                    else
+#if IRMP_SUPPORT_KATHREIN_PROTOCOL
+
+                    if (irmp_param.protocol == IRMP_KATHREIN_PROTOCOL &&
+                        irmp_pulse_time >= KATHREIN_1_PULSE_LEN_MIN && irmp_pulse_time <= KATHREIN_1_PULSE_LEN_MAX &&
+                        (((irmp_bit == 8 || irmp_bit == 6) &&
+                                irmp_pause_time >= KATHREIN_SYNC_BIT_PAUSE_LEN_MIN && irmp_pause_time <= KATHREIN_SYNC_BIT_PAUSE_LEN_MAX) ||
+                         (irmp_bit == 12 &&
+                                irmp_pause_time >= KATHREIN_START_BIT_PAUSE_LEN_MIN && irmp_pause_time <= KATHREIN_START_BIT_PAUSE_LEN_MAX)))
+
+                    {
+                        if (irmp_bit == 8)
+                        {
+                            irmp_bit++;
+                            ANALYZE_PUTCHAR ('S');
+                            ANALYZE_NEWLINE ();
+                            irmp_tmp_command <<= 1;
+                        }
+                        else
+                        {
+                            ANALYZE_PUTCHAR ('S');
+                            ANALYZE_NEWLINE ();
+                            irmp_store_bit (1);
+                        }
+                        wait_for_space = 0;
+                    }
+                    else
+#endif // IRMP_SUPPORT_KATHREIN_PROTOCOL
+#if IRMP_SUPPORT_MELINERA_PROTOCOL == 1
+#if IRMP_SUPPORT_NEC42_PROTOCOL == 1
+                    if (irmp_param.protocol == IRMP_NEC42_PROTOCOL &&
+#else // IRMP_SUPPORT_NEC_PROTOCOL instead
+                    if (irmp_param.protocol == IRMP_NEC_PROTOCOL &&
+#endif // IRMP_SUPPORT_NEC42_PROTOCOL == 1
+                       (
+                        (irmp_pulse_time >= MELINERA_0_PULSE_LEN_MIN && irmp_pulse_time <= MELINERA_0_PULSE_LEN_MAX &&
+                         irmp_pause_time >= MELINERA_0_PAUSE_LEN_MIN && irmp_pause_time <= MELINERA_0_PAUSE_LEN_MAX) ||
+                        (irmp_pulse_time >= MELINERA_1_PULSE_LEN_MIN && irmp_pulse_time <= MELINERA_1_PULSE_LEN_MAX &&
+                         irmp_pause_time >= MELINERA_1_PAUSE_LEN_MIN && irmp_pause_time <= MELINERA_1_PAUSE_LEN_MAX)
+                       ))
+                    {
+                        ANALYZE_PRINTF1 ("Switching to MELINERA protocol ");
+                        irmp_param.protocol         = IRMP_MELINERA_PROTOCOL;
+                        irmp_param.pulse_0_len_min  = MELINERA_0_PULSE_LEN_MIN;
+                        irmp_param.pulse_0_len_max  = MELINERA_0_PULSE_LEN_MAX;
+                        irmp_param.pause_0_len_min  = MELINERA_0_PAUSE_LEN_MIN;
+                        irmp_param.pulse_0_len_max  = MELINERA_0_PAUSE_LEN_MAX;
+                        irmp_param.pulse_1_len_min  = MELINERA_1_PULSE_LEN_MIN;
+                        irmp_param.pulse_1_len_max  = MELINERA_1_PULSE_LEN_MAX;
+                        irmp_param.pause_1_len_min  = MELINERA_1_PAUSE_LEN_MIN;
+                        irmp_param.pulse_1_len_max  = MELINERA_1_PAUSE_LEN_MAX;
+                        irmp_param.address_offset   = MELINERA_ADDRESS_OFFSET;
+                        irmp_param.address_end      = MELINERA_ADDRESS_OFFSET + MELINERA_ADDRESS_LEN;
+                        irmp_param.command_offset   = MELINERA_COMMAND_OFFSET;
+                        irmp_param.command_end      = MELINERA_COMMAND_OFFSET + MELINERA_COMMAND_LEN;
+                        irmp_param.complete_len     = MELINERA_COMPLETE_DATA_LEN;
+#if IRMP_SYMBOL_LUT_LEN > 0
+                        irmp_symbol_lut_fill ();
+#endif
+
+                        if (irmp_pause_time >= MELINERA_0_PAUSE_LEN_MIN && irmp_pause_time <= MELINERA_0_PAUSE_LEN_MAX)
+                        {
+                            ANALYZE_PUTCHAR ('0');
+                            irmp_store_bit (0);
+                        }
+                        else
+                        {
+                            ANALYZE_PUTCHAR ('1');
+                            irmp_store_bit (1);
+                        }
+
+                        ANALYZE_NEWLINE ();
+                        wait_for_space = 0;
+                    }
+                    else
+#endif // IRMP_SUPPORT_MELINERA_PROTOCOL
+                    {                                                               // timing incorrect!
+                        ANALYZE_PRINTF4 ("error 3: timing not correct: data bit %d,  pulse: %d, pause: %d\n", irmp_bit, irmp_pulse_time, irmp_pause_time);
+                        ANALYZE_ONLY_NORMAL_PUTCHAR ('\n');
+                        irmp_start_bit_detected = 0;                                // reset flags and wait for next start bit
+                        irmp_pause_time         = 0;
+                    }
+
+                    irmp_pulse_time = 1;                                            // set counter to 1, not 0
+                }
+            }
+            else
+            {                                                                       // counting the pulse length ...
+                if (! irmp_input)                                                   // still light?
+                {                                                                   // yes...
+                    irmp_pulse_time++;                                              // increment counter
+                }
+                else
+                {                                                                   // now it's dark!
+                    wait_for_space  = 1;                                            // let's count the time (see above)
+                    irmp_pause_time = 1;                                            // set pause counter to 1, not 0
+
+#if IRMP_SUPPORT_RCII_PROTOCOL == 1
+                    if (irmp_param.protocol == IRMP_RCII_PROTOCOL && waiting_for_2nd_pulse)
+                    {
+                        // fm: output is "1000 466" or "1533 466"
+                        // printf ("fm: %d %d\n", irmp_pulse_time * 1000000 / F_INTERRUPTS, RCII_BIT_LEN * 1000000 / F_INTERRUPTS);
+                        irmp_pulse_time -= RCII_BIT_LEN;
+                        last_value = 0;
+
+                        ANALYZE_PRINTF2 ("RCII: got 2nd pulse, irmp_pulse_time = %d\n", irmp_pulse_time);
+                        waiting_for_2nd_pulse = 0;
+                    }
+#endif
+                }
+            }
+
+            if (irmp_start_bit_detected && irmp_bit == irmp_param.complete_len && irmp_param.stop_bit == 0)    // enough bits received?
+            {
+#if IRMP_ENABLE_CANDIDATES == 1
+                irmp_candidate_state = IRMP_CANDIDATE_IDLE;                         // frame accepted by candidate, even if ignored below
+#endif
+#if IRMP_ENABLE_HASH_DECODER == 1
+                if (irmp_hash_state == IRMP_HASH_RECORDING)                         // frame is known, even if ignored below: drop its hash
+                {                                                                   // and the rest of the frame, e.g. trailing bits
+                    irmp_hash_state = IRMP_HASH_DROPPED;
+                }
+                else if (irmp_hash_state == IRMP_HASH_COMPLETE)
+                {
+                    irmp_hash_state = IRMP_HASH_IDLE;
+                }
+#endif
+                if (last_irmp_command == irmp_tmp_command && key_repetition_len < AUTO_FRAME_REPETITION_LEN)
+                {
+                    repetition_frame_number++;
+                }
+                else
+                {
+                    repetition_frame_number = 0;
+                }
+
+#if IRMP_SUPPORT_SIRCS_PROTOCOL == 1
+                // if SIRCS protocol and the code will be repeated within 50 ms, we will ignore 2nd and 3rd repetition frame
+                if (irmp_param.protocol == IRMP_SIRCS_PROTOCOL && (repetition_frame_number == 1 || repetition_frame_number == 2))
+                {
+                    ANALYZE_PRINTF4 ("code skipped: SIRCS auto repetition frame #%d, counter = %u, auto repetition len = %u\n",
+                                    repetition_frame_number + 1, (unsigned int) key_repetition_len, (unsigned int) AUTO_FRAME_REPETITION_LEN);
+                    key_repetition_len = 0;
+                }
+                else
+#endif
+
+#if IRMP_SUPPORT_ORTEK_PROTOCOL == 1
+                // if ORTEK protocol and the code will be repeated within 50 ms, we will ignore 2nd repetition frame
+                if (irmp_param.protocol == IRMP_ORTEK_PROTOCOL && repetition_frame_number == 1)
+                {
+                    ANALYZE_PRINTF4 ("code skipped: ORTEK auto repetition frame #%d, counter = %d, auto repetition len = %d\n",
+                                    repetition_frame_number + 1, key_repetition_len, AUTO_FRAME_REPETITION_LEN);
+                    key_repetition_len = 0;
+                }
+                else
+#endif
+
+#if 0 && IRMP_SUPPORT_KASEIKYO_PROTOCOL == 1    // fm 2015-12-02: don't ignore every 2nd frame
+                // if KASEIKYO protocol and the code will be repeated within 50 ms, we will ignore 2nd repetition frame
+                if (irmp_param.protocol == IRMP_KASEIKYO_PROTOCOL && repetition_frame_number == 1)
+                {
+                    ANALYZE_PRINTF4 ("code skipped: KASEIKYO auto repetition frame #%d, counter = %d, auto repetition len = %d\n",
+                                    repetition_frame_number + 1, key_repetition_len, AUTO_FRAME_REPETITION_LEN);
+                    key_repetition_len = 0;
+                }
+                else
+#endif
+
+#if 0 && IRMP_SUPPORT_SAMSUNG_PROTOCOL == 1     // fm 2015-12-02: don't ignore every 2nd frame
+                // if SAMSUNG32 or SAMSUNG48 protocol and the code will be repeated within 50 ms, we will ignore every 2nd frame
+                if ((irmp_param.protocol == IRMP_SAMSUNG32_PROTOCOL || irmp_param.protocol == IRMP_SAMSUNG48_PROTOCOL) && (repetition_frame_number & 0x01))
+                {
+                    ANALYZE_PRINTF4 ("code skipped: SAMSUNG32/SAMSUNG48 auto repetition frame #%d, counter = %d, auto repetition len = %d\n",
+                                    repetition_frame_number + 1, key_repetition_len, AUTO_FRAME_REPETITION_LEN);
+                    key_repetition_len = 0;
+                }
+                else
+#endif
+
+#if IRMP_SUPPORT_NUBERT_PROTOCOL == 1
+                // if NUBERT protocol and the code will be repeated within 50 ms, we will ignore every 2nd frame
+                if (irmp_param.protocol == IRMP_NUBERT_PROTOCOL && (repetition_frame_number & 0x01))
+                {
+                    ANALYZE_PRINTF4 ("code skipped: NUBERT auto repetition frame #%d, counter = %u, auto repetition len = %u\n",
+                                    repetition_frame_number + 1, (unsigned int) key_repetition_len, (unsigned int) AUTO_FRAME_REPETITION_LEN);
+                    key_repetition_len = 0;
+                }
+                else
+#endif
+
+#if IRMP_SUPPORT_SPEAKER_PROTOCOL == 1
+                // if SPEAKER protocol and the code will be repeated within 50 ms, we will ignore every 2nd frame
+                if (irmp_param.protocol == IRMP_SPEAKER_PROTOCOL && (repetition_frame_number & 0x01))
+                {
+                    ANALYZE_PRINTF4 ("code skipped: SPEAKER auto repetition frame #%d, counter = %u, auto repetition len = %u\n",
+                                    repetition_frame_number + 1, (unsigned int) key_repetition_len, (unsigned int) AUTO_FRAME_REPETITION_LEN);
+                    key_repetition_len = 0;
+                }
+                else
+#endif
+
+                {
+                    ANALYZE_PRINTF3 ("%8.3fms code detected, length = %d\n", (double) (time_counter * 1000) / F_INTERRUPTS, irmp_bit);
+                    irmp_ir_detected = TRUE;
+
+#if IRMP_SUPPORT_KATHREIN_PROTOCOL == 1
+                    if (irmp_param.protocol == IRMP_KATHREIN_PROTOCOL && irmp_tmp_command == 0x0000)
+                    {
+                        if (irmp_tmp_command == 0x0000)                             // KATHREIN sends key release with command = 0x0000, ignore it
+                        {
+                            ANALYZE_PRINTF1 ("got KATHREIN release command, ignore it\n");
+                            irmp_ir_detected = FALSE;
+                        }
+                    }
+                    else
+#endif // IRMP_SUPPORT_KATHREIN_PROTOCOL
+#if IRMP_SUPPORT_DENON_PROTOCOL == 1
+                    if (irmp_param.protocol == IRMP_DENON_PROTOCOL)
+                    {                                                               // check for repetition frame
+                        if ((~irmp_tmp_command & 0x3FF) == last_irmp_denon_command) // command bits must be inverted
+                        {
+                            irmp_tmp_command = last_irmp_denon_command;             // use command received before!
+                            last_irmp_denon_command = 0;
+
+                            irmp_protocol = irmp_param.protocol;                    // store protocol
+                            irmp_address = irmp_tmp_address;                        // store address
+                            irmp_command = irmp_tmp_command;                        // store command
+                        }
+                        else
+                        {
+                            if ((irmp_tmp_command & 0x01) == 0x00)
+                            {
+                                ANALYZE_PRINTF2 ("%8.3fms info Denon: waiting for inverted command repetition\n", (double) (time_counter * 1000) / F_INTERRUPTS);
+                                last_irmp_denon_command = irmp_tmp_command;
+                                denon_repetition_len = 0;
+                                irmp_ir_detected = FALSE;
+                            }
+                            else
+                            {
+                                ANALYZE_PRINTF2 ("%8.3fms warning Denon: got unexpected inverted command, ignoring it\n", (double) (time_counter * 1000) / F_INTERRUPTS);
+                                last_irmp_denon_command = 0;
+                                irmp_ir_detected = FALSE;
+                            }
+                        }
+                    }
+                    else
+#endif // IRMP_SUPPORT_DENON_PROTOCOL
+
+#if IRMP_SUPPORT_GRUNDIG_PROTOCOL == 1
+                    if (irmp_param.protocol == IRMP_GRUNDIG_PROTOCOL && irmp_tmp_command == 0x01ff)
+                    {                                                               // Grundig start frame?
+                        ANALYZE_PRINTF1 ("Detected GRUNDIG start frame, ignoring it\n");
+                        irmp_ir_detected = FALSE;
+                    }
+                    else
+#endif // IRMP_SUPPORT_GRUNDIG_PROTOCOL
+
+#if IRMP_SUPPORT_NOKIA_PROTOCOL == 1
+                    if (irmp_param.protocol == IRMP_NOKIA_PROTOCOL && irmp_tmp_address == 0x00ff && irmp_tmp_command == 0x00fe)
+                    {                                                               // Nokia start frame?
+                        ANALYZE_PRINTF1 ("Detected NOKIA start frame, ignoring it\n");
+                        irmp_ir_detected = FALSE;
+                    }
+                    else
+#endif // IRMP_SUPPORT_NOKIA_PROTOCOL
+                    {
+#if IRMP_SUPPORT_NEC_PROTOCOL == 1
+                        if (irmp_param.protocol == IRMP_NEC_PROTOCOL && irmp_bit == 0)  // repetition frame
+                        {
+                            if (key_repetition_len < NEC_FRAME_REPEAT_PAUSE_LEN_MAX)
+                            {
+                                ANALYZE_PRINTF2 ("Detected NEC repetition frame, key_repetition_len = %u\n", (unsigned int) key_repetition_len);
+                                ANALYZE_ONLY_NORMAL_PRINTF1("REPETETION FRAME                ");
+                                irmp_tmp_address = last_irmp_address;                   // address is last address
+                                irmp_tmp_command = last_irmp_command;                   // command is last command
+                                irmp_flags |= IRMP_FLAG_REPETITION;
+                                key_repetition_len = 0;
+                            }
+                            else
+                            {
+                                ANALYZE_PRINTF3 ("Detected NEC repetition frame, ignoring it: timeout occured, key_repetition_len = %u > %u\n",
+                                                (unsigned int) key_repetition_len, (unsigned int) NEC_FRAME_REPEAT_PAUSE_LEN_MAX);
+                                irmp_ir_detected = FALSE;
+                            }
+                        }
+#endif // IRMP_SUPPORT_NEC_PROTOCOL
+
+#if IRMP_SUPPORT_KASEIKYO_PROTOCOL == 1
+                        if (irmp_param.protocol == IRMP_KASEIKYO_PROTOCOL)
+                        {
+                            uint_fast8_t xor_value;
+
+                            xor_value = (xor_check[0] & 0x0F) ^ ((xor_check[0] & 0xF0) >> 4) ^ (xor_check[1] & 0x0F) ^ ((xor_check[1] & 0xF0) >> 4);
+
+                            if (xor_value != (xor_check[2] & 0x0F))
+                            {
+                                ANALYZE_PRINTF3 ("error 4: wrong XOR check for customer id: 0x%1x 0x%1x\n", xor_value, xor_check[2] & 0x0F);
+                                irmp_ir_detected = FALSE;
+                            }
+
+                            xor_value = xor_check[2] ^ xor_check[3] ^ xor_check[4];
+
+                            if (xor_value != xor_check[5])
+                            {
+                                ANALYZE_PRINTF3 ("error 5: wrong XOR check for data bits: 0x%02x 0x%02x\n", xor_value, xor_check[5]);
+                                irmp_ir_detected = FALSE;
+                            }
+
+                            irmp_flags |= genre2;       // write the genre2 bits into MSB of the flag byte
+                        }
+#endif // IRMP_SUPPORT_KASEIKYO_PROTOCOL == 1
+
+#if IRMP_SUPPORT_ORTEK_PROTOCOL == 1
+                        if (irmp_param.protocol == IRMP_ORTEK_PROTOCOL)
+                        {
+                            if (parity == PARITY_CHECK_FAILED)
+                            {
+                                ANALYZE_PRINTF1 ("error 6: parity check failed\n");
+                                irmp_ir_detected = FALSE;
+                            }
+
+                            if ((irmp_tmp_address & 0x03) == 0x02)
+                            {
+                                ANALYZE_PRINTF1 ("code skipped: ORTEK end of transmission frame (key release)\n");
+                                irmp_ir_detected = FALSE;
+                            }
+                            irmp_tmp_address >>= 2;
+                        }
+#endif // IRMP_SUPPORT_ORTEK_PROTOCOL == 1
+
+#if IRMP_FRAME_BITS >= 128 && (IRMP_SUPPORT_ACP24_PROTOCOL == 1 || IRMP_SUPPORT_MITSU_HEAVY_PROTOCOL == 1)
+                        if (irmp_param.protocol == IRMP_ACP24_PROTOCOL || irmp_param.protocol == IRMP_MITSU_HEAVY_PROTOCOL)
+                        {
+                            irmp_frame_acc_fold ();                                 // address and command: see irmp_get_data()
+                        }
+#elif IRMP_SUPPORT_MITSU_HEAVY_PROTOCOL == 1
+                        if (irmp_param.protocol == IRMP_MITSU_HEAVY_PROTOCOL)
+                        {
+                            check = irmp_tmp_command >> 8;                    // inverted upper byte == lower byte?
+                            check = ~ check;
+                            if (check == (irmp_tmp_command & 0xFF)) {         //ok:
+                              irmp_tmp_command &= 0xFF;
+                            }
+                            else  mitsu_parity = PARITY_CHECK_FAILED;
+                            if (mitsu_parity == PARITY_CHECK_FAILED)
+                            {
+                                ANALYZE_PRINTF1 ("error 7: parity check failed\n");
+                                irmp_ir_detected = FALSE;
+                            }
+                        }
+#endif // IRMP_SUPPORT_MITSU_HEAVY_PROTOCOL
+
+#if IRMP_SUPPORT_RC6_PROTOCOL == 1
+                        if (irmp_param.protocol == IRMP_RC6_PROTOCOL && irmp_param.complete_len == RC6_COMPLETE_DATA_LEN_LONG)     // RC6 mode = 6?
+                        {
+                            irmp_protocol = IRMP_RC6A_PROTOCOL;
+                        }
+                        else if (irmp_param.protocol == IRMP_RC6_PROTOCOL && irmp_param.complete_len == RC6_COMPLETE_DATA_LEN_20)       // RC6 mode = 6?
+                        {
+                            irmp_protocol = IRMP_RC6A20_PROTOCOL;
+                        }
+                        else if (irmp_param.protocol == IRMP_RC6_PROTOCOL && irmp_param.complete_len == RC6_COMPLETE_DATA_LEN_28)       // RC6 mode = 6?
+                        {
+                            irmp_protocol = IRMP_RC6A28_PROTOCOL;
+                        }
+                        else
+#endif // IRMP_SUPPORT_RC6_PROTOCOL == 1
+                        {
+                            irmp_protocol = irmp_param.protocol;
+                        }
+
+#if IRMP_SUPPORT_FDC_PROTOCOL == 1
+                        if (irmp_param.protocol == IRMP_FDC_PROTOCOL)
+                        {
+                            if (irmp_tmp_command & 0x000F)                          // released key?
+                            {
+                                irmp_tmp_command = (irmp_tmp_command >> 4) | 0x80;  // yes, set bit 7
+                            }
+                            else
+                            {
+                                irmp_tmp_command >>= 4;                             // no, it's a pressed key
+                            }
+                            irmp_tmp_command |= (irmp_tmp_address << 2) & 0x0F00;   // 000000CCCCAAAAAA -> 0000CCCC00000000
+                            irmp_tmp_address &= 0x003F;
+                        }
+#endif
+
+                        irmp_address = irmp_tmp_address;                            // store address
+#if IRMP_SUPPORT_NEC_PROTOCOL == 1
+                        if (irmp_param.protocol == IRMP_NEC_PROTOCOL)
+                        {
+                            last_irmp_address = irmp_tmp_address;                   // store as last address, too
+                        }
+#endif
+
+#if IRMP_SUPPORT_RC5_PROTOCOL == 1
+                        if (irmp_param.protocol == IRMP_RC5_PROTOCOL)
+                        {
+                            irmp_tmp_command |= rc5_cmd_bit6;                       // store bit 6
+                        }
+#endif
+#if IRMP_SUPPORT_S100_PROTOCOL == 1
+                        if (irmp_param.protocol == IRMP_S100_PROTOCOL)
+                        {
+                            irmp_tmp_command |= rc5_cmd_bit6;                       // store bit 6
+                        }
+#endif
+                        irmp_command = irmp_tmp_command;                            // store command
+
+#if IRMP_SUPPORT_SAMSUNG_PROTOCOL == 1
+                        irmp_id = irmp_tmp_id;
+#endif
+                    }
+                }
+
+                if (irmp_ir_detected)
+                {
+#if IRMP_ENABLE_DATA_EX == 1
+                    irmp_store_frame_ticks (irmp_start_bit_ticks, TRUE);
+#endif
+#if IRMP_FRAME_BITS > 0
+                    irmp_frame_acc_len = (irmp_bit < IRMP_FRAME_BITS) ? irmp_bit : IRMP_FRAME_BITS;
+#endif
+                    if (last_irmp_command == irmp_tmp_command &&
+                        last_irmp_address == irmp_tmp_address &&
+#if IRMP_AUTODETECT_REPEATRATE
+                        irmp_protocol == previous_irmp_protocol)
+                    {
+                        same_key = 1;
+                    }
+                    pass_on_delta_detection = delta_detection;
+                    delta_detection = 0;
+#else
+                        key_repetition_len < IRMP_KEY_REPETITION_LEN) // time after data frame, not total since start
+                    {
+                        irmp_flags |= IRMP_FLAG_REPETITION;
+                    }
+#endif
+                    last_irmp_address   = irmp_tmp_address;                          // store as last address, too
+                    last_irmp_command   = irmp_tmp_command;                          // store as last command, too
+
+#if IRMP_ENABLE_RELEASE_DETECTION == 1
+                    key_released        = FALSE;
+#endif
+                    key_repetition_len  = 0;
+                }
+                else
+                {
+                    ANALYZE_ONLY_NORMAL_PUTCHAR ('\n');
+                }
+
+                irmp_start_bit_detected = 0;                                        // and wait for next start bit
+                irmp_tmp_command        = 0;
+                irmp_pulse_time         = 0;
+                irmp_pause_time         = 0;
+
+#if IRMP_SUPPORT_JVC_PROTOCOL == 1
+                if (irmp_protocol == IRMP_JVC_PROTOCOL)                             // the stop bit of JVC frame is also start bit of next frame
+                {                                                                   // set pulse time here!
+                    irmp_pulse_time = ((uint_fast8_t)(F_INTERRUPTS * JVC_START_BIT_PULSE_TIME));
+                }
+#endif // IRMP_SUPPORT_JVC_PROTOCOL == 1
+            }
+        }
+    }
+
+#if IRMP_ENABLE_CANDIDATES == 1
+    if (irmp_candidate_state != IRMP_CANDIDATE_IDLE && ! irmp_start_bit_detected && ! irmp_candidate_replaying)
+    {                                                                           // frame finished or start bit timed out
+        if (irmp_candidate_state == IRMP_CANDIDATE_DECODING && ! irmp_ir_detected && irmp_candidate_mask)
+        {                                                                       // failed, try next candidates
+            return irmp_candidate_replay ();                                    // the replayed ticks, this one too, did the rest
+        }
+
+        irmp_candidate_state = IRMP_CANDIDATE_IDLE;
+    }
+#endif
+
+#if IRMP_ENABLE_HASH_DECODER == 1
+    irmp_hash_put ();
+#endif
+
+#if IRMP_USE_IDLE_FAST_PATH == 1
+    irmp_steady_idle = irmp_input && ! irmp_start_bit_detected && ! irmp_pulse_time && ! irmp_ir_detected  // dark, no frame
+#  if IRMP_ENABLE_RELEASE_DETECTION == 1
+                       && key_released                                          // no release frame pending
+#  endif
+#  if IRMP_AUTODETECT_REPEATRATE
+                       && delta_detection == 0xFFFF
+#  endif
+#  if IRMP_SUPPORT_DENON_PROTOCOL == 1
+                       && denon_repetition_len == 0xFFFF                        // no inverted DENON frame pending
+#  endif
+#  if IRMP_ENABLE_CANDIDATES == 1
+                       && irmp_candidate_state == IRMP_CANDIDATE_IDLE
+#  endif
+#  if IRMP_RAW_CAPTURE_LEN > 0
+                       && ! irmp_raw_recording
+#  endif
+                       ;
+#endif // IRMP_USE_IDLE_FAST_PATH == 1
+
+#if IRMP_FRAME_QUEUE_SIZE > 0
+    frame_ready = irmp_ir_detected && irmp_queue_put ();                       // store frame in queue and continue decoding at next call
+#else
+    frame_ready = irmp_ir_detected;
+#endif
+
+#if defined(STELLARIS_ARM_CORTEX_M4)
+    // Clear the timer interrupt
+    TimerIntClear(TIMER1_BASE, TIMER_TIMA_TIMEOUT);
+#endif
+
+#if (defined(_CHIBIOS_RT_) || defined(_CHIBIOS_NIL_)) && IRMP_USE_EVENT == 1
+    if (IRMP_EVENT_THREAD_PTR != nullptr && frame_ready)
+        chEvtSignalI(IRMP_EVENT_THREAD_PTR,IRMP_EVENT_BIT);
+#endif
+
+#if IRMP_USE_COMPLETE_CALLBACK == 1
+    if (irmp_complete_callback_function != nullptr && frame_ready) {
+        irmp_complete_callback_function();
+    }
+#endif
+
+#if IRMP_USE_IDLE_CALL == 1
+    // check if there is no ongoing transmission or repetition
+    if (!irmp_start_bit_detected && !irmp_pulse_time
+        && key_repetition_len > IRMP_KEY_REPETITION_LEN)
+    {
+        // no ongoing transmission
+        // enough time passed since last decoded signal that a repetition won't affect our output
+
+        irmp_idle();
+    }
+#endif // IRMP_USE_IDLE_CALL
+
+    return (frame_ready);
+}
+
+#if IRMP_ENABLE_CONTEXT == 1
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ *  Initialize decoder context
+ *  @details  sets all members to their start values, must be called once for every context before use
+ *  @param    pointer to context
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+void
+irmp_init_ctx (IRMP_CONTEXT * ctx)
+{
+    IRMP_CONTEXT *  saved_ctx = irmp_ctx;
+
+    memset ((void *) ctx, 0, sizeof (IRMP_CONTEXT));
+    irmp_ctx = ctx;
+    last_irmp_address = 0xFFFF;
+#if IRMP_32_BIT == 1
+    last_irmp_command = 0xFFFFFFFF;
+#else
+    last_irmp_command = 0xFFFF;
+#endif
+#if IRMP_ENABLE_RELEASE_DETECTION == 1
+    key_released = TRUE;
+#endif
+#if IRMP_SUPPORT_DENON_PROTOCOL == 1
+    denon_repetition_len = 0xFFFF;
+#endif
+    irmp_ctx = saved_ctx;
+}
+
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ *  ISR routine working on a context
+ *  @details  same as irmp_ISR(), but takes the input level from the caller and works on the given context
+ *  @param    pointer to context
+ *  @param    input level as read from the pin (0 = active for low active sensors)
+ *  @return   TRUE: frame complete and ready for irmp_get_data_ctx()
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+#ifdef __cplusplus
+bool
+#else
+uint_fast8_t
+#endif
+#if defined(ESP8266) || defined(ESP32)
+IRAM_ATTR
+#endif
+irmp_ISR_ctx (IRMP_CONTEXT * ctx, uint_fast8_t level)
+{
+    IRMP_CONTEXT *  saved_ctx = irmp_ctx;                               // irmp_ISR_ctx() may interrupt an irmp_get_data_ctx() call
+    uint_fast8_t    rtc;
+
+    irmp_ctx = ctx;
+    rtc = irmp_ISR_input (level);
+    irmp_ctx = saved_ctx;
+    return rtc;
+}
+
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ *  Get IRMP data of a context
+ *  @details  same as irmp_get_data(), but for the given context
+ *  @param    pointer to context
+ *  @param    pointer in order to store IRMP data
+ *  @return   TRUE: successful, FALSE: failed
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+#ifdef __cplusplus
+bool
+#else
+uint_fast8_t
+#endif
+irmp_get_data_ctx (IRMP_CONTEXT * ctx, IRMP_DATA * irmp_data_p)
+{
+    IRMP_CONTEXT *  saved_ctx = irmp_ctx;
+    uint_fast8_t    rtc;
+
+    irmp_ctx = ctx;
+    rtc = irmp_get_data_current (irmp_data_p);
+    irmp_ctx = saved_ctx;
+    return rtc;
+}
+
+#if IRMP_FRAME_QUEUE_SIZE > 0
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ *  Get IRMP data and time of the frame of a context
+ *  @details  same as irmp_get_data_timestamp(), but for the given context
+ *  @param    pointer to context
+ *  @param    pointer in order to store IRMP data
+ *  @param    pointer in order to store the tick count at end of frame
+ *  @return   TRUE: successful, FALSE: failed
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+#ifdef __cplusplus
+bool
+#else
+uint_fast8_t
+#endif
+irmp_get_data_timestamp_ctx (IRMP_CONTEXT * ctx, IRMP_DATA * irmp_data_p, uint32_t * ticks_p)
+{
+    IRMP_CONTEXT *  saved_ctx = irmp_ctx;
+    uint_fast8_t    rtc;
+
+    irmp_ctx = ctx;
+    rtc = irmp_queue_get (irmp_data_p, ticks_p);
+    irmp_ctx = saved_ctx;
+    return rtc;
+}
+
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ *  Get number of lost frames of a context
+ *  @details  same as irmp_get_queue_overflows(), but for the given context
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+uint16_t
+irmp_get_queue_overflows_ctx (IRMP_CONTEXT * ctx)
+{
+    IRMP_CONTEXT *  saved_ctx = irmp_ctx;
+    uint16_t        overflows;
+
+    irmp_ctx = ctx;
+    overflows = irmp_queue_get_overflows ();
+    irmp_ctx = saved_ctx;
+    return overflows;
+}
+#endif // IRMP_FRAME_QUEUE_SIZE > 0
+
+#if IRMP_ENABLE_DATA_EX == 1
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ *  Get IRMP data with timestamps of a context
+ *  @details  same as irmp_get_data_ex(), but for the given context
+ *  @param    pointer to context
+ *  @param    pointer in order to store IRMP data and timestamps
+ *  @return   TRUE: successful, FALSE: failed
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+#ifdef __cplusplus
+bool
+#else
+uint_fast8_t
+#endif
+irmp_get_data_ex_ctx (IRMP_CONTEXT * ctx, IRMP_DATA_EX * irmp_data_ex_p)
+{
+    IRMP_CONTEXT *  saved_ctx = irmp_ctx;
+    uint_fast8_t    rtc;
+
+    irmp_ctx = ctx;
+    rtc = irmp_get_data_ex_current (irmp_data_ex_p);
+    irmp_ctx = saved_ctx;
+    return rtc;
+}
+
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ *  Get tick count of a context
+ *  @details  same as irmp_get_ticks(), but for the given context
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+uint32_t
+irmp_get_ticks_ctx (IRMP_CONTEXT * ctx)
+{
+    IRMP_CONTEXT *  saved_ctx = irmp_ctx;
+    uint32_t        ticks;
+
+    irmp_ctx = ctx;
+    ticks = irmp_get_ticks_current ();
+    irmp_ctx = saved_ctx;
+    return ticks;
+}
+#endif // IRMP_ENABLE_DATA_EX == 1
+
+#if IRMP_RAW_CAPTURE_LEN > 0
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ *  Get raw frame of a context
+ *  @details  same as irmp_get_raw_frame(), but for the given context
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+const IRMP_RAW_FRAME *
+irmp_get_raw_frame_ctx (IRMP_CONTEXT * ctx)
+{
+    IRMP_CONTEXT *          saved_ctx = irmp_ctx;
+    const IRMP_RAW_FRAME *  frame_p;
+
+    irmp_ctx = ctx;
+    frame_p = irmp_get_raw_frame_current ();
+    irmp_ctx = saved_ctx;
+    return frame_p;
+}
+#endif // IRMP_RAW_CAPTURE_LEN > 0
+
+#if IRMP_FRAME_BITS > 0
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ *  Get data bits of frame of a context
+ *  @details  same as irmp_get_frame(), but for the given context
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+const IRMP_FRAME *
+irmp_get_frame_ctx (IRMP_CONTEXT * ctx)
+{
+    IRMP_CONTEXT *      saved_ctx = irmp_ctx;
+    const IRMP_FRAME *  frame_p;
+
+    irmp_ctx = ctx;
+    frame_p = irmp_get_frame_current ();
+    irmp_ctx = saved_ctx;
+    return frame_p;
+}
+#endif // IRMP_FRAME_BITS > 0
+
+/*
+ * The global API works on the default context
+ */
+#if defined(ESP8266) || defined(ESP32)
+bool IRAM_ATTR irmp_ISR(void)
+#else
+#  ifdef __cplusplus
+bool irmp_ISR(void)
+#  else
+uint_fast8_t irmp_ISR(void)
+#  endif
+#endif
+{
+    return irmp_ISR_ctx (&irmp_default_context, input(IRMP_PIN));
+}
+
+#ifdef __cplusplus
+bool
+#else
+uint_fast8_t
+#endif
+irmp_get_data (IRMP_DATA * irmp_data_p)
+{
+    return irmp_get_data_ctx (&irmp_default_context, irmp_data_p);
+}
+
+#if IRMP_FRAME_QUEUE_SIZE > 0
+#ifdef __cplusplus
+bool
+#else
+uint_fast8_t
+#endif
+irmp_get_data_timestamp (IRMP_DATA * irmp_data_p, uint32_t * ticks_p)
+{
+    return irmp_get_data_timestamp_ctx (&irmp_default_context, irmp_data_p, ticks_p);
+}
+
+uint16_t
+irmp_get_queue_overflows (void)
+{
+    return irmp_get_queue_overflows_ctx (&irmp_default_context);
+}
+#endif // IRMP_FRAME_QUEUE_SIZE > 0
+
+#if IRMP_ENABLE_DATA_EX == 1
+#ifdef __cplusplus
+bool
+#else
+uint_fast8_t
+#endif
+irmp_get_data_ex (IRMP_DATA_EX * irmp_data_ex_p)
+{
+    return irmp_get_data_ex_ctx (&irmp_default_context, irmp_data_ex_p);
+}
+
+uint32_t
+irmp_get_ticks (void)
+{
+    return irmp_get_ticks_ctx (&irmp_default_context);
+}
+#endif // IRMP_ENABLE_DATA_EX == 1
+
+#if IRMP_RAW_CAPTURE_LEN > 0
+const IRMP_RAW_FRAME *
+irmp_get_raw_frame (void)
+{
+    return irmp_get_raw_frame_ctx (&irmp_default_context);
+}
+#endif // IRMP_RAW_CAPTURE_LEN > 0
+
+#if IRMP_FRAME_BITS > 0
+const IRMP_FRAME *
+irmp_get_frame (void)
+{
+    return irmp_get_frame_ctx (&irmp_default_context);
+}
+#endif // IRMP_FRAME_BITS > 0
+#endif // IRMP_ENABLE_CONTEXT == 1
+
+#if IRMP_ENABLE_FEED_DURATION == 1
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ *  Get number of following ticks which only increment a counter
+ *  @details  irmp_feed_duration() skips these ticks instead of calling irmp_ISR_input() for each of them.
+ *            Every limit here belongs to a comparison in irmp_ISR_input(), so keep both in sync!
+ *            A limit may be too small (then some more ticks are run through irmp_ISR_input()), but never too big.
+ *  @param    irmp_input as used in irmp_ISR_input(): 0 = pulse, 1 = pause
+ *  @return   number of ticks which can be skipped
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+static uint_fast16_t
+irmp_get_decoder_skip_len (uint_fast8_t irmp_input)
+{
+    uint_fast16_t   limit = 0xFFFF;
+    uint_fast16_t   pulse_time_max = (sizeof (irmp_pulse_time) == 1) ? 0xFF : 0xFFFF;
+
+    if (! irmp_start_bit_detected)
+    {
+        if (! irmp_input)
+        {                                                                       // counting start bit pulse
+            return pulse_time_max - irmp_pulse_time;
+        }
+
+        if (irmp_pulse_time)
+        {                                                                       // start bit pulse ended, next tick starts the pause
+            return 0;
+        }
+
+        if (key_repetition_len == 0xFFFF)
+        {                                                                       // idle, counter is already saturated
+            return limit;
+        }
+
+        limit = 0xFFFF - key_repetition_len;
+
+#if IRMP_ENABLE_RELEASE_DETECTION == 1
+        if (! key_released)
+        {
+            if (key_repetition_len >= IRMP_KEY_RELEASE_LEN)
+            {
+                return 0;
+            }
+
+            if (limit > IRMP_KEY_RELEASE_LEN - key_repetition_len)
+            {
+                limit = IRMP_KEY_RELEASE_LEN - key_repetition_len;
+            }
+        }
+#endif
+
+#if IRMP_SUPPORT_DENON_PROTOCOL == 1
+        if (denon_repetition_len < 0xFFFF)
+        {
+            uint_fast16_t denon_limit;
+
+            if (last_irmp_denon_command != 0)
+            {
+                if (denon_repetition_len + 1 >= DENON_AUTO_REPETITION_PAUSE_LEN)
+                {
+                    return 0;
+                }
+                denon_limit = DENON_AUTO_REPETITION_PAUSE_LEN - 1 - denon_repetition_len;
+            }
+            else
+            {
+                denon_limit = 0xFFFF - denon_repetition_len;
+            }
+
+            if (limit > denon_limit)
+            {
+                limit = denon_limit;
+            }
+        }
+#endif
+        return limit;
+    }
+
+    if (irmp_bit == irmp_param.complete_len && irmp_param.stop_bit == 0)
+    {                                                                           // frame is completed with next tick
+        return 0;
+    }
+
+    if (! irmp_input)
+    {
+        if (wait_for_start_space || wait_for_space)
+        {                                                                       // pause ended, next tick handles it
+            return 0;
+        }
+        return pulse_time_max - irmp_pulse_time;                                // counting data pulse
+    }
+
+    if (wait_for_start_space)
+    {
+        uint_fast16_t timeout_len = IRMP_TIMEOUT_LEN;
+
+#if IRMP_SUPPORT_NIKON_PROTOCOL == 1
+        if (irmp_pulse_time >= NIKON_START_BIT_PULSE_LEN_MIN && irmp_pulse_time <= NIKON_START_BIT_PULSE_LEN_MAX)
+        {
+            timeout_len = IRMP_TIMEOUT_NIKON_LEN;
+        }
+        else if (IRMP_TIMEOUT_NIKON_LEN < IRMP_TIMEOUT_LEN)
+        {
+            timeout_len = IRMP_TIMEOUT_NIKON_LEN;
+        }
+#endif
+        return (irmp_pause_time < timeout_len) ? timeout_len - irmp_pause_time : 0;
+    }
+
+    if (wait_for_space)
+    {                                                                           // counting data pause
+        uint_fast16_t pause_limit = IRMP_TIMEOUT_LEN;                           // last pause value which triggers nothing
+
+        if (irmp_bit == irmp_param.complete_len && irmp_param.stop_bit == 1)
+        {
+            if (irmp_param.flags & IRMP_PARAM_FLAG_IS_MANCHESTER)
+            {
+                return 0;
+            }
+            if (pause_limit > STOP_BIT_PAUSE_LEN_MIN)
+            {
+                pause_limit = STOP_BIT_PAUSE_LEN_MIN;
+            }
+        }
+
+#if IRMP_SUPPORT_SIRCS_PROTOCOL == 1
+        if (irmp_param.protocol == IRMP_SIRCS_PROTOCOL && irmp_bit >= 12 - 1 && pause_limit > SIRCS_PAUSE_LEN_MAX)
+        {
+            pause_limit = SIRCS_PAUSE_LEN_MAX;
+        }
+#endif
+#if IRMP_SUPPORT_MERLIN_PROTOCOL == 1
+        if (irmp_param.protocol == IRMP_MERLIN_PROTOCOL && irmp_bit >= 8 - 1 && pause_limit > MERLIN_START_BIT_PAUSE_LEN_MAX)
+        {
+            pause_limit = MERLIN_START_BIT_PAUSE_LEN_MAX;
+        }
+#endif
+#if IRMP_SUPPORT_FAN_PROTOCOL == 1
+        if (irmp_param.protocol == IRMP_FAN_PROTOCOL && irmp_bit >= FAN_COMPLETE_DATA_LEN - 1)
+        {
+            if (pause_limit > FAN_0_PAUSE_LEN_MIN - 1)
+            {
+                pause_limit = FAN_0_PAUSE_LEN_MIN - 1;
+            }
+            if (pause_limit > FAN_1_PAUSE_LEN_MIN - 1)
+            {
+                pause_limit = FAN_1_PAUSE_LEN_MIN - 1;
+            }
+        }
+#endif
+#if IRMP_SUPPORT_SERIAL == 1
+        if ((irmp_param.flags & IRMP_PARAM_FLAG_IS_SERIAL) && irmp_param.protocol == IRMP_NETBOX_PROTOCOL)
+        {
+            if (irmp_bit >= NETBOX_COMPLETE_DATA_LEN)
+            {
+                return 0;
+            }
+            if (pause_limit > NETBOX_PULSE_LEN * (NETBOX_COMPLETE_DATA_LEN - irmp_bit) - 1)
+            {
+                pause_limit = NETBOX_PULSE_LEN * (NETBOX_COMPLETE_DATA_LEN - irmp_bit) - 1;
+            }
+        }
+#endif
+#if IRMP_SUPPORT_GRUNDIG_NOKIA_IR60_PROTOCOL == 1
+        if (irmp_param.protocol == IRMP_GRUNDIG_PROTOCOL && ! irmp_param.stop_bit)
+        {
+            if (irmp_bit >= GRUNDIG_COMPLETE_DATA_LEN - 2)
+            {                                                                   // may switch to NOKIA without any pause condition
+                return 0;
+            }
+            if (pause_limit > IR60_TIMEOUT_LEN)
+            {
+                pause_limit = IR60_TIMEOUT_LEN;
+            }
+        }
+#endif
+#if IRMP_SUPPORT_SIEMENS_OR_RUWIDO_PROTOCOL == 1
+        if (irmp_param.protocol == IRMP_RUWIDO_PROTOCOL && ! irmp_param.stop_bit && irmp_bit >= RUWIDO_COMPLETE_DATA_LEN - 2)
+        {
+            return 0;
+        }
+#endif
+#if IRMP_SUPPORT_ROOMBA_PROTOCOL == 1
+        if (irmp_param.protocol == IRMP_ROOMBA_PROTOCOL && irmp_bit >= ROOMBA_COMPLETE_DATA_LEN - 1)
+        {
+            return 0;
+        }
+#endif
+#if IRMP_SUPPORT_MANCHESTER == 1
+        if ((irmp_param.flags & IRMP_PARAM_FLAG_IS_MANCHESTER) && pause_limit > 2 * irmp_param.pause_1_len_max - 1)
+        {
+            pause_limit = 2 * irmp_param.pause_1_len_max - 1;
+        }
+#endif
+        return (irmp_pause_time < pause_limit) ? pause_limit - irmp_pause_time : 0;
+    }
+
+    return 0;
+}
+
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ *  Get number of following ticks which can be skipped
+ *  @details  limit of the decoder, reduced by the limits of the hash decoder, of the logging and of the repeat rate detection
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+static uint_fast16_t
+irmp_get_skip_len (uint_fast8_t irmp_input)
+{
+    uint_fast16_t   skip_len = irmp_get_decoder_skip_len (irmp_input);
+
+#if IRMP_ENABLE_HASH_DECODER == 1
+    uint_fast16_t   hash_skip_len = irmp_hash_get_skip_len (irmp_input);
+
+    if (skip_len > hash_skip_len)
+    {
+        skip_len = hash_skip_len;
+    }
+#endif
+
+#if IRMP_LOGGING == 1
+#  if IRMP_ENABLE_CANDIDATES == 1
+    if (! irmp_candidate_replaying)                                             // replayed ticks have been logged already
+#  endif
+    {
+        uint_fast16_t   log_skip_len = irmp_log_get_skip_len (irmp_input);
+
+        if (skip_len > log_skip_len)
+        {
+            skip_len = log_skip_len;
+        }
+    }
+#endif
+
+#if IRMP_AUTODETECT_REPEATRATE && IRMP_ENABLE_RELEASE_DETECTION == 1
+    if (! key_released)
+    {                                                                           // stop before the release timeout of irmp_ISR_input()
+        uint_fast16_t   release_len = (uint32_t) upper_border * 1000 / (1000000 / F_INTERRUPTS);
+
+        if (delta_detection + 1 >= release_len)
+        {
+            return 0;
+        }
+
+        if (skip_len > release_len - 1 - delta_detection)
+        {
+            skip_len = release_len - 1 - delta_detection;
+        }
+    }
+#endif
+
+    return skip_len;
+}
+
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ *  Skip ticks
+ *  @details  does the same as len calls of irmp_ISR_input(), len must not be greater than irmp_get_skip_len()
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+static void
+irmp_skip_ticks (uint_fast8_t irmp_input, uint_fast16_t len)
+{
+#if IRMP_USE_IDLE_FAST_PATH == 1
+    irmp_steady_idle = FALSE;                                                   // the ticks may be a pulse, next irmp_ISR() checks again
+#endif
+
+#if defined(ANALYZE)
+    time_counter += len;
+#endif
+
+#if IRMP_USE_TICK_COUNTER == 1
+    irmp_tick_counter += len;
+#endif
+
+#if IRMP_ENABLE_CANDIDATES == 1
+    irmp_candidate_record (irmp_input, len);
+#endif
+
+#if IRMP_RAW_CAPTURE_LEN > 0
+#  if IRMP_ENABLE_CANDIDATES == 1
+    if (! irmp_candidate_replaying)                                             // replayed ticks have been recorded already
+#  endif
+    {
+        irmp_raw_record (irmp_input, len);
+    }
+#endif
+
+#if IRMP_ENABLE_HASH_DECODER == 1
+#  if IRMP_ENABLE_CANDIDATES == 1
+    if (! irmp_candidate_replaying)                                             // replayed ticks have been hashed already
+#  endif
+    {
+        irmp_hash_record (irmp_input, len);
+    }
+#endif
+
+#if IRMP_LOGGING == 1
+#  if IRMP_ENABLE_CANDIDATES == 1
+    if (! irmp_candidate_replaying)                                             // replayed ticks have been logged already
+#  endif
+    {
+        irmp_log_skip (len);
+    }
+#endif
+
+#if IRMP_AUTODETECT_REPEATRATE
+    delta_detection = (delta_detection < 0xFFFF - len) ? delta_detection + len : 0xFFFF;
+#endif
+
+    if (! irmp_start_bit_detected)
+    {
+        if (! irmp_input)
+        {
+            irmp_pulse_time += len;
+        }
+        else if (key_repetition_len < 0xFFFF)
+        {
+            key_repetition_len += len;
+#if IRMP_SUPPORT_DENON_PROTOCOL == 1
+            if (denon_repetition_len < 0xFFFF)
+            {
+                denon_repetition_len += len;
+            }
+#endif
+        }
+    }
+    else if (irmp_input)
+    {
+        irmp_pause_time += len;
+    }
+    else
+    {
+        irmp_pulse_time += len;
+    }
+}
+
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ *  Feed the decoder with a constant input level for a given time
+ *  @details  same result as calling irmp_ISR() ticks times with this input level, but most of the ticks are skipped,
+ *            so the CPU time depends on the number of edges instead of the length of the signal.
+ *            Call it for every edge with the level and the duration of the mark or space which just ended.
+ *            Durations may be split into several calls, e.g. to let a long pause end a frame before the next edge.
+ *            Feeding stops as soon as a frame is complete: fetch it with irmp_get_data() and feed the remaining ticks,
+ *            else they are lost like ticks of irmp_ISR() while a frame waits for irmp_get_data().
+ *  @param    input level as read from the pin (0 = active for low active sensors)
+ *  @param    duration in ticks (1 / F_INTERRUPTS)
+ *  @return   number of ticks not fed because a frame is ready for irmp_get_data(), 0 if all ticks were fed
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+#if IRMP_ENABLE_CONTEXT == 1
+static uint32_t
+irmp_feed_duration_current (uint_fast8_t level, uint32_t ticks)                // works on irmp_ctx, see irmp_feed_duration_ctx()
+#else
+uint32_t
+irmp_feed_duration (uint_fast8_t level, uint32_t ticks)
+#endif
+{
+    uint_fast8_t    irmp_input;
+    uint_fast16_t   skip_len;
+
+#if IRMP_HIGH_ACTIVE == 1
+    irmp_input = ! level;
+#else
+    irmp_input = level;
+#endif
+
+    while (ticks && ! irmp_ir_detected)
+    {
+        ticks--;
+
+        if (irmp_ISR_input (level))                                             // one real tick, the first one may be an edge
+        {
+            break;
+        }
+
+        skip_len = irmp_get_skip_len (irmp_input);
+
+        if (skip_len > ticks)
+        {
+            skip_len = ticks;
+        }
+
+        if (skip_len)
+        {
+            irmp_skip_ticks (irmp_input, skip_len);
+            ticks -= skip_len;
+        }
+    }
+
+    return (ticks);
+}
+
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ *  Convert microseconds to ticks for irmp_feed_duration()
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+#define IRMP_TICKS_PER_US_Q16   ((uint32_t) (F_INTERRUPTS * 65536.0 / 1000000 + 0.5))   // ticks per microsecond, 16.16 fixed point
+
+uint32_t
+irmp_micros_to_ticks (uint32_t micros)
+{                                                                               // no division, called by pin change ISRs. +-1 tick up to 100 ms
+    return (micros >> 16) * IRMP_TICKS_PER_US_Q16 + (((micros & 0xFFFF) * IRMP_TICKS_PER_US_Q16 + 0x8000) >> 16);
+}
+
+#if IRMP_ENABLE_CONTEXT == 1
+uint32_t
+irmp_feed_duration_ctx (IRMP_CONTEXT * ctx, uint_fast8_t level, uint32_t ticks)
+{
+    IRMP_CONTEXT *  saved_ctx = irmp_ctx;
+    uint32_t        rtc;
+
+    irmp_ctx = ctx;
+    rtc = irmp_feed_duration_current (level, ticks);
+    irmp_ctx = saved_ctx;
+    return rtc;
+}
+
+uint32_t
+irmp_feed_duration (uint_fast8_t level, uint32_t ticks)
+{
+    return irmp_feed_duration_ctx (&irmp_default_context, level, ticks);
+}
+
+#if IRMP_MULTI_RECEIVER_CHANNELS > 0
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ *  Multi receiver
+ *  @details  irmp_ISR_multi() gets the value of a port with up to 8 receivers and runs one decoder context per receiver,
+ *            channel n is bit n of the port value. A channel is fed with irmp_ISR_input() only if its level changes,
+ *            if its decoder needs every tick, or if the ticks which irmp_get_skip_len() allowed to skip have passed.
+ *            The skipped ticks are fed at once by irmp_skip_ticks() before. So the edges of all channels are detected
+ *            with one XOR, and an idle tick costs about the same for 8 channels as for one.
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+#define IRMP_MULTI_CHANNEL_MASK                 ((uint8_t) (0xFF >> (8 - IRMP_MULTI_RECEIVER_CHANNELS)))
+#if IRMP_MULTI_RECOVER == 1
+#  define IRMP_MULTI_CANDIDATES                 (IRMP_MULTI_RECEIVER_CHANNELS + 1)     // channels and merged signal
+#else
+#  define IRMP_MULTI_CANDIDATES                 IRMP_MULTI_RECEIVER_CHANNELS
+#endif
+
+static IRMP_CONTEXT                             irmp_multi_ctx[IRMP_MULTI_RECEIVER_CHANNELS];   // decoder context of each channel
+static uint16_t                                 irmp_multi_fed[IRMP_MULTI_RECEIVER_CHANNELS];   // irmp_multi_ticks after last feed
+static uint16_t                                 irmp_multi_due[IRMP_MULTI_RECEIVER_CHANNELS];   // tick at which channel must be fed
+static uint16_t                                 irmp_multi_ticks;       // tick counter, runs freely
+static uint16_t                                 irmp_multi_deadline;    // next tick at which a channel must be fed
+static uint8_t                                  irmp_multi_last_port;   // port value of last tick
+static uint8_t                                  irmp_multi_busy;        // bit mask of channels which are fed every tick
+#if IRMP_MULTI_COMBINE_TIME > 0
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ *  Combiner
+ *  @details  irmp_ISR_multi() fetches the frames of all channels. The first frame opens a window of IRMP_MULTI_COMBINE_LEN ticks,
+ *            each distinct frame (protocol, address, command) seen within the window is a candidate with the mask of the channels
+ *            which decoded it. At the end of the window, the candidate decoded by most channels wins, so a frame which was
+ *            corrupted on one channel, but decoded by the others, is outvoted, and a frame missed by a channel is still returned.
+ *            Key repetitions are detected by the decoder of each channel as before, see last_irmp_address and last_irmp_command.
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+typedef struct
+{
+    IRMP_DATA                                   data;                   // frame of first channel
+    uint8_t                                     channels;               // bit mask of channels which decoded the frame
+#if IRMP_MULTI_RECOVER == 1
+    uint8_t                                     recovered;              // bit mask of channels with edges, if recovered from merged signal
+#endif
+} IRMP_MULTI_CANDIDATE;
+
+static IRMP_MULTI_CANDIDATE                     irmp_multi_candidates[IRMP_MULTI_CANDIDATES];   // frames within window
+static uint_fast8_t                             irmp_multi_n_candidates;    // number of candidates, 0: window closed
+static uint16_t                                 irmp_multi_window_end;  // tick at which window closes
+static IRMP_MULTI_CANDIDATE                     irmp_multi_event;       // combined frame for irmp_get_data_combined()
+static volatile uint_fast8_t                    irmp_multi_event_ready; // flag: irmp_multi_event is valid
+
+#if defined(__GNUC__)
+#  define IRMP_MULTI_BARRIER()                  __asm__ __volatile__ ("" ::: "memory")  // keep event accesses on their side of the flag update
+#else
+#  define IRMP_MULTI_BARRIER()
+#endif
+
+#if IRMP_MULTI_RECOVER == 1
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ *  Recovery from the merged signal
+ *  @details  one more decoder context gets the merged signal of all channels: a pulse on any channel is a pulse. If a receiver
+ *            misses some pulses of a frame, e.g. because it sees the remote at a flat angle, the other receivers fill them in.
+ *            So a frame which no channel decoded alone can still be decoded from the merged signal. Such a frame only wins,
+ *            if no channel decoded a frame within the window, because noise of any channel also disturbs the merged signal.
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+static IRMP_CONTEXT                             irmp_multi_merged_ctx;  // decoder context of merged signal
+static uint16_t                                 irmp_multi_merged_fed;  // irmp_multi_ticks after last feed
+static uint16_t                                 irmp_multi_merged_due;  // tick at which merged signal must be fed
+static uint8_t                                  irmp_multi_merged_busy; // flag: merged signal is fed every tick
+static uint8_t                                  irmp_multi_merged_last; // merged input level of last tick
+static uint8_t                                  irmp_multi_edges;       // bit mask of channels with edges since last event
+#endif
+#else
+static uint_fast8_t                             irmp_multi_next_channel;    // channel which irmp_get_data_multi() looks at first
+#endif
+
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ *  Initialize multi receiver
+ *  @details  initializes the decoder contexts of all channels, must be called once before irmp_ISR_multi()
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+void
+irmp_init_multi (void)
+{
+    uint_fast8_t    channel;
+
+    for (channel = 0; channel < IRMP_MULTI_RECEIVER_CHANNELS; channel++)
+    {
+        irmp_init_ctx (&irmp_multi_ctx[channel]);
+        irmp_multi_fed[channel] = 0;
+    }
+
+#if IRMP_MULTI_COMBINE_TIME > 0 && IRMP_MULTI_RECOVER == 1
+    irmp_init_ctx (&irmp_multi_merged_ctx);
+    irmp_multi_merged_fed   = 0;
+    irmp_multi_merged_busy  = TRUE;
+    irmp_multi_merged_last  = IRMP_HIGH_ACTIVE ? 0 : 1;                         // idle
+    irmp_multi_edges        = 0;
+#endif
+
+    irmp_multi_ticks        = 0;
+    irmp_multi_last_port    = IRMP_HIGH_ACTIVE ? 0x00 : 0xFF;                  // idle
+    irmp_multi_busy         = IRMP_MULTI_CHANNEL_MASK;                          // feed all channels with the 1st tick
+#if IRMP_MULTI_COMBINE_TIME > 0
+    irmp_multi_n_candidates = 0;
+    irmp_multi_event_ready  = FALSE;
+#else
+    irmp_multi_next_channel = 0;
+#endif
+}
+
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ *  Feed a decoder context
+ *  @details  feeds the skipped ticks and the current tick
+ *  @param    decoder context
+ *  @param    irmp_multi_ticks after last feed, updated
+ *  @param    input level of the skipped ticks as read from the pin
+ *  @param    input level of the current tick as read from the pin
+ *  @param    number of ticks which may be skipped now, 0: feed every tick
+ *  @return   TRUE: frame complete
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+static uint_fast8_t
+irmp_multi_feed_ctx (IRMP_CONTEXT * ctx, uint16_t * fed_p, uint_fast8_t last_level, uint_fast8_t level, uint_fast16_t * skip_len_p)
+{
+    IRMP_CONTEXT *  saved_ctx = irmp_ctx;
+    uint_fast16_t   skip_len = (uint16_t) (irmp_multi_ticks - *fed_p);
+    uint_fast8_t    frame_ready;
+
+    irmp_ctx = ctx;
+
+    if (skip_len)
+    {
+        irmp_skip_ticks (IRMP_HIGH_ACTIVE ? ! last_level : last_level, skip_len);
+    }
+
+    frame_ready = irmp_ISR_input (level);
+    *fed_p = irmp_multi_ticks + 1;
+
+    *skip_len_p = irmp_ir_detected ? 0 : irmp_get_skip_len (IRMP_HIGH_ACTIVE ? ! level : level);  // a waiting frame stops the decoder
+
+    irmp_ctx = saved_ctx;
+    return frame_ready;
+}
+
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ *  Feed one channel
+ *  @details  feeds the skipped ticks and the current tick, then computes when the channel must be fed next
+ *  @param    channel
+ *  @param    input level of the channel as read from the pin
+ *  @return   TRUE: frame complete
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+static uint_fast8_t
+irmp_multi_feed (uint_fast8_t channel, uint_fast8_t level)
+{
+    uint_fast16_t   skip_len;
+    uint_fast8_t    frame_ready;
+
+    frame_ready = irmp_multi_feed_ctx (&irmp_multi_ctx[channel], &irmp_multi_fed[channel],
+                                       (irmp_multi_last_port >> channel) & 1, level, &skip_len);
+
+    if (skip_len)
+    {
+        irmp_multi_busy &= ~(1 << channel);
+        irmp_multi_due[channel] = irmp_multi_fed[channel] + skip_len;
+    }
+    else
+    {
+        irmp_multi_busy |= (1 << channel);
+    }
+
+    return frame_ready;
+}
+
+#if IRMP_MULTI_COMBINE_TIME > 0
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ *  Add frame of a channel to the candidates of the current window
+ *  @param    decoder context of the channel
+ *  @param    bit mask of the channel, 0: merged signal
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+static void
+irmp_multi_combine (IRMP_CONTEXT * ctx, uint8_t channel_mask)
+{
+    IRMP_DATA       irmp_data;
+    uint_fast8_t    i;
+
+    while (irmp_get_data_ctx (ctx, &irmp_data))                                 // fetch at once, a waiting frame would stop the decoder
+    {
+        if (irmp_multi_n_candidates == 0)
+        {
+            irmp_multi_window_end = irmp_multi_ticks + IRMP_MULTI_COMBINE_LEN;  // first frame opens the window
+        }
+
+        for (i = 0; i < irmp_multi_n_candidates; i++)
+        {
+            if (irmp_multi_candidates[i].data.protocol == irmp_data.protocol &&
+                irmp_multi_candidates[i].data.address == irmp_data.address &&
+                irmp_multi_candidates[i].data.command == irmp_data.command)
+            {
+                break;
+            }
+        }
+
+        if (i == irmp_multi_n_candidates)
+        {                                                                       // new candidate
+            if (i == IRMP_MULTI_CANDIDATES)
+            {
+                continue;                                                       // no space left, ignore frame
+            }
+
+            irmp_multi_candidates[i].data       = irmp_data;
+            irmp_multi_candidates[i].channels   = 0;
+#if IRMP_MULTI_RECOVER == 1
+            irmp_multi_candidates[i].recovered  = 0;
+#endif
+            irmp_multi_n_candidates++;
+        }
+
+        irmp_multi_candidates[i].channels |= channel_mask;
+#if IRMP_MULTI_RECOVER == 1
+        if (! channel_mask)
+        {                                                                       // merged signal: channels which have seen the frame
+            irmp_multi_candidates[i].recovered = irmp_multi_edges;
+        }
+#endif
+    }
+}
+
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ *  Close window and return candidate decoded by most channels
+ *  @return   TRUE: combined frame ready for irmp_get_data_combined()
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+static uint_fast8_t
+irmp_multi_close_window (void)
+{
+    uint_fast8_t    best = 0;
+    uint_fast8_t    best_count = 0;
+    uint_fast8_t    count;
+    uint_fast8_t    i;
+    uint8_t         channels;
+
+    for (i = 0; i < irmp_multi_n_candidates; i++)
+    {
+        for (count = 0, channels = irmp_multi_candidates[i].channels; channels; channels &= channels - 1)
+        {
+            count++;                                                            // count channels
+        }
+
+        if (count > best_count)                                                 // on a tie the first frame wins
+        {
+            best = i;
+            best_count = count;
+        }
+    }
+
+    irmp_multi_n_candidates = 0;
+#if IRMP_MULTI_RECOVER == 1
+    irmp_multi_edges        = 0;
+#endif
+
+    if (irmp_multi_event_ready)
+    {
+        return FALSE;                                                           // last frame not fetched yet, drop this one
+    }
+
+    irmp_multi_event = irmp_multi_candidates[best];
+#if IRMP_MULTI_RECOVER == 1
+    if (best_count == 0)
+    {                                                                           // only decoded from merged signal
+        irmp_multi_event.channels = irmp_multi_event.recovered;
+    }
+#endif
+    IRMP_MULTI_BARRIER ();
+    irmp_multi_event_ready = TRUE;
+    return TRUE;
+}
+
+#if IRMP_MULTI_RECOVER == 1
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ *  Decode merged signal
+ *  @details  feeds the merged signal of all channels on edges and due timeouts, as irmp_ISR_multi() does for each channel
+ *  @param    port value, bit n is the input level of channel n
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+static void
+irmp_multi_recover (uint_fast8_t port)
+{
+    uint_fast8_t    level;
+    uint_fast16_t   skip_len;
+
+#if IRMP_HIGH_ACTIVE == 1
+    level = (port & IRMP_MULTI_CHANNEL_MASK) ? 1 : 0;                          // pulse on any channel
+#else
+    level = ((port & IRMP_MULTI_CHANNEL_MASK) == IRMP_MULTI_CHANNEL_MASK) ? 1 : 0;
+#endif
+    irmp_multi_edges |= (port ^ irmp_multi_last_port) & IRMP_MULTI_CHANNEL_MASK;
+
+    if (level != irmp_multi_merged_last || irmp_multi_merged_busy || irmp_multi_ticks == irmp_multi_merged_due)
+    {
+        if (irmp_multi_feed_ctx (&irmp_multi_merged_ctx, &irmp_multi_merged_fed, irmp_multi_merged_last, level, &skip_len))
+        {
+            irmp_multi_combine (&irmp_multi_merged_ctx, 0);
+        }
+
+        irmp_multi_merged_busy  = (skip_len == 0);
+        irmp_multi_merged_due   = irmp_multi_merged_fed + skip_len;
+    }
+
+    irmp_multi_merged_last = level;
+}
+#endif // IRMP_MULTI_RECOVER == 1
+#endif // IRMP_MULTI_COMBINE_TIME > 0
+
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ *  ISR routine for multi receiver
+ *  @details  call it F_INTERRUPTS times per second with the value of the port the receivers are connected to
+ *  @param    port value, bit n is the input level of channel n
+ *  @return   TRUE: frame of at least one channel complete and ready for irmp_get_data_multi() or irmp_get_data_combined()
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+#ifdef __cplusplus
+bool
+#else
+uint_fast8_t
+#endif
+#if defined(ESP8266) || defined(ESP32)
+IRAM_ATTR
+#endif
+irmp_ISR_multi (uint_fast8_t port)
+{
+    uint8_t         due = ((port ^ irmp_multi_last_port) & IRMP_MULTI_CHANNEL_MASK) | irmp_multi_busy;  // channels with edge or busy decoder
+    uint_fast8_t    frame_ready = FALSE;
+    uint_fast8_t    channel;
+    uint16_t        distance;
+    uint16_t        min_distance;
+
+    if (irmp_multi_ticks == irmp_multi_deadline)
+    {                                                                           // add channels which have skipped as many ticks as allowed
+        for (channel = 0; channel < IRMP_MULTI_RECEIVER_CHANNELS; channel++)
+        {
+            if (irmp_multi_due[channel] == irmp_multi_ticks)
+            {
+                due |= (1 << channel);
+            }
+        }
+    }
+
+    if (due)
+    {
+        min_distance = 0xFFFF;
+
+        for (channel = 0; channel < IRMP_MULTI_RECEIVER_CHANNELS; channel++)
+        {
+            if (due & (1 << channel))
+            {
+                if (irmp_multi_feed (channel, (port >> channel) & 1))
+                {
+#if IRMP_MULTI_COMBINE_TIME > 0
+                    irmp_multi_combine (&irmp_multi_ctx[channel], 1 << channel);
+#else
+                    frame_ready = TRUE;
+#endif
+                }
+            }
+
+            if (! (irmp_multi_busy & (1 << channel)))
+            {
+                distance = irmp_multi_due[channel] - irmp_multi_ticks;
+
+                if (distance && distance < min_distance)
+                {
+                    min_distance = distance;
+                }
+            }
+        }
+
+        irmp_multi_deadline = irmp_multi_ticks + min_distance;
+    }
+
+#if IRMP_MULTI_COMBINE_TIME > 0 && IRMP_MULTI_RECOVER == 1
+    irmp_multi_recover (port);
+#endif
+
+#if IRMP_MULTI_COMBINE_TIME > 0
+    if (irmp_multi_n_candidates && irmp_multi_ticks == irmp_multi_window_end)
+    {
+        frame_ready = irmp_multi_close_window ();
+    }
+#endif
+
+    irmp_multi_last_port = port;
+    irmp_multi_ticks++;
+    return frame_ready;
+}
+
+#if IRMP_MULTI_COMBINE_TIME > 0
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ *  Get combined IRMP data of multi receiver
+ *  @details  returns a frame once, even if several channels decoded it
+ *  @param    pointer in order to store IRMP data
+ *  @param    pointer in order to store the bit mask of the channels which decoded the frame
+ *  @return   TRUE: successful, FALSE: failed
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+#ifdef __cplusplus
+bool
+#else
+uint_fast8_t
+#endif
+irmp_get_data_combined (IRMP_DATA * irmp_data_p, uint8_t * channels_p)
+{
+    if (! irmp_multi_event_ready)
+    {
+        return FALSE;
+    }
+
+    *irmp_data_p = irmp_multi_event.data;
+    *channels_p = irmp_multi_event.channels;
+    IRMP_MULTI_BARRIER ();
+    irmp_multi_event_ready = FALSE;
+    return TRUE;
+}
+#else
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ *  Get IRMP data of multi receiver
+ *  @details  returns the frame of one channel, the channels are looked at in turn, so a busy channel cannot block the others
+ *  @param    pointer in order to store IRMP data
+ *  @param    pointer in order to store the channel of the frame
+ *  @return   TRUE: successful, FALSE: failed
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+#ifdef __cplusplus
+bool
+#else
+uint_fast8_t
+#endif
+irmp_get_data_multi (IRMP_DATA * irmp_data_p, uint_fast8_t * channel_p)
+{
+    uint_fast8_t    channel = irmp_multi_next_channel;
+    uint_fast8_t    i;
+
+    for (i = 0; i < IRMP_MULTI_RECEIVER_CHANNELS; i++)
+    {
+        if (irmp_get_data_ctx (&irmp_multi_ctx[channel], irmp_data_p))
+        {
+            *channel_p = channel;
+            irmp_multi_next_channel = (channel + 1 < IRMP_MULTI_RECEIVER_CHANNELS) ? channel + 1 : 0;
+            return TRUE;
+        }
+
+        channel = (channel + 1 < IRMP_MULTI_RECEIVER_CHANNELS) ? channel + 1 : 0;
+    }
+
+    return FALSE;
+}
+#endif // IRMP_MULTI_COMBINE_TIME > 0
+#endif // IRMP_MULTI_RECEIVER_CHANNELS > 0
+#else // IRMP_ENABLE_CONTEXT == 0
+#if defined(ESP8266) || defined(ESP32)
+bool IRAM_ATTR irmp_ISR(void)
+#else
+#  ifdef __cplusplus
+bool irmp_ISR(void)
+#  else
+uint_fast8_t irmp_ISR(void)
+#  endif
+#endif
+{
+    return irmp_ISR_input (input(IRMP_PIN));
+}
+#endif // IRMP_ENABLE_CONTEXT == 1
+#endif // IRMP_ENABLE_FEED_DURATION == 1
+
+#if defined(ANALYZE)
+
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ * main functions - for Unix/Linux + Windows only!
+ *
+ * AVR: see main.c!
+ *
+ * Compile it under linux with:
+ * cc irmp.c -o irmp
+ *
+ * usage: ./irmp [-v|-s|-a|-l] < file                  file: ASCII scan or binary RLE scan (see IRMP_RLE_MAGIC)
+ *        ./irmp -b [-j threads] file|directory|@listfile ...
+ *
+ * options:
+ *   -v verbose
+ *   -s silent
+ *   -a analyze
+ *   -l list pulse/pauses
+ *   -b batch mode, decode many files in parallel (needs C++17, e.g. -std=gnu++17, and -lpthread)
+ *   -j number of threads in batch mode, default: number of CPU cores
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+
+void
+print_spectrum (const char *text, int *buf, int is_pulse)
+{
+    int     i;
+    int     j;
+    int     min;
+    int     max;
+    int     max_value = 0;
+    int     value;
+    int     sum = 0;
+    int     counter = 0;
+    double  average = 0;
+    double  tolerance;
+
+    puts ("-----------------------------------------------------------------------------");
+    printf ("%s:\n", text);
+
+    for (i = 0; i < 256; i++)
+    {
+        if (buf[i] > max_value)
+        {
+            max_value = buf[i];
+        }
+    }
+
+    for (i = 1; i < 200; i++)
+    {
+        if (buf[i] > 0)
+        {
+            printf ("%3d ", i);
+            value = (buf[i] * 60) / max_value;
+
+            for (j = 0; j < value; j++)
+            {
+                putchar ('o');
+            }
+            printf (" %d\n", buf[i]);
+
+            sum += i * buf[i];
+            counter += buf[i];
+        }
+        else
+        {
+            max = i - 1;
+
+            if (counter > 0)
+            {
+                average = (float) sum / (float) counter;
+
+                if (is_pulse)
+                {
+                    printf ("pulse ");
+                }
+                else
+                {
+                    printf ("pause ");
+                }
+
+                printf ("avg: %4.1f=%6.1f us, ", average, (1000000. * average) / (float) F_INTERRUPTS);
+                printf ("min: %2d=%6.1f us, ", min, (1000000. * min) / (float) F_INTERRUPTS);
+                printf ("max: %2d=%6.1f us, ", max, (1000000. * max) / (float) F_INTERRUPTS);
+
+                tolerance = (max - average);
+
+                if (average - min > tolerance)
+                {
+                    tolerance = average - min;
+                }
+
+                tolerance = tolerance * 100 / average;
+                printf ("tol: %4.1f%%\n", tolerance);
+            }
+
+            counter = 0;
+            sum = 0;
+            min = i + 1;
+        }
+    }
+}
+
+#define STATE_LEFT_SHIFT    0x01
+#define STATE_RIGHT_SHIFT   0x02
+#define STATE_LEFT_CTRL     0x04
+#define STATE_LEFT_ALT      0x08
+#define STATE_RIGHT_ALT     0x10
+
+#define KEY_ESCAPE          0x1B            // keycode = 0x006e
+#define KEY_MENUE           0x80            // keycode = 0x0070
+#define KEY_BACK            0x81            // keycode = 0x0071
+#define KEY_FORWARD         0x82            // keycode = 0x0072
+#define KEY_ADDRESS         0x83            // keycode = 0x0073
+#define KEY_WINDOW          0x84            // keycode = 0x0074
+#define KEY_1ST_PAGE        0x85            // keycode = 0x0075
+#define KEY_STOP            0x86            // keycode = 0x0076
+#define KEY_MAIL            0x87            // keycode = 0x0077
+#define KEY_FAVORITES       0x88            // keycode = 0x0078
+#define KEY_NEW_PAGE        0x89            // keycode = 0x0079
+#define KEY_SETUP           0x8A            // keycode = 0x007a
+#define KEY_FONT            0x8B            // keycode = 0x007b
+#define KEY_PRINT           0x8C            // keycode = 0x007c
+#define KEY_ON_OFF          0x8E            // keycode = 0x007c
 
-#if IRMP_SUPPORT_NEC16_PROTOCOL
-#if IRMP_SUPPORT_NEC42_PROTOCOL == 1
-                    if (irmp_param.protocol == IRMP_NEC42_PROTOCOL &&
-#else // IRMP_SUPPORT_NEC_PROTOCOL instead
-                    if (irmp_param.protocol == IRMP_NEC_PROTOCOL &&
-#endif // IRMP_SUPPORT_NEC42_PROTOCOL == 1
-                        irmp_bit == 8 && irmp_pause_time >= NEC_START_BIT_PAUSE_LEN_MIN && irmp_pause_time <= NEC_START_BIT_PAUSE_LEN_MAX)
-                    {
-                        ANALYZE_PRINTF1 ("Switching to NEC16 protocol\n");
-                        irmp_param.protocol         = IRMP_NEC16_PROTOCOL;
-                        irmp_param.address_offset   = NEC16_ADDRESS_OFFSET;
-                        irmp_param.address_end      = NEC16_ADDRESS_OFFSET + NEC16_ADDRESS_LEN;
-                        irmp_param.command_offset   = NEC16_COMMAND_OFFSET;
-                        irmp_param.command_end      = NEC16_COMMAND_OFFSET + NEC16_COMMAND_LEN;
-                        irmp_param.complete_len     = NEC16_COMPLETE_DATA_LEN;
-                        wait_for_space = 0;
-                    }
-                    else
-#endif // IRMP_SUPPORT_NEC16_PROTOCOL
+#define KEY_INSERT          0x90            // keycode = 0x004b
+#define KEY_DELETE          0x91            // keycode = 0x004c
+#define KEY_LEFT            0x92            // keycode = 0x004f
+#define KEY_HOME            0x93            // keycode = 0x0050
+#define KEY_END             0x94            // keycode = 0x0051
+#define KEY_UP              0x95            // keycode = 0x0053
+#define KEY_DOWN            0x96            // keycode = 0x0054
+#define KEY_PAGE_UP         0x97            // keycode = 0x0055
+#define KEY_PAGE_DOWN       0x98            // keycode = 0x0056
+#define KEY_RIGHT           0x99            // keycode = 0x0059
+#define KEY_MOUSE_1         0x9E            // keycode = 0x0400
+#define KEY_MOUSE_2         0x9F            // keycode = 0x0800
 
-#if IRMP_SUPPORT_BANG_OLUFSEN_PROTOCOL == 1
-                    if (irmp_param.protocol == IRMP_BANG_OLUFSEN_PROTOCOL)
-                    {
-                        if (irmp_pulse_time >= BANG_OLUFSEN_PULSE_LEN_MIN && irmp_pulse_time <= BANG_OLUFSEN_PULSE_LEN_MAX)
-                        {
-                            if (irmp_bit == 1)                                      // Bang & Olufsen: 3rd bit
-                            {
-                                if (irmp_pause_time >= BANG_OLUFSEN_START_BIT3_PAUSE_LEN_MIN && irmp_pause_time <= BANG_OLUFSEN_START_BIT3_PAUSE_LEN_MAX)
-                                {
-                                    ANALYZE_PRINTF1 ("3rd start bit\n");
-                                    wait_for_space = 0;
-                                    irmp_bit++;
-                                }
-                                else
-                                {                                                   // timing incorrect!
-                                    ANALYZE_PRINTF4 ("error 3a B&O: timing not correct: data bit %d,  pulse: %d, pause: %d\n", irmp_bit, irmp_pulse_time, irmp_pause_time);
-                                    ANALYZE_ONLY_NORMAL_PUTCHAR ('\n');
-                                    irmp_start_bit_detected = 0;                    // reset flags and wait for next start bit
-                                    irmp_pause_time         = 0;
-                                }
-                            }
-                            else if (irmp_bit == 19)                                // Bang & Olufsen: trailer bit
-                            {
-                                if (irmp_pause_time >= BANG_OLUFSEN_TRAILER_BIT_PAUSE_LEN_MIN && irmp_pause_time <= BANG_OLUFSEN_TRAILER_BIT_PAUSE_LEN_MAX)
-                                {
-                                    ANALYZE_PRINTF1 ("trailer bit\n");
-                                    wait_for_space = 0;
-                                    irmp_bit++;
-                                }
-                                else
-                                {                                                   // timing incorrect!
-                                    ANALYZE_PRINTF4 ("error 3b B&O: timing not correct: data bit %d,  pulse: %d, pause: %d\n", irmp_bit, irmp_pulse_time, irmp_pause_time);
-                                    ANALYZE_ONLY_NORMAL_PUTCHAR ('\n');
-                                    irmp_start_bit_detected = 0;                    // reset flags and wait for next start bit
-                                    irmp_pause_time         = 0;
-                                }
-                            }
-                            else
-                            {
-                                if (irmp_pause_time >= BANG_OLUFSEN_1_PAUSE_LEN_MIN && irmp_pause_time <= BANG_OLUFSEN_1_PAUSE_LEN_MAX)
-                                {                                                   // pulse & pause timings correct for "1"?
-                                    ANALYZE_PUTCHAR ('1');
-                                    ANALYZE_NEWLINE ();
-                                    irmp_store_bit (1);
-                                    last_value = 1;
-                                    wait_for_space = 0;
-                                }
-                                else if (irmp_pause_time >= BANG_OLUFSEN_0_PAUSE_LEN_MIN && irmp_pause_time <= BANG_OLUFSEN_0_PAUSE_LEN_MAX)
-                                {                                                   // pulse & pause timings correct for "0"?
-                                    ANALYZE_PUTCHAR ('0');
-                                    ANALYZE_NEWLINE ();
-                                    irmp_store_bit (0);
-                                    last_value = 0;
-                                    wait_for_space = 0;
-                                }
-                                else if (irmp_pause_time >= BANG_OLUFSEN_R_PAUSE_LEN_MIN && irmp_pause_time <= BANG_OLUFSEN_R_PAUSE_LEN_MAX)
-                                {
-                                    ANALYZE_PUTCHAR (last_value + '0');
-                                    ANALYZE_NEWLINE ();
-                                    irmp_store_bit (last_value);
-                                    wait_for_space = 0;
-                                }
-                                else
-                                {                                                   // timing incorrect!
-                                    ANALYZE_PRINTF4 ("error 3c B&O: timing not correct: data bit %d,  pulse: %d, pause: %d\n", irmp_bit, irmp_pulse_time, irmp_pause_time);
-                                    ANALYZE_ONLY_NORMAL_PUTCHAR ('\n');
-                                    irmp_start_bit_detected = 0;                    // reset flags and wait for next start bit
-                                    irmp_pause_time         = 0;
-                                }
-                            }
-                        }
-                        else
-                        {                                                           // timing incorrect!
-                            ANALYZE_PRINTF4 ("error 3d B&O: timing not correct: data bit %d,  pulse: %d, pause: %d\n", irmp_bit, irmp_pulse_time, irmp_pause_time);
-                            ANALYZE_ONLY_NORMAL_PUTCHAR ('\n');
-                            irmp_start_bit_detected = 0;                            // reset flags and wait for next start bit
-                            irmp_pause_time         = 0;
-                        }
-                    }
-                    else
-#endif // IRMP_SUPPORT_BANG_OLUFSEN_PROTOCOL
+static uint_fast8_t
+get_fdc_key (uint_fast16_t cmd)
+{
+    static const uint8_t key_table[128] =
+    {
+     // 0     1      2    3    4     5    6    7    8     9     A     B     C     D     E     F
+        0x00, '^',  '1', '2', '3',  '4', '5', '6', '7',  '8',  '9',  '0',  0xDF, 0xB4,  0x00, '\b',
+        '\t', 'q',  'w', 'e', 'r',  't', 'z', 'u', 'i',  'o',  'p',  0xFC, '+',  0x00,  0x00, 'a',
+        's',  'd',  'f', 'g', 'h',  'j', 'k', 'l', 0xF6, 0xE4, '#',  '\r', 0x00, '<',   'y',  'x',
+        'c',  'v',  'b', 'n', 'm',  ',', '.', '-', 0x00, 0x00, 0x00, 0x00, 0x00,  ' ',  0x00, 0x00,
 
-#if IRMP_SUPPORT_RCMM_PROTOCOL == 1
-                    if (irmp_param.protocol == IRMP_RCMM32_PROTOCOL)
-                    {
-                        if (irmp_pause_time >= RCMM32_BIT_00_PAUSE_LEN_MIN && irmp_pause_time <= RCMM32_BIT_00_PAUSE_LEN_MAX)
-                        {
-                            ANALYZE_PUTCHAR ('0');
-                            ANALYZE_PUTCHAR ('0');
-                            irmp_store_bit (0);
-                            irmp_store_bit (0);
-                        }
-                        else if (irmp_pause_time >= RCMM32_BIT_01_PAUSE_LEN_MIN && irmp_pause_time <= RCMM32_BIT_01_PAUSE_LEN_MAX)
-                        {
-                            ANALYZE_PUTCHAR ('0');
-                            ANALYZE_PUTCHAR ('1');
-                            irmp_store_bit (0);
-                            irmp_store_bit (1);
-                        }
-                        else if (irmp_pause_time >= RCMM32_BIT_10_PAUSE_LEN_MIN && irmp_pause_time <= RCMM32_BIT_10_PAUSE_LEN_MAX)
-                        {
-                            ANALYZE_PUTCHAR ('1');
-                            ANALYZE_PUTCHAR ('0');
-                            irmp_store_bit (1);
-                            irmp_store_bit (0);
-                        }
-                        else if (irmp_pause_time >= RCMM32_BIT_11_PAUSE_LEN_MIN && irmp_pause_time <= RCMM32_BIT_11_PAUSE_LEN_MAX)
-                        {
-                            ANALYZE_PUTCHAR ('1');
-                            ANALYZE_PUTCHAR ('1');
-                            irmp_store_bit (1);
-                            irmp_store_bit (1);
-                        }
+        0x00, 0xB0, '!', '"', 0xA7, '$', '%', '&', '/',  '(',  ')',  '=',  '?',  0x60,  0x00, '\b',
+        '\t', 'Q',  'W', 'E', 'R',  'T', 'Z', 'U', 'I',  'O',  'P',  0xDC, '*',  0x00,  0x00, 'A',
+        'S',  'D',  'F', 'G', 'H',  'J', 'K', 'L', 0xD6, 0xC4, '\'', '\r', 0x00, '>',   'Y',  'X',
+        'C',  'V',  'B', 'N', 'M',  ';', ':', '_', 0x00, 0x00, 0x00, 0x00, 0x00, ' ',   0x00, 0x00
+    };
+    static uint_fast8_t state;
 
-                        ANALYZE_PRINTF1 ("\n");
-                        wait_for_space = 0;
-                    }
-                    else
-#endif
+    uint_fast8_t key = 0;
 
-                    if (irmp_pulse_time >= irmp_param.pulse_1_len_min && irmp_pulse_time <= irmp_param.pulse_1_len_max &&
-                        irmp_pause_time >= irmp_param.pause_1_len_min && irmp_pause_time <= irmp_param.pause_1_len_max)
-                    {                                                               // pulse & pause timings correct for "1"?
-                        ANALYZE_PUTCHAR ('1');
-                        ANALYZE_NEWLINE ();
-                        irmp_store_bit (1);
-                        wait_for_space = 0;
-                    }
-                    else if (irmp_pulse_time >= irmp_param.pulse_0_len_min && irmp_pulse_time <= irmp_param.pulse_0_len_max &&
-                             irmp_pause_time >= irmp_param.pause_0_len_min && irmp_pause_time <= irmp_param.pause_0_len_max)
-                    {                                                               // pulse & pause timings correct for "0"?
-                        ANALYZE_PUTCHAR ('0');
-                        ANALYZE_NEWLINE ();
-                        irmp_store_bit (0);
-                        wait_for_space = 0;
-                    }
-                    else
-#if IRMP_SUPPORT_KATHREIN_PROTOCOL
+    switch (cmd)
+    {
+        case 0x002C: state |=  STATE_LEFT_SHIFT;    break;              // pressed left shift
+        case 0x00AC: state &= ~STATE_LEFT_SHIFT;    break;              // released left shift
+        case 0x0039: state |=  STATE_RIGHT_SHIFT;   break;              // pressed right shift
+        case 0x00B9: state &= ~STATE_RIGHT_SHIFT;   break;              // released right shift
+        case 0x003A: state |=  STATE_LEFT_CTRL;     break;              // pressed left ctrl
+        case 0x00BA: state &= ~STATE_LEFT_CTRL;     break;              // released left ctrl
+        case 0x003C: state |=  STATE_LEFT_ALT;      break;              // pressed left alt
+        case 0x00BC: state &= ~STATE_LEFT_ALT;      break;              // released left alt
+        case 0x003E: state |=  STATE_RIGHT_ALT;     break;              // pressed left alt
+        case 0x00BE: state &= ~STATE_RIGHT_ALT;     break;              // released left alt
 
-                    if (irmp_param.protocol == IRMP_KATHREIN_PROTOCOL &&
-                        irmp_pulse_time >= KATHREIN_1_PULSE_LEN_MIN && irmp_pulse_time <= KATHREIN_1_PULSE_LEN_MAX &&
-                        (((irmp_bit == 8 || irmp_bit == 6) &&
-                                irmp_pause_time >= KATHREIN_SYNC_BIT_PAUSE_LEN_MIN && irmp_pause_time <= KATHREIN_SYNC_BIT_PAUSE_LEN_MAX) ||
-                         (irmp_bit == 12 &&
-                                irmp_pause_time >= KATHREIN_START_BIT_PAUSE_LEN_MIN && irmp_pause_time <= KATHREIN_START_BIT_PAUSE_LEN_MAX)))
+        case 0x006e: key = KEY_ESCAPE;              break;
+        case 0x004b: key = KEY_INSERT;              break;
+        case 0x004c: key = KEY_DELETE;              break;
+        case 0x004f: key = KEY_LEFT;                break;
+        case 0x0050: key = KEY_HOME;                break;
+        case 0x0051: key = KEY_END;                 break;
+        case 0x0053: key = KEY_UP;                  break;
+        case 0x0054: key = KEY_DOWN;                break;
+        case 0x0055: key = KEY_PAGE_UP;             break;
+        case 0x0056: key = KEY_PAGE_DOWN;           break;
+        case 0x0059: key = KEY_RIGHT;               break;
+        case 0x0400: key = KEY_MOUSE_1;             break;
+        case 0x0800: key = KEY_MOUSE_2;             break;
 
+        default:
+        {
+            if (!(cmd & 0x80))                      // pressed key
+            {
+                if (cmd >= 0x70 && cmd <= 0x7F)     // function keys
+                {
+                    key = cmd + 0x10;               // 7x -> 8x
+                }
+                else if (cmd < 64)                  // key listed in key_table
+                {
+                    if (state & (STATE_LEFT_ALT | STATE_RIGHT_ALT))
                     {
-                        if (irmp_bit == 8)
+                        switch (cmd)
                         {
-                            irmp_bit++;
-                            ANALYZE_PUTCHAR ('S');
-                            ANALYZE_NEWLINE ();
-                            irmp_tmp_command <<= 1;
+                            case 0x0003: key = 0xB2;    break; // upper 2
+                            case 0x0008: key = '{';     break;
+                            case 0x0009: key = '[';     break;
+                            case 0x000A: key = ']';     break;
+                            case 0x000B: key = '}';     break;
+                            case 0x000C: key = '\\';    break;
+                            case 0x001C: key = '~';     break;
+                            case 0x002D: key = '|';     break;
+                            case 0x0034: key = 0xB5;    break; // Mu
+                        }
+                    }
+                    else if (state & (STATE_LEFT_CTRL))
+                    {
+                        if (key_table[cmd] >= 'a' && key_table[cmd] <= 'z')
+                        {
+                            key = key_table[cmd] - 'a' + 1;
                         }
                         else
                         {
-                            ANALYZE_PUTCHAR ('S');
-                            ANALYZE_NEWLINE ();
-                            irmp_store_bit (1);
+                            key = key_table[cmd];
                         }
-                        wait_for_space = 0;
                     }
                     else
-#endif // IRMP_SUPPORT_KATHREIN_PROTOCOL
-#if IRMP_SUPPORT_MELINERA_PROTOCOL == 1
-#if IRMP_SUPPORT_NEC42_PROTOCOL == 1
-                    if (irmp_param.protocol == IRMP_NEC42_PROTOCOL &&
-#else // IRMP_SUPPORT_NEC_PROTOCOL instead
-                    if (irmp_param.protocol == IRMP_NEC_PROTOCOL &&
-#endif // IRMP_SUPPORT_NEC42_PROTOCOL == 1
-                       (
-                        (irmp_pulse_time >= MELINERA_0_PULSE_LEN_MIN && irmp_pulse_time <= MELINERA_0_PULSE_LEN_MAX &&
-                         irmp_pause_time >= MELINERA_0_PAUSE_LEN_MIN && irmp_pause_time <= MELINERA_0_PAUSE_LEN_MAX) ||
-                        (irmp_pulse_time >= MELINERA_1_PULSE_LEN_MIN && irmp_pulse_time <= MELINERA_1_PULSE_LEN_MAX &&
-                         irmp_pause_time >= MELINERA_1_PAUSE_LEN_MIN && irmp_pause_time <= MELINERA_1_PAUSE_LEN_MAX)
-                       ))
                     {
-                        ANALYZE_PRINTF1 ("Switching to MELINERA protocol ");
-                        irmp_param.protocol         = IRMP_MELINERA_PROTOCOL;
-                        irmp_param.pulse_0_len_min  = MELINERA_0_PULSE_LEN_MIN;
-                        irmp_param.pulse_0_len_max  = MELINERA_0_PULSE_LEN_MAX;
-                        irmp_param.pause_0_len_min  = MELINERA_0_PAUSE_LEN_MIN;
-                        irmp_param.pulse_0_len_max  = MELINERA_0_PAUSE_LEN_MAX;
-                        irmp_param.pulse_1_len_min  = MELINERA_1_PULSE_LEN_MIN;
-                        irmp_param.pulse_1_len_max  = MELINERA_1_PULSE_LEN_MAX;
-                        irmp_param.pause_1_len_min  = MELINERA_1_PAUSE_LEN_MIN;
-                        irmp_param.pulse_1_len_max  = MELINERA_1_PAUSE_LEN_MAX;
-                        irmp_param.address_offset   = MELINERA_ADDRESS_OFFSET;
-                        irmp_param.address_end      = MELINERA_ADDRESS_OFFSET + MELINERA_ADDRESS_LEN;
-                        irmp_param.command_offset   = MELINERA_COMMAND_OFFSET;
-                        irmp_param.command_end      = MELINERA_COMMAND_OFFSET + MELINERA_COMMAND_LEN;
-                        irmp_param.complete_len     = MELINERA_COMPLETE_DATA_LEN;
+                        int idx = cmd + ((state & (STATE_LEFT_SHIFT | STATE_RIGHT_SHIFT)) ? 64 : 0);
 
-                        if (irmp_pause_time >= MELINERA_0_PAUSE_LEN_MIN && irmp_pause_time <= MELINERA_0_PAUSE_LEN_MAX)
-                        {
-                            ANALYZE_PUTCHAR ('0');
-                            irmp_store_bit (0);
-                        }
-                        else
+                        if (key_table[idx])
                         {
-                            ANALYZE_PUTCHAR ('1');
-                            irmp_store_bit (1);
+                            key = key_table[idx];
                         }
-
-                        ANALYZE_NEWLINE ();
-                        wait_for_space = 0;
-                    }
-                    else
-#endif // IRMP_SUPPORT_MELINERA_PROTOCOL
-                    {                                                               // timing incorrect!
-                        ANALYZE_PRINTF4 ("error 3: timing not correct: data bit %d,  pulse: %d, pause: %d\n", irmp_bit, irmp_pulse_time, irmp_pause_time);
-                        ANALYZE_ONLY_NORMAL_PUTCHAR ('\n');
-                        irmp_start_bit_detected = 0;                                // reset flags and wait for next start bit
-                        irmp_pause_time         = 0;
                     }
-
-                    irmp_pulse_time = 1;                                            // set counter to 1, not 0
                 }
             }
-            else
-            {                                                                       // counting the pulse length ...
-                if (! irmp_input)                                                   // still light?
-                {                                                                   // yes...
-                    irmp_pulse_time++;                                              // increment counter
-                }
-                else
-                {                                                                   // now it's dark!
-                    wait_for_space  = 1;                                            // let's count the time (see above)
-                    irmp_pause_time = 1;                                            // set pause counter to 1, not 0
+            break;
+        }
+    }
 
-#if IRMP_SUPPORT_RCII_PROTOCOL == 1
-                    if (irmp_param.protocol == IRMP_RCII_PROTOCOL && waiting_for_2nd_pulse)
-                    {
-                        // fm: output is "1000 466" or "1533 466"
-                        // printf ("fm: %d %d\n", irmp_pulse_time * 1000000 / F_INTERRUPTS, RCII_BIT_LEN * 1000000 / F_INTERRUPTS);
-                        irmp_pulse_time -= RCII_BIT_LEN;
-                        last_value = 0;
+    return (key);
+}
 
-                        ANALYZE_PRINTF2 ("RCII: got 2nd pulse, irmp_pulse_time = %d\n", irmp_pulse_time);
-                        waiting_for_2nd_pulse = 0;
-                    }
-#endif
-                }
-            }
+static int         analyze = FALSE;
+static int         list = FALSE;
+static int         benchmark = FALSE;
+static IRMP_DATA   irmp_data;
+static int         expected_protocol;
+static int         expected_address;
+static int         expected_command;
+static int         do_check_expected_values;
 
-            if (irmp_start_bit_detected && irmp_bit == irmp_param.complete_len && irmp_param.stop_bit == 0)    // enough bits received?
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ *  Print decoded data into a buffer
+ *  @details  used by next_tick() and by the batch mode, so both print the same
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+static void
+sprint_irmp_data (char * buf, size_t size, const IRMP_DATA * irmp_data_p)
+{
+    uint_fast8_t key;
+
+    if (irmp_data_p->protocol == IRMP_ACP24_PROTOCOL)
+    {
+        uint16_t    temp = (irmp_data_p->command & 0x000F) + 15;
+
+        snprintf (buf, size, "p=%2d (%s), a=0x%04x, c=0x%04x, f=0x%02x, temp=%d",
+                  irmp_data_p->protocol, irmp_protocol_names[irmp_data_p->protocol], irmp_data_p->address, irmp_data_p->command, irmp_data_p->flags, temp);
+    }
+    else if (irmp_data_p->protocol == IRMP_FDC_PROTOCOL && (key = get_fdc_key (irmp_data_p->command)) != 0)
+    {
+        if ((key >= 0x20 && key < 0x7F) || key >= 0xA0)
+        {
+            snprintf (buf, size, "p=%2d (%s), a=0x%04x, c=0x%04x, f=0x%02x, asc=0x%02x, key='%c'",
+                      irmp_data_p->protocol,  irmp_protocol_names[irmp_data_p->protocol], irmp_data_p->address, irmp_data_p->command, irmp_data_p->flags, key, key);
+        }
+        else if (key == '\r' || key == '\t' || key == KEY_ESCAPE || (key >= 0x80 && key <= 0x9F))                 // function keys
+        {
+            const char * p = (const char *) nullptr;
+
+            switch (key)
             {
-                if (last_irmp_command == irmp_tmp_command && key_repetition_len < AUTO_FRAME_REPETITION_LEN)
-                {
-                    repetition_frame_number++;
-                }
-                else
-                {
-                    repetition_frame_number = 0;
-                }
+                case '\t'                : p = "TAB";           break;
+                case '\r'                : p = "CR";            break;
+                case KEY_ESCAPE          : p = "ESCAPE";        break;
+                case KEY_MENUE           : p = "MENUE";         break;
+                case KEY_BACK            : p = "BACK";          break;
+                case KEY_FORWARD         : p = "FORWARD";       break;
+                case KEY_ADDRESS         : p = "ADDRESS";       break;
+                case KEY_WINDOW          : p = "WINDOW";        break;
+                case KEY_1ST_PAGE        : p = "1ST_PAGE";      break;
+                case KEY_STOP            : p = "STOP";          break;
+                case KEY_MAIL            : p = "MAIL";          break;
+                case KEY_FAVORITES       : p = "FAVORITES";     break;
+                case KEY_NEW_PAGE        : p = "NEW_PAGE";      break;
+                case KEY_SETUP           : p = "SETUP";         break;
+                case KEY_FONT            : p = "FONT";          break;
+                case KEY_PRINT           : p = "PRINT";         break;
+                case KEY_ON_OFF          : p = "ON_OFF";        break;
+
+                case KEY_INSERT          : p = "INSERT";        break;
+                case KEY_DELETE          : p = "DELETE";        break;
+                case KEY_LEFT            : p = "LEFT";          break;
+                case KEY_HOME            : p = "HOME";          break;
+                case KEY_END             : p = "END";           break;
+                case KEY_UP              : p = "UP";            break;
+                case KEY_DOWN            : p = "DOWN";          break;
+                case KEY_PAGE_UP         : p = "PAGE_UP";       break;
+                case KEY_PAGE_DOWN       : p = "PAGE_DOWN";     break;
+                case KEY_RIGHT           : p = "RIGHT";         break;
+                case KEY_MOUSE_1         : p = "KEY_MOUSE_1";   break;
+                case KEY_MOUSE_2         : p = "KEY_MOUSE_2";   break;
+                default                  : p = "<UNKNWON>";     break;
+            }
 
-#if IRMP_SUPPORT_SIRCS_PROTOCOL == 1
-                // if SIRCS protocol and the code will be repeated within 50 ms, we will ignore 2nd and 3rd repetition frame
-                if (irmp_param.protocol == IRMP_SIRCS_PROTOCOL && (repetition_frame_number == 1 || repetition_frame_number == 2))
-                {
-                    ANALYZE_PRINTF4 ("code skipped: SIRCS auto repetition frame #%d, counter = %u, auto repetition len = %u\n",
-                                    repetition_frame_number + 1, (unsigned int) key_repetition_len, (unsigned int) AUTO_FRAME_REPETITION_LEN);
-                    key_repetition_len = 0;
-                }
-                else
-#endif
+            snprintf (buf, size, "p=%2d (%s), a=0x%04x, c=0x%04x, f=0x%02x, asc=0x%02x, key=%s",
+                      irmp_data_p->protocol, irmp_protocol_names[irmp_data_p->protocol], irmp_data_p->address, irmp_data_p->command, irmp_data_p->flags, key, p);
+        }
+        else
+        {
+            snprintf (buf, size, "p=%2d (%s), a=0x%04x, c=0x%04x, f=0x%02x, asc=0x%02x",
+                      irmp_data_p->protocol,  irmp_protocol_names[irmp_data_p->protocol], irmp_data_p->address, irmp_data_p->command, irmp_data_p->flags, key);
+        }
+    }
+    else
+    {
+        snprintf (buf, size, "p=%2d (%s), a=0x%04x, c=0x%04x, f=0x%02x",
+                  irmp_data_p->protocol, irmp_protocol_names[irmp_data_p->protocol], irmp_data_p->address, irmp_data_p->command, irmp_data_p->flags);
+    }
+}
 
-#if IRMP_SUPPORT_ORTEK_PROTOCOL == 1
-                // if ORTEK protocol and the code will be repeated within 50 ms, we will ignore 2nd repetition frame
-                if (irmp_param.protocol == IRMP_ORTEK_PROTOCOL && repetition_frame_number == 1)
-                {
-                    ANALYZE_PRINTF4 ("code skipped: ORTEK auto repetition frame #%d, counter = %d, auto repetition len = %d\n",
-                                    repetition_frame_number + 1, key_repetition_len, AUTO_FRAME_REPETITION_LEN);
-                    key_repetition_len = 0;
-                }
-                else
-#endif
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ *  Compare decoded data with the values expected by a comment line like "# [2 0x00ff 0x0010]"
+ *  @return   TRUE: values are equal, buf holds the text to print after the decoded data
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+static int
+sprint_expected_values_check (char * buf, size_t size, const IRMP_DATA * irmp_data_p, int protocol, int address, int command)
+{
+    if (irmp_data_p->protocol != protocol ||
+        irmp_data_p->address  != address  ||
+        irmp_data_p->command  != command)
+    {
+        snprintf (buf, size, "\nerror 7: expected values differ: p=%2d (%s), a=0x%04x, c=0x%04x\n",
+                  protocol, irmp_protocol_names[protocol], address, command);
+        return FALSE;
+    }
 
-#if 0 && IRMP_SUPPORT_KASEIKYO_PROTOCOL == 1    // fm 2015-12-02: don't ignore every 2nd frame
-                // if KASEIKYO protocol and the code will be repeated within 50 ms, we will ignore 2nd repetition frame
-                if (irmp_param.protocol == IRMP_KASEIKYO_PROTOCOL && repetition_frame_number == 1)
-                {
-                    ANALYZE_PRINTF4 ("code skipped: KASEIKYO auto repetition frame #%d, counter = %d, auto repetition len = %d\n",
-                                    repetition_frame_number + 1, key_repetition_len, AUTO_FRAME_REPETITION_LEN);
-                    key_repetition_len = 0;
-                }
-                else
-#endif
+    snprintf (buf, size, " checked!\n");
+    return TRUE;
+}
 
-#if 0 && IRMP_SUPPORT_SAMSUNG_PROTOCOL == 1     // fm 2015-12-02: don't ignore every 2nd frame
-                // if SAMSUNG32 or SAMSUNG48 protocol and the code will be repeated within 50 ms, we will ignore every 2nd frame
-                if ((irmp_param.protocol == IRMP_SAMSUNG32_PROTOCOL || irmp_param.protocol == IRMP_SAMSUNG48_PROTOCOL) && (repetition_frame_number & 0x01))
-                {
-                    ANALYZE_PRINTF4 ("code skipped: SAMSUNG32/SAMSUNG48 auto repetition frame #%d, counter = %d, auto repetition len = %d\n",
-                                    repetition_frame_number + 1, key_repetition_len, AUTO_FRAME_REPETITION_LEN);
-                    key_repetition_len = 0;
-                }
-                else
-#endif
+#if IRMP_FRAME_BITS > 0
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ *  Print data bits of a frame into a buffer, in hex, 1st bit is MSB of 1st byte
+ *  @details  used by print_frame() and by the batch mode
+ *  @return   FALSE: frame is empty, nothing printed
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+#define IRMP_FRAME_PRINT_LEN    (IRMP_FRAME_BITS / 4 + 32)                      // buffer size for sprint_frame()
 
-#if IRMP_SUPPORT_NUBERT_PROTOCOL == 1
-                // if NUBERT protocol and the code will be repeated within 50 ms, we will ignore every 2nd frame
-                if (irmp_param.protocol == IRMP_NUBERT_PROTOCOL && (repetition_frame_number & 0x01))
-                {
-                    ANALYZE_PRINTF4 ("code skipped: NUBERT auto repetition frame #%d, counter = %u, auto repetition len = %u\n",
-                                    repetition_frame_number + 1, (unsigned int) key_repetition_len, (unsigned int) AUTO_FRAME_REPETITION_LEN);
-                    key_repetition_len = 0;
-                }
-                else
-#endif
+static uint_fast8_t
+sprint_frame (char * buf, size_t size, const IRMP_FRAME * frame_p)
+{
+    size_t          pos;
+    uint_fast8_t    idx;
 
-#if IRMP_SUPPORT_SPEAKER_PROTOCOL == 1
-                // if SPEAKER protocol and the code will be repeated within 50 ms, we will ignore every 2nd frame
-                if (irmp_param.protocol == IRMP_SPEAKER_PROTOCOL && (repetition_frame_number & 0x01))
-                {
-                    ANALYZE_PRINTF4 ("code skipped: SPEAKER auto repetition frame #%d, counter = %u, auto repetition len = %u\n",
-                                    repetition_frame_number + 1, (unsigned int) key_repetition_len, (unsigned int) AUTO_FRAME_REPETITION_LEN);
-                    key_repetition_len = 0;
-                }
-                else
+    if (frame_p->len == 0)
+    {
+        return FALSE;
+    }
+
+    pos = snprintf (buf, size, "frame: %u bits 0x", (unsigned int) frame_p->len);
+
+    for (idx = 0; idx < (frame_p->len + 7) / 8 && pos < size; idx++)
+    {
+        pos += snprintf (buf + pos, size - pos, "%02x", frame_p->bits[idx]);
+    }
+
+    if (pos < size)
+    {
+        snprintf (buf + pos, size - pos, "\n");
+    }
+    return TRUE;
+}
+
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ *  Print data bits of the frame returned by irmp_get_data()
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+static void
+print_frame (void)
+{
+    char    buf[IRMP_FRAME_PRINT_LEN];
+
+    if (sprint_frame (buf, sizeof (buf), irmp_get_frame ()))
+    {
+        ANALYZE_ONLY_NORMAL_PUTCHAR (' ');
+        fputs (buf, stdout);
+    }
+}
+#endif // IRMP_FRAME_BITS > 0
+
+static void
+print_decoded_data (void)
+{
+    if (irmp_get_data (&irmp_data))
+    {
+        char    buf[256];
+
+        ANALYZE_ONLY_NORMAL_PUTCHAR (' ');
+
+        if (verbose)
+        {
+            printf ("%8.3fms ", (double) (time_counter * 1000) / F_INTERRUPTS);
+        }
+
+        sprint_irmp_data (buf, sizeof (buf), &irmp_data);
+        fputs (buf, stdout);
+
+        if (do_check_expected_values)
+        {
+            (void) sprint_expected_values_check (buf, sizeof (buf), &irmp_data, expected_protocol, expected_address, expected_command);
+            fputs (buf, stdout);
+            do_check_expected_values = FALSE;                               // only check 1st frame in a line!
+        }
+        else
+        {
+            putchar ('\n');
+        }
+
+#if IRMP_FRAME_BITS > 0
+        print_frame ();
 #endif
+    }
+}
+
+#if IRMP_RAW_CAPTURE_LEN > 0
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ *  Print raw frame recorded by irmp_ISR() into a buffer, pulses and pauses in ticks
+ *  @details  used by print_raw_frame() and by the batch mode
+ *  @return   FALSE: no new raw frame, nothing printed
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+#define IRMP_RAW_FRAME_PRINT_LEN    (IRMP_RAW_CAPTURE_LEN * 6 + 32)             // buffer size for sprint_raw_frame(), 6 chars per tick count
+
+static uint_fast8_t
+sprint_raw_frame (char * buf, size_t size, const IRMP_RAW_FRAME * frame_p)
+{
+    size_t          pos;
+    uint_fast16_t   idx;
+
+    if (! frame_p)
+    {
+        return FALSE;
+    }
+
+    pos = snprintf (buf, size, "raw frame: %u%s", (unsigned int) frame_p->len, frame_p->overflow ? "+" : "");
+
+    for (idx = 0; idx < frame_p->len && pos < size; idx++)
+    {
+        pos += snprintf (buf + pos, size - pos, " %u", (unsigned int) frame_p->ticks[idx]);
+    }
+
+    if (pos < size)
+    {
+        snprintf (buf + pos, size - pos, "\n");
+    }
+    return TRUE;
+}
+
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ *  Print raw frame returned by irmp_get_raw_frame()
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+static void
+print_raw_frame (void)
+{
+    char    buf[IRMP_RAW_FRAME_PRINT_LEN];
 
-                {
-                    ANALYZE_PRINTF3 ("%8.3fms code detected, length = %d\n", (double) (time_counter * 1000) / F_INTERRUPTS, irmp_bit);
-                    irmp_ir_detected = TRUE;
+    if (sprint_raw_frame (buf, sizeof (buf), irmp_get_raw_frame ()))
+    {
+        ANALYZE_ONLY_NORMAL_PUTCHAR (' ');
+        fputs (buf, stdout);
+    }
+}
+#endif // IRMP_RAW_CAPTURE_LEN > 0
 
-#if IRMP_SUPPORT_KATHREIN_PROTOCOL == 1
-                    if (irmp_param.protocol == IRMP_KATHREIN_PROTOCOL && irmp_tmp_command == 0x0000)
-                    {
-                        if (irmp_tmp_command == 0x0000)                             // KATHREIN sends key release with command = 0x0000, ignore it
-                        {
-                            ANALYZE_PRINTF1 ("got KATHREIN release command, ignore it\n");
-                            irmp_ir_detected = FALSE;
-                        }
-                    }
-                    else
-#endif // IRMP_SUPPORT_KATHREIN_PROTOCOL
-#if IRMP_SUPPORT_DENON_PROTOCOL == 1
-                    if (irmp_param.protocol == IRMP_DENON_PROTOCOL)
-                    {                                                               // check for repetition frame
-                        if ((~irmp_tmp_command & 0x3FF) == last_irmp_denon_command) // command bits must be inverted
-                        {
-                            irmp_tmp_command = last_irmp_denon_command;             // use command received before!
-                            last_irmp_denon_command = 0;
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ *  Benchmark mode: cost of irmp_ISR() per protocol, see irmpBenchmark.hpp
+ *
+ *  usage: ./irsnd -t | ./irmp -t [max-p99]
+ *
+ *  Every '#' comment line of the scan starts a new protocol, every line is a frame. Ticks are measured while a line is fed and
+ *  IRMP_BENCH_TAIL_LEN ticks after it, the rest of the long pause after a line is not measured. The last row "idle" is the cost
+ *  of a tick without any signal.
+ *  Returns 1 if the 99th percentile of a protocol is greater than max-p99, so that it can be used in scripts.
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+#include "irmpBenchmark.hpp"
 
-                            irmp_protocol = irmp_param.protocol;                    // store protocol
-                            irmp_address = irmp_tmp_address;                        // store address
-                            irmp_command = irmp_tmp_command;                        // store command
-                        }
-                        else
-                        {
-                            if ((irmp_tmp_command & 0x01) == 0x00)
-                            {
-                                ANALYZE_PRINTF2 ("%8.3fms info Denon: waiting for inverted command repetition\n", (double) (time_counter * 1000) / F_INTERRUPTS);
-                                last_irmp_denon_command = irmp_tmp_command;
-                                denon_repetition_len = 0;
-                                irmp_ir_detected = FALSE;
-                            }
-                            else
-                            {
-                                ANALYZE_PRINTF2 ("%8.3fms warning Denon: got unexpected inverted command, ignoring it\n", (double) (time_counter * 1000) / F_INTERRUPTS);
-                                last_irmp_denon_command = 0;
-                                irmp_ir_detected = FALSE;
-                            }
-                        }
-                    }
-                    else
-#endif // IRMP_SUPPORT_DENON_PROTOCOL
+#define IRMP_BENCH_TAIL_LEN     ((int) (F_INTERRUPTS * 200.0e-3))       // measure 200 msec after end of line, longer than any timeout
 
-#if IRMP_SUPPORT_GRUNDIG_PROTOCOL == 1
-                    if (irmp_param.protocol == IRMP_GRUNDIG_PROTOCOL && irmp_tmp_command == 0x01ff)
-                    {                                                               // Grundig start frame?
-                        ANALYZE_PRINTF1 ("Detected GRUNDIG start frame, ignoring it\n");
-                        irmp_ir_detected = FALSE;
-                    }
-                    else
-#endif // IRMP_SUPPORT_GRUNDIG_PROTOCOL
+static IRMP_BENCH   bench;
+static int          bench_measure;                                      // flag: measure the current tick
+static int          bench_decoded;                                      // number of decoded frames of current protocol
+static uint32_t     bench_max_p99;                                      // limit of 99th percentile, 0: none
+static int          bench_rtc;
 
-#if IRMP_SUPPORT_NOKIA_PROTOCOL == 1
-                    if (irmp_param.protocol == IRMP_NOKIA_PROTOCOL && irmp_tmp_address == 0x00ff && irmp_tmp_command == 0x00fe)
-                    {                                                               // Nokia start frame?
-                        ANALYZE_PRINTF1 ("Detected NOKIA start frame, ignoring it\n");
-                        irmp_ir_detected = FALSE;
-                    }
-                    else
-#endif // IRMP_SUPPORT_NOKIA_PROTOCOL
-                    {
-#if IRMP_SUPPORT_NEC_PROTOCOL == 1
-                        if (irmp_param.protocol == IRMP_NEC_PROTOCOL && irmp_bit == 0)  // repetition frame
-                        {
-                            if (key_repetition_len < NEC_FRAME_REPEAT_PAUSE_LEN_MAX)
-                            {
-                                ANALYZE_PRINTF2 ("Detected NEC repetition frame, key_repetition_len = %u\n", (unsigned int) key_repetition_len);
-                                ANALYZE_ONLY_NORMAL_PRINTF1("REPETETION FRAME                ");
-                                irmp_tmp_address = last_irmp_address;                   // address is last address
-                                irmp_tmp_command = last_irmp_command;                   // command is last command
-                                irmp_flags |= IRMP_FLAG_REPETITION;
-                                key_repetition_len = 0;
-                            }
-                            else
-                            {
-                                ANALYZE_PRINTF3 ("Detected NEC repetition frame, ignoring it: timeout occured, key_repetition_len = %u > %u\n",
-                                                (unsigned int) key_repetition_len, (unsigned int) NEC_FRAME_REPEAT_PAUSE_LEN_MAX);
-                                irmp_ir_detected = FALSE;
-                            }
-                        }
-#endif // IRMP_SUPPORT_NEC_PROTOCOL
+static void
+bench_next_protocol (const char * name)
+{
+    uint32_t    p99;
 
-#if IRMP_SUPPORT_KASEIKYO_PROTOCOL == 1
-                        if (irmp_param.protocol == IRMP_KASEIKYO_PROTOCOL)
-                        {
-                            uint_fast8_t xor_value;
+    if (bench.n_samples)
+    {
+        p99 = irmp_bench_print (stdout, &bench, bench_decoded);
 
-                            xor_value = (xor_check[0] & 0x0F) ^ ((xor_check[0] & 0xF0) >> 4) ^ (xor_check[1] & 0x0F) ^ ((xor_check[1] & 0xF0) >> 4);
+        if (bench_max_p99 && p99 > bench_max_p99)
+        {
+            printf ("%-*s error: p99 > %u %s\n", IRMP_BENCH_NAME_LEN, bench.name, (unsigned int) bench_max_p99, IRMP_BENCH_UNIT);
+            bench_rtc = 1;
+        }
+    }
 
-                            if (xor_value != (xor_check[2] & 0x0F))
-                            {
-                                ANALYZE_PRINTF3 ("error 4: wrong XOR check for customer id: 0x%1x 0x%1x\n", xor_value, xor_check[2] & 0x0F);
-                                irmp_ir_detected = FALSE;
-                            }
+    irmp_bench_start (&bench, name);
+    bench_decoded = 0;
+}
 
-                            xor_value = xor_check[2] ^ xor_check[3] ^ xor_check[4];
+static void
+bench_tick (void)
+{
+    uint64_t    start = irmp_bench_now ();
 
-                            if (xor_value != xor_check[5])
-                            {
-                                ANALYZE_PRINTF3 ("error 5: wrong XOR check for data bits: 0x%02x 0x%02x\n", xor_value, xor_check[5]);
-                                irmp_ir_detected = FALSE;
-                            }
+    (void) irmp_ISR ();
 
-                            irmp_flags |= genre2;       // write the genre2 bits into MSB of the flag byte
-                        }
-#endif // IRMP_SUPPORT_KASEIKYO_PROTOCOL == 1
+    if (bench_measure)
+    {
+        irmp_bench_add (&bench, start);
+    }
 
-#if IRMP_SUPPORT_ORTEK_PROTOCOL == 1
-                        if (irmp_param.protocol == IRMP_ORTEK_PROTOCOL)
-                        {
-                            if (parity == PARITY_CHECK_FAILED)
-                            {
-                                ANALYZE_PRINTF1 ("error 6: parity check failed\n");
-                                irmp_ir_detected = FALSE;
-                            }
+    if (irmp_get_data (&irmp_data))
+    {
+        bench_decoded++;
+    }
+}
 
-                            if ((irmp_tmp_address & 0x03) == 0x02)
-                            {
-                                ANALYZE_PRINTF1 ("code skipped: ORTEK end of transmission frame (key release)\n");
-                                irmp_ir_detected = FALSE;
-                            }
-                            irmp_tmp_address >>= 2;
-                        }
-#endif // IRMP_SUPPORT_ORTEK_PROTOCOL == 1
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ *  Cost of irmp_ISR() without any signal, printed as protocol "idle"
+ *  @details  the ticks after the last frame are not measured until all counters of irmp_ISR() are saturated, then one second is
+ *            measured. Build with -DIRMP_USE_IDLE_FAST_PATH=0 for comparison.
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+static void
+bench_idle (void)
+{
+    long    i;
 
-#if IRMP_SUPPORT_MITSU_HEAVY_PROTOCOL == 1
-                        if (irmp_param.protocol == IRMP_MITSU_HEAVY_PROTOCOL)
-                        {
-                            check = irmp_tmp_command >> 8;                    // inverted upper byte == lower byte?
-                            check = ~ check;
-                            if (check == (irmp_tmp_command & 0xFF)) {         //ok:
-                              irmp_tmp_command &= 0xFF;
-                            }
-                            else  mitsu_parity = PARITY_CHECK_FAILED;
-                            if (mitsu_parity == PARITY_CHECK_FAILED)
-                            {
-                                ANALYZE_PRINTF1 ("error 7: parity check failed\n");
-                                irmp_ir_detected = FALSE;
-                            }
-                        }
-#endif // IRMP_SUPPORT_MITSU_HEAVY_PROTOCOL
+    bench_next_protocol ("idle");
+    IRMP_PIN = IRMP_HIGH_ACTIVE ? 0x00 : 0xff;
 
-#if IRMP_SUPPORT_RC6_PROTOCOL == 1
-                        if (irmp_param.protocol == IRMP_RC6_PROTOCOL && irmp_param.complete_len == RC6_COMPLETE_DATA_LEN_LONG)     // RC6 mode = 6?
-                        {
-                            irmp_protocol = IRMP_RC6A_PROTOCOL;
-                        }
-                        else if (irmp_param.protocol == IRMP_RC6_PROTOCOL && irmp_param.complete_len == RC6_COMPLETE_DATA_LEN_20)       // RC6 mode = 6?
-                        {
-                            irmp_protocol = IRMP_RC6A20_PROTOCOL;
-                        }
-                        else if (irmp_param.protocol == IRMP_RC6_PROTOCOL && irmp_param.complete_len == RC6_COMPLETE_DATA_LEN_28)       // RC6 mode = 6?
-                        {
-                            irmp_protocol = IRMP_RC6A28_PROTOCOL;
-                        }
-                        else
-#endif // IRMP_SUPPORT_RC6_PROTOCOL == 1
-                        {
-                            irmp_protocol = irmp_param.protocol;
-                        }
+    for (i = 0; i < 0x10000L; i++)
+    {
+        bench_tick ();
+    }
 
-#if IRMP_SUPPORT_FDC_PROTOCOL == 1
-                        if (irmp_param.protocol == IRMP_FDC_PROTOCOL)
-                        {
-                            if (irmp_tmp_command & 0x000F)                          // released key?
-                            {
-                                irmp_tmp_command = (irmp_tmp_command >> 4) | 0x80;  // yes, set bit 7
-                            }
-                            else
-                            {
-                                irmp_tmp_command >>= 4;                             // no, it's a pressed key
-                            }
-                            irmp_tmp_command |= (irmp_tmp_address << 2) & 0x0F00;   // 000000CCCCAAAAAA -> 0000CCCC00000000
-                            irmp_tmp_address &= 0x003F;
-                        }
-#endif
+    bench_measure = TRUE;
 
-                        irmp_address = irmp_tmp_address;                            // store address
-#if IRMP_SUPPORT_NEC_PROTOCOL == 1
-                        if (irmp_param.protocol == IRMP_NEC_PROTOCOL)
-                        {
-                            last_irmp_address = irmp_tmp_address;                   // store as last address, too
-                        }
-#endif
+    for (i = 0; i < (long) F_INTERRUPTS; i++)
+    {
+        bench_tick ();
+    }
 
-#if IRMP_SUPPORT_RC5_PROTOCOL == 1
-                        if (irmp_param.protocol == IRMP_RC5_PROTOCOL)
-                        {
-                            irmp_tmp_command |= rc5_cmd_bit6;                       // store bit 6
-                        }
-#endif
-#if IRMP_SUPPORT_S100_PROTOCOL == 1
-                        if (irmp_param.protocol == IRMP_S100_PROTOCOL)
-                        {
-                            irmp_tmp_command |= rc5_cmd_bit6;                       // store bit 6
-                        }
-#endif
-                        irmp_command = irmp_tmp_command;                            // store command
+    bench_measure = FALSE;
+}
 
-#if IRMP_SUPPORT_SAMSUNG_PROTOCOL == 1
-                        irmp_id = irmp_tmp_id;
+static void
+next_tick (void)
+{
+    if (benchmark)
+    {
+        bench_tick ();
+    }
+    else if (! analyze && ! list)
+    {
+        (void) irmp_ISR ();
+#if IRMP_RAW_CAPTURE_LEN > 0
+        print_raw_frame ();                                                 // a raw frame is complete before or with its data
 #endif
-                    }
-                }
+        print_decoded_data ();
+    }
+}
 
-                if (irmp_ir_detected)
-                {
-                    if (last_irmp_command == irmp_tmp_command &&
-                        last_irmp_address == irmp_tmp_address &&
-#if IRMP_AUTODETECT_REPEATRATE
-                        irmp_protocol == previous_irmp_protocol)
-                    {
-                        same_key = 1;
-                    }
-                    pass_on_delta_detection = delta_detection;
-                    delta_detection = 0;
-#else
-                        key_repetition_len < IRMP_KEY_REPETITION_LEN) // time after data frame, not total since start
-                    {
-                        irmp_flags |= IRMP_FLAG_REPETITION;
-                    }
-#endif
-                    last_irmp_address   = irmp_tmp_address;                          // store as last address, too
-                    last_irmp_command   = irmp_tmp_command;                          // store as last command, too
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ *  Reader for binary RLE scans, see IRMP_RLE_MAGIC
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+typedef struct
+{
+    const uint8_t *     data;
+    size_t              len;
+    size_t              pos;
+    uint32_t            f_interrupts;                                       // F_INTERRUPTS of current record, 0: between records
+    uint_fast8_t        is_pulse;                                           // flag: next duration is a pulse
+} IRMP_RLE_READER;
+
+#define IRMP_RLE_ERROR              (-1)                                    // format error at reader.pos
+#define IRMP_RLE_END_OF_DATA        0
+#define IRMP_RLE_DURATION           1
+#define IRMP_RLE_END_OF_FRAME       2
+
+static int
+is_rle_scan (const uint8_t * data, size_t len)
+{
+    return len >= IRMP_RLE_HEADER_LEN && ! memcmp (data, IRMP_RLE_MAGIC, 4);
+}
 
-#if IRMP_ENABLE_RELEASE_DETECTION == 1
-                    key_released        = FALSE;
-#endif
-                    key_repetition_len  = 0;
-                }
-                else
-                {
-                    ANALYZE_ONLY_NORMAL_PUTCHAR ('\n');
-                }
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ *  Read next duration of a binary RLE scan
+ *  @details  durations of scans logged with another F_INTERRUPTS are converted to the F_INTERRUPTS of the analyzer
+ *  @return   IRMP_RLE_DURATION (*is_pulse_p and *ticks_p are set), IRMP_RLE_END_OF_FRAME, IRMP_RLE_END_OF_DATA or IRMP_RLE_ERROR
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+static int
+rle_read (IRMP_RLE_READER * r, uint_fast8_t * is_pulse_p, uint32_t * ticks_p)
+{
+    const uint8_t *     p;
+    uint32_t            d;
 
-                irmp_start_bit_detected = 0;                                        // and wait for next start bit
-                irmp_tmp_command        = 0;
-                irmp_pulse_time         = 0;
-                irmp_pause_time         = 0;
+    if (! r->f_interrupts)                                                  // start of record
+    {
+        if (r->pos == r->len)
+        {
+            return IRMP_RLE_END_OF_DATA;
+        }
 
-#if IRMP_SUPPORT_JVC_PROTOCOL == 1
-                if (irmp_protocol == IRMP_JVC_PROTOCOL)                             // the stop bit of JVC frame is also start bit of next frame
-                {                                                                   // set pulse time here!
-                    irmp_pulse_time = ((uint_fast8_t)(F_INTERRUPTS * JVC_START_BIT_PULSE_TIME));
-                }
-#endif // IRMP_SUPPORT_JVC_PROTOCOL == 1
-            }
+        p = r->data + r->pos;
+
+        if (r->len - r->pos < IRMP_RLE_HEADER_LEN || memcmp (p, IRMP_RLE_MAGIC, 4) || p[4] != IRMP_RLE_VERSION)
+        {
+            return IRMP_RLE_ERROR;
+        }
+
+        r->f_interrupts = p[6] | (p[7] << 8) | ((uint32_t) p[8] << 16) | ((uint32_t) p[9] << 24);
+
+        if (! r->f_interrupts)
+        {
+            return IRMP_RLE_ERROR;
         }
+
+        r->pos += IRMP_RLE_HEADER_LEN;
+        r->is_pulse = TRUE;
     }
 
-#if defined(STELLARIS_ARM_CORTEX_M4)
-    // Clear the timer interrupt
-    TimerIntClear(TIMER1_BASE, TIMER_TIMA_TIMEOUT);
-#endif
+    if (r->pos == r->len)                                                   // record without end of frame
+    {
+        return IRMP_RLE_ERROR;
+    }
 
-#if (defined(_CHIBIOS_RT_) || defined(_CHIBIOS_NIL_)) && IRMP_USE_EVENT == 1
-    if (IRMP_EVENT_THREAD_PTR != nullptr && irmp_ir_detected)
-        chEvtSignalI(IRMP_EVENT_THREAD_PTR,IRMP_EVENT_BIT);
-#endif
+    d = r->data[r->pos++];
 
-#if IRMP_USE_COMPLETE_CALLBACK == 1
-    if (irmp_complete_callback_function != nullptr && irmp_ir_detected) {
-        irmp_complete_callback_function();
+    if (d == IRMP_RLE_ESCAPE)
+    {
+        if (r->len - r->pos < 2)
+        {
+            return IRMP_RLE_ERROR;
+        }
+
+        d = r->data[r->pos] | (r->data[r->pos + 1] << 8);
+        r->pos += 2;
     }
-#endif
 
-#if IRMP_USE_IDLE_CALL == 1
-    // check if there is no ongoing transmission or repetition
-    if (!irmp_start_bit_detected && !irmp_pulse_time
-        && key_repetition_len > IRMP_KEY_REPETITION_LEN)
+    if (! d)
     {
-        // no ongoing transmission
-        // enough time passed since last decoded signal that a repetition won't affect our output
+        r->f_interrupts = 0;
+        return IRMP_RLE_END_OF_FRAME;
+    }
 
-        irmp_idle();
+    if (r->f_interrupts != (uint32_t) F_INTERRUPTS)
+    {
+        d = (uint32_t) (((uint64_t) d * (uint32_t) F_INTERRUPTS + r->f_interrupts / 2) / r->f_interrupts);
+
+        if (! d)
+        {
+            d = 1;
+        }
     }
-#endif // IRMP_USE_IDLE_CALL
 
-    return (irmp_ir_detected);
+    *is_pulse_p = r->is_pulse;
+    *ticks_p    = d;
+    r->is_pulse = ! r->is_pulse;
+    return IRMP_RLE_DURATION;
 }
 
-#if defined(ANALYZE)
-
 /*---------------------------------------------------------------------------------------------------------------------------------------------------
- * main functions - for Unix/Linux + Windows only!
- *
- * AVR: see main.c!
- *
- * Compile it under linux with:
- * cc irmp.c -o irmp
- *
- * usage: ./irmp [-v|-s|-a|-l] < file
- *
- * options:
- *   -v verbose
- *   -s silent
- *   -a analyze
- *   -l list pulse/pauses
+ *  Feed the decoder with a pulse or pause and print decoded frames
  *---------------------------------------------------------------------------------------------------------------------------------------------------
  */
-
-void
-print_spectrum (const char *text, int *buf, int is_pulse)
+static void
+feed_duration (uint_fast8_t is_pulse, uint32_t ticks)
 {
-    int     i;
-    int     j;
-    int     min;
-    int     max;
-    int     max_value = 0;
-    int     value;
-    int     sum = 0;
-    int     counter = 0;
-    double  average = 0;
-    double  tolerance;
+    uint_fast8_t    level;
 
-    puts ("-----------------------------------------------------------------------------");
-    printf ("%s:\n", text);
+    if (IRMP_HIGH_ACTIVE)
+    {
+        level = is_pulse ? 0xff : 0x00;
+    }
+    else
+    {
+        level = is_pulse ? 0x00 : 0xff;
+    }
 
-    for (i = 0; i < 256; i++)
+#if IRMP_ENABLE_FEED_DURATION == 1
+    while (ticks)
     {
-        if (buf[i] > max_value)
-        {
-            max_value = buf[i];
-        }
+        ticks = irmp_feed_duration (level, ticks);                          // returns early if a frame is complete
+#if IRMP_RAW_CAPTURE_LEN > 0
+        print_raw_frame ();                                                 // a raw frame is complete before or with its data
+#endif
+        print_decoded_data ();
     }
+#else
+    IRMP_PIN = level;
 
-    for (i = 1; i < 200; i++)
+    while (ticks--)
     {
-        if (buf[i] > 0)
+        next_tick ();
+    }
+#endif
+}
+
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ *  Decode, list or analyze a binary RLE scan
+ *  @return   0: ok, 1: format error
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+static int
+analyze_rle_scan (const uint8_t * data, size_t len, int * start_pulses, int * start_pauses, int * pulses, int * pauses)
+{
+    IRMP_RLE_READER     r = { data, len, 0, 0, TRUE };
+    uint_fast8_t        is_pulse;
+    uint32_t            ticks;
+    int                 first_pulse = TRUE;
+    int                 first_pause = TRUE;
+    int                 rtc;
+
+    while ((rtc = rle_read (&r, &is_pulse, &ticks)) != IRMP_RLE_END_OF_DATA)
+    {
+        if (rtc == IRMP_RLE_ERROR)
         {
-            printf ("%3d ", i);
-            value = (buf[i] * 60) / max_value;
+            fprintf (stderr, "error: invalid RLE scan at offset %lu\n", (unsigned long) r.pos);
+            return 1;
+        }
 
-            for (j = 0; j < value; j++)
+        if (rtc == IRMP_RLE_END_OF_FRAME)
+        {
+            if (list)
             {
-                putchar ('o');
+                putchar ('\n');
             }
-            printf (" %d\n", buf[i]);
+            else if (! analyze)
+            {
+                time_counter = 0;
+                feed_duration (FALSE, F_INTERRUPTS);                        // long pause like a newline in ASCII scans
+            }
+            first_pulse = TRUE;
+            first_pause = TRUE;
+        }
+        else if (list)
+        {
+            printf (is_pulse ? "pulse: %lu " : "pause: %lu\n", (unsigned long) ticks);
+        }
+        else if (analyze)
+        {
+            int *   spectrum;
 
-            sum += i * buf[i];
-            counter += buf[i];
+            if (is_pulse)
+            {
+                spectrum = first_pulse ? start_pulses : pulses;
+                first_pulse = FALSE;
+            }
+            else
+            {
+                spectrum = first_pause ? start_pauses : pauses;
+                first_pause = FALSE;
+            }
+
+            if (ticks < 256)
+            {
+                spectrum[ticks]++;
+            }
         }
         else
         {
-            max = i - 1;
+            feed_duration (is_pulse, ticks);
+        }
+    }
+    return 0;
+}
 
-            if (counter > 0)
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ *  Parse the values expected by a comment line, e.g. "2 0x00ff 0x0010" of "# [2 0x00ff 0x0010]"
+ *  @return   TRUE: protocol, address and command found
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+static int
+parse_expected_values (const char * buf, int * protocol_p, int * address_p, int * command_p)
+{
+    const char *    p;
+
+    *protocol_p = atoi (buf);
+
+    if (*protocol_p > 0)
+    {
+        for (p = buf; *p; p++)
+        {
+            if (*p == 'x')
             {
-                average = (float) sum / (float) counter;
+                p++;
 
-                if (is_pulse)
-                {
-                    printf ("pulse ");
-                }
-                else
+                if (sscanf (p, "%x", address_p) != 1)
                 {
-                    printf ("pause ");
+                    return FALSE;
                 }
 
-                printf ("avg: %4.1f=%6.1f us, ", average, (1000000. * average) / (float) F_INTERRUPTS);
-                printf ("min: %2d=%6.1f us, ", min, (1000000. * min) / (float) F_INTERRUPTS);
-                printf ("max: %2d=%6.1f us, ", max, (1000000. * max) / (float) F_INTERRUPTS);
-
-                tolerance = (max - average);
-
-                if (average - min > tolerance)
+                for ( ; *p; p++)
                 {
-                    tolerance = average - min;
+                    if (*p == 'x')
+                    {
+                        p++;
+                        return sscanf (p, "%x", command_p) == 1;
+                    }
                 }
-
-                tolerance = tolerance * 100 / average;
-                printf ("tol: %4.1f%%\n", tolerance);
+                return FALSE;
             }
-
-            counter = 0;
-            sum = 0;
-            min = i + 1;
         }
     }
+    return FALSE;
 }
 
-#define STATE_LEFT_SHIFT    0x01
-#define STATE_RIGHT_SHIFT   0x02
-#define STATE_LEFT_CTRL     0x04
-#define STATE_LEFT_ALT      0x08
-#define STATE_RIGHT_ALT     0x10
+#if IRMP_ENABLE_CONTEXT == 1 && defined(__cplusplus) && __cplusplus >= 201703L
+#  define IRMP_ANALYZE_BATCH    1
+#else
+#  define IRMP_ANALYZE_BATCH    0
+#endif
 
-#define KEY_ESCAPE          0x1B            // keycode = 0x006e
-#define KEY_MENUE           0x80            // keycode = 0x0070
-#define KEY_BACK            0x81            // keycode = 0x0071
-#define KEY_FORWARD         0x82            // keycode = 0x0072
-#define KEY_ADDRESS         0x83            // keycode = 0x0073
-#define KEY_WINDOW          0x84            // keycode = 0x0074
-#define KEY_1ST_PAGE        0x85            // keycode = 0x0075
-#define KEY_STOP            0x86            // keycode = 0x0076
-#define KEY_MAIL            0x87            // keycode = 0x0077
-#define KEY_FAVORITES       0x88            // keycode = 0x0078
-#define KEY_NEW_PAGE        0x89            // keycode = 0x0079
-#define KEY_SETUP           0x8A            // keycode = 0x007a
-#define KEY_FONT            0x8B            // keycode = 0x007b
-#define KEY_PRINT           0x8C            // keycode = 0x007c
-#define KEY_ON_OFF          0x8E            // keycode = 0x007c
+#if IRMP_ANALYZE_BATCH == 1
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <filesystem>
+#include <string>
+#include <thread>
+#include <vector>
 
-#define KEY_INSERT          0x90            // keycode = 0x004b
-#define KEY_DELETE          0x91            // keycode = 0x004c
-#define KEY_LEFT            0x92            // keycode = 0x004f
-#define KEY_HOME            0x93            // keycode = 0x0050
-#define KEY_END             0x94            // keycode = 0x0051
-#define KEY_UP              0x95            // keycode = 0x0053
-#define KEY_DOWN            0x96            // keycode = 0x0054
-#define KEY_PAGE_UP         0x97            // keycode = 0x0055
-#define KEY_PAGE_DOWN       0x98            // keycode = 0x0056
-#define KEY_RIGHT           0x99            // keycode = 0x0059
-#define KEY_MOUSE_1         0x9E            // keycode = 0x0400
-#define KEY_MOUSE_2         0x9F            // keycode = 0x0800
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ *  Batch mode: decode many scan files in parallel
+ *
+ *  usage: ./irmp -b [-j threads] file|directory|@listfile ...
+ *
+ *  Every file is decoded by its own IRMP_CONTEXT, so the worker threads do not share any decoder state.
+ *  Files may be ASCII or binary RLE scans.
+ *  The output of every file is the same as of ./irmp -s < file, all outputs are printed in the order of the arguments.
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+typedef struct
+{
+    std::string                 name;                                           // file name
+    std::string                 output;                                         // decoder output
+    int                         read_error;                                     // flag: file not readable or invalid
+    int                         frames;                                         // number of decoded frames
+    int                         checked;                                        // number of frames checked against expected values
+    int                         errors;                                         // number of frames with unexpected values
+    double                      msec;                                           // decoding time
+    int                         expected_protocol;
+    int                         expected_address;
+    int                         expected_command;
+    int                         do_check_expected_values;
+} BATCH_FILE;
 
-static uint_fast8_t
-get_fdc_key (uint_fast16_t cmd)
+static void
+batch_get_data (IRMP_CONTEXT * ctx, BATCH_FILE * f)
 {
-    static const uint8_t key_table[128] =
+    IRMP_DATA   data;
+    char        buf[256];
+
+#if IRMP_RAW_CAPTURE_LEN > 0
+    char        raw_buf[IRMP_RAW_FRAME_PRINT_LEN];
+
+    if (sprint_raw_frame (raw_buf, sizeof (raw_buf), irmp_get_raw_frame_ctx (ctx)))
+    {                                                                           // a raw frame is complete before or with its data
+        f->output += raw_buf;
+    }
+#endif
+
+    if (irmp_get_data_ctx (ctx, &data))
     {
-     // 0     1      2    3    4     5    6    7    8     9     A     B     C     D     E     F
-        0x00, '^',  '1', '2', '3',  '4', '5', '6', '7',  '8',  '9',  '0',  0xDF, 0xB4,  0x00, '\b',
-        '\t', 'q',  'w', 'e', 'r',  't', 'z', 'u', 'i',  'o',  'p',  0xFC, '+',  0x00,  0x00, 'a',
-        's',  'd',  'f', 'g', 'h',  'j', 'k', 'l', 0xF6, 0xE4, '#',  '\r', 0x00, '<',   'y',  'x',
-        'c',  'v',  'b', 'n', 'm',  ',', '.', '-', 0x00, 0x00, 0x00, 0x00, 0x00,  ' ',  0x00, 0x00,
+        f->frames++;
+        sprint_irmp_data (buf, sizeof (buf), &data);
+        f->output += buf;
+
+        if (f->do_check_expected_values)
+        {
+            if (sprint_expected_values_check (buf, sizeof (buf), &data, f->expected_protocol, f->expected_address, f->expected_command))
+            {
+                f->checked++;
+            }
+            else
+            {
+                f->errors++;
+            }
+            f->output += buf;
+            f->do_check_expected_values = FALSE;                                // only check 1st frame in a line!
+        }
+        else
+        {
+            f->output += '\n';
+        }
+
+#if IRMP_FRAME_BITS > 0
+        char    frame_buf[IRMP_FRAME_PRINT_LEN];
+
+        if (sprint_frame (frame_buf, sizeof (frame_buf), irmp_get_frame_ctx (ctx)))
+        {
+            f->output += frame_buf;
+        }
+#endif
+    }
+}
 
-        0x00, 0xB0, '!', '"', 0xA7, '$', '%', '&', '/',  '(',  ')',  '=',  '?',  0x60,  0x00, '\b',
-        '\t', 'Q',  'W', 'E', 'R',  'T', 'Z', 'U', 'I',  'O',  'P',  0xDC, '*',  0x00,  0x00, 'A',
-        'S',  'D',  'F', 'G', 'H',  'J', 'K', 'L', 0xD6, 0xC4, '\'', '\r', 0x00, '>',   'Y',  'X',
-        'C',  'V',  'B', 'N', 'M',  ';', ':', '_', 0x00, 0x00, 0x00, 0x00, 0x00, ' ',   0x00, 0x00
-    };
-    static uint_fast8_t state;
+static void
+batch_feed (IRMP_CONTEXT * ctx, BATCH_FILE * f, uint_fast8_t level, uint32_t ticks)
+{
+#if IRMP_ENABLE_FEED_DURATION == 1
+    while (ticks)
+    {
+        ticks = irmp_feed_duration_ctx (ctx, level, ticks);
+        batch_get_data (ctx, f);
+    }
+#else
+    while (ticks--)
+    {
+        (void) irmp_ISR_ctx (ctx, level);
+        batch_get_data (ctx, f);
+    }
+#endif
+}
 
-    uint_fast8_t key = 0;
+static void
+batch_decode_ascii (IRMP_CONTEXT * ctx, BATCH_FILE * f, const std::vector<unsigned char> & content)
+{
+    const uint_fast8_t  pulse_level = IRMP_HIGH_ACTIVE ? 0xff : 0x00;
+    const uint_fast8_t  pause_level = IRMP_HIGH_ACTIVE ? 0x00 : 0xff;
+    uint_fast8_t        level = pause_level;
+    size_t              pos;
 
-    switch (cmd)
+    for (pos = 0; pos < content.size (); pos++)
     {
-        case 0x002C: state |=  STATE_LEFT_SHIFT;    break;              // pressed left shift
-        case 0x00AC: state &= ~STATE_LEFT_SHIFT;    break;              // released left shift
-        case 0x0039: state |=  STATE_RIGHT_SHIFT;   break;              // pressed right shift
-        case 0x00B9: state &= ~STATE_RIGHT_SHIFT;   break;              // released right shift
-        case 0x003A: state |=  STATE_LEFT_CTRL;     break;              // pressed left ctrl
-        case 0x00BA: state &= ~STATE_LEFT_CTRL;     break;              // released left ctrl
-        case 0x003C: state |=  STATE_LEFT_ALT;      break;              // pressed left alt
-        case 0x00BC: state &= ~STATE_LEFT_ALT;      break;              // released left alt
-        case 0x003E: state |=  STATE_RIGHT_ALT;     break;              // pressed left alt
-        case 0x00BE: state &= ~STATE_RIGHT_ALT;     break;              // released left alt
+        int ch = content[pos];
 
-        case 0x006e: key = KEY_ESCAPE;              break;
-        case 0x004b: key = KEY_INSERT;              break;
-        case 0x004c: key = KEY_DELETE;              break;
-        case 0x004f: key = KEY_LEFT;                break;
-        case 0x0050: key = KEY_HOME;                break;
-        case 0x0051: key = KEY_END;                 break;
-        case 0x0053: key = KEY_UP;                  break;
-        case 0x0054: key = KEY_DOWN;                break;
-        case 0x0055: key = KEY_PAGE_UP;             break;
-        case 0x0056: key = KEY_PAGE_DOWN;           break;
-        case 0x0059: key = KEY_RIGHT;               break;
-        case 0x0400: key = KEY_MOUSE_1;             break;
-        case 0x0800: key = KEY_MOUSE_2;             break;
+        if (ch == '_' || ch == '0')
+        {
+            level = pulse_level;
+        }
+        else if (ch == 0xaf || ch == '-' || ch == '1')
+        {
+            level = pause_level;
+        }
+        else if (ch == '\n')
+        {
+            level = pause_level;
+            time_counter = 0;
 
-        default:
+            batch_feed (ctx, f, level, (int) ((10000.0 * F_INTERRUPTS) / 10000));     // newline: long pause of 10000 msec
+        }
+        else if (ch == '#')
         {
-            if (!(cmd & 0x80))                      // pressed key
+            char    buf[1024];
+            int     idx = -1;
+
+            time_counter = 0;
+            f->output += "----------------------------------------------------------------------\n#";
+
+            while (++pos < content.size () && (ch = content[pos]) != '\n')
             {
-                if (cmd >= 0x70 && cmd <= 0x7F)     // function keys
-                {
-                    key = cmd + 0x10;               // 7x -> 8x
-                }
-                else if (cmd < 64)                  // key listed in key_table
+                if (ch != '\r')                                                 // ignore CR in DOS/Windows files
                 {
-                    if (state & (STATE_LEFT_ALT | STATE_RIGHT_ALT))
+                    if (ch == '[' && idx == -1)
                     {
-                        switch (cmd)
-                        {
-                            case 0x0003: key = 0xB2;    break; // upper 2
-                            case 0x0008: key = '{';     break;
-                            case 0x0009: key = '[';     break;
-                            case 0x000A: key = ']';     break;
-                            case 0x000B: key = '}';     break;
-                            case 0x000C: key = '\\';    break;
-                            case 0x001C: key = '~';     break;
-                            case 0x002D: key = '|';     break;
-                            case 0x0034: key = 0xB5;    break; // Mu
-                        }
+                        idx = 0;
                     }
-                    else if (state & (STATE_LEFT_CTRL))
+                    else if (idx >= 0)
                     {
-                        if (key_table[cmd] >= 'a' && key_table[cmd] <= 'z')
+                        if (ch == ']')
                         {
-                            key = key_table[cmd] - 'a' + 1;
-                        }
-                        else
-                        {
-                            key = key_table[cmd];
-                        }
-                    }
-                    else
-                    {
-                        int idx = cmd + ((state & (STATE_LEFT_SHIFT | STATE_RIGHT_SHIFT)) ? 64 : 0);
+                            buf[idx] = '\0';
+                            idx = -1;
 
-                        if (key_table[idx])
+                            f->do_check_expected_values = parse_expected_values (buf, &f->expected_protocol, &f->expected_address, &f->expected_command);
+                        }
+                        else if (idx < 1024 - 2)
                         {
-                            key = key_table[idx];
+                            buf[idx++] = ch;
                         }
                     }
+                    f->output += (char) ch;
                 }
             }
-            break;
+            f->output += '\n';
         }
-    }
 
-    return (key);
+        batch_feed (ctx, f, level, 1);
+    }
 }
 
-static int         analyze = FALSE;
-static int         list = FALSE;
-static IRMP_DATA   irmp_data;
-static int         expected_protocol;
-static int         expected_address;
-static int         expected_command;
-static int         do_check_expected_values;
-
 static void
-next_tick (void)
+batch_decode_rle (IRMP_CONTEXT * ctx, BATCH_FILE * f, const std::vector<unsigned char> & content)
 {
-    if (! analyze && ! list)
+    const uint_fast8_t  pulse_level = IRMP_HIGH_ACTIVE ? 0xff : 0x00;
+    const uint_fast8_t  pause_level = IRMP_HIGH_ACTIVE ? 0x00 : 0xff;
+    IRMP_RLE_READER     r = { content.data (), content.size (), 0, 0, TRUE };
+    uint_fast8_t        is_pulse;
+    uint32_t            ticks;
+    int                 rtc;
+
+    while ((rtc = rle_read (&r, &is_pulse, &ticks)) != IRMP_RLE_END_OF_DATA)
     {
-        (void) irmp_ISR ();
+        if (rtc == IRMP_RLE_ERROR)
+        {
+            f->read_error = TRUE;
+            f->output += "error: invalid RLE scan at offset " + std::to_string (r.pos) + "\n";
+            break;
+        }
 
-        if (irmp_get_data (&irmp_data))
+        if (rtc == IRMP_RLE_END_OF_FRAME)
+        {
+            time_counter = 0;
+            batch_feed (ctx, f, pause_level, F_INTERRUPTS);                     // long pause like a newline in ASCII scans
+        }
+        else
         {
-            uint_fast8_t key;
+            batch_feed (ctx, f, is_pulse ? pulse_level : pause_level, ticks);
+        }
+    }
+}
 
-            ANALYZE_ONLY_NORMAL_PUTCHAR (' ');
+static void
+batch_decode_file (BATCH_FILE * f)
+{
+    std::chrono::steady_clock::time_point   start = std::chrono::steady_clock::now ();
+    std::vector<unsigned char>              content;
+    IRMP_CONTEXT                            ctx;
+    FILE *                                  fp;
+    size_t                                  len;
+    unsigned char                           chunk[4096];
 
-            if (verbose)
-            {
-                printf ("%8.3fms ", (double) (time_counter * 1000) / F_INTERRUPTS);
-            }
+    fp = fopen (f->name.c_str (), "rb");
 
-            if (irmp_data.protocol == IRMP_ACP24_PROTOCOL)
-            {
-                uint16_t    temp = (irmp_data.command & 0x000F) + 15;
+    if (! fp)
+    {
+        f->read_error = TRUE;
+        f->output = "error: cannot open " + f->name + "\n";
+        return;
+    }
 
-                printf ("p=%2d (%s), a=0x%04x, c=0x%04x, f=0x%02x, temp=%d",
-                        irmp_data.protocol, irmp_protocol_names[irmp_data.protocol], irmp_data.address, irmp_data.command, irmp_data.flags, temp);
-            }
-            else if (irmp_data.protocol == IRMP_FDC_PROTOCOL && (key = get_fdc_key (irmp_data.command)) != 0)
-            {
-                if ((key >= 0x20 && key < 0x7F) || key >= 0xA0)
-                {
-                    printf ("p=%2d (%s), a=0x%04x, c=0x%04x, f=0x%02x, asc=0x%02x, key='%c'",
-                            irmp_data.protocol,  irmp_protocol_names[irmp_data.protocol], irmp_data.address, irmp_data.command, irmp_data.flags, key, key);
-                }
-                else if (key == '\r' || key == '\t' || key == KEY_ESCAPE || (key >= 0x80 && key <= 0x9F))                 // function keys
-                {
-                    const char * p = (const char *) nullptr;
+    while ((len = fread (chunk, 1, sizeof (chunk), fp)) > 0)
+    {
+        content.insert (content.end (), chunk, chunk + len);
+    }
+    fclose (fp);
 
-                    switch (key)
-                    {
-                        case '\t'                : p = "TAB";           break;
-                        case '\r'                : p = "CR";            break;
-                        case KEY_ESCAPE          : p = "ESCAPE";        break;
-                        case KEY_MENUE           : p = "MENUE";         break;
-                        case KEY_BACK            : p = "BACK";          break;
-                        case KEY_FORWARD         : p = "FORWARD";       break;
-                        case KEY_ADDRESS         : p = "ADDRESS";       break;
-                        case KEY_WINDOW          : p = "WINDOW";        break;
-                        case KEY_1ST_PAGE        : p = "1ST_PAGE";      break;
-                        case KEY_STOP            : p = "STOP";          break;
-                        case KEY_MAIL            : p = "MAIL";          break;
-                        case KEY_FAVORITES       : p = "FAVORITES";     break;
-                        case KEY_NEW_PAGE        : p = "NEW_PAGE";      break;
-                        case KEY_SETUP           : p = "SETUP";         break;
-                        case KEY_FONT            : p = "FONT";          break;
-                        case KEY_PRINT           : p = "PRINT";         break;
-                        case KEY_ON_OFF          : p = "ON_OFF";        break;
-
-                        case KEY_INSERT          : p = "INSERT";        break;
-                        case KEY_DELETE          : p = "DELETE";        break;
-                        case KEY_LEFT            : p = "LEFT";          break;
-                        case KEY_HOME            : p = "HOME";          break;
-                        case KEY_END             : p = "END";           break;
-                        case KEY_UP              : p = "UP";            break;
-                        case KEY_DOWN            : p = "DOWN";          break;
-                        case KEY_PAGE_UP         : p = "PAGE_UP";       break;
-                        case KEY_PAGE_DOWN       : p = "PAGE_DOWN";     break;
-                        case KEY_RIGHT           : p = "RIGHT";         break;
-                        case KEY_MOUSE_1         : p = "KEY_MOUSE_1";   break;
-                        case KEY_MOUSE_2         : p = "KEY_MOUSE_2";   break;
-                        default                  : p = "<UNKNWON>";     break;
-                    }
+    irmp_init_ctx (&ctx);
+    time_counter = 0;
 
-                    printf ("p=%2d (%s), a=0x%04x, c=0x%04x, f=0x%02x, asc=0x%02x, key=%s",
-                            irmp_data.protocol, irmp_protocol_names[irmp_data.protocol], irmp_data.address, irmp_data.command, irmp_data.flags, key, p);
-                }
-                else
-                {
-                    printf ("p=%2d (%s), a=0x%04x, c=0x%04x, f=0x%02x, asc=0x%02x",
-                            irmp_data.protocol,  irmp_protocol_names[irmp_data.protocol], irmp_data.address, irmp_data.command, irmp_data.flags, key);
-                }
-            }
-            else
-            {
-                printf ("p=%2d (%s), a=0x%04x, c=0x%04x, f=0x%02x",
-                        irmp_data.protocol, irmp_protocol_names[irmp_data.protocol], irmp_data.address, irmp_data.command, irmp_data.flags);
-            }
+    if (is_rle_scan (content.data (), content.size ()))
+    {
+        batch_decode_rle (&ctx, f, content);
+    }
+    else
+    {
+        batch_decode_ascii (&ctx, f, content);
+    }
+
+    f->msec = std::chrono::duration<double, std::milli> (std::chrono::steady_clock::now () - start).count ();
+}
+
+static int
+batch_add_files (std::vector<BATCH_FILE> & files, const char * arg)
+{
+    std::error_code                     ec;
+    std::vector<std::string>            names;
+    BATCH_FILE                          f = {};
+
+    if (*arg == '@')                                                            // list file: one file name per line
+    {
+        FILE *  fp = fopen (arg + 1, "r");
+        char    line[4096];
 
-            if (do_check_expected_values)
+        if (! fp)
+        {
+            fprintf (stderr, "error: cannot open %s\n", arg + 1);
+            return FALSE;
+        }
+
+        while (fgets (line, sizeof (line), fp))
+        {
+            line[strcspn (line, "\r\n")] = '\0';
+
+            if (*line)
             {
-                if (irmp_data.protocol != expected_protocol ||
-                    irmp_data.address  != expected_address  ||
-                    irmp_data.command  != expected_command)
-                {
-                    printf ("\nerror 7: expected values differ: p=%2d (%s), a=0x%04x, c=0x%04x\n",
-                            expected_protocol, irmp_protocol_names[expected_protocol], expected_address, expected_command);
-                }
-                else
-                {
-                    printf (" checked!\n");
-                }
-                do_check_expected_values = FALSE;                           // only check 1st frame in a line!
+                names.push_back (line);
             }
-            else
+        }
+        fclose (fp);
+    }
+    else if (std::filesystem::is_directory (arg, ec))
+    {
+        for (const auto & entry : std::filesystem::recursive_directory_iterator (arg, ec))
+        {
+            if (entry.is_regular_file (ec))
             {
-                putchar ('\n');
+                names.push_back (entry.path ().string ());
             }
         }
+        std::sort (names.begin (), names.end ());
+    }
+    else
+    {
+        names.push_back (arg);
+    }
+
+    for (const std::string & name : names)
+    {
+        f.name = name;
+        files.push_back (f);
+    }
+    return TRUE;
+}
+
+static int
+batch_main (int argc, char ** argv)
+{
+    std::chrono::steady_clock::time_point   start = std::chrono::steady_clock::now ();
+    std::vector<BATCH_FILE>                 files;
+    std::vector<std::thread>                threads;
+    std::atomic<size_t>                     next_file (0);
+    unsigned int                            n_threads = std::thread::hardware_concurrency ();
+    int                                     frames = 0;
+    int                                     checked = 0;
+    int                                     errors = 0;
+    int                                     read_errors = 0;
+    double                                  msec = 0;
+    double                                  wall_msec;
+    int                                     i;
+
+    for (i = 0; i < argc; i++)
+    {
+        if (! strcmp (argv[i], "-j") && i + 1 < argc)
+        {
+            n_threads = atoi (argv[++i]);
+        }
+        else if (! batch_add_files (files, argv[i]))
+        {
+            return 1;
+        }
+    }
+
+    if (files.empty ())
+    {
+        fprintf (stderr, "usage: irmp -b [-j threads] file|directory|@listfile ...\n");
+        return 1;
+    }
+
+    if (n_threads < 1)
+    {
+        n_threads = 1;
+    }
+    else if (n_threads > files.size ())
+    {
+        n_threads = files.size ();
+    }
+
+    silent = TRUE;                                                              // ISR must not print, the threads would mix their output
+    verbose = FALSE;
+
+    for (unsigned int t = 0; t < n_threads; t++)
+    {
+        threads.emplace_back ([&files, &next_file] ()
+        {
+            size_t  idx;
+
+            while ((idx = next_file++) < files.size ())
+            {
+                batch_decode_file (&files[idx]);
+            }
+        });
+    }
+
+    for (std::thread & t : threads)
+    {
+        t.join ();
+    }
+
+    wall_msec = std::chrono::duration<double, std::milli> (std::chrono::steady_clock::now () - start).count ();
+
+    for (const BATCH_FILE & f : files)
+    {
+        printf ("==> %s <==\n", f.name.c_str ());
+        fputs (f.output.c_str (), stdout);
+
+        frames      += f.frames;
+        checked     += f.checked;
+        errors      += f.errors;
+        read_errors += f.read_error;
+        msec        += f.msec;
     }
+
+    puts ("----------------------------------------------------------------------");
+    printf ("files: %d, read errors: %d, frames: %d, checked: %d, errors: %d\n", (int) files.size (), read_errors, frames, checked, errors);
+    printf ("decoding time: %.1f ms, wall time: %.1f ms, threads: %u\n", msec, wall_msec, n_threads);
+
+    return (errors || read_errors) ? 1 : 0;
 }
+#endif // IRMP_ANALYZE_BATCH == 1
 
 int
 main (int argc, char ** argv)
@@ -5950,6 +10740,18 @@ main (int argc, char ** argv)
 
     int         first_pulse = TRUE;
     int         first_pause = TRUE;
+    int         rle = FALSE;
+    int         rtc = 0;
+
+    if (argc >= 2 && ! strcmp (argv[1], "-b"))
+    {
+#if IRMP_ANALYZE_BATCH == 1
+        return batch_main (argc - 2, argv + 2);
+#else
+        fprintf (stderr, "batch mode needs C++17 (compile with -std=gnu++17) and IRMP_ENABLE_CONTEXT=1\n");
+        return 1;
+#endif
+    }
 
     if (argc == 2)
     {
@@ -5971,6 +10773,21 @@ main (int argc, char ** argv)
         }
     }
 
+    if (argc >= 2 && ! strcmp (argv[1], "-t"))
+    {
+        benchmark = TRUE;
+        silent = TRUE;
+
+        if (argc >= 3)
+        {
+            bench_max_p99 = atoi (argv[2]);
+        }
+
+        irmp_bench_calibrate ();
+        irmp_bench_print_header (stdout);
+        irmp_bench_start (&bench, "stdin");
+    }
+
     for (i = 0; i < 256; i++)
     {
         start_pulses[i] = 0;
@@ -5988,8 +10805,32 @@ main (int argc, char ** argv)
         IRMP_PIN = 0xFF;
     }
 
-    while ((ch = getchar ()) != EOF)
+#if defined(unix) || defined(__APPLE__)
+    struct stat st;
+
+    if (fstat (STDIN_FILENO, &st) == 0 && S_ISREG (st.st_mode) && st.st_size >= IRMP_RLE_HEADER_LEN)   // binary RLE scan?
+    {
+        void * data = mmap (nullptr, st.st_size, PROT_READ, MAP_PRIVATE, STDIN_FILENO, 0);
+
+        if (data != MAP_FAILED)
+        {
+            if (is_rle_scan ((const uint8_t *) data, st.st_size))
+            {
+                rle = TRUE;
+                rtc = analyze_rle_scan ((const uint8_t *) data, st.st_size, start_pulses, start_pauses, pulses, pauses);
+            }
+            munmap (data, st.st_size);
+        }
+    }
+#endif
+
+    while (! rle && (ch = getchar ()) != EOF)
     {
+        if (benchmark && ch != '\n' && ch != '#')
+        {
+            bench_measure = TRUE;
+        }
+
         if (ch == '_' || ch == '0')
         {
             if (last_ch != ch)
@@ -6097,6 +10938,11 @@ main (int argc, char ** argv)
             {
                 for (i = 0; i < (int) ((10000.0 * F_INTERRUPTS) / 10000); i++)               // newline: long pause of 10000 msec
                 {
+                    if (benchmark && i == IRMP_BENCH_TAIL_LEN)
+                    {
+                        irmp_bench_end_frame (&bench);
+                        bench_measure = FALSE;
+                    }
                     next_tick ();
                 }
             }
@@ -6114,10 +10960,24 @@ main (int argc, char ** argv)
                     ;
                 }
             }
+            else if (benchmark)
+            {
+                char            name[IRMP_BENCH_NAME_LEN + 1];
+                int             idx = 0;
+
+                while ((ch = getchar()) != '\n' && ch != EOF)
+                {
+                    if (ch != '\r' && (idx > 0 || ch != ' ') && idx < IRMP_BENCH_NAME_LEN)
+                    {
+                        name[idx++] = ch;
+                    }
+                }
+                name[idx] = '\0';
+                bench_next_protocol (name);
+            }
             else
             {
                 char            buf[1024];
-                char *          p;
                 int             idx = -1;
 
                 puts ("----------------------------------------------------------------------");
@@ -6136,55 +10996,10 @@ main (int argc, char ** argv)
                         {
                             if (ch == ']')
                             {
-                                do_check_expected_values = FALSE;
                                 buf[idx] = '\0';
                                 idx = -1;
 
-                                expected_protocol = atoi (buf);
-
-                                if (expected_protocol > 0)
-                                {
-                                    p = buf;
-                                    while (*p)
-                                    {
-                                        if (*p == 'x')
-                                        {
-                                            p++;
-
-                                            if (sscanf (p, "%x", &expected_address) == 1)
-                                            {
-                                                do_check_expected_values = TRUE;
-                                            }
-                                            break;
-                                        }
-                                        p++;
-                                    }
-
-                                    if (do_check_expected_values)
-                                    {
-                                        do_check_expected_values = FALSE;
-
-                                        while (*p)
-                                        {
-                                            if (*p == 'x')
-                                            {
-                                                p++;
-
-                                                if (sscanf (p, "%x", &expected_command) == 1)
-                                                {
-                                                    do_check_expected_values = TRUE;
-                                                }
-                                                break;
-                                            }
-                                            p++;
-                                        }
-
-                                        if (do_check_expected_values)
-                                        {
-                                            // printf ("!%2d %04x %04x!\n", expected_protocol, expected_address, expected_command);
-                                        }
-                                    }
-                                }
+                                do_check_expected_values = parse_expected_values (buf, &expected_protocol, &expected_address, &expected_command);
                             }
                             else if (idx < 1024 - 2)
                             {
@@ -6212,7 +11027,80 @@ main (int argc, char ** argv)
         print_spectrum ("PAUSES", pauses, FALSE);
         puts ("-----------------------------------------------------------------------------");
     }
-    return 0;
+
+    if (benchmark)
+    {
+        bench_idle ();
+        bench_next_protocol ("");
+        return bench_rtc;
+    }
+    return rtc;
 }
 
 #endif // ANALYZE
+
+#if IRMP_ENABLE_CONTEXT == 1
+// the context member names must not leak into files included after irmp.hpp, e.g. irsnd.hpp
+#undef irmp_bit
+#undef irmp_param
+#undef irmp_param2
+#undef irmp_ir_detected
+#undef irmp_protocol
+#undef irmp_address
+#undef irmp_command
+#undef irmp_id
+#undef irmp_flags
+#undef irmp_tmp_address
+#undef irmp_tmp_command
+#undef irmp_tmp_address2
+#undef irmp_tmp_command2
+#undef irmp_lgair_address
+#undef irmp_lgair_command
+#undef irmp_melinera_command
+#undef irmp_tmp_id
+#undef xor_check
+#undef genre2
+#undef parity
+#undef check
+#undef mitsu_parity
+#undef first_bit
+#undef irmp_start_bit_detected
+#undef wait_for_space
+#undef wait_for_start_space
+#undef irmp_pulse_time
+#undef irmp_pause_time
+#undef key_repetition_len
+#undef irmp_steady_idle
+#undef repetition_frame_number
+#undef last_irmp_address
+#undef last_irmp_command
+#undef key_released
+#undef last_irmp_denon_command
+#undef denon_repetition_len
+#undef rc5_cmd_bit6
+#undef last_pause
+#undef last_value
+#undef waiting_for_2nd_pulse
+#undef irmp_queue
+#undef irmp_queue_head
+#undef irmp_queue_tail
+#undef irmp_queue_overflows
+#undef irmp_tick_counter
+#undef irmp_start_bit_ticks
+#undef irmp_frame_start_ticks
+#undef irmp_frame_end_ticks
+#undef irmp_frame_gap_ticks
+#undef irmp_last_frame_end_ticks
+#undef irmp_last_frame_valid
+#undef irmp_candidate_buf
+#undef irmp_candidate_len
+#undef irmp_candidate_run
+#undef irmp_candidate_level
+#undef irmp_candidate_state
+#undef irmp_candidate_replaying
+#undef irmp_candidate_mask
+#undef irmp_symbol_lut
+#undef irmp_frame_acc
+#undef irmp_frame_acc_len
+#undef irmp_frame
+#endif // IRMP_ENABLE_CONTEXT == 1
@@ -51,7 +51,26 @@
  *---------------------------------------------------------------------------------------------------------------------------------------------------
  */
 //#define IRMP_ENABLE_PIN_CHANGE_INTERRUPT
-#if defined(IRMP_ENABLE_PIN_CHANGE_INTERRUPT)
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ * Enable hybrid timer / pin change mode. The timer polls the input as usual, but only while there is IR traffic.
+ * It is stopped when the frame is complete and the release timeout has passed, and restarted by a pin change interrupt
+ * at the first edge of the next frame, so a battery powered receiver is not woken up 15000 times per second for nothing.
+ * Decoding is the same as with the timer alone. Same pins as for IRMP_ENABLE_PIN_CHANGE_INTERRUPT.
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+//#define IRMP_ENABLE_HYBRID_TIMER_MODE
+#if defined(IRMP_ENABLE_HYBRID_TIMER_MODE)
+#  if defined(IRMP_ENABLE_PIN_CHANGE_INTERRUPT)
+#error "IRMP_ENABLE_HYBRID_TIMER_MODE and IRMP_ENABLE_PIN_CHANGE_INTERRUPT cannot be used together."
+#  endif
+#  if defined(USE_ONE_TIMER_FOR_IRMP_AND_IRSND)
+#error "IRMP_ENABLE_HYBRID_TIMER_MODE cannot be used with USE_ONE_TIMER_FOR_IRMP_AND_IRSND, since the timer is stopped while idle."
+#  endif
+#  undef IRMP_ENABLE_FEED_DURATION
+#  define IRMP_ENABLE_FEED_DURATION             1       // irmp_PCI_ISR() feeds the idle time while the timer was stopped
+#endif
+
+#if defined(IRMP_ENABLE_PIN_CHANGE_INTERRUPT) || defined(IRMP_ENABLE_HYBRID_TIMER_MODE)
 #  if ! (defined(__AVR_ATtiny25__) || defined(__AVR_ATtiny45__) || defined(__AVR_ATtiny85__)) /* ATtinyX5 */ \
 && ! ( (defined(__AVR_ATtiny87__) || defined(__AVR_ATtiny167__)) && ( (defined(ARDUINO_AVR_DIGISPARKPRO) && ((IRMP_INPUT_PIN == 3) || (IRMP_INPUT_PIN == 9))) /*ATtinyX7(digisparkpro) and pin 3 or 9 */\
         || (! defined(ARDUINO_AVR_DIGISPARKPRO) && ((IRMP_INPUT_PIN == 3) || (IRMP_INPUT_PIN == 14)))) ) /*ATtinyX7(ATTinyCore) and pin 3 or 14 */ \
@@ -62,9 +81,11 @@
 && ((IRMP_INPUT_PIN == 2) || (IRMP_INPUT_PIN == 3)) ) /* ATmegas and pin 2 or 3 */
 #  define IRMP_USE_ARDUINO_ATTACH_INTERRUPT // cannot use any static ISR vector here
 #  endif
+#endif
 
-#  undef F_INTERRUPTS
-#  define F_INTERRUPTS                          15625   // 15625 interrupts per second gives 64 us period
+#if defined(IRMP_ENABLE_PIN_CHANGE_INTERRUPT)
+#  undef IRMP_ENABLE_FEED_DURATION
+#  define IRMP_ENABLE_FEED_DURATION             1       // irmp_PCI_ISR() feeds the decoder with the duration since the last change
 #endif
 
 #if defined(__AVR__)
@@ -122,6 +143,10 @@ void irmp_init(uint_fast8_t aIrmpInputPin, uint_fast8_t aIrmpFeedbackLedPin, boo
 bool irmp_IsBusy();
 
 extern uint32_t irmp_last_change_micros;
+#if defined(IRMP_ENABLE_HYBRID_TIMER_MODE)
+extern volatile bool irmp_timer_stopped;
+void irmp_stop_timer_if_idle(void);
+#endif
 
 void irmp_result_print(Print *aSerial, IRMP_DATA *aIRMPDataPtr);
 void irmp_result_print(IRMP_DATA *aIRMPDataPtr);
@@ -19,9 +19,9 @@
 #include "IRFeedbackLED.hpp"    // include code for Feedback LED
 #include "irmpprotocols.hpp"    // include protocol strings and array of strings
 
-#if defined(IRMP_ENABLE_PIN_CHANGE_INTERRUPT)
+#if defined(IRMP_ENABLE_PIN_CHANGE_INTERRUPT) || defined(IRMP_ENABLE_HYBRID_TIMER_MODE)
 #include "irmpPinChangeInterrupt.hpp"
-#endif // defined(IRMP_ENABLE_PIN_CHANGE_INTERRUPT)
+#endif // defined(IRMP_ENABLE_PIN_CHANGE_INTERRUPT) || defined(IRMP_ENABLE_HYBRID_TIMER_MODE)
 
 #if defined(IRMP_IRSND_ALLOW_DYNAMIC_PINS)
 uint_fast8_t irmp_InputPin; // global variable to hold input pin number. Is referenced by defining IRMP_INPUT_PIN as irmp_InputPin.
@@ -50,6 +50,9 @@ void irmp_init(uint_fast8_t aIrmpInputPin, uint_fast8_t aFeedbackLedPin, bool aI
     enablePCIInterrupt();
 #  else
     initIRTimerForReceive();
+#    if defined(IRMP_ENABLE_HYBRID_TIMER_MODE)
+    enablePCIInterrupt(); // restarts the timer at the first edge after it was stopped, see irmp_PCI_ISR()
+#    endif
 #  endif
 #  if defined(IRMP_MEASURE_TIMING)
     pinModeFast(IR_TIMING_TEST_PIN, OUTPUT);
@@ -99,6 +102,9 @@ void irmp_init(void)
     enablePCIInterrupt();
 #  else
     initIRTimerForReceive();
+#    if defined(IRMP_ENABLE_HYBRID_TIMER_MODE)
+    enablePCIInterrupt(); // restarts the timer at the first edge after it was stopped, see irmp_PCI_ISR()
+#    endif
 #  endif
 #  if defined(IRMP_MEASURE_TIMING)
     pinModeFast(IR_TIMING_TEST_PIN, OUTPUT);
@@ -131,9 +137,14 @@ void irmp_DoLEDFeedback(bool aSwitchLedOff)
 bool irmp_IsBusy()
 {
 #if defined(IRMP_ENABLE_PIN_CHANGE_INTERRUPT)
-    uint32_t tTicks = micros() - irmp_last_change_micros;
-    tTicks = (tTicks << 2) >> 8;
+    uint32_t tTicks = irmp_micros_to_ticks(micros() - irmp_last_change_micros);
     return (irmp_start_bit_detected || irmp_pulse_time || tTicks <= IRMP_KEY_REPETITION_LEN);
+#elif defined(IRMP_ENABLE_HYBRID_TIMER_MODE)
+    if (irmp_timer_stopped) {
+        // key_repetition_len is not counted while the timer is stopped
+        return (key_repetition_len + irmp_micros_to_ticks(micros() - irmp_last_change_micros) <= IRMP_KEY_REPETITION_LEN);
+    }
+    return (irmp_start_bit_detected || irmp_pulse_time || key_repetition_len <= IRMP_KEY_REPETITION_LEN);
 #else
     return (irmp_start_bit_detected || irmp_pulse_time || key_repetition_len <= IRMP_KEY_REPETITION_LEN);
 #endif
@@ -315,6 +326,9 @@ const uint8_t irmp_used_protocol_index[] PROGMEM =
 #if IRMP_SUPPORT_NEC_PROTOCOL == 1
     IRMP_ONKYO_PROTOCOL,
 #endif
+#if IRMP_ENABLE_HASH_DECODER == 1
+    IRMP_HASH_PROTOCOL,
+#endif
 #if IRMP_SUPPORT_RF_GEN24_PROTOCOL == 1
     RF_GEN24_PROTOCOL,
 #endif
@@ -502,6 +516,9 @@ const char * const irmp_used_protocol_names[] PROGMEM =
 #if IRMP_SUPPORT_NEC_PROTOCOL == 1
     proto_onkyo,
 #endif
+#if IRMP_ENABLE_HASH_DECODER == 1
+    proto_hash,
+#endif
 #if IRMP_SUPPORT_RF_GEN24_PROTOCOL == 1
     proto_rf_gen24,
 #endif
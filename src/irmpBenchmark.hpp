@@ -0,0 +1,214 @@
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ * irmpBenchmark.hpp - cost per call of irmp_ISR() and irsnd_ISR(), used by the benchmark mode of the analyzers
+ *
+ * Unix/Linux or Windows only:
+ *
+ *   ./irsnd -t 2>irsnd-benchmark.txt | ./irmp -t [max-p99]
+ *
+ * irsnd -t sends a frame of every protocol supported by irsnd, prints the scans to stdout and the cost of irsnd_ISR() to stderr.
+ * irmp -t replays the scans through irmp_ISR() and prints its cost for every protocol, i.e. every '#' comment line of the scan.
+ * The cost is measured in CPU cycles (x86) or nanoseconds of the host, so compare numbers of the same host only.
+ *
+ * This file is part of IRMP https://github.com/IRMP-org/IRMP.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+
+#ifndef _IRMP_BENCHMARK_HPP_
+#define _IRMP_BENCHMARK_HPP_
+
+#if defined(_MSC_VER)
+#  include <intrin.h>
+#  define IRMP_BENCH_UNIT                       "cycles"
+#  define irmp_bench_now()                      ((uint64_t) __rdtsc ())
+#elif defined(__x86_64__) || defined(__i386__)
+#  include <x86intrin.h>
+#  define IRMP_BENCH_UNIT                       "cycles"
+#  define irmp_bench_now()                      ((uint64_t) __rdtsc ())
+#else
+#  include <time.h>
+#  define IRMP_BENCH_UNIT                       "ns"
+
+static uint64_t
+irmp_bench_now (void)
+{
+    struct timespec ts;
+
+    clock_gettime (CLOCK_MONOTONIC, &ts);
+    return (uint64_t) ts.tv_sec * 1000000000 + ts.tv_nsec;
+}
+#endif
+
+#define IRMP_BENCH_NAME_LEN                     24                      // max. length of a protocol name in the output
+
+typedef struct
+{
+    char                name[IRMP_BENCH_NAME_LEN + 1];                  // name of protocol, e.g. comment of scan
+    uint32_t *          samples;                                        // cost of every tick
+    size_t              n_samples;
+    size_t              size;                                           // allocated number of samples
+    uint64_t            sum;                                            // sum of all samples
+    uint64_t            frame_sum;                                      // cost of current frame
+    uint64_t            frame_total;                                    // cost of all frames
+    uint64_t            frame_max;                                      // cost of most expensive frame
+    uint32_t            frames;                                         // number of frames
+} IRMP_BENCH;
+
+static uint32_t         irmp_bench_overhead;                            // cost of irmp_bench_now() itself
+
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ *  Measure the cost of reading the counter, it is subtracted from every sample
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+static void
+irmp_bench_calibrate (void)
+{
+    uint64_t    start;
+    uint64_t    cost;
+    int         i;
+
+    irmp_bench_overhead = 0xFFFFFFFF;
+
+    for (i = 0; i < 10000; i++)
+    {
+        start = irmp_bench_now ();
+        cost = irmp_bench_now () - start;
+
+        if (cost < irmp_bench_overhead)
+        {
+            irmp_bench_overhead = cost;
+        }
+    }
+}
+
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ *  Start statistics of next protocol
+ *  @param    name of protocol
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+static void
+irmp_bench_start (IRMP_BENCH * b, const char * name)
+{
+    uint32_t *  samples = b->samples;
+    size_t      size    = b->size;
+
+    memset (b, 0, sizeof (IRMP_BENCH));
+    b->samples  = samples;                                              // keep buffer for next protocol
+    b->size     = size;
+
+    strncpy (b->name, name, IRMP_BENCH_NAME_LEN);
+}
+
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ *  Add cost of one tick
+ *  @param    start: counter before call of ISR, see irmp_bench_now()
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+static void
+irmp_bench_add (IRMP_BENCH * b, uint64_t start)
+{
+    uint64_t    cost = irmp_bench_now () - start;
+
+    cost = (cost > irmp_bench_overhead) ? cost - irmp_bench_overhead : 0;
+
+    if (cost > 0xFFFFFFFF)
+    {
+        cost = 0xFFFFFFFF;
+    }
+
+    if (b->n_samples == b->size)
+    {
+        b->size     = b->size ? 2 * b->size : 65536;
+        b->samples  = (uint32_t *) realloc (b->samples, b->size * sizeof (uint32_t));
+
+        if (! b->samples)
+        {
+            fprintf (stderr, "benchmark: out of memory\n");
+            exit (1);
+        }
+    }
+
+    b->samples[b->n_samples++] = cost;
+    b->sum          += cost;
+    b->frame_sum    += cost;
+}
+
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ *  Finish a frame, e.g. a line of a scan
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+static void
+irmp_bench_end_frame (IRMP_BENCH * b)
+{
+    if (b->frame_sum)
+    {
+        b->frames++;
+        b->frame_total += b->frame_sum;
+
+        if (b->frame_sum > b->frame_max)
+        {
+            b->frame_max = b->frame_sum;
+        }
+        b->frame_sum = 0;
+    }
+}
+
+static int
+irmp_bench_compare (const void * a, const void * b)
+{
+    uint32_t    x = *(const uint32_t *) a;
+    uint32_t    y = *(const uint32_t *) b;
+
+    return (x > y) - (x < y);
+}
+
+static void
+irmp_bench_print_header (FILE * fp)
+{
+    fprintf (fp, "%-*s %8s %7s %7s %7s %7s %6s %7s %11s %11s   (%s per tick/frame)\n",
+             IRMP_BENCH_NAME_LEN, "protocol", "ticks", "min", "mean", "p99", "max", "frames", "decoded", "frame mean", "frame max", IRMP_BENCH_UNIT);
+}
+
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ *  Print statistics of a protocol
+ *  @param    decoded: number of decoded frames, -1 if unknown
+ *  @return   99th percentile of the cost per tick
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+static uint32_t
+irmp_bench_print (FILE * fp, IRMP_BENCH * b, int decoded)
+{
+    uint32_t    p99;
+    char        decoded_buf[16];
+
+    irmp_bench_end_frame (b);
+
+    if (! b->n_samples)
+    {
+        return 0;
+    }
+
+    qsort (b->samples, b->n_samples, sizeof (uint32_t), irmp_bench_compare);
+    p99 = b->samples[b->n_samples - 1 - b->n_samples / 100];
+
+    if (decoded >= 0)
+    {
+        snprintf (decoded_buf, sizeof (decoded_buf), "%d", decoded);
+    }
+    else
+    {
+        strcpy (decoded_buf, "-");
+    }
+
+    fprintf (fp, "%-*s %8zu %7u %7.1f %7u %7u %6u %7s %11.0f %11llu\n",
+             IRMP_BENCH_NAME_LEN, b->name, b->n_samples, (unsigned int) b->samples[0], (double) b->sum / b->n_samples, (unsigned int) p99,
+             (unsigned int) b->samples[b->n_samples - 1], (unsigned int) b->frames, decoded_buf,
+             b->frames ? (double) b->frame_total / b->frames : 0.0, (unsigned long long) b->frame_max);
+    return p99;
+}
+
+#endif // _IRMP_BENCHMARK_HPP_
@@ -35,134 +35,131 @@ void irmp_debug_print(const __FlashStringHelper *aMessage, bool aDoShortOutput =
 void irmp_debug_print(const char *aMessage, bool aDoShortOutput);
 #  endif
 
-uint32_t irmp_last_change_micros; // microseconds of last Pin Change Interrupt. Used for irmp_IsBusy().
+uint32_t irmp_last_change_micros; // microseconds of last Pin Change Interrupt, or of stop of timer in hybrid mode. Used for irmp_IsBusy().
+
+#if defined(IRMP_ENABLE_HYBRID_TIMER_MODE)
+#  if IRMP_USE_IDLE_FAST_PATH == 0
+#error "IRMP_ENABLE_HYBRID_TIMER_MODE needs the idle state of irmp_ISR(), which is not available with IRMP_LOGGING or IRMP_ENABLE_HASH_DECODER."
+#  endif
+volatile bool irmp_timer_stopped; // true: timer interrupt is disabled until next edge
+
+/*
+ * Called by the timer ISR after irmp_ISR().
+ * Stops the timer if irmp_ISR() has nothing to do but counting idle ticks, i.e. the frame is complete, irmp_get_data() has fetched it
+ * and the release timeout has passed. The idle ticks are fed by irmp_PCI_ISR() at the next edge.
+ */
+#if defined(ESP8266) || defined(ESP32)
+void IRAM_ATTR irmp_stop_timer_if_idle(void)
+#else
+void irmp_stop_timer_if_idle(void)
+#endif
+{
+    if (irmp_steady_idle) {
+        disableIRTimerInterrupt();
+        irmp_last_change_micros = micros();
+        irmp_timer_stopped = true;
+
+        uint_fast8_t tInput = input(IRMP_PIN);
+        if (tInput == IRMP_HIGH_ACTIVE) {
+            irmp_PCI_ISR(); // the pulse started after the last sample, but before irmp_timer_stopped was set -> restart at once
+        }
+    }
+}
+
+/*
+ * Pin change interrupt of hybrid mode. Restarts the timer at the first edge after it was stopped, later edges are ignored.
+ * The ticks since the stop are fed as idle ticks, so key_repetition_len etc. have the same values as if the timer had run.
+ * The first pulse is counted by the timer from its next tick on, as it would be by polling.
+ */
+#if defined(ESP8266) || defined(ESP32)
+void IRAM_ATTR irmp_PCI_ISR(void)
+#else
+void irmp_PCI_ISR(void)
+#endif
+{
+    if (irmp_timer_stopped) {
+        irmp_timer_stopped = false;
+        (void) irmp_feed_duration(! IRMP_HIGH_ACTIVE, irmp_micros_to_ticks(micros() - irmp_last_change_micros)); // inactive level
+        enableIRTimerInterrupt();
+    }
+}
+
+#else // defined(IRMP_ENABLE_HYBRID_TIMER_MODE)
+uint32_t irmp_ticks_fed_ahead; // inactive ticks already fed by irmp_PCI_ISR() to complete the last frame
+
 /*
  * Wrapper for irmp_ISR() in order to run it with Pin Change Interrupts.
  * Needs additional 8-9us per call and 13us for signal going inactive and 19us for going active.
  * Tested for NEC, Kaseiko, Denon, RC6, Samsung and others.
  * Requires micros() for timing.
+ *
+ * Without a timer, the pause after the last bit of a frame is only seen at the next edge. So if the decoder waits only
+ * for this pause, it is fed at once, and subtracted from the time fed at the next edge.
+ * Frames which are ended by a timeout instead, e.g. NEC while NEC42 is enabled, are completed at the next edge.
  */
-//#define PCI_DEBUG
 #if defined(ESP8266) || defined(ESP32)
 void IRAM_ATTR irmp_PCI_ISR(void)
 #else
 void irmp_PCI_ISR(void)
 #endif
 {
-
-    // save IR input level - negative logic, true means inactive / IR pause
+    // save IR input level
     uint_fast8_t irmp_input = input(IRMP_PIN);
 
     /*
-     * 1. compute ticks after last change
+     * 1. compute ticks after last change, without the ticks already fed
      */
     uint32_t tMicros = micros();
-    uint32_t tTicks = tMicros - irmp_last_change_micros; // values up to 10000
+    uint32_t tTicks = irmp_micros_to_ticks(tMicros - irmp_last_change_micros);
     irmp_last_change_micros = tMicros;
-#if (F_INTERRUPTS == 15625)
-    // F_INTERRUPTS value of 31250 does not work (maybe 8 bit overflow?)
-    tTicks = (tTicks << 2) >> 8;// saves 1.3 us
-#else
-#error F_INTERRUPTS must be 15625 (to avoid a time consuming division)
-#endif
 
-    if (tTicks != 0) {
-        tTicks -= 1; // adjust for irmp_pulse_time / irmp_pause_time incremented in irmp_ISR()
+    if (tTicks > irmp_ticks_fed_ahead) {
+        tTicks -= irmp_ticks_fed_ahead + 1; // the first tick of the new level is processed by irmp_ISR() below
+    } else {
+        tTicks = 0;
     }
+    irmp_ticks_fed_ahead = 0;
 
     /*
-     * 2. check for input level and tweak timings
+     * 2. feed the remaining ticks of the previous level, which is the opposite of the current one
      */
-    if (irmp_input) // true means inactive / IR pause
-    {
-        // start of pause -> just set pulse width
-        irmp_pulse_time += tTicks;
-    } else {
-        if (irmp_start_bit_detected) {
-            irmp_pause_time += tTicks;
-        } else { // start pulse here -> set pause or time between repetitions
-            if (tTicks > UINT16_MAX) {
-                // avoid overflow for 16 bit key_repetition_len
-                tTicks = UINT16_MAX;
-            }
-            key_repetition_len = tTicks;
-        }
-    }
+    irmp_feed_duration(!irmp_input, tTicks);
 
     /*
      * 3. call the protocol detection routine
      */
-    irmp_ISR();
+    bool tFrameReady = irmp_ISR(); // irmp_ir_detected is always false if IRMP_FRAME_QUEUE_SIZE > 0, so use the return value
 
-    if (!irmp_ir_detected && irmp_input) {
+    if (!tFrameReady && irmp_input != IRMP_HIGH_ACTIVE && irmp_start_bit_detected) {
         /*
-         * No valid protocol detected and IR input is inactive now -> simulate end for protocols.
-         * IRMP may be waiting for stop bit, but detects it only at the next call, so do one additional call.
-         * !!! ATTENTION !!! This will NOT work if we try to receive simultaneously two protocols which are only different in length like NEC16 and NEC42
+         * 4. IR input is inactive now. If all bits are received, the decoder only waits for the pause after the stop bit
+         * or after the last Manchester bit, so feed it now.
          */
-#if defined(PCI_DEBUG)
-        Serial.write('x');
-        if (irmp_bit > 0 && irmp_bit == irmp_param.complete_len)
-        {
-            Serial.println(irmp_start_bit_detected); // print start bit if complete_len is reached
-        }
-#endif
-        if (irmp_start_bit_detected && irmp_bit == irmp_param.complete_len && irmp_param.stop_bit == TRUE) {
-            // Try to detect a nec repeat irmp_bit is 0
-#if defined(PCI_DEBUG)
-            irmp_debug_print(F("R"));
-#endif
-            PAUSE_LEN irmp_pause_time_store = irmp_pause_time;
-            irmp_pause_time = STOP_BIT_PAUSE_LEN_MIN + 1; // set pause time to minimal pause required to detect a stop bit
-            irmp_ISR(); // Call to detect a NEC repeat
-#if defined(PCI_DEBUG)
-            irmp_debug_print(F("E")); // print info after call
-            Serial.println();
-#endif
-            if (irmp_ir_detected) {
-                // no protocol detected -> restore irmp_pause_time. Not sure if this is really required.
-                irmp_pause_time = irmp_pause_time_store;
+        uint32_t tPauseTicks = 0;
+
+        if (irmp_bit == irmp_param.complete_len) {
+            tPauseTicks = STOP_BIT_PAUSE_LEN_MIN + 2;
+#if (IRMP_SUPPORT_MANCHESTER == 1)
+            if (irmp_param.flags & IRMP_PARAM_FLAG_IS_MANCHESTER) {
+                tPauseTicks = 2 * irmp_param.pause_1_len_max + 2;
             }
+        } else if ((irmp_param.flags & IRMP_PARAM_FLAG_IS_MANCHESTER)
+                && ((irmp_bit == irmp_param.complete_len - 1 && tTicks < irmp_param.pause_1_len_max)
+                        || (irmp_bit == irmp_param.complete_len - 2 && tTicks > irmp_param.pause_1_len_max))) {
+            tPauseTicks = 2 * irmp_param.pause_1_len_max + 2; // last bit is written after a long pause
+#endif
         }
 
-        // For condition see also line 4203 and 5098 in irmp.hpp
-        if (irmp_start_bit_detected && irmp_bit > 0 && irmp_bit == irmp_param.complete_len) {
-            // Complete length of bit now received -> try to detect end of protocol
+        if (tPauseTicks) {
 #if defined(PCI_DEBUG)
-            irmp_debug_print(F("S")); // print info before call
+            Serial.write('E');
 #endif
-            PAUSE_LEN irmp_pause_time_store = irmp_pause_time;
-            irmp_pause_time = STOP_BIT_PAUSE_LEN_MIN + 1; // set pause time to minimal pause required to detect a stop bit
-            irmp_ISR(); // Call to detect end of protocol, irmp_param.stop_bit (printed as Sb) should be set to 0 if stop bit was successfully detected.
-#if defined(PCI_DEBUG)
-            irmp_debug_print(F("E")); // print info after call
-            Serial.println();
-#endif
-            if (irmp_ir_detected) {
-                // no protocol detected -> restore irmp_pause_time. Not sure if this is really required.
-                irmp_pause_time = irmp_pause_time_store;
-            }
+            // irmp_feed_duration() returns as soon as the frame is complete
+            irmp_ticks_fed_ahead = tPauseTicks - irmp_feed_duration(irmp_input, tPauseTicks);
         }
-
-#if (IRMP_SUPPORT_MANCHESTER == 1)
-    /*
-     * Simulate end for Manchester/biphase protocols - 130 bytes
-     */
-    if (((irmp_bit == irmp_param.complete_len - 1 && tTicks < irmp_param.pause_1_len_max)
-                    || (irmp_bit == irmp_param.complete_len - 2 && tTicks > irmp_param.pause_1_len_max))
-            && (irmp_param.flags & IRMP_PARAM_FLAG_IS_MANCHESTER) && irmp_start_bit_detected)
-    {
-#  if defined(PCI_DEBUG)
-    Serial.println('M'); // Try to detect a Manchester end of protocol
-#  endif
-    irmp_pause_time = 2 * irmp_param.pause_1_len_max;
-        irmp_ISR();        // Write last one (with value 0) or 2 (with last value 1) data bits and set wait for dummy stop bit
-        irmp_ISR();// process dummy stop bit
-        irmp_ISR();// reset stop bit and call callback
-    }
-#endif
     }
 }
+#endif // defined(IRMP_ENABLE_HYBRID_TIMER_MODE)
 
 void enablePCIInterrupt() {
 #if defined(__AVR_ATtiny1616__)  || defined(__AVR_ATtiny3216__) || defined(__AVR_ATtiny3217__)
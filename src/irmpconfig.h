@@ -293,6 +293,26 @@
 #  define IRMP_EXT_LOGGING                      0                       // 1: use external logging, 0: do not. default is 0
 #endif
 
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ * Set IRMP_LOGGING_RLE to 1 if the logged IR signal should be written in the binary RLE scan format instead of '0'/'1' characters
+ * A frame then costs a few bytes per bit instead of one byte per interrupt. See irmp.hpp for the format, the analyzer reads both.
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+#if !defined(IRMP_LOGGING_RLE)
+#  define IRMP_LOGGING_RLE                      0                       // 1: log in binary RLE format, 0: log '0'/'1' characters. default is 0
+#endif
+
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ * Set IRMP_LOGGING_BUFFER_SIZE to the size of a log buffer in bytes if the ISR should not write the log to the UART
+ * Without buffer, the ISR waits for the UART at the end of every frame, which blocks it for a long time.
+ * With buffer, the ISR only stores the durations of up to 4 frames, call irmp_log_flush() in the main loop to write them to the UART.
+ * A frame needs one byte per pulse or pause, or three bytes if it is longer than 254 interrupts. Frames which do not fit are dropped.
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+#if !defined(IRMP_LOGGING_BUFFER_SIZE)
+#  define IRMP_LOGGING_BUFFER_SIZE              0                       // size of log buffer, 0: ISR writes log to UART. default is 0
+#endif
+
 /*---------------------------------------------------------------------------------------------------------------------------------------------------
  * Set IRMP_PROTOCOL_NAMES to 1 if want to access protocol names (for logging etc), costs ~300 bytes RAM!
  *---------------------------------------------------------------------------------------------------------------------------------------------------
@@ -336,6 +356,219 @@
 #  define JITTER_COMPENSATION                   3                       // percent, increase for remote controls with big jitter
 #endif
 
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ * Keep decoder state in a context struct instead of static variables
+ *
+ * If 1, all decoder state is held in an IRMP_CONTEXT. irmp_ISR_ctx() and irmp_get_data_ctx() then drive as many
+ * independent decoders as you like, e.g. one per receiver channel. irmp_ISR() and irmp_get_data() work on a default context.
+ * Costs one pointer indirection per state access, so leave it at 0 on small 8 bit targets.
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+#if !defined(IRMP_ENABLE_CONTEXT)
+#  if defined(UNIX_OR_WINDOWS)
+#    define IRMP_ENABLE_CONTEXT                 1                       // analyzer batch mode runs one decoder context per thread
+#  else
+#    define IRMP_ENABLE_CONTEXT                 0                       // 1: use decoder contexts. 0: do not. default is 0
+#  endif
+#endif
+
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ * Feed the decoder with durations of marks and spaces instead of calling irmp_ISR() with F_INTERRUPTS
+ *
+ * If 1, irmp_feed_duration(level, ticks) advances the decoder by a whole mark or space. Call it on every edge of the input signal,
+ * e.g. from a pin change interrupt or with timestamps of a capture unit. irmp_micros_to_ticks() converts microseconds to ticks.
+ * irmp_ISR() can still be used.
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+#if !defined(IRMP_ENABLE_FEED_DURATION)
+#  if defined(UNIX_OR_WINDOWS)
+#    define IRMP_ENABLE_FEED_DURATION           1                       // analyzer decodes binary RLE scans with irmp_feed_duration()
+#  else
+#    define IRMP_ENABLE_FEED_DURATION           0                       // 1: provide irmp_feed_duration(). 0: do not. default is 0
+#  endif
+#endif
+
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ * Queue decoded frames between irmp_ISR() and irmp_get_data()
+ *
+ * Without queue, irmp_ISR() stops decoding until irmp_get_data() has fetched the last frame, so frames get lost while the
+ * application is busy. With queue, irmp_ISR() stores every frame with the tick count of its end and continues decoding.
+ * irmp_get_data_timestamp() returns the tick count too, irmp_get_queue_overflows() the number of frames lost because the queue was full.
+ * Costs about 8 bytes RAM per entry.
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+#if !defined(IRMP_FRAME_QUEUE_SIZE)
+#  define IRMP_FRAME_QUEUE_SIZE                 0                       // 0: no queue, 2, 4, 8 ... 128: number of queued frames. default is 0
+#endif
+
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ * Frame timestamps
+ *
+ * irmp_get_data_ex() returns IRMP_DATA_EX: the frame plus the tick count at begin of start bit, the tick count at end of frame
+ * and the gap to the end of the previous frame. irmp_get_ticks() returns the current tick count, so the application can
+ * compute its own latency. One tick is 1 / F_INTERRUPTS. IRMP_DATA itself stays unchanged.
+ * Costs about 20 bytes RAM, 8 more per queue entry.
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+#if !defined(IRMP_ENABLE_DATA_EX)
+#  define IRMP_ENABLE_DATA_EX                   0                       // 1: provide irmp_get_data_ex(). 0: do not. default is 0
+#endif
+
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ * Start bit candidates
+ *
+ * Some protocols share their start bit timings, so irmp_ISR() follows only the first protocol matching the start bit and
+ * irmp.h disables the conflicting ones. With candidates, irmp_ISR() records the pulses and pauses of the frame. If the
+ * frame fails for the first protocol, it is replayed for the next protocol matching the start bit, and so on.
+ * Then most of the conflicting protocols can be enabled at the same time (see irmp.h).
+ * A candidate which would end before the recorded frame is rejected, but a single FAN frame ending with a 0 bit looks exactly
+ * like a NUBERT frame, so FAN stays disabled if NUBERT is enabled.
+ * The replay runs within one call of irmp_ISR() and needs irmp_feed_duration() (IRMP_ENABLE_FEED_DURATION), so use it on fast CPUs only.
+ * Every recorded pulse or pause costs about 2 edge ticks of irmp_ISR(), the rest is skipped. So in the worst case this call costs
+ * IRMP_CANDIDATE_MAX_REPLAYS * (IRMP_CANDIDATE_BUFFER_LEN + 1) * 2 edge ticks, about 1500 with the defaults. Option -t of the
+ * analyzer shows the real costs on the host as max. cycles per tick.
+ * Costs IRMP_CANDIDATE_BUFFER_LEN + about 10 bytes RAM.
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+#if !defined(IRMP_ENABLE_CANDIDATES)
+#  define IRMP_ENABLE_CANDIDATES                0                       // 1: try all protocols matching a start bit. 0: only the first one. default is 0
+#endif
+
+#if !defined(IRMP_CANDIDATE_BUFFER_LEN)
+#  define IRMP_CANDIDATE_BUFFER_LEN             192                     // max. number of pulses and pauses of a replayed frame, max. 255
+#endif
+
+#if !defined(IRMP_CANDIDATE_MAX_REPLAYS)
+#  define IRMP_CANDIDATE_MAX_REPLAYS            4                       // max. number of candidates tried after the first one
+#endif
+
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ * Raw frame capture
+ *
+ * If > 0, irmp_ISR() records the lengths of the pulses and pauses of every frame in ticks, decoded or not, e.g. for learning
+ * remote controls or for decoding protocols which are not enabled. A frame ends with a pause longer than IRMP_TIMEOUT_TIME.
+ * irmp_get_raw_frame() returns the last complete frame without copying it: irmp_ISR() records into one of two buffers
+ * while the application reads the other one. Entries are 8 bit, longer pulses and pauses are stored as 255 (17 ms at 15 kHz),
+ * with IRMP_RAW_CAPTURE_16_BIT they are 16 bit.
+ * Costs 2 * IRMP_RAW_CAPTURE_LEN entries + about 10 bytes RAM.
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+#if !defined(IRMP_RAW_CAPTURE_LEN)
+#  define IRMP_RAW_CAPTURE_LEN                  0                       // 0: no capture, else max. number of pulses and pauses of a frame. default is 0
+#endif
+
+#if !defined(IRMP_RAW_CAPTURE_16_BIT)
+#  define IRMP_RAW_CAPTURE_16_BIT               0                       // 1: 16 bit entries. 0: 8 bit entries. default is 0
+#endif
+
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ * Hash decoder for unknown protocols
+ *
+ * If 1, a frame which no enabled protocol decodes is returned as IRMP_HASH_PROTOCOL with a 32 bit hash in address (upper
+ * 16 bits) and command (lower 16 bits), so that remote controls with unsupported protocols can be used, too.
+ * Every pulse is compared with the previous pulse and every pause with the previous pause: shorter, about equal or longer.
+ * The hash of these results does not depend on the exact timing, but it is not a real address and command.
+ * Same hash shortly after the last one sets IRMP_FLAG_REPETITION. The hash is computed edge by edge, costs about 25 bytes RAM.
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+#if !defined(IRMP_ENABLE_HASH_DECODER)
+#  define IRMP_ENABLE_HASH_DECODER              0                       // 1: return unknown frames as hash. 0: do not. default is 0
+#endif
+
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ * Multi receiver
+ *
+ * Up to 8 receivers on one port, e.g. in different rooms. Call irmp_init_multi() once and irmp_ISR_multi() F_INTERRUPTS times
+ * per second with the port value, bit n is the receiver of channel n. irmp_get_data_multi() returns the frames with their channel.
+ * Each channel has its own decoder context, but a channel only runs its decoder on edges and when a timeout is due,
+ * so idle ticks cost about the same as for one receiver. Needs IRMP_ENABLE_CONTEXT and IRMP_ENABLE_FEED_DURATION.
+ * Costs one IRMP_CONTEXT + 4 bytes RAM per channel.
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+#if !defined(IRMP_MULTI_RECEIVER_CHANNELS)
+#  define IRMP_MULTI_RECEIVER_CHANNELS          0                       // 0: off, 1 ... 8: number of receivers on one port. default is 0
+#endif
+
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ * Combine the frames of the multi receiver channels
+ *
+ * If several receivers see the same remote, each keypress is decoded by several channels. With IRMP_MULTI_COMBINE_TIME > 0,
+ * the first frame opens a window of this time. At its end, irmp_get_data_combined() returns the frame decoded by most channels
+ * once, together with the bit mask of these channels. So a frame corrupted on one channel is outvoted by the others,
+ * and a frame missed by one channel is still returned. The window adds its time to the latency. irmp_get_data_multi() is not available then.
+ * With IRMP_MULTI_RECOVER, one more decoder gets the merged signal of all channels, a pulse on any channel is a pulse there.
+ * So a frame which is corrupted on every channel, because each receiver misses some pulses, can be recovered from the merged
+ * signal. It is only returned if no channel decoded a frame within the window, its bit mask holds the channels with edges.
+ * Costs one more IRMP_CONTEXT.
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+#if !defined(IRMP_MULTI_COMBINE_TIME)
+#  define IRMP_MULTI_COMBINE_TIME               0                       // 0: off, else window in ms, e.g. 10. default is 0
+#endif
+
+#if !defined(IRMP_MULTI_RECOVER)
+#  define IRMP_MULTI_RECOVER                    1                       // 1: decode merged signal of all channels, 0: do not. default is 1
+#endif
+
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ * Runtime protocol mask
+ *
+ * One firmware with many protocols enabled above can be restricted at runtime to the protocols really used at a site:
+ * irmp_set_protocol_mask (IRMP_PROTOCOL_BIT (IRMP_NEC_PROTOCOL) | IRMP_PROTOCOL_BIT (IRMP_RC5_PROTOCOL)).
+ * The start bit checks of disabled protocols are skipped, so they cost no ISR time and cannot catch frames of other protocols.
+ * Protocols which share a start bit, e.g. NEC and APPLE, are checked once more when the frame is returned.
+ * All protocols are enabled after reset. The mask applies to all contexts. Costs 8 bytes per start bit check in flash.
+ * irmp_set_protocol_mask() writes the mask with interrupts disabled on AVR, ARM Cortex-M and Arduino. For other targets,
+ * define IRMP_IRQ_STATE, IRMP_DISABLE_INTERRUPTS(state) and IRMP_RESTORE_INTERRUPTS(state), else disable the IR timer interrupt
+ * while calling it.
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+#if !defined(IRMP_ENABLE_PROTOCOL_MASK)
+#  define IRMP_ENABLE_PROTOCOL_MASK             0                       // 1: irmp_set_protocol_mask() available. 0: not. default is 0
+#endif
+
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ * Symbol table for data bits
+ *
+ * Pulse distance and pulse width protocols check the pulse and pause of each data bit against the four timing ranges of the protocol.
+ * With IRMP_SYMBOL_LUT_LEN > 0, irmp_ISR() fills a table from these ranges when the start bit is accepted, then a data bit costs two
+ * table loads, the same for all these protocols. Pulses and pauses with IRMP_SYMBOL_LUT_LEN ticks or more are still compared.
+ * 64 covers the data bits of most protocols at 15000 interrupts/sec. Filling costs about 2 * IRMP_SYMBOL_LUT_LEN cycles once per frame.
+ * Costs IRMP_SYMBOL_LUT_LEN bytes RAM, per context with IRMP_ENABLE_CONTEXT.
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+#if !defined(IRMP_SYMBOL_LUT_LEN)
+#  define IRMP_SYMBOL_LUT_LEN                   0                       // 0: off, else number of entries, max. 256, e.g. 64. default is 0
+#endif
+
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ * Frame buffer
+ *
+ * With IRMP_FRAME_BITS 64 or 128, irmp_ISR() also stores the data bits of each frame in a buffer, in the order received.
+ * irmp_get_frame() returns the buffer of the frame last returned by irmp_get_data(), so the complete payload of long
+ * air condition frames is available, e.g. GREE, LGAIR, MITSU_HEAVY and ACP24.
+ * The bits of LGAIR and MELINERA are taken from the buffer once per frame instead of being collected bit by bit.
+ * With 128, ACP24 and MITSU_HEAVY no longer squeeze their frames bit by bit in irmp_ISR(), irmp_get_data() extracts address
+ * and command from the buffer. Costs 2 * IRMP_FRAME_BITS / 8 + 2 bytes RAM, and IRMP_FRAME_BITS / 8 + 2 per queue entry.
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+#if !defined(IRMP_FRAME_BITS)
+#  define IRMP_FRAME_BITS                       0                       // 0: off, 64 or 128: max. number of bits in buffer. default is 0
+#endif
+
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ * Constexpr tables, C++11 only
+ *
+ * The pulse and pause lengths of the protocols are computed from F_INTERRUPTS and truncated to 8 bits. If a length does not fit,
+ * e.g. the start bits of PENTAX or GREE above 17000 interrupts/sec on 8/16 bit CPUs, the protocol silently fails.
+ * With constexpr tables, the protocol parameter tables are computed at compile time and lengths which do not fit into their
+ * variables are compile errors. The generated code is the same.
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+#if !defined(IRMP_ENABLE_CONSTEXPR_TABLES)
+#  define IRMP_ENABLE_CONSTEXPR_TABLES          0                       // 1: check protocol tables at compile time (C++11). 0: do not. default is 0
+#endif
+
 /*---------------------------------------------------------------------------------------------------------------------------------------------------
  * Use ChibiOS Events to signal that valid IR data was received
  *---------------------------------------------------------------------------------------------------------------------------------------------------
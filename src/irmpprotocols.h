@@ -87,8 +87,9 @@
 #define IRMP_MELINERA_PROTOCOL                  60
 #define IRMP_RC6A20_PROTOCOL                    61              // RC6A20, e.g. Sky+
 #define IRMP_RC6A28_PROTOCOL                    62              // RC6A28, e.g. Sky Q (Sky+ Pro)
+#define IRMP_HASH_PROTOCOL                      63              // hash of a frame of an unknown protocol, see IRMP_ENABLE_HASH_DECODER
 
-#define IRMP_N_PROTOCOLS                        62              // number of supported protocols
+#define IRMP_N_PROTOCOLS                        63              // number of supported protocols
 
 #if defined(UNIX_OR_WINDOWS) || IRMP_PROTOCOL_NAMES == 1 || IRSND_PROTOCOL_NAMES == 1
 extern const char proto_unknown[]       PROGMEM;
@@ -155,6 +156,7 @@ extern const char proto_rf_medion[]     PROGMEM;
 extern const char proto_melinera[]      PROGMEM;
 extern const char proto_rc6a20[]        PROGMEM;
 extern const char proto_rc6a28[]        PROGMEM;
+extern const char proto_hash[]          PROGMEM;
 #endif
 
 /*---------------------------------------------------------------------------------------------------------------------------------------------------
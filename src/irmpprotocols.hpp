@@ -93,6 +93,7 @@ const char proto_rf_medion[]     PROGMEM = "RF_MEDION";
 const char proto_melinera[]      PROGMEM = "MELINERA";
 const char proto_rc6a20[]        PROGMEM = "RC6A20";
 const char proto_rc6a28[]        PROGMEM = "RC6A28";
+const char proto_hash[]          PROGMEM = "HASH";
 
 /*
  * Must be in the same order as the Protocol numbers in irmpprotocols.h starting with IRMP_UNKNOWN_PROTOCOL = 0
@@ -164,7 +165,8 @@ irmp_protocol_names[IRMP_N_PROTOCOLS + 1] PROGMEM =
 
     proto_melinera,
     proto_rc6a20,
-    proto_rc6a28
+    proto_rc6a28,
+    proto_hash
 };
 
 #endif // IRMP_PROTOCOLS_HPP
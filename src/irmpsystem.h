@@ -127,6 +127,11 @@
 #  define F_CPU 8000000L
 #  define ANALYZE
 #  include <stdint.h>
+#  if defined(unix) || defined(__APPLE__)                                            // analyzer maps binary RLE scans
+#    include <sys/mman.h>
+#    include <sys/stat.h>
+#    include <unistd.h>
+#  endif
 #  ifdef _MSC_VER
 #    define IRMP_PACKED_STRUCT
 #  endif
@@ -257,4 +262,16 @@ typedef struct IRMP_PACKED_STRUCT IRMP_DATA
     uint8_t                             flags;                                      // flags, e.g. repetition
 } IRMP_DATA;
 
+#define IRMP_PAYLOAD_BITS               128                                         // max. number of bits in IRMP_DATA_EX payload
+
+typedef struct IRMP_DATA_EX
+{
+    IRMP_DATA                           data;                                       // same as returned by irmp_get_data()
+    uint32_t                            start_ticks;                                // tick count at begin of start bit
+    uint32_t                            end_ticks;                                  // tick count at end of frame
+    uint32_t                            gap_ticks;                                  // ticks since end of previous frame, IRMP_GAP_UNKNOWN if none
+    uint8_t                             payload_len;                                // number of data bits in payload, 0 without IRMP_FRAME_BITS
+    uint8_t                             payload[IRMP_PAYLOAD_BITS / 8];             // data bits in the order received, 1st bit is MSB of payload[0]
+} IRMP_DATA_EX;
+
 #endif // _IRMPSYSTEM_H_
@@ -151,6 +151,10 @@
 #  define IRSND_SUPPORT_LEGO_PROTOCOL           0
 #endif
 
+#if IRSND_QUEUE_SIZE > 128 || (IRSND_QUEUE_SIZE & (IRSND_QUEUE_SIZE - 1)) != 0
+#  error IRSND_QUEUE_SIZE must be 0 or a power of 2, max. 128
+#endif
+
 #include "irmpprotocols.h"
 
 #define IRSND_NO_REPETITIONS                     0      // no repetitions
@@ -177,6 +181,33 @@ extern uint8_t                                  irsnd_ISR (void);
 #endif
 extern void                                     irsnd_stop (void);
 
+#if IRSND_QUEUE_SIZE > 0
+#  ifdef __cplusplus
+extern bool                                     irsnd_queue_data (IRMP_DATA *, uint16_t);
+#else
+extern uint8_t                                  irsnd_queue_data (IRMP_DATA *, uint16_t);
+#endif
+extern uint8_t                                  irsnd_get_queue_count (void);
+#endif // IRSND_QUEUE_SIZE > 0
+
+#if IRSND_USE_DATA_EX == 1
+#  ifdef __cplusplus
+extern bool                                     irsnd_send_data_ex (IRMP_DATA_EX *, uint8_t);
+#else
+extern uint8_t                                  irsnd_send_data_ex (IRMP_DATA_EX *, uint8_t);
+#endif
+#endif // IRSND_USE_DATA_EX == 1
+
+#if IRSND_USE_RAW_SEND == 1
+#  ifdef __cplusplus
+extern bool                                     irsnd_send_raw (const uint16_t *, uint16_t, uint16_t, uint8_t);
+extern bool                                     irsnd_send_raw_P (const uint16_t *, uint16_t, uint16_t, uint8_t);
+#else
+extern uint8_t                                  irsnd_send_raw (const uint16_t *, uint16_t, uint16_t, uint8_t);
+extern uint8_t                                  irsnd_send_raw_P (const uint16_t *, uint16_t, uint16_t, uint8_t);
+#endif
+#endif // IRSND_USE_RAW_SEND == 1
+
 #if IRSND_USE_CALLBACK == 1
 extern void                                     irsnd_set_callback_ptr (void (*cb)(uint8_t));
 #endif // IRSND_USE_CALLBACK == 1
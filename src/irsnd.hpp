@@ -28,6 +28,7 @@
 #endif
 
 #define IRMP_NEC_REPETITION_PROTOCOL                0xFF            // pseudo protocol: NEC repetition frame
+#define IRSND_RAW_PROTOCOL                          0xFE            // pseudo protocol: irsnd_send_raw()
 
 /*---------------------------------------------------------------------------------------------------------------------------------------------------
  *  ATtiny pin definition of OC0A / OC0B
@@ -580,6 +581,70 @@ static volatile uint8_t                         irsnd_repeat = 0;
 static volatile uint8_t                         irsnd_suppress_trailer = 0;
 // @formatter:on
 
+#if defined(ANALYZE)
+static char *                                   irsnd_bench_buf;        // benchmark mode: output of irsnd_ISR(), see main()
+static size_t                                   irsnd_bench_len;
+#  define IRSND_ANALYZE_PUTCHAR(c)              { if (irsnd_bench_buf) { irsnd_bench_buf[irsnd_bench_len++] = (c); } else { putchar (c); } }
+#endif
+
+#if IRSND_USE_EDGE_LIST == 1
+#  define IRSND_EDGE_PULSE                      0x8000                  // flag of list entry: carrier on
+#  define IRSND_EDGE_MAX_TICKS                  0x7FFF                  // mask of list entry: duration in ticks
+static uint16_t                                 irsnd_edge_list[IRSND_EDGE_LIST_LEN];   // pulses and pauses, see irsnd_compile_edges()
+static uint16_t                                 irsnd_edge_len;
+static uint16_t                                 irsnd_edge_index;
+static uint16_t                                 irsnd_edge_counter;     // remaining ticks of current list entry
+static volatile uint8_t                         irsnd_edge_ready;       // list is complete, irsnd_ISR() may start
+static uint8_t                                  irsnd_edge_live;        // continue with irsnd_tick() after end of list
+static uint8_t                                  irsnd_edge_level;       // output of irsnd_tick()
+#  define IRSND_SWITCH_ON()                     irsnd_edge_level = TRUE
+#  define IRSND_SWITCH_OFF()                    irsnd_edge_level = FALSE
+static void                                     irsnd_compile_edges (uint16_t max_len);
+#else
+#  define IRSND_SWITCH_ON()                     irsnd_on ()
+#  define IRSND_SWITCH_OFF()                    irsnd_off ()
+#endif
+
+#if IRSND_QUEUE_SIZE > 0
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ *  Transmit queue
+ *  @details  ring buffer with one producer, irsnd_queue_data(), and one consumer, irsnd_ISR(). irsnd_queue_data() only writes
+ *            irsnd_queue_head, irsnd_ISR() only writes irsnd_queue_tail, so no locking is needed. Both indexes run freely,
+ *            the number of queued frames is (uint8_t) (irsnd_queue_head - irsnd_queue_tail).
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+typedef struct
+{
+    IRMP_DATA                                   data;                   // frame to send
+    uint32_t                                    pause_ticks;            // pause after end of previous frame
+} IRSND_QUEUE_ENTRY;
+
+static IRSND_QUEUE_ENTRY                        irsnd_queue[IRSND_QUEUE_SIZE];
+static volatile uint8_t                         irsnd_queue_head;       // index of next entry to write, changed by irsnd_queue_data() only
+static volatile uint8_t                         irsnd_queue_tail;       // index of next entry to send, changed by irsnd_ISR() only
+static volatile uint32_t                        irsnd_queue_pause_counter;  // remaining ticks of pause before next frame, 0: no pause
+
+#  if defined(__GNUC__)
+#    define IRSND_QUEUE_BARRIER()               __asm__ __volatile__ ("" ::: "memory")  // keep entry accesses on their side of the index update
+#  else
+#    define IRSND_QUEUE_BARRIER()
+#  endif
+#endif // IRSND_QUEUE_SIZE > 0
+
+#if IRSND_USE_RAW_SEND == 1
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ *  Raw send
+ *  @details  irsnd_send_raw() selects the internal protocol IRSND_RAW_PROTOCOL, irsnd_ISR() then reads one duration after
+ *            the other from the caller's buffer. Repetitions, edge list and transmit queue work as for all other protocols.
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+#  define IRSND_RAW_TICKS_FACTOR                ((uint32_t) ((F_INTERRUPTS * 65536.0) / 1000000 + 0.5))   // ticks per microsecond * 2^16
+static const uint16_t *                         irsnd_raw_durations;    // pulse, pause, pulse, ... in microseconds
+static uint16_t                                 irsnd_raw_len;          // number of durations
+static uint8_t                                  irsnd_raw_progmem;      // durations are stored in flash
+static IRSND_FREQ_TYPE                          irsnd_raw_freq;
+#endif // IRSND_USE_RAW_SEND == 1
+
 #if defined(ARDUINO)
 #include "irsndArduinoExt.hpp" // must be after the declarations of irsnd_busy etc.
 #else
@@ -1194,19 +1259,107 @@ static uint16_t bitsrevervse(uint16_t x, uint8_t len)
 static uint8_t  sircs_additional_bitlen;
 #endif // IRSND_SUPPORT_SIRCS_PROTOCOL == 1
 
-/**
- * @param  do_wait - true: Wait for last command to have ended sending its trailing space before start of new sending.
- *                   For Arduino: Additionally wait for sent command to have ended (including trailing gap).
- *                   false: Return directly and do sending in background.
- *                   Keep in mind not to send next frame in background before this frame and its trailing space has ended!
- * @return false if protocol was not found or do_wait was false and sending (of former frame and its trailing space) is still in progress.
+#if IRSND_USE_RAW_SEND == 1
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ *  Get duration of raw pulse or pause
+ *  @details  called by irsnd_ISR() once per pulse or pause, converts microseconds to interrupt ticks
+ *  @param    index of duration
+ *  @return   number of ticks, at least 1
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
  */
-#  ifdef __cplusplus
-bool
-#else
-uint8_t
-#endif
-irsnd_send_data(IRMP_DATA *irmp_data_p, uint8_t do_wait)
+static uint16_t
+irsnd_raw_get_ticks (uint16_t idx)
+{
+    uint16_t    us;
+    uint16_t    ticks;
+
+    if (irsnd_raw_progmem)
+    {
+        memcpy_P (&us, irsnd_raw_durations + idx, sizeof (us));
+    }
+    else
+    {
+        us = irsnd_raw_durations[idx];
+    }
+
+    ticks = (uint16_t) (((uint32_t) us * IRSND_RAW_TICKS_FACTOR + 0x8000) >> 16);
+    return ticks ? ticks : 1;
+}
+
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ *  Get carrier frequency of raw send
+ *  @param    carrier frequency in kHz
+ *  @return   nearest frequency supported by irsnd_set_freq()
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+static IRSND_FREQ_TYPE
+irsnd_raw_get_freq (uint16_t carrier_khz)
+{
+    if (carrier_khz >= 200)
+    {
+        return IRSND_FREQ_455_KHZ;
+    }
+    if (carrier_khz >= 48)
+    {
+        return IRSND_FREQ_56_KHZ;
+    }
+    if (carrier_khz >= 39)
+    {
+        return IRSND_FREQ_40_KHZ;
+    }
+    if (carrier_khz >= 37)
+    {
+        return IRSND_FREQ_38_KHZ;
+    }
+    if (carrier_khz >= 34)
+    {
+        return IRSND_FREQ_36_KHZ;
+    }
+    if (carrier_khz >= 31)
+    {
+        return IRSND_FREQ_32_KHZ;
+    }
+    return IRSND_FREQ_30_KHZ;
+}
+#endif // IRSND_USE_RAW_SEND == 1
+
+#if IRSND_USE_DATA_EX == 1
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ *  Get the payload length of a protocol
+ *  @details  only protocols whose frame is longer than address and command can be sent from a payload
+ *  @param    protocol
+ *  @return   number of data bits, 0 if the protocol has no payload
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+static uint8_t
+irsnd_get_payload_len (uint8_t protocol)
+{
+    switch (protocol)
+    {
+#  if IRSND_SUPPORT_LGAIR_PROTOCOL == 1
+        case IRMP_LGAIR_PROTOCOL:       return LGAIR_COMPLETE_DATA_LEN;
+#  endif
+#  if IRSND_SUPPORT_MITSU_HEAVY_PROTOCOL == 1
+        case IRMP_MITSU_HEAVY_PROTOCOL: return MITSU_HEAVY_COMPLETE_DATA_LEN;
+#  endif
+#  if IRSND_SUPPORT_ACP24_PROTOCOL == 1
+        case IRMP_ACP24_PROTOCOL:       return ACP24_COMPLETE_DATA_LEN;
+#  endif
+        default:                        return 0;
+    }
+}
+#endif // IRSND_USE_DATA_EX == 1
+
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ *  Initialize a frame for irsnd_ISR()
+ *  @details  called by irsnd_send_data() and by irsnd_ISR() for queued frames
+ *  @param    frame to send
+ *  @param    payload to send instead of address and command, 0 if none
+ *  @return   FALSE if protocol is not enabled
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+static uint8_t
+irsnd_start_frame (IRMP_DATA *irmp_data_p, const uint8_t *payload_p)
 {
 #if IRSND_SUPPORT_RECS80_PROTOCOL == 1
     static uint8_t  toggle_bit_recs80;
@@ -1229,19 +1382,6 @@ irsnd_send_data(IRMP_DATA *irmp_data_p, uint8_t do_wait)
     (void) address;
     (void) command;
 
-    if (do_wait)
-    {
-        while (irsnd_busy)
-        {
-            // wait for last command to have ended
-        }
-    }
-    else if (irsnd_busy)
-    {
-        // Here we do not want to wait, but sending is still in progress and we may overwrite current frame data if not returning here.
-        return (FALSE);
-    }
-
     irsnd_protocol = irmp_data_p->protocol;
     irsnd_repeat = irmp_data_p->flags & IRSND_REPETITION_MASK;
 #if !defined(ARDUINO) // never send a trailing space for Arduino
@@ -1892,6 +2032,51 @@ irsnd_send_data(IRMP_DATA *irmp_data_p, uint8_t do_wait)
         }
 // @formatter:on
     }
+#if IRSND_USE_DATA_EX == 1
+    if (payload_p)
+    {                                                                           // send the payload bits instead of the frame built above
+        uint8_t i;
+
+        for (i = 0; i < (irsnd_get_payload_len (irsnd_protocol) + 7) / 8; i++)
+        {
+            irsnd_buffer[i] = payload_p[i];
+        }
+    }
+#else
+    (void) payload_p;
+#endif
+    return TRUE;
+}
+
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ *  Send a frame
+ *  @details  common part of irsnd_send_data() and irsnd_send_data_ex()
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+static uint8_t
+irsnd_send_frame (IRMP_DATA *irmp_data_p, const uint8_t *payload_p, uint8_t do_wait)
+{
+    if (do_wait)
+    {
+        while (irsnd_busy)
+        {
+            // wait for last command to have ended
+        }
+    }
+    else if (irsnd_busy)
+    {
+        // Here we do not want to wait, but sending is still in progress and we may overwrite current frame data if not returning here.
+        return (FALSE);
+    }
+
+    if (! irsnd_start_frame (irmp_data_p, payload_p))
+    {
+        return (FALSE);                                                         // protocol not enabled
+    }
+
+#if IRSND_USE_EDGE_LIST == 1
+    irsnd_compile_edges (IRSND_EDGE_LIST_LEN);
+#endif
 #if defined(ARDUINO)
     storeIRTimer(); // store current timer state to enable alternately send and receive with the same timer
     initIRTimerForSend(); // Setup timer and interrupts for sending
@@ -1909,23 +2094,161 @@ irsnd_send_data(IRMP_DATA *irmp_data_p, uint8_t do_wait)
 #endif
 }
 
+/**
+ * @param  do_wait - true: Wait for last command to have ended sending its trailing space before start of new sending.
+ *                   For Arduino: Additionally wait for sent command to have ended (including trailing gap).
+ *                   false: Return directly and do sending in background.
+ *                   Keep in mind not to send next frame in background before this frame and its trailing space has ended!
+ * @return false if protocol was not found or do_wait was false and sending (of former frame and its trailing space) is still in progress.
+ */
+#  ifdef __cplusplus
+bool
+#else
+uint8_t
+#endif
+irsnd_send_data(IRMP_DATA *irmp_data_p, uint8_t do_wait)
+{
+    return irsnd_send_frame (irmp_data_p, 0, do_wait);
+}
+
+#if IRSND_USE_DATA_EX == 1
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ *  Send extended IRMP data
+ *  @details  sends the payload as received by irmp_get_data_ex(), e.g. the whole state of an air conditioner.
+ *            Supported are LGAIR, MITSU_HEAVY and ACP24. Without payload, address and command are sent as by irsnd_send_data().
+ *  @param    extended IRMP data
+ *  @param    do_wait, see irsnd_send_data()
+ *  @return   FALSE if the payload does not fit the protocol, else as irsnd_send_data()
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+#  ifdef __cplusplus
+bool
+#else
+uint8_t
+#endif
+irsnd_send_data_ex (IRMP_DATA_EX *irmp_data_ex_p, uint8_t do_wait)
+{
+    if (irmp_data_ex_p->payload_len == 0)
+    {
+        return irsnd_send_frame (&irmp_data_ex_p->data, 0, do_wait);
+    }
+
+    if (irmp_data_ex_p->payload_len != irsnd_get_payload_len (irmp_data_ex_p->data.protocol))
+    {
+        return (FALSE);                                                         // payload of another protocol or truncated by IRMP_FRAME_BITS
+    }
+
+    return irsnd_send_frame (&irmp_data_ex_p->data, irmp_data_ex_p->payload, do_wait);
+}
+#endif // IRSND_USE_DATA_EX == 1
+
 void irsnd_stop(void)
 {
     irsnd_repeat = 0;
 }
 
+#if IRSND_USE_RAW_SEND == 1
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ *  Start raw send
+ *  @details  called by irsnd_send_raw() and irsnd_send_raw_P()
+ *  @return   FALSE if sending is still in progress, a repeated sequence has no final pause or the carrier is not supported
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+static uint8_t
+irsnd_start_raw (const uint16_t *durations, uint16_t n, uint16_t carrier_khz, uint8_t repeats, uint8_t progmem)
+{
+    if (irsnd_busy || n == 0)
+    {
+        return (FALSE);
+    }
+
+    if ((n & 1) && repeats > 0)
+    {
+        return (FALSE);                                                         // repetition would follow the last pulse without pause
+    }
+
+#if defined(ARDUINO)
+    if (irsnd_raw_get_freq (carrier_khz) != irsnd_raw_get_freq (IRSND_IR_FREQUENCY / 1000))
+    {
+        return (FALSE);                                                         // Arduino always sends with IRSND_IR_FREQUENCY
+    }
+#endif
+
+    irsnd_raw_durations = durations;
+    irsnd_raw_len       = n;
+    irsnd_raw_progmem   = progmem;
+    irsnd_raw_freq      = irsnd_raw_get_freq (carrier_khz);
+    irsnd_protocol      = IRSND_RAW_PROTOCOL;
+    irsnd_repeat        = (repeats < IRSND_ENDLESS_REPETITION) ? repeats : IRSND_ENDLESS_REPETITION;
+#if !defined(ARDUINO) // never send a trailing space for Arduino
+    irsnd_suppress_trailer = TRUE;                                              // the pause after the frame is part of the durations
+#endif
+    irsnd_busy          = TRUE;
+
+#if IRSND_USE_EDGE_LIST == 1
+    irsnd_compile_edges (IRSND_EDGE_LIST_LEN);
+#endif
+#if defined(ARDUINO)
+    storeIRTimer(); // store current timer state to enable alternately send and receive with the same timer
+    initIRTimerForSend(); // Setup timer and interrupts for sending
+#endif
+    return TRUE;
+}
+
+/**
+ * Send an arbitrary sequence of pulses and pauses in the background
+ * @param  durations - pulse, pause, pulse, ... in microseconds, max. 65535. The last pause is sent before each repetition.
+ *                     The buffer is not copied, keep it unchanged until irsnd_is_busy() returns false.
+ * @param  n - number of durations, must be even if repeats is not 0
+ * @param  carrier_khz - carrier frequency in kHz, rounded to 30, 32, 36, 38, 40, 56 or 455 kHz.
+ *                       For Arduino it must be rounded to IRSND_IR_FREQUENCY, the only carrier generated there.
+ * @param  repeats - number of repetitions, 0 ... 14, 15 = endless until irsnd_stop()
+ * @return false if sending is still in progress, n is 0, n is odd with repeats or the carrier is not supported.
+ */
+#  ifdef __cplusplus
+bool
+#else
+uint8_t
+#endif
+irsnd_send_raw (const uint16_t *durations, uint16_t n, uint16_t carrier_khz, uint8_t repeats)
+{
+    return irsnd_start_raw (durations, n, carrier_khz, repeats, FALSE);
+}
+
+/**
+ * Same as irsnd_send_raw(), but durations are stored in flash (PROGMEM)
+ */
+#  ifdef __cplusplus
+bool
+#else
+uint8_t
+#endif
+irsnd_send_raw_P (const uint16_t *durations, uint16_t n, uint16_t carrier_khz, uint8_t repeats)
+{
+    return irsnd_start_raw (durations, n, carrier_khz, repeats, TRUE);
+}
+#endif // IRSND_USE_RAW_SEND == 1
+
 /*---------------------------------------------------------------------------------------------------------------------------------------------------
  *  ISR routine
  *  @details  ISR routine, called from 10000 to 20000, typically 15000 times per second
  *  If new frame starts, check for autorepeat gap, then check for trailing space gap, then initialize frame.
  *---------------------------------------------------------------------------------------------------------------------------------------------------
  */
+#if IRSND_USE_EDGE_LIST == 1
+static uint8_t
+irsnd_tick (void)                                                               // called by irsnd_compile_edges() and irsnd_ISR()
+#elif IRSND_QUEUE_SIZE > 0
+static uint8_t
+irsnd_frame_ISR (void)                                                          // called by irsnd_ISR()
+#else
 #  ifdef __cplusplus
 bool
 #else
 uint8_t
 #endif
 irsnd_ISR(void)
+#endif
 {
 // @formatter:off
 #if !defined(ARDUINO) // never send a trailing space for Arduino
@@ -1953,6 +2276,10 @@ irsnd_ISR(void)
     static uint16_t             packet_repeat_pause_counter     = 0;        // pause before repeat, uint16_t!
 #if IRSND_SUPPORT_BANG_OLUFSEN_PROTOCOL == 1
     static uint8_t              last_bit_value;
+#endif
+#if IRSND_USE_RAW_SEND == 1
+    static uint16_t             raw_index;                                  // index of next raw duration
+    static uint16_t             raw_counter;                                // remaining ticks of current raw pulse or pause
 #endif
     static uint8_t              pulse_len = 0xFF;
     static IRSND_PAUSE_LEN      pause_len = 0xFF;
@@ -2020,14 +2347,14 @@ irsnd_ISR(void)
                 }
                 else
                 {
-#if defined(ANALYZE)
+#if defined(ANALYZE) && IRSND_USE_EDGE_LIST == 0
                     if (irsnd_is_on)
                     {
-                        putchar('0');
+                        IRSND_ANALYZE_PUTCHAR ('0');
                     }
                     else
                     {
-                        putchar('1');
+                        IRSND_ANALYZE_PUTCHAR ('1');
                     }
 #endif
                     // auto repetition pause here
@@ -2044,14 +2371,14 @@ irsnd_ISR(void)
                  * Send trailing space, especially for repeats
                  */
                 packet_repeat_pause_counter++; // count trailing space duration
-#if defined(ANALYZE)
+#if defined(ANALYZE) && IRSND_USE_EDGE_LIST == 0
                 if (irsnd_is_on)
                 {
-                    putchar ('0');
+                    IRSND_ANALYZE_PUTCHAR ('0');
                 }
                 else
                 {
-                    putchar ('1');
+                    IRSND_ANALYZE_PUTCHAR ('1');
                 }
 #endif
                 return irsnd_busy;
@@ -2840,6 +3167,18 @@ irsnd_ISR(void)
                         break;
                     }
 #endif
+#if IRSND_USE_RAW_SEND == 1
+                    case IRSND_RAW_PROTOCOL:
+                    {
+                        raw_index                   = 0;
+                        raw_counter                 = 0;
+                        n_auto_repetitions          = 1;                                                    // 1 frame
+                        auto_repetition_pause_len   = 0;
+                        repeat_frame_pause_len      = 0;                                                    // pause is part of the durations
+                        irsnd_set_freq (irsnd_raw_freq);
+                        break;
+                    }
+#endif
 // @formatter:off
                     default:
                     {
@@ -3099,7 +3438,7 @@ irsnd_ISR(void)
                     {
                         if (pulse_counter == 0)
                         {
-                            irsnd_on ();
+                            IRSND_SWITCH_ON ();
                         }
                         pulse_counter++;
                     }
@@ -3107,7 +3446,7 @@ irsnd_ISR(void)
                     {
                         if (pause_counter == 0)
                         {
-                            irsnd_off ();
+                            IRSND_SWITCH_OFF ();
                         }
                         pause_counter++;
                     }
@@ -3212,7 +3551,7 @@ irsnd_ISR(void)
                             }
 
                             new_frame = TRUE;
-                            irsnd_off ();
+                            IRSND_SWITCH_OFF ();
                         }
 
                         pulse_counter = 0;
@@ -3316,7 +3655,7 @@ irsnd_ISR(void)
                             {
                                 if (pulse_counter == 0)
                                 {
-                                    irsnd_on ();
+                                    IRSND_SWITCH_ON ();
                                 }
                                 pulse_counter++;
                             }
@@ -3324,7 +3663,7 @@ irsnd_ISR(void)
                             {
                                 if (pause_counter == 0)
                                 {
-                                    irsnd_off ();
+                                    IRSND_SWITCH_OFF ();
                                 }
                                 pause_counter++;
                             }
@@ -3337,7 +3676,7 @@ irsnd_ISR(void)
                             {
                                 if (pause_counter == 0)
                                 {
-                                    irsnd_off ();
+                                    IRSND_SWITCH_OFF ();
                                 }
                                 pause_counter++;
                             }
@@ -3345,7 +3684,7 @@ irsnd_ISR(void)
                             {
                                 if (pulse_counter == 0)
                                 {
-                                    irsnd_on ();
+                                    IRSND_SWITCH_ON ();
                                 }
                                 pulse_counter++;
                             }
@@ -3355,6 +3694,41 @@ irsnd_ISR(void)
                 }
 #endif // IRSND_SUPPORT_RC5_PROTOCOL == 1 || IRSND_SUPPORT_RC6_PROTOCOL == 1 || || IRSND_SUPPORT_RC6A_PROTOCOL == 1 || IRSND_SUPPORT_SIEMENS_PROTOCOL == 1 ||
             // IRSND_SUPPORT_RUWIDO_PROTOCOL == 1 || IRSND_SUPPORT_GRUNDIG_PROTOCOL == 1 || IRSND_SUPPORT_IR60_PROTOCOL == 1 || IRSND_SUPPORT_NOKIA_PROTOCOL == 1
+#if IRSND_USE_RAW_SEND == 1
+                case IRSND_RAW_PROTOCOL:
+                {
+                    if (raw_counter == 0)                                                       // start of next pulse or pause
+                    {
+                        if (raw_index < irsnd_raw_len)
+                        {
+                            raw_counter = irsnd_raw_get_ticks (raw_index);
+
+                            if (raw_index & 1)
+                            {
+                                IRSND_SWITCH_OFF ();
+                            }
+                            else
+                            {
+                                IRSND_SWITCH_ON ();
+                            }
+
+                            raw_index++;
+                        }
+                        else                                                                    // end of frame
+                        {
+                            IRSND_SWITCH_OFF ();
+                            raw_index = 0;
+                            current_bit = 0xFF;
+                            new_frame = TRUE;
+                            irsnd_busy = FALSE;
+                            break;
+                        }
+                    }
+
+                    raw_counter--;
+                    break;
+                }
+#endif
 // @formatter:off
                 default:
                 {
@@ -3403,19 +3777,260 @@ irsnd_ISR(void)
         }
     }
 
+#if defined(ANALYZE) && IRSND_USE_EDGE_LIST == 0
+    if (irsnd_is_on)
+    {
+        IRSND_ANALYZE_PUTCHAR ('0');
+    }
+    else
+    {
+        IRSND_ANALYZE_PUTCHAR ('1');
+    }
+#endif
+
+    return irsnd_busy;
+}
+
+#if IRSND_USE_EDGE_LIST == 1
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ *  Compute all pulses and pauses of the transmission started by irsnd_send_data()
+ *  @details  Runs irsnd_tick() until the transmission has ended or max_len entries are computed. In the latter case and for
+ *            endless repetitions, irsnd_ISR() continues with irsnd_tick() after the end of the list.
+ *  @param    max. number of list entries, 0: irsnd_ISR() computes the whole transmission, e.g. for queued frames
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+static void
+irsnd_compile_edges (uint16_t max_len)
+{
+    uint16_t    len     = 0;
+    uint8_t     busy    = TRUE;
+    uint16_t    level;
+
+    irsnd_edge_level = irsnd_is_on;
+
+    if (irsnd_repeat != IRSND_ENDLESS_REPETITION)                               // irsnd_stop() must be able to stop them
+    {
+        while (len < max_len)
+        {
+            busy = irsnd_tick ();
+
+            if (! busy)
+            {                                                                   // end of transmission, this call did not send a tick
+                break;
+            }
+
+            level = irsnd_edge_level ? IRSND_EDGE_PULSE : 0;
+
+            if (len > 0 && (irsnd_edge_list[len - 1] & IRSND_EDGE_PULSE) == level &&
+                (irsnd_edge_list[len - 1] & IRSND_EDGE_MAX_TICKS) < IRSND_EDGE_MAX_TICKS)
+            {
+                irsnd_edge_list[len - 1]++;
+            }
+            else
+            {
+                irsnd_edge_list[len++] = level | 1;
+            }
+        }
+    }
+
+    irsnd_edge_len      = len;
+    irsnd_edge_live     = busy;
+    irsnd_edge_index    = 0;
+    irsnd_edge_counter  = 0;
+    irsnd_busy          = TRUE;                                                 // irsnd_tick() has reset it at end of transmission
+    irsnd_edge_ready    = TRUE;
+}
+
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ *  ISR routine
+ *  @details  ISR routine, called from 10000 to 20000, typically 15000 times per second
+ *  Plays the edge list computed by irsnd_compile_edges()
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+#if IRSND_QUEUE_SIZE > 0
+static uint8_t
+irsnd_frame_ISR (void)                                                          // called by irsnd_ISR()
+#else
+#  ifdef __cplusplus
+bool
+#else
+uint8_t
+#endif
+irsnd_ISR(void)
+#endif
+{
+    if (irsnd_busy && irsnd_edge_ready)
+    {
+        if (irsnd_edge_index < irsnd_edge_len)
+        {
+            if (irsnd_edge_counter == 0)                                        // start of next pulse or pause
+            {
+                uint16_t edge = irsnd_edge_list[irsnd_edge_index];
+
+                irsnd_edge_counter = edge & IRSND_EDGE_MAX_TICKS;
+
+                if (edge & IRSND_EDGE_PULSE)
+                {
+                    irsnd_on ();
+                }
+                else
+                {
+                    irsnd_off ();
+                }
+            }
+
+            if (--irsnd_edge_counter == 0 && ++irsnd_edge_index == irsnd_edge_len && ! irsnd_edge_live)
+            {
+                irsnd_edge_ready = FALSE;
+                irsnd_busy = FALSE;
+            }
+        }
+        else                                                                    // end of list: compute rest of transmission
+        {
+            if (! irsnd_tick ())
+            {                                                                   // end of transmission, this call does not send a tick
+                irsnd_edge_ready = FALSE;
+                return irsnd_busy;
+            }
+
+            if (irsnd_edge_level)
+            {
+                irsnd_on ();
+            }
+            else
+            {
+                irsnd_off ();
+            }
+        }
+    }
+
 #if defined(ANALYZE)
     if (irsnd_is_on)
     {
-        putchar ('0');
+        IRSND_ANALYZE_PUTCHAR ('0');
     }
     else
     {
-        putchar ('1');
+        IRSND_ANALYZE_PUTCHAR ('1');
     }
 #endif
 
     return irsnd_busy;
 }
+#endif // IRSND_USE_EDGE_LIST == 1
+
+#if IRSND_QUEUE_SIZE > 0
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ *  Queue a frame
+ *  @details  The frame is sent by irsnd_ISR() after all frames queued before, irsnd_is_busy() is TRUE until the last one has ended.
+ *            A frame with a protocol which is not enabled is skipped.
+ *  @param    frame to send
+ *  @param    pause in milliseconds after the end of the previous frame, ignored if irsnd_ISR() is idle
+ *  @return   TRUE: frame queued, FALSE: queue full
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+#  ifdef __cplusplus
+bool
+#else
+uint8_t
+#endif
+irsnd_queue_data (IRMP_DATA * irmp_data_p, uint16_t pause_ms)
+{
+    uint8_t         head = irsnd_queue_head;
+
+    if ((uint8_t) (head - irsnd_queue_tail) >= IRSND_QUEUE_SIZE)
+    {
+        return FALSE;
+    }
+
+    irsnd_queue[head & (IRSND_QUEUE_SIZE - 1)].data         = *irmp_data_p;
+    irsnd_queue[head & (IRSND_QUEUE_SIZE - 1)].pause_ticks  = (uint32_t) pause_ms * F_INTERRUPTS / 1000;
+    IRSND_QUEUE_BARRIER ();
+    irsnd_queue_head = head + 1;
+
+#if defined(ARDUINO)
+    if (! irsnd_busy)                                                           // IR timer is not running for sending, start it
+    {
+        irsnd_queue_pause_counter = 1;                                          // start frame at next call of irsnd_ISR()
+        irsnd_busy = TRUE;
+        storeIRTimer();
+        initIRTimerForSend();
+    }
+#endif
+    return TRUE;
+}
+
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ *  Get number of queued frames
+ *  @return   number of frames which are queued but not yet started
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+uint8_t
+irsnd_get_queue_count (void)
+{
+    return (uint8_t) (irsnd_queue_head - irsnd_queue_tail);
+}
+
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ *  ISR routine
+ *  @details  ISR routine, called from 10000 to 20000, typically 15000 times per second
+ *  Starts the next queued frame after the end of the current frame and the pause. irsnd_busy stays TRUE in between.
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+#  ifdef __cplusplus
+bool
+#else
+uint8_t
+#endif
+irsnd_ISR(void)
+{
+    uint8_t was_busy;
+
+    if (irsnd_queue_pause_counter)                                              // pause before next queued frame
+    {
+        if (--irsnd_queue_pause_counter)
+        {
+#if defined(ANALYZE)
+            IRSND_ANALYZE_PUTCHAR ('1');
+#endif
+            return TRUE;
+        }
+
+        IRSND_QUEUE_BARRIER ();
+
+        if (! irsnd_start_frame (&irsnd_queue[irsnd_queue_tail & (IRSND_QUEUE_SIZE - 1)].data, 0))
+        {
+            irsnd_busy = FALSE;                                                 // protocol not enabled, skip frame
+        }
+#if IRSND_USE_EDGE_LIST == 1
+        else
+        {
+            irsnd_compile_edges (0);                                            // computing the list here would stall the ISR
+        }
+#endif
+
+        IRSND_QUEUE_BARRIER ();
+        irsnd_queue_tail++;
+    }
+
+    was_busy = irsnd_busy;
+
+    if (! irsnd_frame_ISR () && irsnd_queue_tail != irsnd_queue_head)           // end of frame or idle, next frame is queued
+    {
+        if (was_busy)
+        {                                                                       // end of previous frame: pause
+            irsnd_queue_pause_counter = irsnd_queue[irsnd_queue_tail & (IRSND_QUEUE_SIZE - 1)].pause_ticks + 1;
+        }
+        else
+        {                                                                       // idle: start frame at next call, as on Arduino
+            irsnd_queue_pause_counter = 1;
+        }
+        irsnd_busy = TRUE;
+    }
+
+    return irsnd_busy;
+}
+#endif // IRSND_QUEUE_SIZE > 0
 
 #if defined(ANALYZE)
 
@@ -3425,6 +4040,75 @@ irsnd_ISR(void)
 // cc irsnd.c -o irsnd
 //
 // usage: ./irsnd protocol hex-address hex-command >filename
+//        ./irsnd -t >filename (benchmark)
+//        ./irsnd -r carrier-khz repeat duration ... >filename (raw send, durations in microseconds)
+
+#include "irmpprotocols.hpp"
+#include "irmpBenchmark.hpp"
+
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ *  Benchmark mode: cost of irsnd_ISR() per protocol, see irmpBenchmark.hpp
+ *
+ *  usage: ./irsnd -t 2>irsnd-benchmark.txt | ./irmp -t
+ *
+ *  Sends one frame of every protocol enabled in irsndconfig.h. The scans are printed to stdout, each with the name of
+ *  the protocol as comment, so that ./irmp -t can measure irmp_ISR() with them. The cost of irsnd_ISR() is printed to stderr.
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+static int
+benchmark_main (void)
+{
+    IRMP_BENCH  bench;
+    IRMP_DATA   irmp_data;
+    size_t      buf_size = (size_t) (F_INTERRUPTS * 10);                        // max. 10 seconds per frame
+    uint64_t    start;
+    int         protocol;
+
+    memset (&bench, 0, sizeof (bench));
+    irsnd_bench_buf = (char *) malloc (buf_size);
+
+    if (! irsnd_bench_buf)
+    {
+        fprintf (stderr, "benchmark: out of memory\n");
+        return 1;
+    }
+
+    irmp_bench_calibrate ();
+    irmp_bench_print_header (stderr);
+    irsnd_init ();
+
+    for (protocol = 1; protocol <= IRMP_N_PROTOCOLS; protocol++)
+    {
+        irmp_data.protocol  = protocol;
+        irmp_data.address   = 0x00FF;
+        irmp_data.command   = 0x0010;
+        irmp_data.flags     = 0;
+
+        if (! irsnd_send_data (&irmp_data, TRUE))                               // protocol not enabled
+        {
+            continue;
+        }
+
+        irmp_bench_start (&bench, irmp_protocol_names[protocol]);
+        irsnd_bench_len = 0;
+
+        while (irsnd_busy && irsnd_bench_len < buf_size)
+        {
+            start = irmp_bench_now ();
+            (void) irsnd_ISR ();
+            irmp_bench_add (&bench, start);
+        }
+
+        printf ("# %s\n", irmp_protocol_names[protocol]);
+        fwrite (irsnd_bench_buf, 1, irsnd_bench_len, stdout);
+        putchar ('\n');
+        (void) irmp_bench_print (stderr, &bench, -1);
+    }
+
+    free (irsnd_bench_buf);
+    free (bench.samples);
+    return 0;
+}
 
 int
 main (int argc, char ** argv)
@@ -3434,9 +4118,84 @@ main (int argc, char ** argv)
     int         command;
     IRMP_DATA   irmp_data;
 
+    if (argc == 2 && ! strcmp (argv[1], "-t"))
+    {
+        return benchmark_main ();
+    }
+
+#if IRSND_USE_RAW_SEND == 1
+    if (argc >= 5 && ! strcmp (argv[1], "-r"))
+    {
+        uint16_t    durations[256];
+        int         n;
+
+        for (n = 0; n + 4 < argc && n < 256; n++)
+        {
+            durations[n] = (uint16_t) atoi (argv[n + 4]);
+        }
+
+        irsnd_init ();
+
+        if (! irsnd_send_raw (durations, n, (uint16_t) atoi (argv[2]), (uint8_t) atoi (argv[3])))
+        {
+            fprintf (stderr, "%s: wrong arguments\n", argv[0]);
+            return 1;
+        }
+
+        while (irsnd_busy)
+        {
+            irsnd_ISR ();
+        }
+
+        putchar ('\n');
+        return 0;
+    }
+#endif // IRSND_USE_RAW_SEND == 1
+
+#if IRSND_USE_DATA_EX == 1
+    if (argc == 4 && ! strcmp (argv[1], "-p"))
+    {
+        IRMP_DATA_EX    irmp_data_ex;
+        unsigned int    byte;
+        int             n;
+
+        memset (&irmp_data_ex, 0, sizeof (irmp_data_ex));
+        irmp_data_ex.data.protocol = (uint8_t) atoi (argv[2]);
+        irmp_data_ex.payload_len = irsnd_get_payload_len (irmp_data_ex.data.protocol);
+
+        for (n = 0; n < IRMP_PAYLOAD_BITS / 8 && sscanf (argv[3] + 2 * n, "%2x", &byte) == 1; n++)
+        {
+            irmp_data_ex.payload[n] = (uint8_t) byte;
+        }
+
+        irsnd_init ();
+
+        if (! irsnd_send_data_ex (&irmp_data_ex, TRUE))
+        {
+            fprintf (stderr, "%s: wrong arguments\n", argv[0]);
+            return 1;
+        }
+
+        while (irsnd_busy)
+        {
+            irsnd_ISR ();
+        }
+
+        putchar ('\n');
+        return 0;
+    }
+#endif // IRSND_USE_DATA_EX == 1
+
     if (argc != 4 && argc != 5)
     {
         fprintf (stderr, "usage: %s protocol hex-address hex-command [repeat] > filename\n", argv[0]);
+        fprintf (stderr, "       %s -t > filename (benchmark)\n", argv[0]);
+#if IRSND_USE_RAW_SEND == 1
+        fprintf (stderr, "       %s -r carrier-khz repeat duration ... > filename (raw send)\n", argv[0]);
+#endif
+#if IRSND_USE_DATA_EX == 1
+        fprintf (stderr, "       %s -p protocol hex-payload > filename (extended data)\n", argv[0]);
+#endif
         return 1;
     }
 
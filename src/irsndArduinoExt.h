@@ -56,6 +56,27 @@ void irsnd_init(uint_fast8_t aIrsndOutputPin, uint_fast8_t aFeedbackLedPin, bool
 #  endif
 #endif // defined(IRMP_IRSND_ALLOW_DYNAMIC_PINS)
 
+/*
+ * Generate the carrier by the hardware PWM of timer 1 (OC1A) instead of toggling the output pin in the ISR.
+ * irsnd_on() and irsnd_off() only connect and disconnect OC1A, so the IR timer ISR is called at F_INTERRUPTS and not at IRSND_IR_FREQUENCY * 2.
+ * Timer 1 is then no longer available for other libraries like Servo during sending, its registers are restored after sending.
+ * The carrier is always IRSND_IR_FREQUENCY, the carrier of the protocol is ignored.
+ */
+#if defined(IRSND_USE_HARDWARE_PWM)
+#  if !defined(__AVR__) || !(defined(OCF2B) || defined(__AVR_ATmega32U4__)) || !defined(ICR1)
+#error IRSND_USE_HARDWARE_PWM is only supported for ATmega168, ATmega328, ATmega1280, ATmega2560 and ATmega32U4
+#  endif
+#  if defined(IRMP_IRSND_ALLOW_DYNAMIC_PINS) || defined(IRSND_GENERATE_NO_SEND_RF)
+#error IRSND_USE_HARDWARE_PWM cannot be used together with IRMP_IRSND_ALLOW_DYNAMIC_PINS or IRSND_GENERATE_NO_SEND_RF
+#  endif
+#undef IRSND_OUTPUT_PIN
+#  if defined(__AVR_ATmega1280__) || defined(__AVR_ATmega2560__)
+#define IRSND_OUTPUT_PIN            11                  // OC1A
+#  else
+#define IRSND_OUTPUT_PIN            9                   // OC1A
+#  endif
+#endif // defined(IRSND_USE_HARDWARE_PWM)
+
 void irsnd_data_print(Print *aSerial, IRMP_DATA *aIRMPDataPtr);
 
 #if defined(ARDUINO_ARCH_MBED) // Arduino Nano 33 BLE + Sparkfun Apollo3
@@ -70,11 +91,16 @@ void irsnd_data_print(Print *aSerial, IRMP_DATA *aIRMPDataPtr);
 #if ! defined(IRSND_IR_FREQUENCY)
 #define IRSND_IR_FREQUENCY          38000
 #endif
+#if defined(IRSND_USE_HARDWARE_PWM)
+#define IRSND_INTERRUPT_FREQUENCY   F_INTERRUPTS                // carrier is generated by timer 1, ISR only switches it on and off
+#else
 #define IRSND_INTERRUPT_FREQUENCY   (IRSND_IR_FREQUENCY * 2)  // *2 to toggle output pin at each interrupt
+#endif
 
 /*
  * For Arduino AVR use timer 2 with FIXED 38000 * 2 = 76000 interrupts per second to toggle output pin.
  * ISR is called each 4. interrupt at a rate of 19000 interrupts per second.
+ * With IRSND_USE_HARDWARE_PWM the IR timer generates only these 19000 interrupts per second.
  * (Re)define F_INTERRUPTS to the resulting call value in order to generate correct values for all the protocols.
  */
 #  undef  F_INTERRUPTS
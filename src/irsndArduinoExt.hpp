@@ -96,15 +96,28 @@ void irsnd_init(void)
 {
     // Do not call irsnd_init_and_store_timer() here, it is done at irsnd_send_data().
     pinModeFast(IRSND_OUTPUT_PIN, OUTPUT);
+#  if defined(IRSND_USE_HARDWARE_PWM)
+    digitalWriteFast(IRSND_OUTPUT_PIN, IR_OUTPUT_INACTIVE_LEVEL); // level of pin while OC1A is disconnected
+#  endif
 #  if defined(IRMP_MEASURE_TIMING)
     pinModeFast(IR_TIMING_TEST_PIN, OUTPUT);
 #  endif
 }
 #endif // defined(IRMP_IRSND_ALLOW_DYNAMIC_PINS)
 
+/*
+ * Called from irsnd_ISR at start of each frame.
+ * The protocol frequency is not supported by now, we always use IRSND_IR_FREQUENCY.
+ */
 static void irsnd_set_freq(IRSND_FREQ_TYPE freq __attribute__((unused)))
 {
-    // not supported by now
+#if defined(IRSND_USE_HARDWARE_PWM)
+    // (Re)initialize timer 1 in each frame, since it may have been used by another library in between
+    TCCR1A = _BV(WGM11);                                            // fast PWM with ICR1 as TOP, OC1A disconnected
+    TCCR1B = _BV(WGM13) | _BV(WGM12) | _BV(CS10);                   // no prescale
+    ICR1 = (F_CPU / IRSND_IR_FREQUENCY) - 1;                        // 420 for 38 kHz @16 MHz
+    OCR1A = (F_CPU / IRSND_IR_FREQUENCY) / 2;                       // 50% duty cycle like bit banging
+#endif
 }
 
 /*
@@ -134,6 +147,13 @@ void irsnd_on(void)
 #    endif
 #  endif
         }
+#endif
+#if defined(IRSND_USE_HARDWARE_PWM)
+#  if defined(IR_OUTPUT_IS_ACTIVE_LOW)
+        TCCR1A = _BV(WGM11) | _BV(COM1A1) | _BV(COM1A0);            // connect inverted carrier to OC1A
+#  else
+        TCCR1A = _BV(WGM11) | _BV(COM1A1);                          // connect carrier to OC1A
+#  endif
 #endif
         irsnd_is_on = TRUE; // evaluated at ISR
     }
@@ -164,6 +184,9 @@ void irsnd_off(void)
 #    endif
 #  endif
         }
+#endif
+#if defined(IRSND_USE_HARDWARE_PWM)
+        TCCR1A = _BV(WGM11);                                        // disconnect OC1A, pin has inactive level of its port register
 #endif
         irsnd_is_on = FALSE; // evaluated at ISR
     }
@@ -195,4 +195,51 @@
 #  define IRSND_USE_CALLBACK                    0                       // flag: 0 = don't use callbacks, 1 = use callbacks, default is 0
 #endif
 
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ * Edge list: irsnd_send_data() computes all pulses and pauses of the frame including its repetitions and trailing space
+ * in advance, irsnd_ISR() then only counts down the duration of the current pulse or pause.
+ * Needs 2 bytes RAM for each entry of the list. If the list is too short or with endless repetitions, the rest of the
+ * transmission is computed in irsnd_ISR() as without edge list. Frames of the transmit queue are always computed in irsnd_ISR(),
+ * computing their list at once would stall irsnd_ISR() for milliseconds.
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+#if !defined(IRSND_USE_EDGE_LIST)
+#  define IRSND_USE_EDGE_LIST                   0                       // flag: 0 = compute signal in irsnd_ISR(), 1 = use edge list, default is 0
+#endif
+
+#if !defined(IRSND_EDGE_LIST_LEN)
+#  define IRSND_EDGE_LIST_LEN                   256                     // number of pulses and pauses, max. 65535
+#endif
+
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ * Transmit queue: irsnd_queue_data() stores a frame and the pause before it and returns immediately,
+ * irsnd_ISR() sends the queued frames one after another. If irsnd_ISR() is idle, the frame starts without pause.
+ * Needs 10 bytes RAM for each entry.
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+#if !defined(IRSND_QUEUE_SIZE)
+#  define IRSND_QUEUE_SIZE                      0                       // 0: no queue, 2, 4, 8 ... 128: number of queued frames. default is 0
+#endif
+
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ * Raw send: irsnd_send_raw() sends an arbitrary sequence of pulses and pauses, given in microseconds, e.g. for protocols
+ * which are not supported by IRSND. The sequence is not copied, it must not be changed until irsnd_is_busy() returns FALSE.
+ * A repeated sequence must end with a pause, the gap before the next repetition, so an odd number of durations is rejected.
+ * The carrier is rounded to a frequency of irsnd_set_freq(). Arduino only generates IRSND_IR_FREQUENCY, so there
+ * irsnd_send_raw() returns FALSE for other carriers.
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+#if !defined(IRSND_USE_RAW_SEND)
+#  define IRSND_USE_RAW_SEND                    0                       // flag: 0 = no raw send, 1 = support irsnd_send_raw(), default is 0
+#endif
+
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ * Extended data: irsnd_send_data_ex() sends the payload of IRMP_DATA_EX, e.g. an air conditioner state received by
+ * irmp_get_data_ex() with IRMP_FRAME_BITS set to 128. Supported protocols: LGAIR, MITSU_HEAVY, ACP24.
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+#if !defined(IRSND_USE_DATA_EX)
+#  define IRSND_USE_DATA_EX                     0                       // flag: 0 = no extended data, 1 = support irsnd_send_data_ex(), default is 0
+#endif
+
 #endif // _IRSNDCONFIG_H_